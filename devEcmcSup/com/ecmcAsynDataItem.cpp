@@ -14,6 +14,7 @@
 #include "../com/ecmcAsynDataItem.h"
 #include "../com/ecmcOctetIF.h"  //LOG macros
 #include "../com/ecmcAsynPortDriver.h"
+#include "../com/ecmcAsynPublisher.h"
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h> 
@@ -212,6 +213,87 @@ int ecmcAsynDataItem::refreshParam(int force,uint8_t *data, size_t bytes)
 
   dataItem_.dataSize = bytes;
 
+  int errorCode = 0;
+  ecmcAsynPublisher *publisher = asynPortDriver_->getRtPublisher();
+  if(publisher) {
+    // Param lib and callbacks handled by publisher thread
+    asynPortDriver_->lockRtParam();
+    errorCode = publisher->pushValue(this,data,bytes);
+    asynPortDriver_->unlockRtParam();
+  }
+  else {
+    errorCode = writeParam(data,bytes);
+  }
+
+  if(errorCode==ERROR_ASYN_DATA_TYPE_NOT_SUPPORTED) {
+    return errorCode;
+  }
+
+  asynUpdateCycleCounter_=0;    
+  if(errorCode==ERROR_ASYN_REFRESH_FAIL) {
+    asynPrint(asynPortDriver_->getTraceAsynUser(), ASYN_TRACE_ERROR, "ecmcAsynDataItem::refreshParam: ERROR: Refresh failed for parameter %s, bytes %zu, force %d, sample time %d (0x%x).\n",
+    getName(),bytes,force,paramInfo_.sampleTimeCycles,ERROR_ASYN_REFRESH_FAIL);
+  }
+  return errorCode;
+}
+
+/*
+* Write data to parameter library (and do callbacks for arrays).
+* Param lib writes are serialized with lockRtParam() (rt task groups).
+* Array callbacks are done without that lock (interrupt lists are
+* protected by asyn), so no record processing under the spin lock.
+*/
+int ecmcAsynDataItem::writeParam(uint8_t *data, size_t bytes)
+{
+  if(!paramInfo_.initialized) {
+    return 0;
+  }
+
+  asynStatus stat=asynError;
+  switch(paramInfo_.asynType){
+    case asynParamInt8Array:
+      stat = asynPortDriver_->doCallbacksInt8Array((epicsInt8*)data,bytes, paramInfo_.index, 0);
+      break;
+    case asynParamInt16Array:
+      stat = asynPortDriver_->doCallbacksInt16Array((epicsInt16*)data,bytes/sizeof(epicsInt16), paramInfo_.index, 0);
+      break;
+    case asynParamInt32Array:
+      stat = asynPortDriver_->doCallbacksInt32Array((epicsInt32*)data,bytes/sizeof(epicsInt32), paramInfo_.index, 0);
+      break;
+    case asynParamFloat32Array:
+      stat = asynPortDriver_->doCallbacksFloat32Array((epicsFloat32*)data,bytes/sizeof(epicsFloat32), paramInfo_.index, 0);
+      break;
+    case asynParamFloat64Array:
+      stat = asynPortDriver_->doCallbacksFloat64Array((epicsFloat64*)data,bytes/sizeof(epicsFloat64), paramInfo_.index, 0);
+      break;
+
+#ifdef ECMC_ASYN_ASYNPARAMINT64
+    case asynParamInt64Array:
+      stat = asynPortDriver_->doCallbacksInt64Array((epicsInt64*)data,bytes/sizeof(epicsInt64), paramInfo_.index, 0);
+      break;
+#endif // ECMC_ASYN_ASYNPARAMINT64
+
+    default:
+      {
+        asynPortDriver_->lockRtParam();
+        int errorCode = writeScalarParam(data,bytes);
+        asynPortDriver_->unlockRtParam();
+        return errorCode;
+      }
+      break;
+  }
+
+  if(stat!=asynSuccess) {
+    return ERROR_ASYN_REFRESH_FAIL;
+  }
+  return 0;
+}
+
+/*
+* Write scalar to parameter library (callbacks in callParamCallbacks()).
+*/
+int ecmcAsynDataItem::writeScalarParam(uint8_t *data, size_t bytes)
+{
   asynStatus stat=asynError;
   switch(paramInfo_.asynType){
     case asynParamUInt32Digital:
@@ -222,19 +304,19 @@ int ecmcAsynDataItem::refreshParam(int force,uint8_t *data, size_t bytes)
       break;
     case asynParamFloat64:            
       if(paramInfo_.cmdInt64ToFloat64) {        
-        if(dataItem_.dataSize == sizeof(int64_t)) {
+        if(bytes == sizeof(int64_t)) {
           stat = asynPortDriver_->setDoubleParam(ECMC_ASYN_DEFAULT_LIST,paramInfo_.index,static_cast<epicsFloat64>(*(int64_t*)data));
           break;
         }
       }
       if(paramInfo_.cmdUint64ToFloat64) {        
-        if(dataItem_.dataSize == sizeof(uint64_t)) {          
+        if(bytes == sizeof(uint64_t)) {          
           stat = asynPortDriver_->setDoubleParam(ECMC_ASYN_DEFAULT_LIST,paramInfo_.index,static_cast<epicsFloat64>(*(uint64_t*)data));         
           break;
         }
       }
       if(paramInfo_.cmdFloat64ToInt32) {        
-        if(dataItem_.dataSize == sizeof(double)) {          
+        if(bytes == sizeof(double)) {          
           stat = asynPortDriver_->setIntegerParam(ECMC_ASYN_DEFAULT_LIST,paramInfo_.index,static_cast<epicsInt32>(*(double*)data));         
           break;
         }
@@ -246,29 +328,11 @@ int ecmcAsynDataItem::refreshParam(int force,uint8_t *data, size_t bytes)
 
       stat = asynPortDriver_->setDoubleParam(ECMC_ASYN_DEFAULT_LIST,paramInfo_.index,*((epicsFloat64*)data));
       break;
-    case asynParamInt8Array:
-      stat = asynPortDriver_->doCallbacksInt8Array((epicsInt8*)data,bytes, paramInfo_.index, 0);
-      break;
-    case asynParamInt16Array:
-      stat = asynPortDriver_->doCallbacksInt16Array((epicsInt16*)data,bytes/sizeof(epicsInt16), paramInfo_.index, 0);
-      break;
-    case asynParamInt32Array:
-      stat = asynPortDriver_->doCallbacksInt32Array((epicsInt32*)data,bytes/sizeof(epicsInt32), paramInfo_.index, 0);
-      break;
-    case asynParamFloat32Array:
-      stat = asynPortDriver_->doCallbacksFloat32Array((epicsFloat32*)data,bytes/sizeof(epicsFloat32), paramInfo_.index, 0);
-      break;
-    case asynParamFloat64Array:
-      stat = asynPortDriver_->doCallbacksFloat64Array((epicsFloat64*)data,bytes/sizeof(epicsFloat64), paramInfo_.index, 0);
-      break;
 
 #ifdef ECMC_ASYN_ASYNPARAMINT64
     case asynParamInt64:
       stat = asynPortDriver_->setInteger64Param(ECMC_ASYN_DEFAULT_LIST,paramInfo_.index,*((epicsInt64*)data));      
       break;
-    case asynParamInt64Array:
-      stat = asynPortDriver_->doCallbacksInt64Array((epicsInt64*)data,bytes/sizeof(epicsInt64), paramInfo_.index, 0);
-      break;
 #endif // ECMC_ASYN_ASYNPARAMINT64
 
     default:
@@ -276,10 +340,7 @@ int ecmcAsynDataItem::refreshParam(int force,uint8_t *data, size_t bytes)
       break;
   }
 
-  asynUpdateCycleCounter_=0;    
   if(stat!=asynSuccess) {
-    asynPrint(asynPortDriver_->getTraceAsynUser(), ASYN_TRACE_ERROR, "ecmcAsynDataItem::refreshParam: ERROR: Refresh failed for parameter %s, bytes %zu, force %d, sample time %d (0x%x).\n",
-    getName(),bytes,force,paramInfo_.sampleTimeCycles,ERROR_ASYN_REFRESH_FAIL);
     return ERROR_ASYN_REFRESH_FAIL;
   }
   return 0;
@@ -441,6 +502,60 @@ bool ecmcAsynDataItem::willRefreshNext() {
  * \return asynSuccess or asynError.
  */
 asynStatus ecmcAsynDataItem::setAlarmParam(int alarm,int severity)
+{
+  ecmcAsynPublisher *publisher = asynPortDriver_->getRtPublisher();
+  if(publisher) {
+    if(alarm==paramInfo_.alarmStatus && severity==paramInfo_.alarmSeverity) {
+      return asynSuccess;
+    }
+    asynPortDriver_->lockRtParam();
+    int errorCode = publisher->pushAlarm(this,alarm,severity);
+    asynPortDriver_->unlockRtParam();
+    return errorCode ? asynError : asynSuccess;
+  }
+
+  bool doCallbacks=false;
+  asynPortDriver_->lockRtParam();
+  asynStatus stat = updateAlarm(alarm,severity,&doCallbacks);
+  asynPortDriver_->unlockRtParam();
+  if(stat!=asynSuccess) {
+    return stat;
+  }
+
+  if(!doCallbacks || !asynPortDriver_->getAllowRtThreadCom()){
+    return asynSuccess;
+  }
+  
+  //Alarm status or severity changed=>Do callbacks with old buffered data (if nElemnts==0 then no data in record...)
+  if(paramInfo_.dataIsArray && dataItem_.dataSize>0){
+    refreshParamRT(1);
+  }
+  else if(!asynPortDriver_->getRtParamLockEnable()){
+    stat = asynPortDriver_->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST, ECMC_ASYN_DEFAULT_ADDR);
+  }
+  // else: rt task groups in parallel, callbacks by ecmc_rt (updateAsynParams())
+
+  return stat;
+}
+
+/*
+* Called from publisher thread (asyn port locked).
+*/
+asynStatus ecmcAsynDataItem::writeAlarmParam(int alarm,int severity)
+{
+  bool doCallbacks=false;
+  asynStatus stat = updateAlarm(alarm,severity,&doCallbacks);
+  if(stat!=asynSuccess || !doCallbacks) {
+    return stat;
+  }
+
+  if(paramInfo_.dataIsArray && dataItem_.dataSize>0){
+    return writeParam(dataItem_.data,dataItem_.dataSize) ? asynError : asynSuccess;
+  }
+  return asynPortDriver_->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST, ECMC_ASYN_DEFAULT_ADDR);
+}
+
+asynStatus ecmcAsynDataItem::updateAlarm(int alarm,int severity,bool *changed)
 {
   asynStatus stat;
   int oldAlarmStatus=0;
@@ -449,15 +564,13 @@ asynStatus ecmcAsynDataItem::setAlarmParam(int alarm,int severity)
     return asynError;
   }
 
-  bool doCallbacks=false;
-
   if(oldAlarmStatus!=alarm){
     stat = asynPortDriver_->setParamAlarmStatus(ECMC_ASYN_DEFAULT_LIST,getAsynParameterIndex(),alarm);
     if(stat!=asynSuccess){
       return asynError;
     }
     paramInfo_.alarmStatus=alarm;
-    doCallbacks=true;
+    *changed=true;
   }
 
   int oldAlarmSeverity=0;
@@ -472,22 +585,10 @@ asynStatus ecmcAsynDataItem::setAlarmParam(int alarm,int severity)
       return asynError;
     }
     paramInfo_.alarmSeverity=severity;
-    doCallbacks=true;
+    *changed=true;
   }
 
-  if(!doCallbacks || !asynPortDriver_->getAllowRtThreadCom()){
-    return asynSuccess;
-  }
-  
-  //Alarm status or severity changed=>Do callbacks with old buffered data (if nElemnts==0 then no data in record...)
-  if(paramInfo_.dataIsArray && dataItem_.dataSize>0){
-    refreshParamRT(1);
-  }
-  else{
-    stat = asynPortDriver_->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST, ECMC_ASYN_DEFAULT_ADDR);
-  }
-
-  return stat;
+  return asynSuccess;
 }
 
 int ecmcAsynDataItem::getAlarmStatus() {
@@ -661,6 +762,7 @@ asynStatus ecmcAsynDataItem::writeInt32(epicsInt32 value) {
     if(paramInfo_.asynType == asynParamFloat64 && dataItem_.dataSize == sizeof(epicsFloat64)){
       epicsFloat64 temp = static_cast<epicsFloat64>(value);
       memcpy(dataItem_.data,&temp,sizeof(epicsFloat64));
+      dataWritten();
       
       return refreshParamRT(1) ? asynError : asynSuccess;
     }
@@ -806,6 +908,7 @@ asynStatus  ecmcAsynDataItem::writeFloat64(epicsFloat64 value) {
     if(paramInfo_.asynType == asynParamFloat64 && dataItem_.dataSize == sizeof(int64_t)){
       int64_t temp = static_cast<int64_t>(value);
       memcpy(dataItem_.data,&temp,sizeof(int64_t));
+      dataWritten();
       return asynSuccess;
     }
     else {
@@ -825,6 +928,7 @@ asynStatus  ecmcAsynDataItem::writeFloat64(epicsFloat64 value) {
     if(paramInfo_.asynType == asynParamFloat64 && dataItem_.dataSize == sizeof(uint64_t)){
       uint64_t temp = static_cast<uint64_t>(value);
       memcpy(dataItem_.data,&temp,sizeof(uint64_t));
+      dataWritten();
       return asynSuccess;
     }
     else {
@@ -844,6 +948,7 @@ asynStatus  ecmcAsynDataItem::writeFloat64(epicsFloat64 value) {
     if(paramInfo_.asynType == asynParamFloat64 && dataItem_.dataSize >= sizeof(float)){
       float temp = static_cast<float>(value);
       memcpy(dataItem_.data,&temp,sizeof(float));
+      dataWritten();
       return asynSuccess;
     }
     else {
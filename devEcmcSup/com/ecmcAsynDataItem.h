@@ -108,6 +108,9 @@ public:
   int refreshParamRT(int force);
   int refreshParamRT(int force, size_t bytes);
   int refreshParamRT(int force, uint8_t *data, size_t bytes);
+  // Param lib access without asyn port locking (used by ecmcAsynPublisher)
+  int writeParam(uint8_t *data, size_t bytes);
+  asynStatus writeAlarmParam(int alarm,int severity);
 
   int createParam();
   int createParam(const char *paramName, asynParamType asynParType);
@@ -193,6 +196,8 @@ private:
   asynStatus getRecordInfoFromDrvInfo(const char *drvInfo);
   asynStatus parseInfofromDrvInfo(const char* drvInfo);
   int asynTypeIsArray(asynParamType asynParType);
+  asynStatus updateAlarm(int alarm,int severity,bool *changed);
+  int writeScalarParam(uint8_t *data, size_t bytes);
 
   asynStatus readGeneric(uint8_t *data,
                          size_t bytesToRead,
@@ -25,6 +25,7 @@
 #include <epicsString.h>
 #include <epicsTimer.h>
 #include <epicsMutex.h>
+#include <epicsSpin.h>
 #include <epicsExport.h>
 #include <epicsEvent.h>
 #include <envDefs.h>
@@ -40,6 +41,7 @@
 #include "ecmcCmdParser.h"
 #include "../main/gitversion.h"
 #include "ecmcAsynPortDriverUtils.h"
+#include "ecmcAsynPublisher.h"
 
 #include "../main/ecmcMainThread.h"
 #include "../ethercat/ecmcEthercat.h"
@@ -147,12 +149,14 @@ ecmcAsynPortDriver::ecmcAsynPortDriver(
 
   const char* functionName = "ecmcAsynPortDriver";
   allowRtThreadCom_ = 1;  // Allow at startup (RT thread not started)
+  rtParamLock_      = epicsSpinMustCreate();
   pEcmcParamInUseArray_  = new ecmcAsynDataItem*[paramTableSize];  
   pEcmcParamAvailArray_  = new ecmcAsynDataItem*[paramTableSize];
   for(int i=0; i<paramTableSize; i++) {
     pEcmcParamInUseArray_[i]=NULL;
     pEcmcParamAvailArray_[i]=NULL;
   }
+  availParamIndex_.init(paramTableSize);
   paramTableSize_   = paramTableSize;
   autoConnect_      = autoConnect;
   priority_         = priority;
@@ -230,6 +234,8 @@ ecmcAsynPortDriver::~ecmcAsynPortDriver(){
   delete pEcmcParamAvailArray_; 
   pEcmcParamAvailArray_ = NULL;
   ecmcCleanup();
+  epicsSpinDestroy(rtParamLock_);
+  rtParamLock_ = NULL;
 }
 
 /** 
@@ -248,6 +254,9 @@ void ecmcAsynPortDriver::initVars() {
   autoConnect_           = 0;
   priority_              = 0;
   epicsState_            = 0;
+  rtParamLock_           = NULL;
+  rtParamLockEnable_     = false;
+  publisher_             = NULL;
 }
 
 int ecmcAsynPortDriver::getEpicsState() {
@@ -333,6 +342,7 @@ asynStatus ecmcAsynPortDriver::appendAvailParam(ecmcAsynDataItem *dataItem, bool
     return asynError;
   }
   pEcmcParamAvailArray_[ecmcParamAvailCount_]=dataItem;
+  availParamIndex_.add(dataItem->getParamName(),ecmcParamAvailCount_);
   ecmcParamAvailCount_++; 
   return asynSuccess;
 }
@@ -344,14 +354,11 @@ asynStatus ecmcAsynPortDriver::appendAvailParam(ecmcAsynDataItem *dataItem, bool
   * */
 ecmcAsynDataItem *ecmcAsynPortDriver::findAvailParam(const char * name) {
   //const char* functionName = "findAvailParam";
-  for(int i=0;i<ecmcParamAvailCount_;i++) {
-    if(pEcmcParamAvailArray_[i]) {      
-      if(strcmp(pEcmcParamAvailArray_[i]->getParamName(),name)==0) {
-        return pEcmcParamAvailArray_[i];
-      }
-    }
+  int index = availParamIndex_.find(name);
+  if(index < 0) {
+    return NULL;
   }
-  return NULL;
+  return pEcmcParamAvailArray_[index];
 }
 
 /** Find emcDataItem in list by name\n
@@ -359,17 +366,15 @@ ecmcAsynDataItem *ecmcAsynPortDriver::findAvailParam(const char * name) {
   * 
   * returns ecmcDataItem if found otherwise NULL\n
   * \Note: Very similar to findAvailParam but returns baseclass instead 
+  * (data item name and param name are the same for available params)
   **/
 ecmcDataItem* ecmcAsynPortDriver::findAvailDataItem(const char * name) {
   //const char* functionName = "findAvailParam";
-  for(int i=0;i<ecmcParamAvailCount_;i++) {
-    if(pEcmcParamAvailArray_[i]) {      
-      if(strcmp(pEcmcParamAvailArray_[i]->getName(),name)==0) {
-        return (ecmcDataItem*)pEcmcParamAvailArray_[i];
-      }
-    }
+  int index = availParamIndex_.find(name);
+  if(index < 0) {
+    return NULL;
   }
-  return NULL;
+  return (ecmcDataItem*)pEcmcParamAvailArray_[index];
 }
 
 ecmcAsynDataItem *ecmcAsynPortDriver::addNewAvailParam(const char * name,
@@ -883,6 +888,45 @@ bool ecmcAsynPortDriver::getAllowRtThreadCom() {
   return allowRtThreadCom_;
 }
 
+/** Enable locking of parameter writes from realtime context.\n
+ * Needed when parameters are refreshed from several realtime threads\n
+ * (rt task groups) in parallel. Only change in configuration mode.
+ */
+void ecmcAsynPortDriver::setRtParamLockEnable(bool enable) {
+  rtParamLockEnable_ = enable;
+}
+
+bool ecmcAsynPortDriver::getRtParamLockEnable() {
+  return rtParamLockEnable_;
+}
+
+void ecmcAsynPortDriver::lockRtParam() {
+  if(rtParamLockEnable_) {
+    epicsSpinLock(rtParamLock_);
+  }
+}
+
+void ecmcAsynPortDriver::unlockRtParam() {
+  if(rtParamLockEnable_) {
+    epicsSpinUnlock(rtParamLock_);
+  }
+}
+
+void ecmcAsynPortDriver::setPublisher(ecmcAsynPublisher *publisher) {
+  publisher_ = publisher;
+}
+
+ecmcAsynPublisher* ecmcAsynPortDriver::getPublisher() {
+  return publisher_;
+}
+
+ecmcAsynPublisher* ecmcAsynPortDriver::getRtPublisher() {
+  if(publisher_ && ecmcAsynPublisher::getRtContext()) {
+    return publisher_;
+  }
+  return NULL;
+}
+
 /** Overrides asynPortDriver::drvUserCreate.
  * This function is called by the asyn-framework for each record that is linked to this asyn port.
  * \param[in] pasynUser Pointer to asyn user structure
@@ -16,6 +16,7 @@
 
 #include <epicsEvent.h>
 #include <epicsTime.h>
+#include <epicsSpin.h>
 
 #include "asynPortDriver.h"
 #ifndef VERSION_INT
@@ -31,12 +32,15 @@
 
 #ifndef ECMC_IS_PLUGIN
 #include "../com/ecmcAsynDataItem.h"
+#include "../com/ecmcNameIndex.h"
 #include "../main/ecmcDefinitions.h"
 #else
 #include "ecmcAsynDataItem.h"
 #include "ecmcDefinitions.h"
 #endif
 
+class ecmcAsynPublisher;  //Include in cpp
+
 class ecmcAsynPortDriver : public asynPortDriver {
  public:
   ecmcAsynPortDriver(const char *portName,
@@ -129,6 +133,14 @@ class ecmcAsynPortDriver : public asynPortDriver {
   void grepRecord(FILE *fp, const char *pattern);
   void      setAllowRtThreadCom(bool allowRtCom);
   bool      getAllowRtThreadCom();
+  void      setRtParamLockEnable(bool enable);
+  bool      getRtParamLockEnable();
+  void      lockRtParam();
+  void      unlockRtParam();
+  void      setPublisher(ecmcAsynPublisher *publisher);
+  ecmcAsynPublisher* getPublisher();
+  // Publisher if set and called from a realtime thread, otherwise NULL
+  ecmcAsynPublisher* getRtPublisher();
   asynUser* getTraceAsynUser();
   ecmcAsynDataItem *addNewAvailParam(const char * name,
                                      asynParamType type,                                     
@@ -166,6 +178,8 @@ class ecmcAsynPortDriver : public asynPortDriver {
   bool allowRtThreadCom_;
   ecmcAsynDataItem  **pEcmcParamAvailArray_;
   ecmcAsynDataItem  **pEcmcParamInUseArray_;
+  // Hash index (by name) into pEcmcParamAvailArray_
+  ecmcNameIndex availParamIndex_;
   int ecmcParamAvailCount_;
   int ecmcParamInUseCount_;
   int paramTableSize_;
@@ -177,6 +191,9 @@ class ecmcAsynPortDriver : public asynPortDriver {
   int32_t fastestParamUpdateCycles_;
   friend class paramList;
   int epicsState_;
+  epicsSpinId rtParamLock_;
+  bool rtParamLockEnable_;
+  ecmcAsynPublisher *publisher_;
 };
 
 #endif  /* ECMC_ASYN_PORT_DRIVER_H_ */
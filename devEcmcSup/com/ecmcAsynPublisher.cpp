@@ -0,0 +1,372 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAsynPublisher.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // pthread_setname_np
+#endif
+#include "ecmcAsynPublisher.h"
+#include <string.h>
+#include <limits.h>
+#include <epicsThread.h>
+#include <epicsAtomic.h>
+#include "../main/ecmcErrorsList.h"
+
+// Set for ecmc_rt and rt task group threads
+static __thread bool rtContext = false;
+
+ecmcAsynPublisher::ecmcAsynPublisher(ecmcAsynPortDriver *asynPortDriver,
+                                     int                 queueDepth,
+                                     int                 dataBufferBytes) {
+  initVars();
+  asynPortDriver_ = asynPortDriver;
+
+  if (queueDepth <= 0 || dataBufferBytes <= 0) {
+    LOGERR("%s/%s:%d: ERROR: Invalid queue depth %d or data buffer size %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           queueDepth,
+           dataBufferBytes,
+           ERROR_ASYN_PUBLISHER_INVALID_SIZE);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_ASYN_PUBLISHER_INVALID_SIZE);
+    return;
+  }
+
+  // All data is stored aligned
+  queueDepth_      = queueDepth;
+  dataBufferBytes_ = (dataBufferBytes + ECMC_ASYN_PUBLISHER_DATA_ALIGN - 1) &
+                     ~(size_t)(ECMC_ASYN_PUBLISHER_DATA_ALIGN - 1);
+  entries_.resize(queueDepth_);
+  data_.resize(dataBufferBytes_);
+  memset(&entries_[0], 0, sizeof(ecmcAsynPublisherEntry) * queueDepth_);
+
+  initAsyn();
+}
+
+ecmcAsynPublisher::~ecmcAsynPublisher() {
+  stop();
+}
+
+void ecmcAsynPublisher::initVars() {
+  errorReset();
+  asynPortDriver_      = NULL;
+  asynOverflow_        = NULL;
+  asynDataOverflow_    = NULL;
+  asynUsedMax_         = NULL;
+  queueDepth_          = 0;
+  dataBufferBytes_     = 0;
+  head_                = 0;
+  tail_                = 0;
+  dataHead_            = 0;
+  dataTail_            = 0;
+  overflowCounter_     = 0;
+  dataOverflowCounter_ = 0;
+  usedMax_             = 0;
+  threadRunning_       = false;
+  stop_                = false;
+}
+
+int ecmcAsynPublisher::initAsyn() {
+  if (!asynPortDriver_) {
+    return 0;
+  }
+
+  const char *names[3] = { ECMC_ASYN_PUB_PAR_OVERFLOW_NAME,
+                           ECMC_ASYN_PUB_PAR_DATA_OVERFLOW_NAME,
+                           ECMC_ASYN_PUB_PAR_USED_MAX_NAME };
+  int32_t    *data[3] = { &overflowCounter_,
+                          &dataOverflowCounter_,
+                          &usedMax_ };
+  ecmcAsynDataItem **params[3] = { &asynOverflow_,
+                                   &asynDataOverflow_,
+                                   &asynUsedMax_ };
+
+  for (int i = 0; i < 3; i++) {
+    ecmcAsynDataItem *paramTemp = asynPortDriver_->addNewAvailParam(
+      names[i],
+      asynParamInt32,
+      (uint8_t *)data[i],
+      sizeof(int32_t),
+      ECMC_EC_S32,
+      0);
+
+    if (!paramTemp) {
+      LOGERR(
+        "%s/%s:%d: ERROR: Add create default parameter for %s failed.\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        names[i]);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
+    }
+    paramTemp->setAllowWriteToEcmc(false);
+    paramTemp->refreshParam(1);
+    *params[i] = paramTemp;
+  }
+  return 0;
+}
+
+void ecmcAsynPublisher::setRtContext(bool rt) {
+  rtContext = rt;
+}
+
+bool ecmcAsynPublisher::getRtContext() {
+  return rtContext;
+}
+
+int ecmcAsynPublisher::start() {
+  if (threadRunning_) {
+    LOGERR("%s/%s:%d: ERROR: Already started (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_ASYN_PUBLISHER_ALREADY_STARTED);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_ASYN_PUBLISHER_ALREADY_STARTED);
+  }
+
+  if (getError()) {
+    return getErrorID();
+  }
+
+  // Normal priority (inherited from caller), not realtime
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, PTHREAD_STACK_MIN + ECMC_STACK_SIZE);
+
+  stop_ = false;
+  int result = pthread_create(&thread_, &attr, threadFunc, this);
+  pthread_attr_destroy(&attr);
+
+  if (result) {
+    LOGERR("%s/%s:%d: ERROR: Thread create failed with %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           result,
+           ERROR_ASYN_PUBLISHER_THREAD_CREATE_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_ASYN_PUBLISHER_THREAD_CREATE_FAIL);
+  }
+  pthread_setname_np(thread_, ECMC_ASYN_PUBLISHER_THREAD_NAME);
+  threadRunning_ = true;
+
+  LOGINFO4("%s/%s:%d: INFO: Asyn publisher started (queue depth %zu, data buffer %zu bytes).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           queueDepth_,
+           dataBufferBytes_);
+  return 0;
+}
+
+void ecmcAsynPublisher::stop() {
+  if (!threadRunning_) {
+    return;
+  }
+  stop_ = true;
+  pthread_join(thread_, NULL);
+  threadRunning_ = false;
+}
+
+void* ecmcAsynPublisher::threadFunc(void *arg) {
+  ecmcAsynPublisher *publisher = (ecmcAsynPublisher *)arg;
+
+  while (!publisher->stop_) {
+    publisher->publish();
+    epicsThreadSleep(ECMC_ASYN_PUBLISHER_SLEEP_S);
+  }
+
+  // Drain what is left
+  publisher->publish();
+  return NULL;
+}
+
+/*
+* Returns next free entry or NULL if queue is full.
+*/
+ecmcAsynPublisherEntry* ecmcAsynPublisher::reserveEntry() {
+  if (head_ - epicsAtomicGetSizeT(&tail_) >= queueDepth_) {
+    overflowCounter_++;
+    return NULL;
+  }
+  return &entries_[head_ % queueDepth_];
+}
+
+void ecmcAsynPublisher::commitEntry() {
+  epicsAtomicWriteMemoryBarrier();
+  epicsAtomicSetSizeT(&head_, head_ + 1);
+
+  int32_t used = (int32_t)(head_ - epicsAtomicGetSizeT(&tail_));
+
+  if (used > usedMax_) {
+    usedMax_ = used;
+  }
+}
+
+int ecmcAsynPublisher::pushValue(ecmcAsynDataItem *item,
+                                 uint8_t          *data,
+                                 size_t            bytes) {
+  ecmcAsynPublisherEntry *entry = reserveEntry();
+
+  if (!entry) {
+    return ERROR_ASYN_PUBLISHER_QUEUE_FULL;
+  }
+
+  size_t needed = (bytes + ECMC_ASYN_PUBLISHER_DATA_ALIGN - 1) &
+                  ~(size_t)(ECMC_ASYN_PUBLISHER_DATA_ALIGN - 1);
+  size_t pos  = dataHead_ % dataBufferBytes_;
+  // Data is never split, skip the end of the buffer if needed
+  size_t skip = pos + needed > dataBufferBytes_ ? dataBufferBytes_ - pos : 0;
+
+  if ((needed > dataBufferBytes_) ||
+      (dataHead_ + skip + needed - epicsAtomicGetSizeT(&dataTail_) >
+       dataBufferBytes_)) {
+    dataOverflowCounter_++;
+    return ERROR_ASYN_PUBLISHER_DATA_BUFFER_FULL;
+  }
+
+  entry->type         = ECMC_ASYN_PUB_ENTRY_VALUE;
+  entry->item         = item;
+  entry->bytes        = bytes;
+  entry->dataOffset   = skip ? 0 : pos;
+  entry->dataReserved = skip + needed;
+
+  if (bytes > 0) {
+    memcpy(&data_[entry->dataOffset], data, bytes);
+  }
+  dataHead_ += entry->dataReserved;
+  commitEntry();
+  return 0;
+}
+
+int ecmcAsynPublisher::pushAlarm(ecmcAsynDataItem *item,
+                                 int               alarm,
+                                 int               severity) {
+  ecmcAsynPublisherEntry *entry = reserveEntry();
+
+  if (!entry) {
+    return ERROR_ASYN_PUBLISHER_QUEUE_FULL;
+  }
+
+  entry->type         = ECMC_ASYN_PUB_ENTRY_ALARM;
+  entry->item         = item;
+  entry->alarm        = alarm;
+  entry->severity     = severity;
+  entry->bytes        = 0;
+  entry->dataOffset   = 0;
+  entry->dataReserved = 0;
+  commitEntry();
+  return 0;
+}
+
+int ecmcAsynPublisher::pushCallbacks() {
+  ecmcAsynPublisherEntry *entry = reserveEntry();
+
+  if (!entry) {
+    return ERROR_ASYN_PUBLISHER_QUEUE_FULL;
+  }
+
+  entry->type         = ECMC_ASYN_PUB_ENTRY_CALLBACKS;
+  entry->item         = NULL;
+  entry->bytes        = 0;
+  entry->dataOffset   = 0;
+  entry->dataReserved = 0;
+  commitEntry();
+  return 0;
+}
+
+/*
+* Publisher thread: Drain queue in batches with asyn port locked. The lock
+* is released after ECMC_ASYN_PUBLISHER_BATCH_ENTRIES entries and after
+* each callbacks entry (record processing), so ecmc_rt waits for at most
+* one batch when taking the port lock.
+*/
+void ecmcAsynPublisher::publish() {
+  size_t head = epicsAtomicGetSizeT(&head_);
+
+  if (tail_ == head) {
+    return;
+  }
+  epicsAtomicReadMemoryBarrier();
+
+  while (tail_ != head) {
+    int  count     = 0;
+    bool callbacks = false;
+
+    asynPortDriver_->lock();
+
+    while ((tail_ != head) && (count < ECMC_ASYN_PUBLISHER_BATCH_ENTRIES) &&
+           !callbacks) {
+      ecmcAsynPublisherEntry *entry = &entries_[tail_ % queueDepth_];
+
+      switch (entry->type) {
+      case ECMC_ASYN_PUB_ENTRY_VALUE:
+        entry->item->writeParam(&data_[entry->dataOffset], entry->bytes);
+        break;
+
+      case ECMC_ASYN_PUB_ENTRY_ALARM:
+        entry->item->writeAlarmParam(entry->alarm, entry->severity);
+        break;
+
+      case ECMC_ASYN_PUB_ENTRY_CALLBACKS:
+        asynPortDriver_->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST,
+                                            ECMC_ASYN_DEFAULT_ADDR);
+        callbacks = true;
+        break;
+      }
+
+      // Release entry and data to producer
+      epicsAtomicReadMemoryBarrier();
+      epicsAtomicWriteMemoryBarrier();
+      epicsAtomicSetSizeT(&dataTail_, dataTail_ + entry->dataReserved);
+      epicsAtomicSetSizeT(&tail_, tail_ + 1);
+      count++;
+    }
+
+    if (tail_ == head) {
+      refreshAsyn();
+    }
+    asynPortDriver_->unlock();
+  }
+}
+
+void ecmcAsynPublisher::refreshAsyn() {
+  ecmcAsynDataItem *params[3] = { asynOverflow_,
+                                  asynDataOverflow_,
+                                  asynUsedMax_ };
+  int32_t values[3] = { overflowCounter_,
+                        dataOverflowCounter_,
+                        usedMax_ };
+  bool doCallbacks = false;
+
+  for (int i = 0; i < 3; i++) {
+    if (params[i]) {
+      params[i]->writeParam((uint8_t *)&values[i], sizeof(int32_t));
+      doCallbacks = true;
+    }
+  }
+
+  if (doCallbacks) {
+    asynPortDriver_->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST,
+                                        ECMC_ASYN_DEFAULT_ADDR);
+  }
+}
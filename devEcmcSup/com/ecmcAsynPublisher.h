@@ -0,0 +1,114 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAsynPublisher.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMC_ASYN_PUBLISHER_H_
+#define ECMC_ASYN_PUBLISHER_H_
+
+#include <pthread.h>
+#include <vector>
+#include "../main/ecmcError.h"
+#include "../main/ecmcDefinitions.h"
+#include "ecmcAsynPortDriver.h"
+
+#define ERROR_ASYN_PUBLISHER_INVALID_SIZE 0x221000
+#define ERROR_ASYN_PUBLISHER_QUEUE_FULL 0x221001
+#define ERROR_ASYN_PUBLISHER_DATA_BUFFER_FULL 0x221002
+#define ERROR_ASYN_PUBLISHER_THREAD_CREATE_FAIL 0x221003
+#define ERROR_ASYN_PUBLISHER_ALREADY_STARTED 0x221004
+
+enum ecmcAsynPublisherEntryType {
+  ECMC_ASYN_PUB_ENTRY_VALUE     = 0,
+  ECMC_ASYN_PUB_ENTRY_ALARM     = 1,
+  ECMC_ASYN_PUB_ENTRY_CALLBACKS = 2,
+};
+
+typedef struct {
+  ecmcAsynPublisherEntryType type;
+  ecmcAsynDataItem          *item;
+  int                        alarm;
+  int                        severity;
+  size_t                     bytes;
+  size_t                     dataOffset;
+  // Bytes to release in data buffer (incl. skipped bytes at wrap)
+  size_t                     dataReserved;
+} ecmcAsynPublisherEntry;
+
+/**
+ * Publishes asyn parameters outside the realtime threads.
+ *
+ * Realtime threads only copy refreshed values (and alarm changes) into a
+ * ring buffer. A lower priority thread drains the buffer with the asyn port
+ * locked, writes the values to the parameter library and does the
+ * callbacks. ecmc_rt still holds the asyn port lock while executing (to
+ * synchronize asyn writes and commands), so the buffer is drained between
+ * the realtime cycles. The drain is split in short batches (the lock is
+ * released between them), so ecmc_rt waits for at most one batch (or one
+ * callParamCallbacks()) at wakeup.
+ *
+ * Push is single producer. Several realtime threads must serialize push
+ * with ecmcAsynPortDriver::lockRtParam().
+ * If the ring buffer is full the value is dropped and an overflow counter
+ * is incremented.
+ */
+class ecmcAsynPublisher : public ecmcError {
+ public:
+  ecmcAsynPublisher(ecmcAsynPortDriver *asynPortDriver,
+                    int                 queueDepth,
+                    int                 dataBufferBytes);
+  ~ecmcAsynPublisher();
+  int  start();
+  void stop();
+
+  // Realtime
+  int  pushValue(ecmcAsynDataItem *item,
+                 uint8_t          *data,
+                 size_t            bytes);
+  int  pushAlarm(ecmcAsynDataItem *item,
+                 int               alarm,
+                 int               severity);
+  int  pushCallbacks();
+
+  // Refreshes from threads marked as realtime are queued
+  static void setRtContext(bool rt);
+  static bool getRtContext();
+
+ private:
+  void                    initVars();
+  int                     initAsyn();
+  ecmcAsynPublisherEntry* reserveEntry();
+  void                    commitEntry();
+  void                    publish();
+  void                    refreshAsyn();
+  static void*            threadFunc(void *arg);
+
+  ecmcAsynPortDriver *asynPortDriver_;
+  ecmcAsynDataItem   *asynOverflow_;
+  ecmcAsynDataItem   *asynDataOverflow_;
+  ecmcAsynDataItem   *asynUsedMax_;
+  std::vector<ecmcAsynPublisherEntry> entries_;
+  std::vector<uint8_t> data_;
+  size_t              queueDepth_;
+  size_t              dataBufferBytes_;
+  // Entry ring (head written by producer, tail by publisher)
+  size_t              head_;
+  size_t              tail_;
+  // Data ring (same ownership as entry ring)
+  size_t              dataHead_;
+  size_t              dataTail_;
+  int32_t             overflowCounter_;
+  int32_t             dataOverflowCounter_;
+  int32_t             usedMax_;
+  pthread_t           thread_;
+  volatile bool       threadRunning_;
+  volatile bool       stop_;
+};
+
+#endif  /* ECMC_ASYN_PUBLISHER_H_ */
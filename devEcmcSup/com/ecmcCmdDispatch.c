@@ -0,0 +1,261 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcCmdDispatch.c
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+#include "ecmcCmdDispatch.h"
+
+#define ECMC_CMD_DISPATCH_SEED_BUCKET 0x9e3779b9u
+#define ECMC_CMD_DISPATCH_SEED_SLOT   0x85ebca6bu
+#define ECMC_CMD_DISPATCH_SEED_STEP   0xc2b2ae35u
+#define ECMC_CMD_DISPATCH_MAX_GROW    8
+
+/* FNV-1a with seeded offset basis */
+static uint32_t cmdHash(const char *name, size_t len, uint32_t seed) {
+  uint32_t hash = 2166136261u ^ seed;
+  size_t   i;
+
+  for (i = 0; i < len; i++) {
+    hash ^= (uint8_t)name[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static uint32_t cmdSlot(const char *name,
+                        size_t      len,
+                        uint32_t    displacement,
+                        uint32_t    slotCount) {
+  uint32_t h1 = cmdHash(name, len, ECMC_CMD_DISPATCH_SEED_SLOT);
+  /* Odd step visits all slots (slotCount is a power of 2) */
+  uint32_t h2 = cmdHash(name, len, ECMC_CMD_DISPATCH_SEED_STEP) | 1u;
+
+  return (h1 + displacement * h2) & (slotCount - 1);
+}
+
+static uint32_t cmdBucket(const char *name,
+                          size_t      len,
+                          uint32_t    bucketCount) {
+  return cmdHash(name, len, ECMC_CMD_DISPATCH_SEED_BUCKET) % bucketCount;
+}
+
+/*
+* Try to place all entries in slotCount slots.
+* Buckets with most entries are placed first.
+*/
+static int cmdBuild(ecmcCmdDispatchTable *table) {
+  int       *bucketOf   = NULL;
+  int       *bucketSize = NULL;
+  int       *order      = NULL;
+  uint32_t  *tmpSlots   = NULL;
+  uint32_t   b;
+  int        i, j, k, error = 0;
+  int        maxBucketSize = 0;
+
+  bucketOf   = (int *)malloc(sizeof(int) * table->count);
+  bucketSize = (int *)calloc(table->bucketCount, sizeof(int));
+  order      = (int *)malloc(sizeof(int) * table->bucketCount);
+  tmpSlots   = (uint32_t *)malloc(sizeof(uint32_t) * (table->count + 1));
+
+  if (!bucketOf || !bucketSize || !order || !tmpSlots) {
+    error = -1;
+    goto done;
+  }
+
+  for (i = 0; i < (int)table->slotCount; i++) {
+    table->slots[i] = -1;
+  }
+
+  for (i = 0; i < table->count; i++) {
+    const char *name = table->entries[i].name;
+    bucketOf[i] = cmdBucket(name, strlen(name), table->bucketCount);
+    bucketSize[bucketOf[i]]++;
+  }
+
+  for (b = 0; b < table->bucketCount; b++) {
+    order[b] = b;
+    table->displacements[b] = 0;
+    if (bucketSize[b] > maxBucketSize) {
+      maxBucketSize = bucketSize[b];
+    }
+  }
+
+  /* Largest buckets first (counting order, buckets are small) */
+  k = 0;
+  for (j = maxBucketSize; j > 0; j--) {
+    for (b = 0; b < table->bucketCount; b++) {
+      if (bucketSize[b] == j) {
+        order[k++] = b;
+      }
+    }
+  }
+
+  for (k = 0; k < (int)table->bucketCount && bucketSize[order[k]] > 0; k++) {
+    uint32_t bucket = order[k];
+    uint32_t d;
+    int      placed = 0;
+
+    for (d = 0; d < table->slotCount * 4 && !placed; d++) {
+      int n = 0;
+      placed = 1;
+
+      for (i = 0; i < table->count && placed; i++) {
+        const char *name;
+        uint32_t    slot;
+        int         m;
+
+        if (bucketOf[i] != (int)bucket) {
+          continue;
+        }
+        name = table->entries[i].name;
+        slot = cmdSlot(name, strlen(name), d, table->slotCount);
+
+        if (table->slots[slot] >= 0) {
+          placed = 0;
+          break;
+        }
+
+        for (m = 0; m < n; m++) {
+          if (tmpSlots[m] == slot) {
+            placed = 0;
+            break;
+          }
+        }
+        tmpSlots[n++] = slot;
+      }
+
+      if (placed) {
+        n = 0;
+        for (i = 0; i < table->count; i++) {
+          if (bucketOf[i] == (int)bucket) {
+            table->slots[tmpSlots[n++]] = i;
+          }
+        }
+        table->displacements[bucket] = d;
+      }
+    }
+
+    if (!placed) {
+      error = -1;
+      goto done;
+    }
+  }
+
+done:
+  free(bucketOf);
+  free(bucketSize);
+  free(order);
+  free(tmpSlots);
+  return error;
+}
+
+int ecmcCmdDispatchInit(ecmcCmdDispatchTable       *table,
+                        const ecmcCmdDispatchEntry *entries,
+                        int                         count) {
+  int grow;
+  int i, j;
+
+  memset(table, 0, sizeof(ecmcCmdDispatchTable));
+
+  if (!entries || count <= 0) {
+    return -1;
+  }
+
+  /* Find() falls back to linear search if the hash fails */
+  table->entries = entries;
+  table->count   = count;
+
+  /* Names must be unique */
+  for (i = 0; i < count; i++) {
+    for (j = i + 1; j < count; j++) {
+      if (strcmp(entries[i].name, entries[j].name) == 0) {
+        return -1;
+      }
+    }
+  }
+
+  table->bucketCount = (count + 3) / 4;
+  table->slotCount   = 1;
+
+  while (table->slotCount < (uint32_t)count) {
+    table->slotCount <<= 1;
+  }
+
+  for (grow = 0; grow < ECMC_CMD_DISPATCH_MAX_GROW; grow++) {
+    table->slots         = (int *)malloc(sizeof(int) * table->slotCount);
+    table->displacements = (uint32_t *)malloc(sizeof(uint32_t) *
+                                              table->bucketCount);
+
+    if (!table->slots || !table->displacements) {
+      ecmcCmdDispatchFree(table);
+      return -1;
+    }
+
+    if (cmdBuild(table) == 0) {
+      table->initialized = 1;
+      return 0;
+    }
+
+    free(table->slots);
+    free(table->displacements);
+    table->slots         = NULL;
+    table->displacements = NULL;
+    table->slotCount   <<= 1;
+  }
+
+  ecmcCmdDispatchFree(table);
+  return -1;
+}
+
+void ecmcCmdDispatchFree(ecmcCmdDispatchTable *table) {
+  free(table->slots);
+  free(table->displacements);
+  table->slots         = NULL;
+  table->displacements = NULL;
+  table->initialized   = 0;
+}
+
+const ecmcCmdDispatchEntry* ecmcCmdDispatchFind(
+  const ecmcCmdDispatchTable *table,
+  const char                 *name,
+  size_t                      nameLen) {
+  const ecmcCmdDispatchEntry *entry;
+  uint32_t bucket, slot;
+  int      index;
+
+  if (!table->initialized) {
+    for (index = 0; index < table->count; index++) {
+      entry = &table->entries[index];
+      if ((strncmp(entry->name, name, nameLen) == 0) &&
+          (entry->name[nameLen] == '\0')) {
+        return entry;
+      }
+    }
+    return NULL;
+  }
+
+  bucket = cmdBucket(name, nameLen, table->bucketCount);
+  slot   = cmdSlot(name, nameLen, table->displacements[bucket],
+                   table->slotCount);
+  index  = table->slots[slot];
+
+  if (index < 0) {
+    return NULL;
+  }
+  entry = &table->entries[index];
+
+  /* Not in table if the name in the slot differs */
+  if ((strncmp(entry->name, name, nameLen) != 0) ||
+      (entry->name[nameLen] != '\0')) {
+    return NULL;
+  }
+  return entry;
+}
@@ -0,0 +1,67 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcCmdDispatch.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMC_CMD_DISPATCH_H
+# define ECMC_CMD_DISPATCH_H
+
+# include <stddef.h>
+# include <stdint.h>
+
+# ifdef __cplusplus
+extern "C" {
+# endif /* ifdef __cplusplus */
+
+/**
+ * Command handler. args points to the command string after the command name
+ * (starting with "("). Returns 0 if the arguments matched and the command was
+ * executed (result in *errorCode), otherwise -1.
+ */
+typedef int (*ecmcCmdHandler)(const char *args, int *errorCode);
+
+typedef struct {
+  const char    *name;
+  ecmcCmdHandler handler;
+} ecmcCmdDispatchEntry;
+
+/**
+ * Dispatch table with a perfect hash (hash and displace) of the command
+ * names. The hash is built once in ecmcCmdDispatchInit(). A lookup is two
+ * hash calculations and one string compare (linear search if the hash could
+ * not be built).
+ */
+typedef struct {
+  const ecmcCmdDispatchEntry *entries;
+  int                         count;
+  int                        *slots;          /* entry index or -1 */
+  uint32_t                   *displacements;  /* one per bucket */
+  uint32_t                    slotCount;      /* power of 2 */
+  uint32_t                    bucketCount;
+  int                         initialized;
+} ecmcCmdDispatchTable;
+
+/* Returns 0 if success (names must be unique). Entries must be static. */
+int ecmcCmdDispatchInit(ecmcCmdDispatchTable       *table,
+                        const ecmcCmdDispatchEntry *entries,
+                        int                         count);
+
+void ecmcCmdDispatchFree(ecmcCmdDispatchTable *table);
+
+/* Returns entry or NULL if name (nameLen chars) is not in table */
+const ecmcCmdDispatchEntry* ecmcCmdDispatchFind(
+  const ecmcCmdDispatchTable *table,
+  const char                 *name,
+  size_t                      nameLen);
+
+# ifdef __cplusplus
+}
+# endif /* ifdef __cplusplus */
+
+#endif  /* ECMC_CMD_DISPATCH_H */
@@ -24,6 +24,7 @@
 #include <string.h>
 #include <math.h>
 #include "ecmcCmdParser.h"
+#include "ecmcCmdDispatch.h"
 #include "ecmcOctetIF.h"
 #include "../main/ecmcMainThread.h"
 #include "../main/ecmcErrorsList.h"
@@ -638,6 +639,767 @@ static int motorHandleADS_ADR(const char *arg, ecmcOutputBufferType *buffer) {
   return ERROR_MAIN_PARSER_UNKNOWN_ADS_CMD;
 }
 
+/*
+* Configuration commands with simple int/double arguments are dispatched
+* through a table (perfect hash of the command name) instead of the sscanf()
+* chain in handleCfgCommand(). The argument format is the same as in the
+* chain. A handler returns -1 if the arguments do not match, then the command
+* is passed on to the chain.
+*/
+#define ECMC_CFG_CMD_1I(NAME, FCN)                                  \
+  static int cfgCmd##NAME(const char *args, int *errorCode) {       \
+    int v1 = 0;                                                     \
+    if (sscanf(args, "(%d)", &v1) != 1) {                           \
+      return -1;                                                    \
+    }                                                               \
+    *errorCode = FCN(v1);                                           \
+    return 0;                                                       \
+  }
+
+#define ECMC_CFG_CMD_2I(NAME, FCN)                                  \
+  static int cfgCmd##NAME(const char *args, int *errorCode) {       \
+    int v1 = 0;                                                     \
+    int v2 = 0;                                                     \
+    if (sscanf(args, "(%d,%d)", &v1, &v2) != 2) {                   \
+      return -1;                                                    \
+    }                                                               \
+    *errorCode = FCN(v1, v2);                                       \
+    return 0;                                                       \
+  }
+
+#define ECMC_CFG_CMD_3I(NAME, FCN)                                  \
+  static int cfgCmd##NAME(const char *args, int *errorCode) {       \
+    int v1 = 0;                                                     \
+    int v2 = 0;                                                     \
+    int v3 = 0;                                                     \
+    if (sscanf(args, "(%d,%d,%d)", &v1, &v2, &v3) != 3) {           \
+      return -1;                                                    \
+    }                                                               \
+    *errorCode = FCN(v1, v2, v3);                                   \
+    return 0;                                                       \
+  }
+
+#define ECMC_CFG_CMD_4I(NAME, FCN)                                  \
+  static int cfgCmd##NAME(const char *args, int *errorCode) {       \
+    int v1 = 0;                                                     \
+    int v2 = 0;                                                     \
+    int v3 = 0;                                                     \
+    int v4 = 0;                                                     \
+    if (sscanf(args, "(%d,%d,%d,%d)", &v1, &v2, &v3, &v4) != 4) {   \
+      return -1;                                                    \
+    }                                                               \
+    *errorCode = FCN(v1, v2, v3, v4);                               \
+    return 0;                                                       \
+  }
+
+#define ECMC_CFG_CMD_1D(NAME, FCN)                                  \
+  static int cfgCmd##NAME(const char *args, int *errorCode) {       \
+    double v1 = 0;                                                  \
+    if (sscanf(args, "(%lf)", &v1) != 1) {                          \
+      return -1;                                                    \
+    }                                                               \
+    *errorCode = FCN(v1);                                           \
+    return 0;                                                       \
+  }
+
+#define ECMC_CFG_CMD_1I1D(NAME, FCN)                                \
+  static int cfgCmd##NAME(const char *args, int *errorCode) {       \
+    int v1 = 0;                                                     \
+    double v2 = 0;                                                  \
+    if (sscanf(args, "(%d,%lf)", &v1, &v2) != 2) {                  \
+      return -1;                                                    \
+    }                                                               \
+    *errorCode = FCN(v1, v2);                                       \
+    return 0;                                                       \
+  }
+
+#define ECMC_CFG_CMD_ENTRY(NAME) { #NAME, cfgCmd##NAME }
+
+// Positions of axis group moves (ECMC_AXIS_GROUP_MAX_AXES)
+#define ECMC_AXIS_GROUP_POS_FORMAT "%lf,%lf,%lf,%lf,%lf,%lf,%lf,%lf"
+
+/// "Cfg.SetAppMode(mode)"
+ECMC_CFG_CMD_1I(SetAppMode, setAppMode)
+
+/// "Cfg.SetEcStartupTimeout(timeSeconds)"
+ECMC_CFG_CMD_1I(SetEcStartupTimeout, setEcStartupTimeout)
+
+/// "Cfg.SetSampleRate(double sampleRate)"
+ECMC_CFG_CMD_1D(SetSampleRate, setSampleRate)
+
+/// "Cfg.SetSamplePeriodMs(double samplePeriodMs)"
+ECMC_CFG_CMD_1D(SetSamplePeriodMs, setSamplePeriodMs)
+
+/// "Cfg.CreateRtTaskGroup(groupIndex, priority, cpu)"
+ECMC_CFG_CMD_3I(CreateRtTaskGroup, createRtTaskGroup)
+
+/// "Cfg.AddAxisToRtTaskGroup(groupIndex, axisIndex)"
+ECMC_CFG_CMD_2I(AddAxisToRtTaskGroup, addAxisToRtTaskGroup)
+
+/// "Cfg.AddPLCToRtTaskGroup(groupIndex, plcIndex)"
+ECMC_CFG_CMD_2I(AddPLCToRtTaskGroup, addPLCToRtTaskGroup)
+
+/// "Cfg.AddPluginToRtTaskGroup(groupIndex, pluginIndex)"
+ECMC_CFG_CMD_2I(AddPluginToRtTaskGroup, addPluginToRtTaskGroup)
+
+/// "Cfg.ReportRtTaskGroup(groupIndex)"
+ECMC_CFG_CMD_1I(ReportRtTaskGroup, reportRtTaskGroup)
+
+/// "Cfg.CreateAsynPublisher(queueDepth, dataBufferBytes)"
+ECMC_CFG_CMD_2I(CreateAsynPublisher, createAsynPublisher)
+
+/// "Cfg.DeletePLC(int index)"
+ECMC_CFG_CMD_1I(DeletePLC, deletePLC)
+
+/// "Cfg.SetPLCEnable(int index,int enable)"
+ECMC_CFG_CMD_2I(SetPLCEnable, setPLCEnable)
+
+/// "Cfg.EcSetMaster(masterIndex)"
+ECMC_CFG_CMD_1I(EcSetMaster, ecSetMaster)
+
+/// "Cfg.EcResetMaster(masterIndex)"
+ECMC_CFG_CMD_1I(EcResetMaster, ecResetMaster)
+
+/// "Cfg.EcSlaveConfigWatchDog(slaveBusposition,watchdogDivider,
+/// watchdogIntervals)"
+ECMC_CFG_CMD_3I(EcSlaveConfigWatchDog, ecSlaveConfigWatchDog)
+
+ECMC_CFG_CMD_2I(EcSelectReferenceDC, ecSelectReferenceDC)
+
+/*Cfg.EcUseClockRealtime(int useClcRT)*/  
+ECMC_CFG_CMD_1I(EcUseClockRealtime, ecUseClockRealtime)
+
+ECMC_CFG_CMD_3I(EcAddSyncManager, ecAddSyncManager)
+
+/*Cfg.EcApplyConfig(int nMasterIndex)*/
+ECMC_CFG_CMD_1I(EcApplyConfig, ecApplyConfig)
+
+/*Cfg.EcSetDiagnostics(int nDiagnostics)*/
+ECMC_CFG_CMD_1I(EcSetDiagnostics, ecSetDiagnostics)
+
+/*Cfg.EcEnablePrintouts(int enable)*/
+ECMC_CFG_CMD_1I(EcEnablePrintouts, ecEnablePrintouts)
+
+/*Cfg.EcSetOutputChangeOnly(int enable, int fullRefreshCycles)*/
+ECMC_CFG_CMD_2I(EcSetOutputChangeOnly, ecSetOutputChangeOnly)
+
+/*Cfg.EcAddDomain(int rateDivider, int rateOffset)*/
+ECMC_CFG_CMD_2I(EcAddDomain, ecAddDomain)
+
+/*Cfg.EcSelectDomain(int domainIndex)*/
+ECMC_CFG_CMD_1I(EcSelectDomain, ecSelectDomain)
+
+/*Cfg.EcSetDomainFailedCyclesLimit(int nCycles)*/
+ECMC_CFG_CMD_1I(EcSetDomainFailedCyclesLimit, ecSetDomainFailedCyclesLimit)
+
+/*Cfg.EcSdoRequestRead(int requestIndex)*/
+ECMC_CFG_CMD_1I(EcSdoRequestRead, ecSdoRequestRead)
+
+/*int Cfg.SetAxisJogVel(int traj_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisJogVel, setAxisJogVel)
+
+/*int Cfg.SetAxisEnableAlarmAtHardLimits(int axis_no, int nEnable);*/
+ECMC_CFG_CMD_2I(SetAxisEnableAlarmAtHardLimits, setAxisEnableAlarmAtHardLimits)
+
+/*int Cfg.SetAxisEmergDeceleration(int traj_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisEmergDeceleration, setAxisEmergDeceleration)
+
+/*int Cfg.SetAxisJerk(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisJerk, setAxisJerk)
+
+/*int Cfg.CreateAxisGroup(int groupIndex);*/
+ECMC_CFG_CMD_1I(CreateAxisGroup, createAxisGroup)
+
+/*int Cfg.AddAxisToGroup(int groupIndex, int axisIndex);*/
+ECMC_CFG_CMD_2I(AddAxisToGroup, addAxisToGroup)
+
+/*int Cfg.SetAxisGroupVel(int groupIndex, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisGroupVel, setAxisGroupVel)
+
+/*int Cfg.SetAxisGroupAcc(int groupIndex, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisGroupAcc, setAxisGroupAcc)
+
+/*int Cfg.SetAxisGroupDec(int groupIndex, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisGroupDec, setAxisGroupDec)
+
+/*int Cfg.SetAxisGroupEmergDec(int groupIndex, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisGroupEmergDec, setAxisGroupEmergDec)
+
+/*int Cfg.SetAxisGroupJerk(int groupIndex, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisGroupJerk, setAxisGroupJerk)
+
+/*int Cfg.SetAxisCamMasterAxis(int axisIndex, int masterAxisIndex, int source);*/
+ECMC_CFG_CMD_3I(SetAxisCamMasterAxis, setAxisCamMasterAxis)
+
+/*int Cfg.SetAxisCamMasterScale(int axisIndex, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCamMasterScale, setAxisCamMasterScale)
+
+/*int Cfg.SetAxisCamMasterModulo(int axisIndex, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCamMasterModulo, setAxisCamMasterModulo)
+
+/*int Cfg.SetAxisCamRatio(int axisIndex, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCamRatio, setAxisCamRatio)
+
+/*int Cfg.SetAxisCamOffset(int axisIndex, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCamOffset, setAxisCamOffset)
+
+/*int Cfg.SetAxisPvtBufferSize(int axisIndex, int points);*/
+ECMC_CFG_CMD_2I(SetAxisPvtBufferSize, setAxisPvtBufferSize)
+
+/*int Cfg.SetAxisTrajProfile(int axis_no, int type);*/
+ECMC_CFG_CMD_2I(SetAxisTrajProfile, setAxisTrajProfile)
+
+/*int Cfg.SetAxisTrajSourceType(int axis_no, int nValue);*/
+ECMC_CFG_CMD_2I(SetAxisTrajSourceType, setAxisTrajSource)
+
+/*int Cfg.SetAxisEncSourceType(int axis_no, int nValue);*/
+ECMC_CFG_CMD_2I(SetAxisEncSourceType, setAxisEncSource)
+
+/*int Cfg.SetAxisEncScaleNum(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisEncScaleNum, setAxisEncScaleNum)
+
+/*int Cfg.SetAxisEncScaleDenom(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisEncScaleDenom, setAxisEncScaleDenom)
+
+/*int Cfg.SetAxisEncBits(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisEncBits, setAxisEncBits)
+
+/*int Cfg.SetAxisEncAbsBits(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisEncAbsBits, setAxisEncAbsBits)
+
+/*int Cfg.SetAxisEncType(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisEncType, setAxisEncType)
+
+/*int Cfg.SetAxisEncOffset(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisEncOffset, setAxisEncOffset)
+
+/*int Cfg.SetAxisCntrlKp(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCntrlKp, setAxisCntrlKp)
+
+/*int Cfg.SetAxisCntrlKi(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCntrlKi, setAxisCntrlKi)
+
+/*int Cfg.SetAxisCntrlKd(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCntrlKd, setAxisCntrlKd)
+
+/*int Cfg.SetAxisCntrlKff(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCntrlKff, setAxisCntrlKff)
+
+/*int Cfg.SetAxisCntrlOutHL(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCntrlOutHL, setAxisCntrlOutHL)
+
+/*int Cfg.SetAxisCntrlOutLL(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCntrlOutLL, setAxisCntrlOutLL)
+
+/*int Cfg.SetAxisCntrlIPartHL(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCntrlIPartHL, setAxisCntrlIpartHL)
+
+/*int Cfg.SetAxisCntrlIPartLL(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisCntrlIPartLL, setAxisCntrlIpartLL)
+
+/*int Cfg.SetAxisSoftLimitPosBwd(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisSoftLimitPosBwd, setAxisSoftLimitPosBwd)
+
+/*int Cfg.SetAxisEnableSoftLimitBwd(int axis_no, double value);*/
+ECMC_CFG_CMD_2I(SetAxisEnableSoftLimitBwd, setAxisEnableSoftLimitBwd)
+
+/*int Cfg.SetAxisSoftLimitPosFwd(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisSoftLimitPosFwd, setAxisSoftLimitPosFwd)
+
+/*int Cfg.SetAxisEnableSoftLimitFwd(int axis_no, double value);*/
+ECMC_CFG_CMD_2I(SetAxisEnableSoftLimitFwd, setAxisEnableSoftLimitFwd)
+
+ECMC_CFG_CMD_4I(SetAxisEnableMotionFunctions, setAxisEnableMotionFunctions)
+
+/*int Cfg.SetAxisMonAtTargetTol(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisMonAtTargetTol, setAxisMonAtTargetTol)
+
+/*int Cfg.SetAxisMonAtTargetTime(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonAtTargetTime, setAxisMonAtTargetTime)
+
+/*int Cfg.SetAxisMonEnableAtTargetMon(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonEnableAtTargetMon, setAxisMonEnableAtTargetMon)
+
+/*int Cfg.SetAxisMonPosLagTol(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisMonPosLagTol, setAxisMonPosLagTol)
+
+/*int Cfg.SetAxisMonPosLagTime(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonPosLagTime, setAxisMonPosLagTime)
+
+/*int Cfg.SetAxisMonEnableLagMon(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonEnableLagMon, setAxisMonEnableLagMon)
+
+/*int Cfg.SetAxisMonMaxVel(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisMonMaxVel, setAxisMonMaxVel)
+
+/*int Cfg.SetAxisMonEnableMaxVel(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonEnableMaxVel, setAxisMonEnableMaxVel)
+
+/*int Cfg.SetAxisMonMaxVelDriveILDelay(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonMaxVelDriveILDelay, setAxisMonMaxVelDriveILDelay)
+
+/*int Cfg.SetAxisMonMaxVelTrajILDelay(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonMaxVelTrajILDelay, setAxisMonMaxVelTrajILDelay)
+
+/*int Cfg.SetAxisMonEnableExtHWInterlock(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonEnableExtHWInterlock, setAxisMonEnableExternalInterlock)
+
+/*int Cfg.SetAxisMonExtHWInterlockPolarity(int axisIndex, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonExtHWInterlockPolarity, setAxisMonExtHWInterlockPolarity)
+
+/*int Cfg.SetAxisMonLimitBwdPolarity(int axisIndex, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonLimitBwdPolarity, setAxisMonLimitBwdPolarity)
+
+/*int Cfg.SetAxisMonLimitFwdPolarity(int axisIndex, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonLimitFwdPolarity, setAxisMonLimitFwdPolarity)
+
+/*int Cfg.SetAxisMonHomeSwitchPolarity(int axisIndex, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonHomeSwitchPolarity, setAxisMonHomeSwitchPolarity)
+
+/*int Cfg.SetAxisMonEnableCntrlOutHLMon(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonEnableCntrlOutHLMon, setAxisMonEnableCntrlOutHLMon)
+
+/*int Cfg.SetAxisMonEnableVelocityDiff(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonEnableVelocityDiff, setAxisMonEnableVelocityDiff)
+
+/*int Cfg.SetAxisMonVelDiffTrajILDelay(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonVelDiffTrajILDelay, setAxisMonVelDiffTrajILDelay)
+
+/*int Cfg.SetAxisMonVelDiffDriveILDelay(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisMonVelDiffDriveILDelay, setAxisMonVelDiffDriveILDelay)
+
+/*int Cfg.SetAxisMonVelDiffTol(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisMonVelDiffTol, setAxisMonVelDiffTol)
+
+/*int Cfg.SetAxisMonCntrlOutHL(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisMonCntrlOutHL, setAxisMonCntrlOutHL)
+
+/*int Cfg.SetAxisDrvScaleNum(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisDrvScaleNum, setAxisDrvScaleNum)
+
+/*int Cfg.SetAxisDrvScaleDenom(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisDrvScaleDenom, setAxisDrvScaleDenom)
+
+/*int Cfg.SetAxisDrvVelSet(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisDrvVelSet, setAxisDrvVelSet)
+
+/*int Cfg.SetAxisDrvVelSetRaw(int axis_no, double value);*/
+ECMC_CFG_CMD_2I(SetAxisDrvVelSetRaw, setAxisDrvVelSetRaw)
+
+/*int Cfg.SetAxisDrvEnable(int axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisDrvEnable, setAxisDrvEnable)
+
+/*int Cfg.SetAxisDrvBrakeEnable(int axis_no, int enable);*/
+ECMC_CFG_CMD_2I(SetAxisDrvBrakeEnable, setAxisDrvBrakeEnable)
+
+/*int Cfg.SetAxisDrvBrakeOpenDelayTime(int axis_no, int delayTime);*/
+ECMC_CFG_CMD_2I(SetAxisDrvBrakeOpenDelayTime, setAxisDrvBrakeOpenDelayTime)
+
+/*int Cfg.SetAxisDrvBrakeCloseAheadTime(int axis_no, int aheadTime);*/
+ECMC_CFG_CMD_2I(SetAxisDrvBrakeCloseAheadTime, setAxisDrvBrakeCloseAheadTime)
+
+/*int Cfg.SetAxisDrvReduceTorqueEnable(int axis_no, int enable);*/
+ECMC_CFG_CMD_2I(SetAxisDrvReduceTorqueEnable, setAxisDrvReduceTorqueEnable)
+
+/*int Cfg.SetAxisModRange(int axis_no, double range);*/
+ECMC_CFG_CMD_1I1D(SetAxisModRange, setAxisModRange)
+
+/*int Cfg.SetAxisModType(int axis_no, int type);*/
+ECMC_CFG_CMD_2I(SetAxisModType, setAxisModType)
+
+/*int Cfg.SetAxisDisableAtErrorReset(int axis_no, int disable);*/
+ECMC_CFG_CMD_2I(SetAxisDisableAtErrorReset, setAxisDisableAtErrorReset)
+
+/*int Cfg.SetDiagAxisIndex(int axis_no);*/
+ECMC_CFG_CMD_1I(SetDiagAxisIndex, setDiagAxisIndex)
+
+/*int Cfg.SetDiagAxisFreq(int nFreq);*/
+ECMC_CFG_CMD_1I(SetDiagAxisFreq, setDiagAxisFreq)
+
+/*int Cfg.SetDiagAxisEnable(int nDiag);*/
+ECMC_CFG_CMD_1I(SetDiagAxisEnable, setDiagAxisEnable)
+
+/*int Cfg.SetAxisHomeVelTwordsCam(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisHomeVelTwordsCam, setAxisHomeVelTwordsCam)
+
+/*int Cfg.SetAxisHomeVelOffCam(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisHomeVelOffCam, setAxisHomeVelOffCam)
+
+/*int Cfg.SetAxisHomeLatchCountOffset(int axis_no, int count);*/
+ECMC_CFG_CMD_2I(SetAxisHomeLatchCountOffset, setAxisHomeLatchCountOffset)
+
+/*int Cfg.SetAxisOpMode(int axis_no, int nMode);*/
+ECMC_CFG_CMD_2I(SetAxisOpMode, setAxisOpMode)
+
+/*int Cfg.SetEnableFuncCallDiag(int nEnable);*/
+ECMC_CFG_CMD_1I(SetEnableFuncCallDiag, setEnableFunctionCallDiag)
+
+/*int Cfg.SetEnableTimeDiag(int nEnable);*/
+ECMC_CFG_CMD_1I(SetEnableTimeDiag, setEnableTimeDiag)
+
+/*int Cfg.SetEnableExecProfiler(int nEnable);*/
+ECMC_CFG_CMD_1I(SetEnableExecProfiler, setEnableExecProfiler)
+
+/*int Cfg.SetAxisBlockCom(int axis_no, int block);*/
+ECMC_CFG_CMD_2I(SetAxisBlockCom, setAxisBlockCom)
+
+/*int Cfg.SetAxisTrajStartPos(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisTrajStartPos, setAxisTrajStartPos)
+
+/*int Cfg.SetAxisAcc(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisAcc, setAxisAcceleration)
+
+/*int Cfg.SetAxisDec(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisDec, setAxisDeceleration)
+
+/*int Cfg.SetAxisVel(int axis_no, double value);*/
+ECMC_CFG_CMD_1I1D(SetAxisVel, setAxisTargetVel)
+
+/*int Cfg.SetAxisPLCTrajVelFilterEnable(int axis_no, int enable);*/
+ECMC_CFG_CMD_2I(SetAxisPLCTrajVelFilterEnable, setAxisPLCTrajVelFilterEnable)
+
+/*int Cfg.SetAxisPLCTrajVelFilterSize(int axis_no, int size);*/
+ECMC_CFG_CMD_2I(SetAxisPLCTrajVelFilterSize, setAxisPLCTrajVelFilterSize)
+
+/*int Cfg.SetAxisPLCEncVelFilterEnable(int axis_no, int enable);*/
+ECMC_CFG_CMD_2I(SetAxisPLCEncVelFilterEnable, setAxisPLCEncVelFilterEnable)
+
+/*int Cfg.SetAxisPLCEncVelFilterSize(int axis_no, int size);*/
+ECMC_CFG_CMD_2I(SetAxisPLCEncVelFilterSize, setAxisPLCEncVelFilterSize)
+
+/*int Cfg.SetAxisEncVelFilterSize(int axis_no, int size);*/
+ECMC_CFG_CMD_2I(SetAxisEncVelFilterSize, setAxisEncVelFilterSize)
+
+/*int Cfg.SetAxisEncPosFilterSize(int axis_no, int size);*/
+ECMC_CFG_CMD_2I(SetAxisEncPosFilterSize, setAxisEncPosFilterSize)
+
+/*int Cfg.SetAxisEncPosFilterEnable(int axis_no, int size);*/
+ECMC_CFG_CMD_2I(SetAxisEncPosFilterEnable, setAxisEncPosFilterEnable)
+
+/*int Cfg.ClearPLCExpr(int plcIndex);*/
+ECMC_CFG_CMD_1I(ClearPLCExpr, clearPLCExpr)
+
+/*int Cfg.CompilePLC(int plcIndex);*/
+ECMC_CFG_CMD_1I(CompilePLC, compilePLCExpr)
+
+/*int Cfg.CompileAxisPLC(int plcIndex);*/
+ECMC_CFG_CMD_1I(CompileAxisPLC, compileAxisPLCExpr)
+
+ECMC_CFG_CMD_2I(SetAxisAllowCommandsFromPLC, setAxisAllowCommandsFromPLC)
+
+/*int Cfg.SetAxisPLCEnable(int master_axis_no, int value);*/
+ECMC_CFG_CMD_2I(SetAxisPLCEnable, setAxisPLCEnable)
+
+/*int Cfg.ReportPlugin(int pluginId); */
+ECMC_CFG_CMD_1I(ReportPlugin, reportPlugin)
+
+/*int Cfg.SetAxisSeqTimeout(int axis_no, int value);  IN seconds!!*/
+ECMC_CFG_CMD_2I(SetAxisSeqTimeout, setAxisSeqTimeout)
+
+/*int Cfg.SetAxisHomePostMoveEnable(int axis_no, int value); */
+ECMC_CFG_CMD_2I(SetAxisHomePostMoveEnable, setAxisHomePostMoveEnable)
+
+/*int Cfg.SetAxisHomePostMoveTargetPosition(int axis_no, int value); */
+ECMC_CFG_CMD_1I1D(SetAxisHomePostMoveTargetPosition, setAxisHomePostMoveTargetPosition)
+
+/*int Cfg.CreateEvent(int indexEvent);*/
+ECMC_CFG_CMD_1I(CreateEvent, createEvent)
+
+/*int Cfg.CreateStorage(int index, int elements, int bufferType);*/
+ECMC_CFG_CMD_3I(CreateStorage, createDataStorage)
+
+/*int Cfg.SetStorageEnablePrintouts(int indexStorage,int enable);*/
+ECMC_CFG_CMD_2I(SetStorageEnablePrintouts, setStorageEnablePrintouts)
+
+/*int Cfg.PrintDataStorage(int indexStorage);*/
+ECMC_CFG_CMD_1I(PrintDataStorage, printStorageBuffer)
+
+/*int Cfg.SetDataStorageCurrentDataIndex(0,10)"*/
+ECMC_CFG_CMD_2I(SetDataStorageCurrentDataIndex, setDataStorageCurrentDataIndex)
+
+/*int Cfg.SetEventType(int indexEvent,int recordingType);*/
+ECMC_CFG_CMD_2I(SetEventType, setEventType)
+
+/*int Cfg.SetEventSampleTime(int indexEvent,int sampleTime);*/
+ECMC_CFG_CMD_2I(SetEventSampleTime, setEventSampleTime)
+
+/*int Cfg.SetEventEnable(int indexEvent,int execute);*/
+ECMC_CFG_CMD_2I(SetEventEnable, setEventEnable)
+
+/*int Cfg.ClearStorage(int indexStorage);*/
+ECMC_CFG_CMD_1I(ClearStorage, clearStorage)
+
+/*int Cfg.SetEventTriggerEdge(int indexEvent,int triggerEdge);*/
+ECMC_CFG_CMD_2I(SetEventTriggerEdge, setEventTriggerEdge)
+
+/*int Cfg.SetEventEnableArmSequence(int indexEvent,int enable);*/
+ECMC_CFG_CMD_2I(SetEventEnableArmSequence, setEventEnableArmSequence)
+
+/*int Cfg.SetEventEnablePrintouts(int indexEvent,int enable);*/
+ECMC_CFG_CMD_2I(SetEventEnablePrintouts, setEventEnablePrintouts)
+
+/*int Cfg.TriggerEvent(int indexEvent);*/
+ECMC_CFG_CMD_1I(TriggerEvent, triggerEvent)
+
+/*int Cfg.ArmEvent(int indexEvent);*/
+ECMC_CFG_CMD_1I(ArmEvent, armEvent)
+
+/*int Cfg.CreateRecorder(int indexRecorder);*/
+ECMC_CFG_CMD_1I(CreateRecorder, createRecorder)
+
+/*int Cfg.LinkStorageToRecorder(int indexStorage, int indexRecorder);*/
+ECMC_CFG_CMD_2I(LinkStorageToRecorder, linkStorageToRecorder)
+
+ECMC_CFG_CMD_3I(LinkAxisDataToRecorder, linkAxisDataToRecorder)
+
+/*int Cfg.SetRecorderEnable(int indexRecorder,int execute);*/
+ECMC_CFG_CMD_2I(SetRecorderEnable, setRecorderEnable)
+
+/*int Cfg.SetRecorderEnablePrintouts(int indexRecorder,int enable);*/
+ECMC_CFG_CMD_2I(SetRecorderEnablePrintouts, setRecorderEnablePrintouts)
+
+ECMC_CFG_CMD_3I(LinkRecorderToEvent, linkRecorderToEvent)
+
+/*int Cfg.TriggerRecorder(int indexRecorder);*/
+ECMC_CFG_CMD_1I(TriggerRecorder, triggerRecorder)
+
+/*int Cfg.CreateCommandList(int indexCommandList);*/
+ECMC_CFG_CMD_1I(CreateCommandList, createCommandList)
+
+ECMC_CFG_CMD_3I(LinkCommandListToEvent, linkCommandListToEvent)
+
+/*int Cfg.SetCommandListEnable(int indexCommandList,int enable);*/
+ECMC_CFG_CMD_2I(SetCommandListEnable, setCommandListEnable)
+
+/*int Cfg.SetCommandListEnablePrintouts(int indexCommandList,int enable);*/
+ECMC_CFG_CMD_2I(SetCommandListEnablePrintouts, setCommandListEnablePrintouts)
+
+/*int Cfg.TriggerCommandList(int indexCommandList);*/
+ECMC_CFG_CMD_1I(TriggerCommandList, triggerCommandList)
+
+/*int Cfg.CreateMultiRecorder(int indexRecorder,int channelCount,
+  int sampleCount,int bufferType);*/
+ECMC_CFG_CMD_4I(CreateMultiRecorder, createMultiRecorder)
+
+/*int Cfg.AddMultiRecorderAxisChannel(int indexRecorder,int axisIndex,
+  int dataToStore);*/
+ECMC_CFG_CMD_3I(AddMultiRecorderAxisChannel, addMultiRecorderAxisChannel)
+
+/*int Cfg.LinkMultiRecorderToEvent(int indexRecorder,int indexEvent,
+  int consumerIndex);*/
+ECMC_CFG_CMD_3I(LinkMultiRecorderToEvent, linkMultiRecorderToEvent)
+
+/*int Cfg.SetMultiRecorderEnable(int indexRecorder,int enable);*/
+ECMC_CFG_CMD_2I(SetMultiRecorderEnable, setMultiRecorderEnable)
+
+/*int Cfg.ClearMultiRecorder(int indexRecorder);*/
+ECMC_CFG_CMD_1I(ClearMultiRecorder, clearMultiRecorder)
+
+/*int Cfg.TriggerMultiRecorder(int indexRecorder);*/
+ECMC_CFG_CMD_1I(TriggerMultiRecorder, triggerMultiRecorder)
+
+/*int Cfg.SetMultiRecorderCaptureMode(int indexRecorder,int preSamples,
+  int postSamples);*/
+ECMC_CFG_CMD_3I(SetMultiRecorderCaptureMode, setMultiRecorderCaptureMode)
+
+/*int Cfg.SetMultiRecorderCaptureTrigger(int indexRecorder,int channel,
+  int edge);*/
+ECMC_CFG_CMD_3I(SetMultiRecorderCaptureTrigger, setMultiRecorderCaptureTrigger)
+
+/*int Cfg.LinkMultiRecorderCaptureToEvent(int indexRecorder,int indexEvent,
+  int consumerIndex);*/
+ECMC_CFG_CMD_3I(LinkMultiRecorderCaptureToEvent,
+                linkMultiRecorderCaptureToEvent)
+
+/*int Cfg.TriggerMultiRecorderCapture(int indexRecorder);*/
+ECMC_CFG_CMD_1I(TriggerMultiRecorderCapture, triggerMultiRecorderCapture)
+
+/*int Cfg.LinkStorageToDataStream(int indexStorage,int indexStream);*/
+ECMC_CFG_CMD_2I(LinkStorageToDataStream, linkStorageToDataStream)
+
+/*int Cfg.LinkMultiRecorderToDataStream(int indexRecorder,int indexStream);*/
+ECMC_CFG_CMD_2I(LinkMultiRecorderToDataStream, linkMultiRecorderToDataStream)
+
+/*int Cfg.SetDataStreamEnable(int indexStream,int enable);*/
+ECMC_CFG_CMD_2I(SetDataStreamEnable, setDataStreamEnable)
+
+/*int Cfg.FlushDataStream(int indexStream);*/
+ECMC_CFG_CMD_1I(FlushDataStream, flushDataStream)
+
+static const ecmcCmdDispatchEntry cfgCmdTable[] = {
+  ECMC_CFG_CMD_ENTRY(SetAppMode),
+  ECMC_CFG_CMD_ENTRY(SetEcStartupTimeout),
+  ECMC_CFG_CMD_ENTRY(SetSampleRate),
+  ECMC_CFG_CMD_ENTRY(SetSamplePeriodMs),
+  ECMC_CFG_CMD_ENTRY(CreateRtTaskGroup),
+  ECMC_CFG_CMD_ENTRY(AddAxisToRtTaskGroup),
+  ECMC_CFG_CMD_ENTRY(AddPLCToRtTaskGroup),
+  ECMC_CFG_CMD_ENTRY(AddPluginToRtTaskGroup),
+  ECMC_CFG_CMD_ENTRY(ReportRtTaskGroup),
+  ECMC_CFG_CMD_ENTRY(CreateAsynPublisher),
+  ECMC_CFG_CMD_ENTRY(DeletePLC),
+  ECMC_CFG_CMD_ENTRY(SetPLCEnable),
+  ECMC_CFG_CMD_ENTRY(EcSetMaster),
+  ECMC_CFG_CMD_ENTRY(EcResetMaster),
+  ECMC_CFG_CMD_ENTRY(EcSlaveConfigWatchDog),
+  ECMC_CFG_CMD_ENTRY(EcSelectReferenceDC),
+  ECMC_CFG_CMD_ENTRY(EcUseClockRealtime),
+  ECMC_CFG_CMD_ENTRY(EcAddSyncManager),
+  ECMC_CFG_CMD_ENTRY(EcApplyConfig),
+  ECMC_CFG_CMD_ENTRY(EcSetDiagnostics),
+  ECMC_CFG_CMD_ENTRY(EcEnablePrintouts),
+  ECMC_CFG_CMD_ENTRY(EcSetOutputChangeOnly),
+  ECMC_CFG_CMD_ENTRY(EcAddDomain),
+  ECMC_CFG_CMD_ENTRY(EcSelectDomain),
+  ECMC_CFG_CMD_ENTRY(EcSetDomainFailedCyclesLimit),
+  ECMC_CFG_CMD_ENTRY(EcSdoRequestRead),
+  ECMC_CFG_CMD_ENTRY(SetAxisJogVel),
+  ECMC_CFG_CMD_ENTRY(SetAxisEnableAlarmAtHardLimits),
+  ECMC_CFG_CMD_ENTRY(SetAxisEmergDeceleration),
+  ECMC_CFG_CMD_ENTRY(SetAxisJerk),
+  ECMC_CFG_CMD_ENTRY(CreateAxisGroup),
+  ECMC_CFG_CMD_ENTRY(AddAxisToGroup),
+  ECMC_CFG_CMD_ENTRY(SetAxisGroupVel),
+  ECMC_CFG_CMD_ENTRY(SetAxisGroupAcc),
+  ECMC_CFG_CMD_ENTRY(SetAxisGroupDec),
+  ECMC_CFG_CMD_ENTRY(SetAxisGroupEmergDec),
+  ECMC_CFG_CMD_ENTRY(SetAxisGroupJerk),
+  ECMC_CFG_CMD_ENTRY(SetAxisCamMasterAxis),
+  ECMC_CFG_CMD_ENTRY(SetAxisCamMasterScale),
+  ECMC_CFG_CMD_ENTRY(SetAxisCamMasterModulo),
+  ECMC_CFG_CMD_ENTRY(SetAxisCamRatio),
+  ECMC_CFG_CMD_ENTRY(SetAxisCamOffset),
+  ECMC_CFG_CMD_ENTRY(SetAxisPvtBufferSize),
+  ECMC_CFG_CMD_ENTRY(SetAxisTrajProfile),
+  ECMC_CFG_CMD_ENTRY(SetAxisTrajSourceType),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncSourceType),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncScaleNum),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncScaleDenom),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncBits),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncAbsBits),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncType),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncOffset),
+  ECMC_CFG_CMD_ENTRY(SetAxisCntrlKp),
+  ECMC_CFG_CMD_ENTRY(SetAxisCntrlKi),
+  ECMC_CFG_CMD_ENTRY(SetAxisCntrlKd),
+  ECMC_CFG_CMD_ENTRY(SetAxisCntrlKff),
+  ECMC_CFG_CMD_ENTRY(SetAxisCntrlOutHL),
+  ECMC_CFG_CMD_ENTRY(SetAxisCntrlOutLL),
+  ECMC_CFG_CMD_ENTRY(SetAxisCntrlIPartHL),
+  ECMC_CFG_CMD_ENTRY(SetAxisCntrlIPartLL),
+  ECMC_CFG_CMD_ENTRY(SetAxisSoftLimitPosBwd),
+  ECMC_CFG_CMD_ENTRY(SetAxisEnableSoftLimitBwd),
+  ECMC_CFG_CMD_ENTRY(SetAxisSoftLimitPosFwd),
+  ECMC_CFG_CMD_ENTRY(SetAxisEnableSoftLimitFwd),
+  ECMC_CFG_CMD_ENTRY(SetAxisEnableMotionFunctions),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonAtTargetTol),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonAtTargetTime),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonEnableAtTargetMon),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonPosLagTol),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonPosLagTime),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonEnableLagMon),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonMaxVel),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonEnableMaxVel),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonMaxVelDriveILDelay),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonMaxVelTrajILDelay),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonEnableExtHWInterlock),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonExtHWInterlockPolarity),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonLimitBwdPolarity),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonLimitFwdPolarity),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonHomeSwitchPolarity),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonEnableCntrlOutHLMon),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonEnableVelocityDiff),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonVelDiffTrajILDelay),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonVelDiffDriveILDelay),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonVelDiffTol),
+  ECMC_CFG_CMD_ENTRY(SetAxisMonCntrlOutHL),
+  ECMC_CFG_CMD_ENTRY(SetAxisDrvScaleNum),
+  ECMC_CFG_CMD_ENTRY(SetAxisDrvScaleDenom),
+  ECMC_CFG_CMD_ENTRY(SetAxisDrvVelSet),
+  ECMC_CFG_CMD_ENTRY(SetAxisDrvVelSetRaw),
+  ECMC_CFG_CMD_ENTRY(SetAxisDrvEnable),
+  ECMC_CFG_CMD_ENTRY(SetAxisDrvBrakeEnable),
+  ECMC_CFG_CMD_ENTRY(SetAxisDrvBrakeOpenDelayTime),
+  ECMC_CFG_CMD_ENTRY(SetAxisDrvBrakeCloseAheadTime),
+  ECMC_CFG_CMD_ENTRY(SetAxisDrvReduceTorqueEnable),
+  ECMC_CFG_CMD_ENTRY(SetAxisModRange),
+  ECMC_CFG_CMD_ENTRY(SetAxisModType),
+  ECMC_CFG_CMD_ENTRY(SetAxisDisableAtErrorReset),
+  ECMC_CFG_CMD_ENTRY(SetDiagAxisIndex),
+  ECMC_CFG_CMD_ENTRY(SetDiagAxisFreq),
+  ECMC_CFG_CMD_ENTRY(SetDiagAxisEnable),
+  ECMC_CFG_CMD_ENTRY(SetAxisHomeVelTwordsCam),
+  ECMC_CFG_CMD_ENTRY(SetAxisHomeVelOffCam),
+  ECMC_CFG_CMD_ENTRY(SetAxisHomeLatchCountOffset),
+  ECMC_CFG_CMD_ENTRY(SetAxisOpMode),
+  ECMC_CFG_CMD_ENTRY(SetEnableFuncCallDiag),
+  ECMC_CFG_CMD_ENTRY(SetEnableTimeDiag),
+  ECMC_CFG_CMD_ENTRY(SetEnableExecProfiler),
+  ECMC_CFG_CMD_ENTRY(SetAxisBlockCom),
+  ECMC_CFG_CMD_ENTRY(SetAxisTrajStartPos),
+  ECMC_CFG_CMD_ENTRY(SetAxisAcc),
+  ECMC_CFG_CMD_ENTRY(SetAxisDec),
+  ECMC_CFG_CMD_ENTRY(SetAxisVel),
+  ECMC_CFG_CMD_ENTRY(SetAxisPLCTrajVelFilterEnable),
+  ECMC_CFG_CMD_ENTRY(SetAxisPLCTrajVelFilterSize),
+  ECMC_CFG_CMD_ENTRY(SetAxisPLCEncVelFilterEnable),
+  ECMC_CFG_CMD_ENTRY(SetAxisPLCEncVelFilterSize),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncVelFilterSize),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncPosFilterSize),
+  ECMC_CFG_CMD_ENTRY(SetAxisEncPosFilterEnable),
+  ECMC_CFG_CMD_ENTRY(ClearPLCExpr),
+  ECMC_CFG_CMD_ENTRY(CompilePLC),
+  ECMC_CFG_CMD_ENTRY(CompileAxisPLC),
+  ECMC_CFG_CMD_ENTRY(SetAxisAllowCommandsFromPLC),
+  ECMC_CFG_CMD_ENTRY(SetAxisPLCEnable),
+  ECMC_CFG_CMD_ENTRY(ReportPlugin),
+  ECMC_CFG_CMD_ENTRY(SetAxisSeqTimeout),
+  ECMC_CFG_CMD_ENTRY(SetAxisHomePostMoveEnable),
+  ECMC_CFG_CMD_ENTRY(SetAxisHomePostMoveTargetPosition),
+  ECMC_CFG_CMD_ENTRY(CreateEvent),
+  ECMC_CFG_CMD_ENTRY(CreateStorage),
+  ECMC_CFG_CMD_ENTRY(SetStorageEnablePrintouts),
+  ECMC_CFG_CMD_ENTRY(PrintDataStorage),
+  ECMC_CFG_CMD_ENTRY(SetDataStorageCurrentDataIndex),
+  ECMC_CFG_CMD_ENTRY(SetEventType),
+  ECMC_CFG_CMD_ENTRY(SetEventSampleTime),
+  ECMC_CFG_CMD_ENTRY(SetEventEnable),
+  ECMC_CFG_CMD_ENTRY(ClearStorage),
+  ECMC_CFG_CMD_ENTRY(SetEventTriggerEdge),
+  ECMC_CFG_CMD_ENTRY(SetEventEnableArmSequence),
+  ECMC_CFG_CMD_ENTRY(SetEventEnablePrintouts),
+  ECMC_CFG_CMD_ENTRY(TriggerEvent),
+  ECMC_CFG_CMD_ENTRY(ArmEvent),
+  ECMC_CFG_CMD_ENTRY(CreateRecorder),
+  ECMC_CFG_CMD_ENTRY(LinkStorageToRecorder),
+  ECMC_CFG_CMD_ENTRY(LinkAxisDataToRecorder),
+  ECMC_CFG_CMD_ENTRY(SetRecorderEnable),
+  ECMC_CFG_CMD_ENTRY(SetRecorderEnablePrintouts),
+  ECMC_CFG_CMD_ENTRY(LinkRecorderToEvent),
+  ECMC_CFG_CMD_ENTRY(TriggerRecorder),
+  ECMC_CFG_CMD_ENTRY(CreateCommandList),
+  ECMC_CFG_CMD_ENTRY(LinkCommandListToEvent),
+  ECMC_CFG_CMD_ENTRY(SetCommandListEnable),
+  ECMC_CFG_CMD_ENTRY(SetCommandListEnablePrintouts),
+  ECMC_CFG_CMD_ENTRY(TriggerCommandList),
+  ECMC_CFG_CMD_ENTRY(CreateMultiRecorder),
+  ECMC_CFG_CMD_ENTRY(AddMultiRecorderAxisChannel),
+  ECMC_CFG_CMD_ENTRY(LinkMultiRecorderToEvent),
+  ECMC_CFG_CMD_ENTRY(SetMultiRecorderEnable),
+  ECMC_CFG_CMD_ENTRY(ClearMultiRecorder),
+  ECMC_CFG_CMD_ENTRY(TriggerMultiRecorder),
+  ECMC_CFG_CMD_ENTRY(SetMultiRecorderCaptureMode),
+  ECMC_CFG_CMD_ENTRY(SetMultiRecorderCaptureTrigger),
+  ECMC_CFG_CMD_ENTRY(LinkMultiRecorderCaptureToEvent),
+  ECMC_CFG_CMD_ENTRY(TriggerMultiRecorderCapture),
+  ECMC_CFG_CMD_ENTRY(LinkStorageToDataStream),
+  ECMC_CFG_CMD_ENTRY(LinkMultiRecorderToDataStream),
+  ECMC_CFG_CMD_ENTRY(SetDataStreamEnable),
+  ECMC_CFG_CMD_ENTRY(FlushDataStream)
+};
+
+static ecmcCmdDispatchTable cfgCmdDispatch;
+
 /**
  * \brief Handles all the configuration commands"
 */
@@ -657,14 +1419,19 @@ static int handleCfgCommand(const char *myarg_1) {
   int nvals      = 0;
   double dValue  = 0;
   double dValue2 = 0;
-  
-  /// "Cfg.SetAppMode(mode)"
-  nvals = sscanf(myarg_1, "SetAppMode(%d)", &iValue);
 
-  if (nvals == 1) {
-    return setAppMode(iValue);
+  // Commands in dispatch table
+  const char *args = strchr(myarg_1, '(');
+  if (args) {
+    const ecmcCmdDispatchEntry *cmd = ecmcCmdDispatchFind(&cfgCmdDispatch,
+                                                          myarg_1,
+                                                          args - myarg_1);
+    int errorCode = 0;
+    if (cmd && cmd->handler(args, &errorCode) == 0) {
+      return errorCode;
+    }
   }
-
+  
   /// "Cfg.ValidateConfig()"
   nvals = strcmp(myarg_1, "ValidateConfig()");
 
@@ -672,27 +1439,6 @@ static int handleCfgCommand(const char *myarg_1) {
     return validateConfig();
   }
 
-  /// "Cfg.SetEcStartupTimeout(timeSeconds)"
-  nvals = sscanf(myarg_1, "SetEcStartupTimeout(%d)", &iValue);
-
-  if (nvals == 1) {
-    return setEcStartupTimeout(iValue);
-  }
-
-  /// "Cfg.SetSampleRate(double sampleRate)"
-  nvals = sscanf(myarg_1, "SetSampleRate(%lf)", &dValue);
-
-  if (nvals == 1) {
-    return setSampleRate(dValue);
-  }
-
-  /// "Cfg.SetSamplePeriodMs(double samplePeriodMs)"
-  nvals = sscanf(myarg_1, "SetSamplePeriodMs(%lf)", &dValue);
-
-  if (nvals == 1) {
-    return setSamplePeriodMs(dValue);
-  }
-
   /// "Cfg.CreateAxis(axisIndex, axisType, drvType)"
   nvals = sscanf(myarg_1, "CreateAxis(%d,%d,%d)", &iValue, &iValue2,&iValue3);
 
@@ -738,20 +1484,6 @@ static int handleCfgCommand(const char *myarg_1) {
     return createPLC(iValue, 1, 0);
   }
 
-  /// "Cfg.DeletePLC(int index)"
-  nvals = sscanf(myarg_1, "DeletePLC(%d)", &iValue);
-
-  if (nvals == 1) {
-    return deletePLC(iValue);
-  }
-
-  /// "Cfg.SetPLCEnable(int index,int enable)"
-  nvals = sscanf(myarg_1, "SetPLCEnable(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setPLCEnable(iValue, iValue2);
-  }
-
   /// "Cfg.LinkEcEntryToObject(ecEntryPathString,objPathString)"
   // ec0.s1.POSITION.-1
   // ax1.enc.actpos
@@ -864,6 +1596,19 @@ static int handleCfgCommand(const char *myarg_1) {
     return linkEcEntryToAxisStatusOutput(iValue, cIdBuffer, iValue2);
   }
 
+  /// "Cfg.LinkEcEntryToAxisCamMaster(slaveBusPosition,entryIdString,
+  /// axisIndex)"
+  cIdBuffer[0] = '\0';
+  nvals        = sscanf(myarg_1,
+                        "LinkEcEntryToAxisCamMaster(%d,%[^,],%d)",
+                        &iValue,
+                        cIdBuffer,
+                        &iValue2);
+
+  if (nvals == 3) {
+    return linkEcEntryToAxisCamMaster(iValue, cIdBuffer, iValue2);
+  }
+
   /// "Cfg.WriteEcEntryIDString(slaveBusPosition,entryIdString,value)"
   nvals = sscanf(myarg_1,
                  "WriteEcEntryIDString(%d,%[^,],%d)",
@@ -875,20 +1620,6 @@ static int handleCfgCommand(const char *myarg_1) {
     return writeEcEntryIDString(iValue, cIdBuffer, iValue3);
   }
 
-  /// "Cfg.EcSetMaster(masterIndex)"
-  nvals = sscanf(myarg_1, "EcSetMaster(%d)", &iValue);
-
-  if (nvals == 1) {
-    return ecSetMaster(iValue);
-  }
-
-  /// "Cfg.EcResetMaster(masterIndex)"
-  nvals = sscanf(myarg_1, "EcResetMaster(%d)", &iValue);
-
-  if (nvals == 1) {
-    return ecResetMaster(iValue);
-  }
-
   /// "Cfg.EcAddSlave(alias,slaveBusPosition,vendorId,productCode)"
   nvals = sscanf(myarg_1,
                  "EcAddSlave(%d,%d,0x%x,0x%x)",
@@ -901,18 +1632,6 @@ static int handleCfgCommand(const char *myarg_1) {
     return ecAddSlave(iValue, iValue2, iValue3, iValue4);
   }
 
-  /// "Cfg.EcSlaveConfigWatchDog(slaveBusposition,watchdogDivider,
-  /// watchdogIntervals)"
-  nvals = sscanf(myarg_1,
-                 "EcSlaveConfigWatchDog(%d,%d,%d)",
-                 &iValue,
-                 &iValue2,
-                 &iValue3);
-
-  if (nvals == 3) {
-    return ecSlaveConfigWatchDog(iValue, iValue2, iValue3);
-  }
-
   /// "Cfg.EcSlaveVerify(alias,slaveBusPosition,vendorId,productCode,revisionNum)"
   nvals = sscanf(myarg_1,
                  "EcSlaveVerify(%d,%d,0x%x,0x%x,0x%x)",
@@ -1229,19 +1948,6 @@ static int handleCfgCommand(const char *myarg_1) {
       int master_index,
       int slave_bus_position)
       */
-  nvals = sscanf(myarg_1, "EcSelectReferenceDC(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return ecSelectReferenceDC(iValue, iValue2);
-  }
-
-  /*Cfg.EcUseClockRealtime(int useClcRT)*/  
-  nvals = sscanf(myarg_1, "EcUseClockRealtime(%d)", &iValue);
-
-  if (nvals == 1) {
-    return ecUseClockRealtime(iValue);
-  }
-
   /*Cfg.EcSetEntryUpdateInRealtime(
       uint16_t slavePosition,
       char *entryIDString,
@@ -1263,18 +1969,15 @@ static int handleCfgCommand(const char *myarg_1) {
     return ecResetError();
   }
 
-  /*Cfg.EcAddSyncManager(int nSlave,ec_direction_t nDirection,
-  uint8_t nSyncMangerIndex)*/
-  nvals = sscanf(myarg_1,
-                 "EcAddSyncManager(%d,%d,%d)",
-                 &iValue,
-                 &iValue2,
-                 &iValue3);
+  /*Cfg.EcSetConfigCache(char *fileName)*/
+  nvals = sscanf(myarg_1, "EcSetConfigCache(%[^)])", cExprBuffer);
 
-  if (nvals == 3) {
-    return ecAddSyncManager(iValue, iValue2, iValue3);
+  if (nvals == 1) {
+    return ecSetConfigCache(cExprBuffer);
   }
 
+  /*Cfg.EcAddSyncManager(int nSlave,ec_direction_t nDirection,
+  uint8_t nSyncMangerIndex)*/
   /*Cfg.EcAddSdo(uint16_t slave_position,uint16_t sdo_index,
   uint8_t sdo_subindex,uint32_t value,int byteSize)*/
   nvals = sscanf(myarg_1,
@@ -1329,18 +2032,51 @@ static int handleCfgCommand(const char *myarg_1) {
     return ecAddSdoBuffer(iValue, iValue2, iValue3, cIdBuffer, iValue4);
   }
 
-  /*Cfg.EcWriteSdo(uint16_t slave_position,uint16_t sdo_index,
-  uint8_t sdo_subindex,uint32_t value,int byteSize)*/
+  /*Cfg.EcAddSdoRequest(uint16_t slave_position,uint16_t sdo_index,
+  uint8_t sdo_subindex,int byteSize)*/
   nvals = sscanf(myarg_1,
-                 "EcWriteSdo(%d,0x%x,0x%x,%d,%d)",
+                 "EcAddSdoRequest(%d,0x%x,0x%x,%d)",
                  &iValue,
                  &iValue2,
                  &iValue3,
-                 &iValue4,
-                 &iValue5);
+                 &iValue4);
 
-  if (nvals == 5) {
-    return ecWriteSdo(iValue, iValue2, iValue3, iValue4, iValue5);
+  if (nvals == 4) {
+    return ecAddSdoRequest(iValue, iValue2, iValue3, iValue4);
+  }
+
+  /*Cfg.EcSdoRequestWrite(int requestIndex,uint32_t value)*/
+  nvals = sscanf(myarg_1,
+                 "EcSdoRequestWrite(%d,0x%x)",
+                 &iValue,
+                 &iValue2);
+
+  if (nvals == 2) {
+    return ecSdoRequestWrite(iValue, iValue2);
+  }
+
+  /*Cfg.EcSdoRequestWrite(int requestIndex,uint32_t value)*/
+  nvals = sscanf(myarg_1,
+                 "EcSdoRequestWrite(%d,%d)",
+                 &iValue,
+                 &iValue2);
+
+  if (nvals == 2) {
+    return ecSdoRequestWrite(iValue, iValue2);
+  }
+
+  /*Cfg.EcWriteSdo(uint16_t slave_position,uint16_t sdo_index,
+  uint8_t sdo_subindex,uint32_t value,int byteSize)*/
+  nvals = sscanf(myarg_1,
+                 "EcWriteSdo(%d,0x%x,0x%x,%d,%d)",
+                 &iValue,
+                 &iValue2,
+                 &iValue3,
+                 &iValue4,
+                 &iValue5);
+
+  if (nvals == 5) {
+    return ecWriteSdo(iValue, iValue2, iValue3, iValue4, iValue5);
   }
 
   /*Cfg.EcWriteSdo(uint16_t slave_position,uint16_t sdo_index,
@@ -1390,521 +2126,63 @@ static int handleCfgCommand(const char *myarg_1) {
               uint8_t   driveNo,
               uint16_t  idn, 
               size_t    byteSize,
-              uint64_t  value)*/
-  nvals = sscanf(myarg_1,
-                 "EcWriteSoE(%d,%d,%d,%d,%" SCNu64 ")",
-                 &iValue2,
-                 &iValue3,
-                 &iValue4,
-                 &iValue5,
-                 &uint64Value);
-  
-  if (nvals == 5) {
-    return ecWriteSoE(iValue2, iValue3, iValue4,iValue5,(uint8_t*)(&uint64Value));
-  }
-
-  /*Cfg.EcWriteSdoComplete(uint16_t slave_position,uint16_t sdo_index,
-  uint8_t sdo_subindex,uint32_t value,int byteSize)*/
-  /*nvals = sscanf(myarg_1,
-                 "EcWriteSdoComplete(%d,0x%x,%d,%d)",
-                 &iValue,
-                 &iValue2,
-                 &iValue3,
-                 &iValue4);
-
-  if (nvals == 4) {
-    return ecWriteSdoComplete(iValue, iValue2, iValue3, iValue4);
-  }*/
-
-  /*Cfg.EcWriteSdoComplete(uint16_t slave_position,uint16_t sdo_index,
-  uint8_t sdo_subindex,uint32_t value,int byteSize)*/
-  /*nvals = sscanf(myarg_1,
-                 "EcWriteSdoComplete(%d,0x%x,0x%x,%d)",
-                 &iValue,
-                 &iValue2,
-                 &iValue3,
-                 &iValue4);
-
-  if (nvals == 4) {
-    return ecWriteSdoComplete(iValue, iValue2, iValue3, iValue4);
-  }*/
-
-  /*Cfg.EcApplyConfig(int nMasterIndex)*/
-  nvals = sscanf(myarg_1, "EcApplyConfig(%d)", &iValue);
-
-  if (nvals == 1) {
-    return ecApplyConfig(iValue);
-  }
-
-  /*Cfg.EcSetDiagnostics(int nDiagnostics)*/
-  nvals = sscanf(myarg_1, "EcSetDiagnostics(%d)", &iValue);
-
-  if (nvals == 1) {
-    return ecSetDiagnostics(iValue);
-  }
-
-  /*Cfg.EcEnablePrintouts(int enable)*/
-  nvals = sscanf(myarg_1, "EcEnablePrintouts(%d)", &iValue);
-
-  if (nvals == 1) {
-    return ecEnablePrintouts(iValue);
-  }
-
-  /*Cfg.EcSetDomainFailedCyclesLimit(int nCycles)*/
-  nvals = sscanf(myarg_1, "EcSetDomainFailedCyclesLimit(%d)", &iValue);
-
-  if (nvals == 1) {
-    return ecSetDomainFailedCyclesLimit(iValue);
-  }
-
-  /*int Cfg.SetAxisJogVel(int traj_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisJogVel(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisJogVel(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisEnableAlarmAtHardLimits(int axis_no, int nEnable);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisEnableAlarmAtHardLimits(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEnableAlarmAtHardLimits(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEmergDeceleration(int traj_no, double value);*/
-  nvals =
-    sscanf(myarg_1, "SetAxisEmergDeceleration(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisEmergDeceleration(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisTrajSourceType(int axis_no, int nValue);*/
-  nvals = sscanf(myarg_1, "SetAxisTrajSourceType(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisTrajSource(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEncSourceType(int axis_no, int nValue);*/
-  nvals = sscanf(myarg_1, "SetAxisEncSourceType(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEncSource(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEncScaleNum(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisEncScaleNum(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisEncScaleNum(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisEncScaleDenom(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisEncScaleDenom(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisEncScaleDenom(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisEncBits(int axis_no, int value);*/
-  nvals = sscanf(myarg_1, "SetAxisEncBits(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEncBits(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEncAbsBits(int axis_no, int value);*/
-  nvals = sscanf(myarg_1, "SetAxisEncAbsBits(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEncAbsBits(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEncRawMask(int axis_no, int rawMask);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisEncRawMask(%d,%" PRIx64 ")",
-                 &iValue,
-                 &u64Value);
-
-  if (nvals == 2) {
-    return setAxisEncRawMask(iValue, u64Value);
-  }
-
-  /*int Cfg.SetAxisEncType(int axis_no, int value);*/
-  nvals = sscanf(myarg_1, "SetAxisEncType(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEncType(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEncOffset(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisEncOffset(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisEncOffset(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisCntrlKp(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisCntrlKp(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisCntrlKp(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisCntrlKi(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisCntrlKi(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisCntrlKi(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisCntrlKd(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisCntrlKd(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisCntrlKd(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisCntrlKff(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisCntrlKff(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisCntrlKff(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisCntrlOutHL(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisCntrlOutHL(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisCntrlOutHL(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisCntrlOutLL(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisCntrlOutLL(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisCntrlOutLL(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisCntrlIPartHL(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisCntrlIPartHL(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisCntrlIpartHL(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisCntrlIPartLL(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisCntrlIPartLL(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisCntrlIpartLL(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisSoftLimitPosBwd(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisSoftLimitPosBwd(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisSoftLimitPosBwd(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisEnableSoftLimitBwd(int axis_no, double value);*/
-  nvals =
-    sscanf(myarg_1, "SetAxisEnableSoftLimitBwd(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEnableSoftLimitBwd(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisSoftLimitPosFwd(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisSoftLimitPosFwd(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisSoftLimitPosFwd(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisEnableSoftLimitFwd(int axis_no, double value);*/
-  nvals =
-    sscanf(myarg_1, "SetAxisEnableSoftLimitFwd(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEnableSoftLimitFwd(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEnableMotionFunctions(int axis_no, 
-                                         int enablePos,
-                                         int enableConstVelo,
-                                         int enableHome);*/
-  nvals =
-    sscanf(myarg_1, "SetAxisEnableMotionFunctions(%d,%d,%d,%d)",
-           &iValue, &iValue2, &iValue3, &iValue4);
-
-  if (nvals == 4) {
-    return setAxisEnableMotionFunctions(iValue, iValue2, iValue3, iValue4);
-  }
-
-  /*int Cfg.SetAxisMonAtTargetTol(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonAtTargetTol(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisMonAtTargetTol(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisMonAtTargetTime(int axis_no, int value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonAtTargetTime(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonAtTargetTime(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonEnableAtTargetMon(int axis_no, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonEnableAtTargetMon(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonEnableAtTargetMon(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonPosLagTol(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonPosLagTol(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisMonPosLagTol(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisMonPosLagTime(int axis_no, int value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonPosLagTime(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonPosLagTime(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonEnableLagMon(int axis_no, int value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonEnableLagMon(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonEnableLagMon(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonMaxVel(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonMaxVel(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisMonMaxVel(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisMonEnableMaxVel(int axis_no, int value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonEnableMaxVel(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonEnableMaxVel(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonMaxVelDriveILDelay(int axis_no, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonMaxVelDriveILDelay(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonMaxVelDriveILDelay(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonMaxVelTrajILDelay(int axis_no, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonMaxVelTrajILDelay(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonMaxVelTrajILDelay(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonEnableExtHWInterlock(int axis_no, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonEnableExtHWInterlock(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonEnableExternalInterlock(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonExtHWInterlockPolarity(int axisIndex, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonExtHWInterlockPolarity(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonExtHWInterlockPolarity(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonLimitBwdPolarity(int axisIndex, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonLimitBwdPolarity(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonLimitBwdPolarity(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonLimitFwdPolarity(int axisIndex, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonLimitFwdPolarity(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonLimitFwdPolarity(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonHomeSwitchPolarity(int axisIndex, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonHomeSwitchPolarity(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonHomeSwitchPolarity(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonEnableCntrlOutHLMon(int axis_no, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonEnableCntrlOutHLMon(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonEnableCntrlOutHLMon(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonEnableVelocityDiff(int axis_no, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonEnableVelocityDiff(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonEnableVelocityDiff(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonVelDiffTrajILDelay(int axis_no, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonVelDiffTrajILDelay(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonVelDiffTrajILDelay(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonVelDiffDriveILDelay(int axis_no, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisMonVelDiffDriveILDelay(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisMonVelDiffDriveILDelay(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisMonVelDiffTol(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonVelDiffTol(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisMonVelDiffTol(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisMonCntrlOutHL(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonCntrlOutHL(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisMonCntrlOutHL(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisMonLatchLimit(int axis_no, int value);*/
-  nvals = sscanf(myarg_1, "SetAxisMonLatchLimit(%d,%d)", &iValue, &iValue2);
-  if (nvals == 2) {
-    return setAxisMonLatchLimit(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisDrvScaleNum(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisDrvScaleNum(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisDrvScaleNum(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisDrvScaleDenom(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisDrvScaleDenom(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisDrvScaleDenom(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisDrvVelSet(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisDrvVelSet(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisDrvVelSet(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisDrvVelSetRaw(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisDrvVelSetRaw(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisDrvVelSetRaw(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisDrvEnable(int axis_no, int value);*/
-  nvals = sscanf(myarg_1, "SetAxisDrvEnable(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisDrvEnable(iValue, iValue2);
+              uint64_t  value)*/
+  nvals = sscanf(myarg_1,
+                 "EcWriteSoE(%d,%d,%d,%d,%" SCNu64 ")",
+                 &iValue2,
+                 &iValue3,
+                 &iValue4,
+                 &iValue5,
+                 &uint64Value);
+  
+  if (nvals == 5) {
+    return ecWriteSoE(iValue2, iValue3, iValue4,iValue5,(uint8_t*)(&uint64Value));
   }
 
-  /*int Cfg.SetAxisDrvBrakeEnable(int axis_no, int enable);*/
-  nvals = sscanf(myarg_1, "SetAxisDrvBrakeEnable(%d,%d)", &iValue, &iValue2);
+  /*Cfg.EcWriteSdoComplete(uint16_t slave_position,uint16_t sdo_index,
+  uint8_t sdo_subindex,uint32_t value,int byteSize)*/
+  /*nvals = sscanf(myarg_1,
+                 "EcWriteSdoComplete(%d,0x%x,%d,%d)",
+                 &iValue,
+                 &iValue2,
+                 &iValue3,
+                 &iValue4);
 
-  if (nvals == 2) {
-    return setAxisDrvBrakeEnable(iValue, iValue2);
-  }
+  if (nvals == 4) {
+    return ecWriteSdoComplete(iValue, iValue2, iValue3, iValue4);
+  }*/
 
-  /*int Cfg.SetAxisDrvBrakeOpenDelayTime(int axis_no, int delayTime);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisDrvBrakeOpenDelayTime(%d,%d)",
+  /*Cfg.EcWriteSdoComplete(uint16_t slave_position,uint16_t sdo_index,
+  uint8_t sdo_subindex,uint32_t value,int byteSize)*/
+  /*nvals = sscanf(myarg_1,
+                 "EcWriteSdoComplete(%d,0x%x,0x%x,%d)",
                  &iValue,
-                 &iValue2);
+                 &iValue2,
+                 &iValue3,
+                 &iValue4);
 
-  if (nvals == 2) {
-    return setAxisDrvBrakeOpenDelayTime(iValue, iValue2);
-  }
+  if (nvals == 4) {
+    return ecWriteSdoComplete(iValue, iValue2, iValue3, iValue4);
+  }*/
 
-  /*int Cfg.SetAxisDrvBrakeCloseAheadTime(int axis_no, int aheadTime);*/
+  /*int Cfg.SetAxisEncRawMask(int axis_no, int rawMask);*/
   nvals = sscanf(myarg_1,
-                 "SetAxisDrvBrakeCloseAheadTime(%d,%d)",
+                 "SetAxisEncRawMask(%d,%" PRIx64 ")",
                  &iValue,
-                 &iValue2);
+                 &u64Value);
 
   if (nvals == 2) {
-    return setAxisDrvBrakeCloseAheadTime(iValue, iValue2);
+    return setAxisEncRawMask(iValue, u64Value);
   }
 
-  /*int Cfg.SetAxisDrvReduceTorqueEnable(int axis_no, int enable);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisDrvReduceTorqueEnable(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
+  /*int Cfg.SetAxisEnableMotionFunctions(int axis_no, 
+                                         int enablePos,
+                                         int enableConstVelo,
+                                         int enableHome);*/
+  /*int Cfg.SetAxisMonLatchLimit(int axis_no, int value);*/
+  nvals = sscanf(myarg_1, "SetAxisMonLatchLimit(%d,%d)", &iValue, &iValue2);
   if (nvals == 2) {
-    return setAxisDrvReduceTorqueEnable(iValue, iValue2);
+    return setAxisMonLatchLimit(iValue, iValue2);
   }
 
   /*int Cfg.SetAxisDrvType(int axis_no, int type);*/
@@ -1919,86 +2197,6 @@ static int handleCfgCommand(const char *myarg_1) {
     //return setAxisDrvType(iValue, iValue2);
   }
 
-  /*int Cfg.SetAxisModRange(int axis_no, double range);*/
-  nvals = sscanf(myarg_1, "SetAxisModRange(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisModRange(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisModType(int axis_no, int type);*/
-  nvals = sscanf(myarg_1, "SetAxisModType(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisModType(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisDisableAtErrorReset(int axis_no, int disable);*/
-  nvals = sscanf(myarg_1, "SetAxisDisableAtErrorReset(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisDisableAtErrorReset(iValue, iValue2);
-  }
-
-  /*int Cfg.SetDiagAxisIndex(int axis_no);*/
-  nvals = sscanf(myarg_1, "SetDiagAxisIndex(%d)", &iValue);
-
-  if (nvals == 1) {
-    return setDiagAxisIndex(iValue);
-  }
-
-  /*int Cfg.SetDiagAxisFreq(int nFreq);*/
-  nvals = sscanf(myarg_1, "SetDiagAxisFreq(%d)", &iValue);
-
-  if (nvals == 1) {
-    return setDiagAxisFreq(iValue);
-  }
-
-  /*int Cfg.SetDiagAxisEnable(int nDiag);*/
-  nvals = sscanf(myarg_1, "SetDiagAxisEnable(%d)", &iValue);
-
-  if (nvals == 1) {
-    return setDiagAxisEnable(iValue);
-  }
-
-  /*int Cfg.SetAxisHomeVelTwordsCam(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisHomeVelTwordsCam(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisHomeVelTwordsCam(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisHomeVelOffCam(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisHomeVelOffCam(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisHomeVelOffCam(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisHomeLatchCountOffset(int axis_no, int count);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisHomeLatchCountOffset(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisHomeLatchCountOffset(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisOpMode(int axis_no, int nMode);*/
-  nvals = sscanf(myarg_1, "SetAxisOpMode(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisOpMode(iValue, iValue2);
-  }
-
-  /*int Cfg.SetEnableFuncCallDiag(int nEnable);*/
-  nvals = sscanf(myarg_1, "SetEnableFuncCallDiag(%d)", &iValue);
-
-  if (nvals == 1) {
-    return setEnableFunctionCallDiag(iValue);
-  }
-
   /*int Cfg.SetTraceMask(int mask);*/  
   nvals = sscanf(myarg_1, "SetTraceMask(%d)", &iValue);
 
@@ -2015,48 +2213,6 @@ static int handleCfgCommand(const char *myarg_1) {
     return 0;
   }
 
-  /*int Cfg.SetEnableTimeDiag(int nEnable);*/
-  nvals = sscanf(myarg_1, "SetEnableTimeDiag(%d)", &iValue);
-
-  if (nvals == 1) {
-    return setEnableTimeDiag(iValue);
-  }
-
-  /*int Cfg.SetAxisBlockCom(int axis_no, int block);*/
-  nvals = sscanf(myarg_1, "SetAxisBlockCom(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setAxisBlockCom(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisTrajStartPos(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisTrajStartPos(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisTrajStartPos(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisAcc(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisAcc(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisAcceleration(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisDec(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisDec(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisDeceleration(iValue, dValue);
-  }
-
-  /*int Cfg.SetAxisVel(int axis_no, double value);*/
-  nvals = sscanf(myarg_1, "SetAxisVel(%d,%lf)", &iValue, &dValue);
-
-  if (nvals == 2) {
-    return setAxisTargetVel(iValue, dValue);
-  }
-
   /*int Cfg.SetAxisVelAccDecTime(int axis_no, double vel,double timeToVel);*/
   /* Set Velcoity acceleration and deceleration
    * Acceleration and deceleration is defined by time to reach velocity.
@@ -2093,76 +2249,6 @@ static int handleCfgCommand(const char *myarg_1) {
     return setAxisDeceleration(iValue, acc);
   }
 
-  /*int Cfg.SetAxisPLCTrajVelFilterEnable(int axis_no, int enable);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisPLCTrajVelFilterEnable(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisPLCTrajVelFilterEnable(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisPLCTrajVelFilterSize(int axis_no, int size);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisPLCTrajVelFilterSize(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisPLCTrajVelFilterSize(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisPLCEncVelFilterEnable(int axis_no, int enable);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisPLCEncVelFilterEnable(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisPLCEncVelFilterEnable(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisPLCEncVelFilterSize(int axis_no, int size);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisPLCEncVelFilterSize(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisPLCEncVelFilterSize(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEncVelFilterSize(int axis_no, int size);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisEncVelFilterSize(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEncVelFilterSize(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEncPosFilterSize(int axis_no, int size);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisEncPosFilterSize(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEncPosFilterSize(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisEncPosFilterEnable(int axis_no, int size);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisEncPosFilterEnable(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisEncPosFilterEnable(iValue, iValue2);
-  }
-
   /*int Cfg.AppendAxisPLCExpr(int axis_no,char *cExpr); */
   nvals = sscanf(myarg_1,
                  "AppendAxisPLCExpr(%d)=%[^\n]",
@@ -2228,173 +2314,85 @@ static int handleCfgCommand(const char *myarg_1) {
       if (cExprBuffer[i] == TRANSFORM_EXPR_LINE_END_CHAR) {
         cExprBuffer[i] = ';';
       }
-    }
-    return appendPLCExpr(iValue, cExprBuffer);
-  }
-
-  /*int Cfg.AppendAxisPLCExpr(int index,char *cExpr); */
-  nvals = sscanf(myarg_1, "AppendAxisPLCExpr(%d)=%[^\n]", &iValue, cExprBuffer);
-
-  if (nvals == 1) {
-    cExprBuffer[0] = '\0';
-  }
-
-  if (nvals >= 1) {  // allow empty expression
-    // Change all # to ; (since ; is used as command
-    // delimiter in tcpip communication)
-    size_t str_len = strlen(cExprBuffer);
-
-    int i = 0;
-
-    for (i = 0; i < str_len; i++) {
-      if (cExprBuffer[i] == TRANSFORM_EXPR_LINE_END_CHAR) {
-        cExprBuffer[i] = ';';
-      }
-    }
-    // Axis plcs is indexed "above" normal PLCs in the PLC array
-    return appendPLCExpr(iValue + ECMC_MAX_PLCS, cExprBuffer);
-  }
-
-  /*int Cfg.LoadAxisPLCFile(int index,char *cExpr); */
-  nvals = sscanf(myarg_1, "LoadAxisPLCFile(%d,%[^)])", &iValue, cExprBuffer);
-
-  if (nvals == 2) {
-    // Axis plcs is indexed "above" normal PLCs in the PLC array
-    return loadPLCFile(iValue + ECMC_MAX_PLCS, cExprBuffer);
-  }
-
-  /*int Cfg.LoadPLCFile(int index,char *cExpr); */
-  nvals = sscanf(myarg_1, "LoadPLCFile(%d,%[^)])", &iValue, cExprBuffer);
-
-  if (nvals == 2) {
-    return loadPLCFile(iValue, cExprBuffer);
-  }
-
-  /*int Cfg.ClearPLCExpr(int plcIndex);*/
-  nvals = sscanf(myarg_1, "ClearPLCExpr(%d)", &iValue);
-
-  if (nvals == 1) {
-    return clearPLCExpr(iValue);
-  }
-
-  /*int Cfg.CompilePLC(int plcIndex);*/
-  nvals = sscanf(myarg_1, "CompilePLC(%d)", &iValue);
-
-  if (nvals == 1) {
-    return compilePLCExpr(iValue);
-  }
-
-  /*int Cfg.CompileAxisPLC(int plcIndex);*/
-  nvals = sscanf(myarg_1, "CompileAxisPLC(%d)", &iValue);
-
-  if (nvals == 1) {
-    return compileAxisPLCExpr(iValue);
-  }
-
-  /*int Cfg.SetAxisAllowCommandsFromPLC(int master_axis_no,
-    int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisAllowCommandsFromPLC(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisAllowCommandsFromPLC(iValue, iValue2);
-  }
-
-  /*int Cfg.SetAxisPLCEnable(int master_axis_no, int value);*/
-  nvals = sscanf(myarg_1,
-                 "SetAxisPLCEnable(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setAxisPLCEnable(iValue, iValue2);
-  }
-
-  /*int Cfg.LoadPlugin(int pluginId, char *cFilename, char *configString); */
-  nvals = sscanf(myarg_1, "LoadPlugin(%d,%[^,],%[^)])", &iValue, cIdBuffer,cIdBuffer2);
-
-  if (nvals == 3) {
-    return loadPlugin(iValue,cIdBuffer,cIdBuffer2);
-  }
-
-  /*int Cfg.LoadPlugin(int pluginId, char *cFilename); */
-  nvals = sscanf(myarg_1, "LoadPlugin(%d,%[^)])",&iValue, cIdBuffer);
-
-  if (nvals == 2) {
-    return loadPlugin(iValue,cIdBuffer,"");
+    }
+    return appendPLCExpr(iValue, cExprBuffer);
   }
 
-  /*int Cfg.ReportPlugin(int pluginId); */
-  nvals = sscanf(myarg_1, "ReportPlugin(%d)",&iValue);
+  /*int Cfg.AppendAxisPLCExpr(int index,char *cExpr); */
+  nvals = sscanf(myarg_1, "AppendAxisPLCExpr(%d)=%[^\n]", &iValue, cExprBuffer);
 
   if (nvals == 1) {
-    return reportPlugin(iValue);
+    cExprBuffer[0] = '\0';
   }
 
-  /*int Cfg.SetAxisSeqTimeout(int axis_no, int value);  IN seconds!!*/
-  nvals = sscanf(myarg_1, "SetAxisSeqTimeout(%d,%d)", &iValue, &iValue2);
+  if (nvals >= 1) {  // allow empty expression
+    // Change all # to ; (since ; is used as command
+    // delimiter in tcpip communication)
+    size_t str_len = strlen(cExprBuffer);
+
+    int i = 0;
 
-  if (nvals == 2) {
-    return setAxisSeqTimeout(iValue, iValue2);
+    for (i = 0; i < str_len; i++) {
+      if (cExprBuffer[i] == TRANSFORM_EXPR_LINE_END_CHAR) {
+        cExprBuffer[i] = ';';
+      }
+    }
+    // Axis plcs is indexed "above" normal PLCs in the PLC array
+    return appendPLCExpr(iValue + ECMC_MAX_PLCS, cExprBuffer);
   }
 
-  /*int Cfg.SetAxisHomePostMoveEnable(int axis_no, int value); */
-  nvals = sscanf(myarg_1, "SetAxisHomePostMoveEnable(%d,%d)", &iValue, &iValue2);
+  /*int Cfg.LoadAxisPLCFile(int index,char *cExpr); */
+  nvals = sscanf(myarg_1, "LoadAxisPLCFile(%d,%[^)])", &iValue, cExprBuffer);
 
   if (nvals == 2) {
-    return setAxisHomePostMoveEnable(iValue, iValue2);
+    // Axis plcs is indexed "above" normal PLCs in the PLC array
+    return loadPLCFile(iValue + ECMC_MAX_PLCS, cExprBuffer);
   }
 
-  /*int Cfg.SetAxisHomePostMoveTargetPosition(int axis_no, int value); */
-  nvals = sscanf(myarg_1, "SetAxisHomePostMoveTargetPosition(%d,%lf)", &iValue, &dValue);
+  /*int Cfg.LoadAxisCamTable(int axisIndex,char *fileName,int interp); */
+  nvals = sscanf(myarg_1,
+                 "LoadAxisCamTable(%d,%[^,],%d)",
+                 &iValue,
+                 cExprBuffer,
+                 &iValue2);
 
-  if (nvals == 2) {
-    return setAxisHomePostMoveTargetPosition(iValue, dValue);
+  if (nvals == 3) {
+    return loadAxisCamTable(iValue, cExprBuffer, iValue2);
   }
 
-  /*int Cfg.CreateEvent(int indexEvent);*/
-  nvals = sscanf(myarg_1, "CreateEvent(%d)", &iValue);
+  /*int Cfg.LoadPLCFile(int index,char *cExpr); */
+  nvals = sscanf(myarg_1, "LoadPLCFile(%d,%[^)])", &iValue, cExprBuffer);
 
-  if (nvals == 1) {
-    return createEvent(iValue);
+  if (nvals == 2) {
+    return loadPLCFile(iValue, cExprBuffer);
   }
 
-  /*int Cfg.CreateStorage(int index, int elements, int bufferType);*/
+  /*int Cfg.OpenPLCFile(int index,int channel,int mode,char *fileName); */
   nvals = sscanf(myarg_1,
-                 "CreateStorage(%d,%d,%d)",
+                 "OpenPLCFile(%d,%d,%d,%[^)])",
                  &iValue,
                  &iValue2,
-                 &iValue3);
-
-  if (nvals == 3) {
-    return createDataStorage(iValue, iValue2, iValue3);
-  }
-
-  /*int Cfg.SetStorageEnablePrintouts(int indexStorage,int enable);*/
-  nvals =
-    sscanf(myarg_1, "SetStorageEnablePrintouts(%d,%d)", &iValue, &iValue2);
+                 &iValue3,
+                 cExprBuffer);
 
-  if (nvals == 2) {
-    return setStorageEnablePrintouts(iValue, iValue2);
+  if (nvals == 4) {
+    return openPLCFile(iValue, iValue2, iValue3, cExprBuffer);
   }
 
-  /*int Cfg.PrintDataStorage(int indexStorage);*/
-  nvals = sscanf(myarg_1, "PrintDataStorage(%d)", &iValue);
+  /*int Cfg.SetAxisAllowCommandsFromPLC(int master_axis_no,
+    int value);*/
+  /*int Cfg.LoadPlugin(int pluginId, char *cFilename, char *configString); */
+  nvals = sscanf(myarg_1, "LoadPlugin(%d,%[^,],%[^)])", &iValue, cIdBuffer,cIdBuffer2);
 
-  if (nvals == 1) {
-    return printStorageBuffer(iValue);
+  if (nvals == 3) {
+    return loadPlugin(iValue,cIdBuffer,cIdBuffer2);
   }
 
-  /*int Cfg.SetDataStorageCurrentDataIndex(0,10)"*/
-  nvals = sscanf(myarg_1,
-                 "SetDataStorageCurrentDataIndex(%d,%d)",
-                 &iValue,
-                 &iValue2);
+  /*int Cfg.LoadPlugin(int pluginId, char *cFilename); */
+  nvals = sscanf(myarg_1, "LoadPlugin(%d,%[^)])",&iValue, cIdBuffer);
 
   if (nvals == 2) {
-    return setDataStorageCurrentDataIndex(iValue, iValue2);
+    return loadPlugin(iValue,cIdBuffer,"");
   }
 
   /*Cfg.LinkEcEntryToEvent(int indexEvent,int eventEntryIndex,int Slave,
@@ -2411,84 +2409,6 @@ static int handleCfgCommand(const char *myarg_1) {
     return linkEcEntryToEvent(iValue, iValue2, iValue3, cIdBuffer, iValue4);
   }
 
-  /*int Cfg.SetEventType(int indexEvent,int recordingType);*/
-  nvals = sscanf(myarg_1, "SetEventType(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setEventType(iValue, iValue2);
-  }
-
-  /*int Cfg.SetEventSampleTime(int indexEvent,int sampleTime);*/
-  nvals = sscanf(myarg_1, "SetEventSampleTime(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setEventSampleTime(iValue, iValue2);
-  }
-
-  /*int Cfg.SetEventEnable(int indexEvent,int execute);*/
-  nvals = sscanf(myarg_1, "SetEventEnable(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setEventEnable(iValue, iValue2);
-  }
-
-  /*int Cfg.ClearStorage(int indexStorage);*/
-  nvals = sscanf(myarg_1, "ClearStorage(%d)", &iValue);
-
-  if (nvals == 1) {
-    return clearStorage(iValue);
-  }
-
-  /*int Cfg.SetEventTriggerEdge(int indexEvent,int triggerEdge);*/
-  nvals = sscanf(myarg_1, "SetEventTriggerEdge(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setEventTriggerEdge(iValue, iValue2);
-  }
-
-  /*int Cfg.SetEventEnableArmSequence(int indexEvent,int enable);*/
-  nvals =
-    sscanf(myarg_1, "SetEventEnableArmSequence(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setEventEnableArmSequence(iValue, iValue2);
-  }
-
-  /*int Cfg.SetEventEnablePrintouts(int indexEvent,int enable);*/
-  nvals = sscanf(myarg_1, "SetEventEnablePrintouts(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setEventEnablePrintouts(iValue, iValue2);
-  }
-
-  /*int Cfg.TriggerEvent(int indexEvent);*/
-  nvals = sscanf(myarg_1, "TriggerEvent(%d)", &iValue);
-
-  if (nvals == 1) {
-    return triggerEvent(iValue);
-  }
-
-  /*int Cfg.ArmEvent(int indexEvent);*/
-  nvals = sscanf(myarg_1, "ArmEvent(%d)", &iValue);
-
-  if (nvals == 1) {
-    return armEvent(iValue);
-  }
-
-  /*int Cfg.CreateRecorder(int indexRecorder);*/
-  nvals = sscanf(myarg_1, "CreateRecorder(%d)", &iValue);
-
-  if (nvals == 1) {
-    return createRecorder(iValue);
-  }
-
-  /*int Cfg.LinkStorageToRecorder(int indexStorage, int indexRecorder);*/
-  nvals = sscanf(myarg_1, "LinkStorageToRecorder(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return linkStorageToRecorder(iValue, iValue2);
-  }
-
   /*Cfg.LinkEcEntryToRecorder(int indexRecorder,int recorderEntryIndex,
   int Slave, char *ecEntryIdString, int bitIndex)*/
   nvals = sscanf(myarg_1,
@@ -2505,103 +2425,42 @@ static int handleCfgCommand(const char *myarg_1) {
 
   /*Cfg.LinkAxisDataToRecorder(int indexRecorder,int axisIndex,
   int dataToTypeStore)*/
-  nvals = sscanf(myarg_1,
-                 "LinkAxisDataToRecorder(%d,%d,%d)",
-                 &iValue,
-                 &iValue2,
-                 &iValue3);
-
-  if (nvals == 3) {
-    return linkAxisDataToRecorder(iValue, iValue2, iValue3);
-  }
-
-  /*int Cfg.SetRecorderEnable(int indexRecorder,int execute);*/
-  nvals = sscanf(myarg_1, "SetRecorderEnable(%d,%d)", &iValue, &iValue2);
-
-  if (nvals == 2) {
-    return setRecorderEnable(iValue, iValue2);
-  }
-
-  /*int Cfg.SetRecorderEnablePrintouts(int indexRecorder,int enable);*/
-  nvals = sscanf(myarg_1,
-                 "SetRecorderEnablePrintouts(%d,%d)",
-                 &iValue,
-                 &iValue2);
-
-  if (nvals == 2) {
-    return setRecorderEnablePrintouts(iValue, iValue2);
-  }
-
   /*int Cfg.LinkRecorderToEvent(int indexRecorder,int indexEvent,
   int consumerIndex);*/
-  nvals = sscanf(myarg_1,
-                 "LinkRecorderToEvent(%d,%d,%d)",
-                 &iValue,
-                 &iValue2,
-                 &iValue3);
-
-  if (nvals == 3) {
-    return linkRecorderToEvent(iValue, iValue2, iValue3);
-  }
-
-  /*int Cfg.TriggerRecorder(int indexRecorder);*/
-  nvals = sscanf(myarg_1, "TriggerRecorder(%d)", &iValue);
-
-  if (nvals == 1) {
-    return triggerRecorder(iValue);
-  }
-
-  /*int Cfg.CreateCommandList(int indexCommandList);*/
-  nvals = sscanf(myarg_1, "CreateCommandList(%d)", &iValue);
-
-  if (nvals == 1) {
-    return createCommandList(iValue);
-  }
-
   /*int Cfg.LinkCommandListToEvent(int indexCommandList,int indexEvent,
   int consumerIndex);*/
+  /*int Cfg.AddCommandToCommandList(int indexCommandList,char *cExpr); */
   nvals = sscanf(myarg_1,
-                 "LinkCommandListToEvent(%d,%d,%d)",
+                 "AddCommandToCommandList(%d)=%[^\n]",
                  &iValue,
-                 &iValue2,
-                 &iValue3);
-
-  if (nvals == 3) {
-    return linkCommandListToEvent(iValue, iValue2, iValue3);
-  }
-
-  /*int Cfg.SetCommandListEnable(int indexCommandList,int enable);*/
-  nvals = sscanf(myarg_1, "SetCommandListEnable(%d,%d)", &iValue, &iValue2);
+                 cExprBuffer);
 
   if (nvals == 2) {
-    return setCommandListEnable(iValue, iValue2);
+    return addCommandListCommand(iValue, cExprBuffer);
   }
 
-  /*int Cfg.SetCommandListEnablePrintouts(int indexCommandList,int enable);*/
+  /*int Cfg.AddMultiRecorderChannel(int indexRecorder,char *dataItemName); */
   nvals = sscanf(myarg_1,
-                 "SetCommandListEnablePrintouts(%d,%d)",
+                 "AddMultiRecorderChannel(%d,%[^)])",
                  &iValue,
-                 &iValue2);
+                 cIdBuffer);
 
   if (nvals == 2) {
-    return setCommandListEnablePrintouts(iValue, iValue2);
+    return addMultiRecorderChannel(iValue, cIdBuffer);
   }
 
-  /*int Cfg.AddCommandToCommandList(int indexCommandList,char *cExpr); */
+  /*int Cfg.CreateDataStream(int indexStream,int channelCount,int blockRows,
+                             int blockCount,char *fileName); */
   nvals = sscanf(myarg_1,
-                 "AddCommandToCommandList(%d)=%[^\n]",
+                 "CreateDataStream(%d,%d,%d,%d,%[^)])",
                  &iValue,
-                 cExprBuffer);
-
-  if (nvals == 2) {
-    return addCommandListCommand(iValue, cExprBuffer);
-  }
-
-  /*int Cfg.TriggerCommandList(int indexCommandList);*/
-  nvals = sscanf(myarg_1, "TriggerCommandList(%d)", &iValue);
+                 &iValue2,
+                 &iValue3,
+                 &iValue4,
+                 cIdBuffer);
 
-  if (nvals == 1) {
-    return triggerCommandList(iValue);
+  if (nvals == 5) {
+    return createDataStream(iValue, iValue2, iValue3, iValue4, cIdBuffer);
   }
 
   /*int Cfg.IocshCmd=<command string>*/
@@ -2985,6 +2844,7 @@ int motorHandleOneArg(const char *myarg_1, ecmcOutputBufferType *buffer) {
   int motor_axis_no = 0;
   int nvals = 0;
   double dValue1, dValue2, dValue3, dValue4;  
+  double dValues[ECMC_AXIS_GROUP_MAX_AXES];
 
   if (buffer->buffer == NULL) {
     return ERROR_MAIN_PARSER_BUFFER_NULL;
@@ -2992,6 +2852,14 @@ int motorHandleOneArg(const char *myarg_1, ecmcOutputBufferType *buffer) {
 
   if (!ecmcInitDone) {
     ecmcInitThread();
+    if (ecmcCmdDispatchInit(&cfgCmdDispatch,
+                            cfgCmdTable,
+                            sizeof(cfgCmdTable) / sizeof(cfgCmdTable[0]))) {
+      LOGERR("%s/%s:%d: WARNING: Command hash table init failed (linear search).\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__);
+    }
     ecmcInitDone = 1;
   }  
 
@@ -3155,6 +3023,27 @@ int motorHandleOneArg(const char *myarg_1, ecmcOutputBufferType *buffer) {
                                                    iValue5, &u32Value));
   }
 
+  /*EcGetConfigCacheLoaded()*/
+  if (0 == strcmp(myarg_1, "EcGetConfigCacheLoaded()")) {
+    SEND_RESULT_OR_ERROR_AND_RETURN_INT(ecGetConfigCacheLoaded(&iValue));
+  }
+
+  /*EcGetSdoRequestValue(int requestIndex)*/
+  nvals = sscanf(myarg_1, "EcGetSdoRequestValue(%d)", &iValue);
+
+  if (nvals == 1) {
+    SEND_RESULT_OR_ERROR_AND_RETURN_UINT(ecGetSdoRequestValue(iValue,
+                                                              &u32Value));
+  }
+
+  /*EcGetSdoRequestStatus(int requestIndex)*/
+  nvals = sscanf(myarg_1, "EcGetSdoRequestStatus(%d)", &iValue2);
+
+  if (nvals == 1) {
+    SEND_RESULT_OR_ERROR_AND_RETURN_INT(ecGetSdoRequestStatus(iValue2,
+                                                              &iValue));
+  }
+
   /*EcReadSoE(uint16_t  slavePosition,
               uint8_t   driveNo,
               uint16_t  idn, 
@@ -3498,6 +3387,154 @@ int motorHandleOneArg(const char *myarg_1, ecmcOutputBufferType *buffer) {
                                              dValue3));
   }
 
+  /*int AddMotionQueueItem(int axisIndex,double positionSet,
+  double velocitySet, double accelerationSet, double decelerationSet,
+  int blend);*/
+  nvals = sscanf(myarg_1,
+                 "AddMotionQueueItem(%d,%lf,%lf,%lf,%lf,%d)",
+                 &iValue,
+                 &dValue1,
+                 &dValue2,
+                 &dValue3,
+                 &dValue4,
+                 &iValue2);
+
+  if (nvals == 6) {
+    SEND_OK_OR_ERROR_AND_RETURN(addMotionQueueItem(iValue, dValue1, dValue2,
+                                                   dValue3, dValue4,
+                                                   iValue2));
+  }
+
+  /*int SetMotionQueueEnable(int axisIndex, int enable);*/
+  nvals = sscanf(myarg_1, "SetMotionQueueEnable(%d,%d)", &iValue, &iValue2);
+
+  if (nvals == 2) {
+    SEND_OK_OR_ERROR_AND_RETURN(setMotionQueueEnable(iValue, iValue2));
+  }
+
+  /*int ClearMotionQueue(int axisIndex);*/
+  nvals = sscanf(myarg_1, "ClearMotionQueue(%d)", &iValue);
+
+  if (nvals == 1) {
+    SEND_OK_OR_ERROR_AND_RETURN(clearMotionQueue(iValue));
+  }
+
+  /*int GetMotionQueueCount(int axisIndex);*/
+  nvals = sscanf(myarg_1, "GetMotionQueueCount(%d)", &motor_axis_no);
+
+  if (nvals == 1) {
+    SEND_RESULT_OR_ERROR_AND_RETURN_INT(getMotionQueueCount(motor_axis_no,
+                                                            &iValue));
+  }
+
+  /*int MoveAxisGroupLinear(int groupIndex, double pos1, ... double pos8);*/
+  nvals = sscanf(myarg_1,
+                 "MoveAxisGroupLinear(%d," ECMC_AXIS_GROUP_POS_FORMAT,
+                 &iValue,
+                 &dValues[0], &dValues[1], &dValues[2], &dValues[3],
+                 &dValues[4], &dValues[5], &dValues[6], &dValues[7]);
+
+  if (nvals >= 2) {
+    SEND_OK_OR_ERROR_AND_RETURN(moveAxisGroupLinear(iValue, dValues,
+                                                    nvals - 1));
+  }
+
+  /*int MoveAxisGroupCircular(int groupIndex, int direction, double centerX,
+  double centerY, double pos1, ... double pos8);*/
+  nvals = sscanf(myarg_1,
+                 "MoveAxisGroupCircular(%d,%d,%lf,%lf," ECMC_AXIS_GROUP_POS_FORMAT,
+                 &iValue,
+                 &iValue2,
+                 &dValue1,
+                 &dValue2,
+                 &dValues[0], &dValues[1], &dValues[2], &dValues[3],
+                 &dValues[4], &dValues[5], &dValues[6], &dValues[7]);
+
+  if (nvals >= 6) {
+    SEND_OK_OR_ERROR_AND_RETURN(moveAxisGroupCircular(iValue, iValue2,
+                                                      dValue1, dValue2,
+                                                      dValues, nvals - 4));
+  }
+
+  /*int StopAxisGroup(int groupIndex);*/
+  nvals = sscanf(myarg_1, "StopAxisGroup(%d)", &iValue);
+
+  if (nvals == 1) {
+    SEND_OK_OR_ERROR_AND_RETURN(stopAxisGroup(iValue));
+  }
+
+  /*int SetAxisGroupOverride(int groupIndex, double override);*/
+  nvals = sscanf(myarg_1, "SetAxisGroupOverride(%d,%lf)", &iValue, &dValue1);
+
+  if (nvals == 2) {
+    SEND_OK_OR_ERROR_AND_RETURN(setAxisGroupOverride(iValue, dValue1));
+  }
+
+  /*int GetAxisGroupBusy(int groupIndex);*/
+  nvals = sscanf(myarg_1, "GetAxisGroupBusy(%d)", &motor_axis_no);
+
+  if (nvals == 1) {
+    SEND_RESULT_OR_ERROR_AND_RETURN_INT(getAxisGroupBusy(motor_axis_no,
+                                                         &iValue));
+  }
+
+  /*int SetAxisCamEnable(int axisIndex, int enable);*/
+  nvals = sscanf(myarg_1, "SetAxisCamEnable(%d,%d)", &iValue, &iValue2);
+
+  if (nvals == 2) {
+    SEND_OK_OR_ERROR_AND_RETURN(setAxisCamEnable(iValue, iValue2));
+  }
+
+  /*int AddAxisPvtPoint(int axisIndex, double position, double velocity,
+                        double time);*/
+  nvals = sscanf(myarg_1,
+                 "AddAxisPvtPoint(%d,%lf,%lf,%lf)",
+                 &iValue,
+                 &dValue1,
+                 &dValue2,
+                 &dValue3);
+
+  if (nvals == 4) {
+    SEND_OK_OR_ERROR_AND_RETURN(addAxisPvtPoint(iValue, dValue1, dValue2,
+                                                dValue3));
+  }
+
+  /*int AddAxisPvtFromDataStorage(int axisIndex, int storageIndex);*/
+  nvals = sscanf(myarg_1, "AddAxisPvtFromDataStorage(%d,%d)", &iValue, &iValue2);
+
+  if (nvals == 2) {
+    SEND_OK_OR_ERROR_AND_RETURN(addAxisPvtFromDataStorage(iValue, iValue2));
+  }
+
+  /*int StartAxisPvt(int axisIndex);*/
+  nvals = sscanf(myarg_1, "StartAxisPvt(%d)", &iValue);
+
+  if (nvals == 1) {
+    SEND_OK_OR_ERROR_AND_RETURN(startAxisPvt(iValue));
+  }
+
+  /*int StopAxisPvt(int axisIndex);*/
+  nvals = sscanf(myarg_1, "StopAxisPvt(%d)", &iValue);
+
+  if (nvals == 1) {
+    SEND_OK_OR_ERROR_AND_RETURN(stopAxisPvt(iValue));
+  }
+
+  /*int ClearAxisPvt(int axisIndex);*/
+  nvals = sscanf(myarg_1, "ClearAxisPvt(%d)", &iValue);
+
+  if (nvals == 1) {
+    SEND_OK_OR_ERROR_AND_RETURN(clearAxisPvt(iValue));
+  }
+
+  /*int GetAxisPvtFree(int axisIndex);*/
+  nvals = sscanf(myarg_1, "GetAxisPvtFree(%d)", &motor_axis_no);
+
+  if (nvals == 1) {
+    SEND_RESULT_OR_ERROR_AND_RETURN_INT(getAxisPvtFree(motor_axis_no,
+                                                       &iValue));
+  }
+
   /*int StopMotion(int axisIndex, int killAmplifier);*/
   nvals = sscanf(myarg_1, "StopMotion(%d,%d)", &iValue, &iValue2);
 
@@ -38,13 +38,6 @@ int ecmcInit(void *asynPortObject) {
   
   LOGINFO4("%s/%s:%d\n", __FILE__, __FUNCTION__, __LINE__);
 
-  ecmcRTMutex = epicsMutexCreate();
-  if(!ecmcRTMutex) {
-    LOGERR("ERROR: Failed to create Mutex (epicsMutexCreate())  (0x%x)",
-            ERROR_MAIN_RT_MUTEX_NULL);
-    return ERROR_MAIN_RT_MUTEX_NULL;
-  }
-
   asynPort = reinterpret_cast<ecmcAsynPortDriver *>(asynPortObject);  
   ec = new ecmcEc(asynPort);
 
@@ -252,12 +245,36 @@ void ecmcDelDefaultAsynParams() {
     delete mainAsynParams[i];
     mainAsynParams[i] = NULL;
   }
+
+  for(int i = 0; i < ECMC_THREAD_HIST_COUNT; i++) {
+    delete threadHistograms[i];
+    threadHistograms[i] = NULL;
+  }
+
+  delete execProfiler;
+  execProfiler = NULL;
 }
 
 void ecmcCleanup() {
 
   ecmcDelDefaultAsynParams();
 
+  if(asynPort) {
+    asynPort->setPublisher(NULL);
+  }
+  delete asynPublisher;
+  asynPublisher = NULL;
+
+  for(int i = 0; i < ECMC_MAX_RT_TASK_GROUPS; i++) {
+    delete rtTaskGroups[i];
+    rtTaskGroups[i] = NULL;
+  }
+
+  for(int i = 0; i < ECMC_MAX_AXIS_GROUPS; i++) {
+    delete axisGroups[i];
+    axisGroups[i] = NULL;
+  }
+
   delete plcs;
   plcs = NULL;
   
@@ -281,6 +298,17 @@ void ecmcCleanup() {
     commandLists[i] = NULL;
   }
 
+  for(int i = 0;i < ECMC_MAX_MULTI_RECORDERS; i++) {
+    delete multiRecorders[i];
+    multiRecorders[i] = NULL;
+  }
+
+  // Producers deleted, write remaining data and close files
+  for(int i = 0;i < ECMC_MAX_DATA_STREAMS; i++) {
+    delete dataStreams[i];
+    dataStreams[i] = NULL;
+  }
+
   for(int i = 0;i < ECMC_MAX_PLUGINS; i++) {
     if(plugins[i]) {
       plugins[i]->exeDestructFunc();      
@@ -621,5 +649,27 @@ int ecmcAddDefaultAsynParams() {
   paramTemp->refreshParam(1);
   mainAsynParams[ECMC_ASYN_MAIN_PAR_UPDATE_READY_ID] = paramTemp;
 
+  // Timing histograms of ecmc_rt
+  const char *histNames[ECMC_THREAD_HIST_COUNT] = {
+    ECMC_ASYN_MAIN_HIST_LATENCY_NAME,
+    ECMC_ASYN_MAIN_HIST_PERIOD_NAME,
+    ECMC_ASYN_MAIN_HIST_EXECUTE_NAME,
+    ECMC_ASYN_MAIN_HIST_SEND_NAME };
+
+  for(int i = 0; i < ECMC_THREAD_HIST_COUNT; i++) {
+    delete threadHistograms[i];
+    threadHistograms[i] = new ecmcLatencyHistogram(asynPort, histNames[i]);
+    if(threadHistograms[i]->getErrorID()) {
+      return threadHistograms[i]->getErrorID();
+    }
+  }
+
+  // Execution time per object in ecmc_rt (disabled by default)
+  delete execProfiler;
+  execProfiler = new ecmcExecProfiler(asynPort, ECMC_ASYN_MAIN_PROF_NAME);
+  if(execProfiler->getErrorID()) {
+    return execProfiler->getErrorID();
+  }
+
   return 0;
 }
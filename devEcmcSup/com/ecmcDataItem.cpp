@@ -20,6 +20,8 @@ ecmcDataItem::ecmcDataItem(const char *name) {
     callbackObjs_[i]  = NULL;
   }  
   callbackFuncsMaxIndex_ = 0;
+  writtenCallbackFunc_   = NULL;
+  writtenCallbackObj_    = NULL;
   checkIntRange_         = 0;
   intMax_                = 0;
   intMin_                = 0;
@@ -143,9 +145,22 @@ char *ecmcDataItem::getName() {
 int ecmcDataItem::write(uint8_t *data,
                         size_t   bytes) {
   memcpy(dataItem_.data, data, bytes);
+  dataWritten();
   return 0;
 }
 
+void ecmcDataItem::setDataWrittenCallback(ecmcDataWrittenCallback func,
+                                          void* ownerObj) {
+  writtenCallbackObj_  = ownerObj;
+  writtenCallbackFunc_ = func;
+}
+
+void ecmcDataItem::dataWritten() {
+  if(writtenCallbackFunc_) {
+    writtenCallbackFunc_(writtenCallbackObj_);
+  }
+}
+
 int ecmcDataItem::read(uint8_t *data,
                        size_t   bytes) {
   memcpy(data, dataItem_.data, bytes);  
@@ -45,6 +45,12 @@ struct ecmcDataItemInfo{
 */
 typedef void(*ecmcDataUpdatedCallback)(uint8_t*,size_t,ecmcEcDataType,void*);
 
+/**  
+*  Callback prototype to owner of data, called when data is written from
+*  outside ecmc (asyn or plugins). Arg is the object supplied when registered.
+*/
+typedef void(*ecmcDataWrittenCallback)(void*);
+
 /**
 *  Class for generic access to all registered data items in ecmc (base class to asynDataItem).
 *  All ecmc related information is handled in tgis class. All asyn related 
@@ -94,8 +100,12 @@ class ecmcDataItem {
   *   (retuned by regDataUpdatedCallback()) */
   void deregDataUpdatedCallback(int handle);
 
+  /** Register callback to owner of data when data is written (one only) */
+  void setDataWrittenCallback(ecmcDataWrittenCallback func, void* ownerObj);
+
  protected:
   virtual void refresh();
+  void dataWritten();
 
   ecmcDataItemInfo dataItem_;
   int      checkIntRange_;
@@ -107,6 +117,8 @@ class ecmcDataItem {
   ecmcDataUpdatedCallback callbackFuncs_[ECMC_DATA_ITEM_MAX_CALLBACK_FUNCS];
   void* callbackObjs_[ECMC_DATA_ITEM_MAX_CALLBACK_FUNCS];
   int callbackFuncsMaxIndex_;
+  ecmcDataWrittenCallback writtenCallbackFunc_;
+  void* writtenCallbackObj_;
 };
 
 #endif  /* ECMCDATAITEM_H_ */
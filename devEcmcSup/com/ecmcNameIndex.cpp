@@ -0,0 +1,108 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcNameIndex.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcNameIndex.h"
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+ecmcNameIndex::ecmcNameIndex() {
+  names_    = NULL;
+  indices_  = NULL;
+  size_     = 0;
+  maxCount_ = 0;
+  count_    = 0;
+}
+
+ecmcNameIndex::~ecmcNameIndex() {
+  clear();
+}
+
+void ecmcNameIndex::clear() {
+  for (uint32_t i = 0; i < size_; i++) {
+    free(names_[i]);
+  }
+  delete[] names_;
+  delete[] indices_;
+  names_   = NULL;
+  indices_ = NULL;
+  size_    = 0;
+}
+
+void ecmcNameIndex::init(int maxCount) {
+  clear();
+  maxCount_ = maxCount > 0 ? maxCount : 1;
+  count_    = 0;
+  size_     = 1;
+
+  while (size_ < 2 * (uint32_t)maxCount_) {
+    size_ <<= 1;
+  }
+  names_   = new char*[size_];
+  indices_ = new int[size_];
+
+  for (uint32_t i = 0; i < size_; i++) {
+    names_[i]   = NULL;
+    indices_[i] = -1;
+  }
+}
+
+// FNV-1a
+uint32_t ecmcNameIndex::hash(const char *name) {
+  uint32_t hash = 2166136261u;
+
+  while (*name) {
+    hash ^= (uint8_t)*name;
+    hash *= 16777619u;
+    name++;
+  }
+  return hash;
+}
+
+bool ecmcNameIndex::add(const char *name, int index) {
+  if (!name || !names_ || (count_ >= maxCount_)) {
+    return false;
+  }
+  uint32_t mask = size_ - 1;
+  uint32_t slot = hash(name) & mask;
+
+  // Table is at least twice maxCount so always a free slot
+  while (names_[slot]) {
+    if (strcmp(names_[slot], name) == 0) {
+      return true;
+    }
+    slot = (slot + 1) & mask;
+  }
+  names_[slot]   = strdup(name);
+  indices_[slot] = index;
+  count_++;
+  return true;
+}
+
+int ecmcNameIndex::find(const char *name) {
+  if (!name || !names_) {
+    return -1;
+  }
+  uint32_t mask = size_ - 1;
+  uint32_t slot = hash(name) & mask;
+
+  while (names_[slot]) {
+    if (strcmp(names_[slot], name) == 0) {
+      return indices_[slot];
+    }
+    slot = (slot + 1) & mask;
+  }
+  return -1;
+}
+
+int ecmcNameIndex::getCount() {
+  return count_;
+}
@@ -0,0 +1,48 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcNameIndex.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMC_NAME_INDEX_H_
+#define ECMC_NAME_INDEX_H_
+
+#include <stdint.h>
+
+/**
+ * Hash index from name to index in a list (open addressing, FNV-1a hash,
+ * linear probing).
+ *
+ * The max number of names is set in init(). The table is at least twice
+ * that size (power of 2), so it never needs a rehash. If the same name is
+ * added twice the first index is kept. Names are copied.
+ */
+class ecmcNameIndex {
+ public:
+  ecmcNameIndex();
+  ~ecmcNameIndex();
+  void init(int maxCount);
+  // Returns false if full
+  bool add(const char *name,
+           int         index);
+  // Returns index or -1 if not found
+  int  find(const char *name);
+  int  getCount();
+  static uint32_t hash(const char *name);
+
+ private:
+  void clear();
+
+  char       **names_;
+  int         *indices_;
+  uint32_t     size_;
+  int          maxCount_;
+  int          count_;
+};
+
+#endif  /* ECMC_NAME_INDEX_H_ */
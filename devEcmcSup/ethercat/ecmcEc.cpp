@@ -89,6 +89,30 @@ void ecmcEc::initVars() {
     ecAsynParams_[i]=NULL;
   }
   memset(&timeOffset_,0,sizeof(timeOffset_)); 
+
+  for (int i = 0; i < EC_MAX_DOMAINS; i++) {
+    domains_[i]            = NULL;
+    domainsPd_[i]          = NULL;
+    domainsSize_[i]        = 0;
+    domainsRateDivider_[i] = 1;
+    domainsRateOffset_[i]  = 0;
+    domainsWcState_[i]     = EC_WC_ZERO;
+    processImages_[i]      = NULL;
+  }
+  domainCounter_           = 0;
+  domainSelected_          = 0;
+  outputChangeOnly_        = false;
+  outputFullRefreshCycles_ = 1;
+  domainsQueuedMask_    = 0;
+  domainsProcessedMask_ = 0;
+  cycleCounter_         = 0;
+
+  for (int i = 0; i < EC_MAX_SDO_REQUESTS; i++) {
+    sdoRequests_[i] = NULL;
+  }
+  sdoRequestCounter_ = 0;
+  sdoRequestNext_    = 0;
+  configCache_       = NULL;
 }
 
 int ecmcEc::init(int nMasterIndex) {
@@ -119,7 +143,10 @@ int ecmcEc::init(int nMasterIndex) {
                       __LINE__,
                       ERROR_EC_MAIN_CREATE_DOMAIN_FAILED);
   }
-  initDone_    = true;
+  domains_[0]       = domain_;
+  processImages_[0] = new ecmcEcProcessImage();
+  domainCounter_    = 1;
+  initDone_      = true;
   masterIndex_ = nMasterIndex;
 
   return initAsyn(asynPortDriver_);
@@ -147,6 +174,19 @@ ecmcEc::~ecmcEc() {
     delete ecAsynParams_[i];
     ecAsynParams_[i] = NULL;
   }  
+
+  for (int i = 0; i < EC_MAX_DOMAINS; i++) {
+    delete processImages_[i];
+    processImages_[i] = NULL;
+  }
+
+  for (int i = 0; i < EC_MAX_SDO_REQUESTS; i++) {
+    delete sdoRequests_[i];
+    sdoRequests_[i] = NULL;
+  }
+
+  delete configCache_;
+  configCache_ = NULL;
 }
 
 bool ecmcEc::getInitDone() {
@@ -157,6 +197,94 @@ ec_domain_t * ecmcEc::getDomain() {
   return domain_;
 }
 
+int ecmcEc::addDomain(int rateDivider, int rateOffset) {
+  LOGINFO5("%s/%s:%d: INFO: Adding domain %d (rate divider %d, offset %d).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           domainCounter_,
+           rateDivider,
+           rateOffset);
+
+  if (!master_) {
+    LOGERR("%s/%s:%d: ERROR: Master NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_MASTER_NULL);
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, ERROR_EC_MASTER_NULL);
+  }
+
+  if (rateDivider < 1 || rateOffset < 0 || rateOffset >= rateDivider) {
+    LOGERR("%s/%s:%d: ERROR: Invalid domain rate divider or offset (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_DOMAIN_RATE_DIVIDER_INVALID);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_DOMAIN_RATE_DIVIDER_INVALID);
+  }
+
+  if (domainCounter_ >= EC_MAX_DOMAINS) {
+    LOGERR("%s/%s:%d: ERROR: Domain array full (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_DOMAIN_ARRAY_FULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_DOMAIN_ARRAY_FULL);
+  }
+
+  ec_domain_t *domain = ecrt_master_create_domain(master_);
+
+  if (!domain) {
+    LOGERR("%s/%s:%d: ERROR: EtherCAT create domain failed (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_MAIN_CREATE_DOMAIN_FAILED);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_MAIN_CREATE_DOMAIN_FAILED);
+  }
+
+  domains_[domainCounter_]            = domain;
+  processImages_[domainCounter_]      = new ecmcEcProcessImage();
+  domainsRateDivider_[domainCounter_] = rateDivider;
+  domainsRateOffset_[domainCounter_]  = rateOffset;
+
+  // Entries added after this call will be registered in the new domain
+  domainSelected_ = domainCounter_;
+  domainCounter_++;
+  return 0;
+}
+
+int ecmcEc::selectDomain(int domainIndex) {
+  if (domainIndex < 0 || domainIndex >= domainCounter_) {
+    LOGERR("%s/%s:%d: ERROR: Domain index out of range (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_DOMAIN_INDEX_OUT_OF_RANGE);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_DOMAIN_INDEX_OUT_OF_RANGE);
+  }
+
+  domainSelected_ = domainIndex;
+  return 0;
+}
+
+int ecmcEc::getDomainCount() {
+  return domainCounter_;
+}
+
 ec_master_t * ecmcEc::getMaster() {
   return master_;
 }
@@ -269,6 +397,27 @@ int ecmcEc::activate() {
                       __LINE__,
                       ERROR_EC_MAIN_DOMAIN_DATA_FAILED);
   }
+  domainsPd_[0] = domainPd_;
+
+  for (int i = 1; i < domainCounter_; i++) {
+    // Empty domains are never exchanged
+    if (domainsSize_[i] == 0) {
+      continue;
+    }
+
+    if (!(domainsPd_[i] = ecrt_domain_data(domains_[i]))) {
+      LOGERR("%s/%s:%d: ERROR: ecrt_domain_data() failed for domain %d (0x%x).\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             i,
+             ERROR_EC_MAIN_DOMAIN_DATA_FAILED);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_EC_MAIN_DOMAIN_DATA_FAILED);
+    }
+  }
 
   LOGINFO5("%s/%s:%d: INFO: Writing process data offsets to entries.\n",
            __FILE__,
@@ -305,19 +454,95 @@ int ecmcEc::activate() {
       }
 
       if (!tempEntry->getSimEntry()) {
-        tempEntry->setDomainAdr(domainPd_);
-        LOGINFO5("%s/%s:%d: INFO: Entry %s (index = %d): domainAdr: %p.\n",
+        int domainIndex = tempEntry->getDomainIndex();
+        tempEntry->setDomainAdr(domainsPd_[domainIndex]);
+        LOGINFO5("%s/%s:%d: INFO: Entry %s (index = %d): domain %d, domainAdr: %p.\n",
                  __FILE__,
                  __FUNCTION__,
                  __LINE__,
                  tempEntry->getIdentificationName().c_str(),
                  entryIndex,
-                 domainPd_);
+                 domainIndex,
+                 domainsPd_[domainIndex]);
       }
     }
   }
 
-  return validate();
+  int errorCode = validate();
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  errorCode = compileProcessImages();
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  // Configuration valid, store bus config cache for next start
+  if (configCache_ &&
+      (configCache_->getState() == ECMC_EC_CFG_CACHE_RECORDING)) {
+    if (configCache_->save()) {
+      LOGERR("%s/%s:%d: WARNING: Failed to save config cache %s.\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             configCache_->getFileName());
+    }
+    configCache_->setState(ECMC_EC_CFG_CACHE_OFF);
+  }
+  return 0;
+}
+
+/*
+* Build the flat copy tables used for the cyclic process image mapping.
+* Entry addresses must be valid (validate()).
+*/
+int ecmcEc::compileProcessImages() {
+  for (int i = 0; i < domainCounter_; i++) {
+    processImages_[i]->clear();
+  }
+
+  for (int slaveIndex = 0; slaveIndex < slaveCounter_; slaveIndex++) {
+    if (slaveArray_[slaveIndex] == NULL) {
+      LOGERR("%s/%s:%d: ERROR: Slave NULL (0x%x).\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             ERROR_EC_MAIN_SLAVE_NULL);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_EC_MAIN_SLAVE_NULL);
+    }
+    int nEntryCount = slaveArray_[slaveIndex]->getEntryCount();
+
+    for (int entryIndex = 0; entryIndex < nEntryCount; entryIndex++) {
+      ecmcEcEntry *tempEntry = slaveArray_[slaveIndex]->getEntry(entryIndex);
+
+      if (tempEntry == NULL) {
+        continue;
+      }
+      processImages_[tempEntry->getDomainIndex()]->addEntry(tempEntry);
+    }
+  }
+
+  for (int i = 0; i < domainCounter_; i++) {
+    processImages_[i]->setOutputChangeOnly(outputChangeOnly_,
+                                           outputFullRefreshCycles_);
+  }
+
+  for (int i = 0; i < domainCounter_; i++) {
+    LOGINFO5("%s/%s:%d: INFO: Domain %d: %zu entries in process image.\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             i,
+             processImages_[i]->getEntryCount());
+  }
+
+  return 0;
 }
 
 int ecmcEc::compileRegInfo() {
@@ -371,10 +596,16 @@ int ecmcEc::compileRegInfo() {
 
   // Set domain size to MemMap objects to avoid write outside memarea
   domainSize_ = ecrt_domain_size(domain_);
+  domainsSize_[0] = domainSize_;
+
+  for (int i = 1; i < domainCounter_; i++) {
+    domainsSize_[i] = ecrt_domain_size(domains_[i]);
+  }
 
   for (int i = 0; i < ecMemMapArrayCounter_; i++) {
     if (ecMemMapArray_[i]) {
-      ecMemMapArray_[i]->setDomainSize(domainSize_);
+      ecMemMapArray_[i]->setDomainSize(
+        domainsSize_[ecMemMapArray_[i]->getDomainIndex()]);
     }
   }
 
@@ -388,8 +619,25 @@ void ecmcEc::checkDomainState(void) {
 
   ecrt_domain_state(domain_, &domainState_);
 
+  // Additional domains: use latest state for domains not exchanged this cycle
+  bool allDomainsComplete = domainState_.wc_state == EC_WC_COMPLETE;
+  ec_domain_state_t tempState;
+
+  for (int i = 1; i < domainCounter_; i++) {
+    if (domainsSize_[i] == 0) {
+      continue;
+    }
+
+    if (domainsProcessedMask_ & (1 << i)) {
+      ecrt_domain_state(domains_[i], &tempState);
+      domainsWcState_[i] = tempState.wc_state;
+    }
+    allDomainsComplete = allDomainsComplete &&
+                         domainsWcState_[i] == EC_WC_COMPLETE;
+  }
+
   // filter domainOK_ for some cycles
-  if (domainState_.wc_state != EC_WC_COMPLETE) {
+  if (!allDomainsComplete) {
     if (domainNotOKCounter_ <= domainNotOKCyclesLimit_) {
       domainNotOKCounter_++;
     }
@@ -417,7 +665,7 @@ void ecmcEc::checkDomainState(void) {
   statusWordDomain_ = statusWordDomain_ + ((uint16_t)(domainState_.working_counter) << 16);
 
   // Set summary alarm for ethercat
-  ecStatOk_= domainState_.wc_state ==  EC_WC_COMPLETE;
+  ecStatOk_= allDomainsComplete;
 }
 
 bool ecmcEc::checkSlavesConfState() {
@@ -593,6 +841,15 @@ bool ecmcEc::checkState(void) {
 void ecmcEc::receive() {
   ecrt_master_receive(master_);
   ecrt_domain_process(domain_);
+  domainsProcessedMask_ = 1;
+
+  // Only process domains that were queued in previous cycle
+  for (int i = 1; i < domainCounter_; i++) {
+    if (domainsQueuedMask_ & (1 << i)) {
+      ecrt_domain_process(domains_[i]);
+      domainsProcessedMask_ |= 1 << i;
+    }
+  }
   
   // struct timespec timeRel, timeAbs;
   // epicsTimeStamp epicsTime;
@@ -606,17 +863,51 @@ void ecmcEc::receive() {
   //epicsTimeFromTimespec (&epicsTime,&timeAbs);
   //asynPortDriver_->setTimeStamp(&epicsTime);
   
-  updateInputProcessImage();
+  updateInputProcessImage(domainsProcessedMask_);
+
+  if (sdoRequestCounter_ > 0) {
+    executeSdoRequests();
+  }
+}
+
+void ecmcEc::executeSdoRequests() {
+  int active = 0;
+
+  // Poll transfers in progress (state updated by ecrt_master_receive())
+  for (int i = 0; i < sdoRequestCounter_; i++) {
+    active += sdoRequests_[i]->poll();
+  }
+
+  // Start queued transfers, limit mailbox load by max active transfers
+  for (int i = 0; i < sdoRequestCounter_; i++) {
+    int index = (sdoRequestNext_ + i) % sdoRequestCounter_;
+
+    if (sdoRequests_[index]->start(active < EC_MAX_SDO_REQUESTS_ACTIVE)) {
+      active++;
+      sdoRequestNext_ = (index + 1) % sdoRequestCounter_;
+    }
+  }
 }
 
 void ecmcEc::send(timespec timeOffset) {
   timeOffset_=timeOffset;
+
+  // Find domains due for exchange this cycle
+  uint32_t dueMask = 1;
+  for (int i = 1; i < domainCounter_; i++) {
+    if (domainsSize_[i] > 0 &&
+        (cycleCounter_ + domainsRateOffset_[i]) % domainsRateDivider_[i] == 0) {
+      dueMask |= 1 << i;
+    }
+  }
+  cycleCounter_++;
+
   // Write status hardware status to output
   if (statusOutputEntry_) {
     statusOutputEntry_->writeValue((uint64_t)(getErrorID() == 0));
   }
 
-  updateOutProcessImage();
+  updateOutProcessImage(dueMask);
 
   if (useClockRealtime_) {
     clock_gettime(CLOCK_REALTIME, &timeAbs_);
@@ -630,6 +921,14 @@ void ecmcEc::send(timespec timeOffset) {
   ecrt_master_sync_slave_clocks(master_);
   
   ecrt_domain_queue(domain_);
+
+  for (int i = 1; i < domainCounter_; i++) {
+    if (dueMask & (1 << i)) {
+      ecrt_domain_queue(domains_[i]);
+    }
+  }
+  domainsQueuedMask_ = dueMask;
+
   ecrt_master_send(master_);
 
   //Update asyn time
@@ -743,6 +1042,106 @@ int ecmcEc::readSDO(uint16_t  slavePosition,
   return 0;
 }
 
+int ecmcEc::addSdoRequest(uint16_t slavePosition,
+                          uint16_t sdoIndex,
+                          uint8_t  sdoSubIndex,
+                          int      byteSize,
+                          int     *requestIndex) {
+  ecmcEcSlave *slave = findSlave(slavePosition);
+
+  if (!slave) {
+    LOGERR("%s/%s:%d: ERROR: Slave object NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_MAIN_SLAVE_NULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_MAIN_SLAVE_NULL);
+  }
+
+  if (sdoRequestCounter_ >= EC_MAX_SDO_REQUESTS) {
+    LOGERR("%s/%s:%d: ERROR: Sdo request array full (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_SDO_REQUEST_ARRAY_FULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_SDO_REQUEST_ARRAY_FULL);
+  }
+
+  ecmcEcSdoRequest *request = new ecmcEcSdoRequest(asynPortDriver_,
+                                                   masterIndex_,
+                                                   slave->getSlaveConfig(),
+                                                   slavePosition,
+                                                   sdoRequestCounter_,
+                                                   sdoIndex,
+                                                   sdoSubIndex,
+                                                   (size_t)byteSize);
+  int errorCode = request->getErrorID();
+
+  if (errorCode) {
+    delete request;
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
+
+  // Only read by ecmc_rt after counter is incremented
+  sdoRequests_[sdoRequestCounter_] = request;
+  *requestIndex = sdoRequestCounter_;
+  sdoRequestCounter_++;
+  return 0;
+}
+
+ecmcEcSdoRequest * ecmcEc::getSdoRequest(int requestIndex) {
+  if ((requestIndex < 0) || (requestIndex >= sdoRequestCounter_)) {
+    return NULL;
+  }
+  return sdoRequests_[requestIndex];
+}
+
+int ecmcEc::initConfigCache(const char *fileName, bool *loaded) {
+  *loaded = false;
+
+  if (!master_) {
+    LOGERR("%s/%s:%d: ERROR: Master NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_MASTER_NULL);
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, ERROR_EC_MASTER_NULL);
+  }
+
+  // All configuration commands must pass the cache
+  if (configCache_ || (slaveCounter_ > 0)) {
+    LOGERR("%s/%s:%d: ERROR: Config cache must be defined once, before slaves are added (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_CFG_CACHE_ALREADY_DEFINED);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_CFG_CACHE_ALREADY_DEFINED);
+  }
+
+  configCache_ = new ecmcEcConfigCache(master_, fileName);
+
+  if (configCache_->load() == 0) {
+    *loaded = true;
+    return 0;
+  }
+
+  configCache_->setState(ECMC_EC_CFG_CACHE_RECORDING);
+  return 0;
+}
+
+ecmcEcConfigCache * ecmcEc::getConfigCache() {
+  return configCache_;
+}
+
 int ecmcEc::readSoE(uint16_t  slavePosition, /**< Slave position. */
                     uint8_t   driveNo, /**< Drive number. */
                     uint16_t  idn, /**< SoE IDN (see ecrt_slave_config_idn()). */
@@ -809,15 +1208,16 @@ int ecmcEc::writeSoE(uint16_t  slavePosition, /**< Slave position. */
    return errorCode;
 }
 
-int ecmcEc::updateInputProcessImage() {
-  for (int i = 0; i < slaveCounter_; i++) {
-    if (slaveArray_[i] != NULL) {
-      slaveArray_[i]->updateInputProcessImage();
+int ecmcEc::updateInputProcessImage(uint32_t domainMask) {
+  for (int i = 0; i < domainCounter_; i++) {
+    if (domainMask & (1 << i)) {
+      processImages_[i]->updateInputProcessImage();
     }
   }
 
   for (int i = 0; i < ecMemMapArrayCounter_; i++) {
-    if (ecMemMapArray_[i] != NULL) {
+    if (ecMemMapArray_[i] != NULL &&
+        (domainMask & (1 << ecMemMapArray_[i]->getDomainIndex()))) {
       ecMemMapArray_[i]->updateInputProcessImage();
     }
   }
@@ -825,15 +1225,16 @@ int ecmcEc::updateInputProcessImage() {
   return 0;
 }
 
-int ecmcEc::updateOutProcessImage() {
-  for (int i = 0; i < slaveCounter_; i++) {
-    if (slaveArray_[i] != NULL) {
-      slaveArray_[i]->updateOutProcessImage();
+int ecmcEc::updateOutProcessImage(uint32_t domainMask) {
+  for (int i = 0; i < domainCounter_; i++) {
+    if (domainMask & (1 << i)) {
+      processImages_[i]->updateOutProcessImage();
     }
   }
 
   for (int i = 0; i < ecMemMapArrayCounter_; i++) {
-    if (ecMemMapArray_[i] != NULL) {
+    if (ecMemMapArray_[i] != NULL &&
+        (domainMask & (1 << ecMemMapArray_[i]->getDomainIndex()))) {
       ecMemMapArray_[i]->updateOutProcessImage();
     }
   }
@@ -898,7 +1299,9 @@ int ecmcEc::addEntry(
                                   entrySubIndex,
                                   dt,
                                   id,
-                                  useInRealTime);
+                                  useInRealTime,
+                                  domains_[domainSelected_],
+                                  domainSelected_);
 
   if (errorCode) {
     return errorCode;
@@ -1055,6 +1458,25 @@ int ecmcEc::setDomainFailedCyclesLimitInterlock(int cycles) {
   return 0;
 }
 
+int ecmcEc::setOutputChangeOnly(bool changeOnly, int fullRefreshCycles) {
+  if (fullRefreshCycles < 1) {
+    LOGERR("%s/%s:%d: ERROR: Invalid full refresh cycles (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_FULL_REFRESH_CYCLES_INVALID);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_FULL_REFRESH_CYCLES_INVALID);
+  }
+
+  // Applied to process images at activation
+  outputChangeOnly_        = changeOnly;
+  outputFullRefreshCycles_ = fullRefreshCycles;
+  return 0;
+}
+
 void ecmcEc::slowExecute() {
   LOGINFO5(
     "%s/%s:%d: INFO: MasterOK: %d, SlavesOK: %d, DomainOK: %d, DomainNotOKCounter: %d, DomainNotOKLimit: %d, Error Code:0x%x .\n",
@@ -2007,6 +2429,10 @@ uint64_t ecmcEc::getTimeNs() {
   return TIMESPEC2NS(timeAbs);
 }
 
+uint64_t ecmcEc::getDcTimeNs() {
+  return TIMESPEC2NS(timeAbs_);
+}
+
 uint32_t ecmcEc::getSlaveVendorId(uint16_t alias,  /**< Slave alias. */
                                   uint16_t slavePos   /**< Slave position. */){
 
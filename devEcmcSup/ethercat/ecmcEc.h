@@ -21,8 +21,11 @@
 #include "../com/ecmcAsynPortDriver.h"
 #include "ecmcEcEntry.h"
 #include "ecmcEcSDO.h"
+#include "ecmcEcSdoRequest.h"
+#include "ecmcEcConfigCache.h"
 #include "ecmcEcSlave.h"
 #include "ecmcEcMemMap.h"
+#include "ecmcEcProcessImage.h"
 
 // EC ERRORS
 #define ERROR_EC_MAIN_REQUEST_FAILED 0x26000
@@ -67,6 +70,10 @@
 #define ERROR_EC_SLAVE_VERIFICATION_FAIL 0x26026
 #define ERROR_EC_NO_VALID_CONFIG 0x26027
 #define ERROR_EC_DATATYPE_NOT_VALID 0x26028
+#define ERROR_EC_DOMAIN_INDEX_OUT_OF_RANGE 0x26029
+#define ERROR_EC_DOMAIN_RATE_DIVIDER_INVALID 0x2602A
+#define ERROR_EC_DOMAIN_ARRAY_FULL 0x2602B
+#define ERROR_EC_FULL_REFRESH_CYCLES_INVALID 0x2602C
 
 class ecmcEc : public ecmcError {
  public:
@@ -80,6 +87,10 @@ class ecmcEc : public ecmcError {
     uint32_t productCode  /**< Expected product code. */);
   ecmcEcSlave* getSlave(int slave);  // NOTE: index not bus position
   ec_domain_t* getDomain();
+  int          addDomain(int rateDivider,
+                         int rateOffset);
+  int          selectDomain(int domainIndex);
+  int          getDomainCount();
   ec_master_t* getMaster();
   int          getMasterIndex();
   bool         getInitDone();
@@ -118,6 +129,13 @@ class ecmcEc : public ecmcError {
                         uint8_t     sdoSubIndex,
                         const char* dataBuffer,
                         int         byteSize);
+  // Non blocking sdo access (transfers handled in receive())
+  int addSdoRequest(uint16_t slavePosition,
+                    uint16_t sdoIndex,
+                    uint8_t  sdoSubIndex,
+                    int      byteSize,
+                    int     *requestIndex);
+  ecmcEcSdoRequest* getSdoRequest(int requestIndex);
   int readSoE(uint16_t  slavePosition, /**< Slave position. */
               uint8_t   driveNo, /**< Drive number. */
               uint16_t  idn, /**< SoE IDN (see ecrt_slave_config_idn()). */
@@ -157,6 +175,8 @@ class ecmcEc : public ecmcError {
                                int *slaveIndex);
   int           statusOK();
   int           setDomainFailedCyclesLimitInterlock(int cycles);
+  int           setOutputChangeOnly(bool changeOnly,
+                                    int  fullRefreshCycles);
   void          slowExecute();
   int           reset();
   int           setEcStatusOutputEntry(ecmcEcEntry *entry);
@@ -172,6 +192,8 @@ class ecmcEc : public ecmcError {
 
   int           checkReadyForRuntime();
   uint64_t      getTimeNs();
+  // Application time sent to the DC reference clock in last send [ns]
+  uint64_t      getDcTimeNs();
     
   uint32_t      getSlaveVendorId(uint16_t alias,  /**< Slave alias. */
                                  uint16_t slavePos   /**< Slave position. */);
@@ -182,14 +204,20 @@ class ecmcEc : public ecmcError {
   uint32_t      getSlaveSerialNum(uint16_t alias,  /**< Slave alias. */
                                   uint16_t slavePos   /**< Slave position. */);
   int           useClockRealtime(bool useClkRT);
+  // Bus config cache (loaded set if valid cache found, apply in ecmcEthercat)
+  int           initConfigCache(const char *fileName,
+                                bool       *loaded);
+  ecmcEcConfigCache* getConfigCache();
 
 private:
   void     initVars();
-  int      updateInputProcessImage();
-  int      updateOutProcessImage();
+  int      updateInputProcessImage(uint32_t domainMask);
+  int      updateOutProcessImage(uint32_t domainMask);
+  int      compileProcessImages();
   timespec timespecAdd(timespec time1,
                        timespec time2);
   bool     validEntryType(ecmcEcDataType dt);
+  void     executeSdoRequests();
   ec_master_t *master_;
   ec_domain_t *domain_;
   ec_domain_state_t domainStateOld_;
@@ -227,6 +255,29 @@ private:
   uint32_t statusWordDomain_;
   int ecStatOk_; 
 
+  // Domain 0 (domain_) is always exchanged every cycle. Additional domains
+  // are exchanged every rateDivider cycle (offset by rateOffset cycles).
+  ec_domain_t  *domains_[EC_MAX_DOMAINS];
+  uint8_t      *domainsPd_[EC_MAX_DOMAINS];
+  size_t        domainsSize_[EC_MAX_DOMAINS];
+  int           domainsRateDivider_[EC_MAX_DOMAINS];
+  int           domainsRateOffset_[EC_MAX_DOMAINS];
+  ec_wc_state_t domainsWcState_[EC_MAX_DOMAINS];
+  ecmcEcProcessImage *processImages_[EC_MAX_DOMAINS];
+  bool          outputChangeOnly_;
+  int           outputFullRefreshCycles_;
+  int           domainCounter_;
+  int           domainSelected_;
+  uint32_t      domainsQueuedMask_;
+  uint32_t      domainsProcessedMask_;
+  uint32_t      cycleCounter_;
+
+  ecmcEcSdoRequest *sdoRequests_[EC_MAX_SDO_REQUESTS];
+  int               sdoRequestCounter_;
+  // Next request to start (round robin between queued requests)
+  int               sdoRequestNext_;
+  ecmcEcConfigCache *configCache_;
+
   ecmcAsynPortDriver *asynPortDriver_;
   ecmcAsynDataItem  *ecAsynParams_[ECMC_ASYN_EC_PAR_COUNT];
   timespec timeOffset_;
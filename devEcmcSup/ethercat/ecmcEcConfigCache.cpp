@@ -0,0 +1,392 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcEcConfigCache.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcEcConfigCache.h"
+#include <errno.h>
+#include <string.h>
+#include "../main/ecmcErrorsList.h"
+
+/*
+ * File layout (native byte order):
+ *   char[8]  magic
+ *   uint32   version
+ *   uint32   slave count
+ *   uint32   record count
+ *   slaves:  uint32 vendor id, product code, revision
+ *   records: int32 op, int32 arg count, int64 args[arg count],
+ *            ECMC_EC_CFG_CACHE_MAX_STRINGS * (uint32 length, chars)
+ *   uint32   checksum (FNV-1a of all preceding bytes)
+ */
+
+static uint32_t cacheChecksum(const char *data, size_t bytes) {
+  uint32_t hash = 2166136261u;
+
+  for (size_t i = 0; i < bytes; i++) {
+    hash ^= (uint8_t)data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+static void cacheAppend(std::string *buffer, const void *data, size_t bytes) {
+  buffer->append((const char *)data, bytes);
+}
+
+static bool cacheExtract(const std::string &buffer,
+                         size_t            *pos,
+                         void              *data,
+                         size_t             bytes) {
+  if (*pos + bytes > buffer.size()) {
+    return false;
+  }
+  memcpy(data, buffer.data() + *pos, bytes);
+  *pos += bytes;
+  return true;
+}
+
+ecmcEcConfigCache::ecmcEcConfigCache(ec_master_t *master,
+                                     const char  *fileName) {
+  initVars();
+  master_   = master;
+  fileName_ = fileName;
+}
+
+ecmcEcConfigCache::~ecmcEcConfigCache() {}
+
+void ecmcEcConfigCache::initVars() {
+  errorReset();
+  master_     = NULL;
+  state_      = ECMC_EC_CFG_CACHE_OFF;
+  checkIndex_ = 0;
+}
+
+int ecmcEcConfigCache::scanBus(std::vector<ecmcEcCfgCacheSlave> *slaves) {
+  ec_master_info_t masterInfo;
+  ec_slave_info_t  slaveInfo;
+
+  if (!master_ || ecrt_master(master_, &masterInfo)) {
+    LOGERR("%s/%s:%d: ERROR: Failed to read master info (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_EC_CFG_CACHE_BUS_SCAN_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_CFG_CACHE_BUS_SCAN_FAIL);
+  }
+
+  slaves->clear();
+
+  for (unsigned int i = 0; i < masterInfo.slave_count; i++) {
+    if (ecrt_master_get_slave(master_, i, &slaveInfo)) {
+      LOGERR("%s/%s:%d: ERROR: Failed to read info of slave %u (0x%x).\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             i,
+             ERROR_EC_CFG_CACHE_BUS_SCAN_FAIL);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_EC_CFG_CACHE_BUS_SCAN_FAIL);
+    }
+    ecmcEcCfgCacheSlave slave;
+    slave.vendorId    = slaveInfo.vendor_id;
+    slave.productCode = slaveInfo.product_code;
+    slave.revisionNum = slaveInfo.revision_number;
+    slaves->push_back(slave);
+  }
+  return 0;
+}
+
+int ecmcEcConfigCache::load() {
+  FILE *file = fopen(fileName_.c_str(), "rb");
+
+  if (!file) {
+    LOGINFO4("%s/%s:%d: INFO: No config cache %s (%s).\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             fileName_.c_str(),
+             strerror(errno));
+    return ERROR_EC_CFG_CACHE_FILE_OPEN_FAIL;
+  }
+
+  std::string buffer;
+  char        chunk[4096];
+  size_t      bytes = 0;
+
+  while ((bytes = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    buffer.append(chunk, bytes);
+  }
+  fclose(file);
+
+  size_t   pos = 0;
+  char     magic[8];
+  uint32_t version     = 0;
+  uint32_t slaveCount  = 0;
+  uint32_t recordCount = 0;
+  uint32_t checksum    = 0;
+  bool     valid       = buffer.size() > sizeof(checksum);
+
+  if (valid) {
+    memcpy(&checksum, buffer.data() + buffer.size() - sizeof(checksum),
+           sizeof(checksum));
+    buffer.resize(buffer.size() - sizeof(checksum));
+    valid = checksum == cacheChecksum(buffer.data(), buffer.size()) &&
+            cacheExtract(buffer, &pos, magic, sizeof(magic)) &&
+            memcmp(magic, ECMC_EC_CFG_CACHE_MAGIC, sizeof(magic)) == 0 &&
+            cacheExtract(buffer, &pos, &version, sizeof(version)) &&
+            version == ECMC_EC_CFG_CACHE_VERSION &&
+            cacheExtract(buffer, &pos, &slaveCount, sizeof(slaveCount)) &&
+            cacheExtract(buffer, &pos, &recordCount, sizeof(recordCount));
+  }
+
+  std::vector<ecmcEcCfgCacheSlave> slaves;
+
+  for (uint32_t i = 0; valid && i < slaveCount; i++) {
+    ecmcEcCfgCacheSlave slave;
+    valid = cacheExtract(buffer, &pos, &slave, sizeof(slave));
+    slaves.push_back(slave);
+  }
+
+  std::vector<ecmcEcCfgCacheRecord> records;
+
+  for (uint32_t i = 0; valid && i < recordCount; i++) {
+    ecmcEcCfgCacheRecord record;
+    memset(record.args, 0, sizeof(record.args));
+    valid = cacheExtract(buffer, &pos, &record.op, sizeof(record.op)) &&
+            cacheExtract(buffer, &pos, &record.argCount,
+                         sizeof(record.argCount)) &&
+            record.argCount >= 0 &&
+            record.argCount <= ECMC_EC_CFG_CACHE_MAX_ARGS &&
+            cacheExtract(buffer, &pos, record.args,
+                         sizeof(int64_t) * record.argCount);
+
+    for (int j = 0; valid && j < ECMC_EC_CFG_CACHE_MAX_STRINGS; j++) {
+      uint32_t length = 0;
+      valid = cacheExtract(buffer, &pos, &length, sizeof(length)) &&
+              pos + length <= buffer.size();
+
+      if (valid) {
+        record.str[j].assign(buffer.data() + pos, length);
+        pos += length;
+      }
+    }
+    records.push_back(record);
+  }
+
+  if (!valid || (pos != buffer.size())) {
+    LOGERR("%s/%s:%d: WARNING: Config cache %s invalid, rebuilding (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           fileName_.c_str(),
+           ERROR_EC_CFG_CACHE_FILE_INVALID);
+    return ERROR_EC_CFG_CACHE_FILE_INVALID;
+  }
+
+  std::vector<ecmcEcCfgCacheSlave> busSlaves;
+  int errorCode = scanBus(&busSlaves);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  bool match = busSlaves.size() == slaves.size();
+
+  for (size_t i = 0; match && i < slaves.size(); i++) {
+    match = busSlaves[i].vendorId == slaves[i].vendorId &&
+            busSlaves[i].productCode == slaves[i].productCode &&
+            busSlaves[i].revisionNum == slaves[i].revisionNum;
+  }
+
+  if (!match) {
+    LOGERR("%s/%s:%d: WARNING: Bus differs from config cache %s, rebuilding (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           fileName_.c_str(),
+           ERROR_EC_CFG_CACHE_BUS_MISMATCH);
+    return ERROR_EC_CFG_CACHE_BUS_MISMATCH;
+  }
+
+  records_.swap(records);
+  checkIndex_ = 0;
+  return 0;
+}
+
+int ecmcEcConfigCache::save() {
+  std::vector<ecmcEcCfgCacheSlave> slaves;
+  int errorCode = scanBus(&slaves);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  std::string buffer;
+  uint32_t    version     = ECMC_EC_CFG_CACHE_VERSION;
+  uint32_t    slaveCount  = (uint32_t)slaves.size();
+  uint32_t    recordCount = (uint32_t)records_.size();
+
+  cacheAppend(&buffer, ECMC_EC_CFG_CACHE_MAGIC, 8);
+  cacheAppend(&buffer, &version, sizeof(version));
+  cacheAppend(&buffer, &slaveCount, sizeof(slaveCount));
+  cacheAppend(&buffer, &recordCount, sizeof(recordCount));
+
+  for (size_t i = 0; i < slaves.size(); i++) {
+    cacheAppend(&buffer, &slaves[i], sizeof(slaves[i]));
+  }
+
+  for (size_t i = 0; i < records_.size(); i++) {
+    const ecmcEcCfgCacheRecord *record = &records_[i];
+    cacheAppend(&buffer, &record->op, sizeof(record->op));
+    cacheAppend(&buffer, &record->argCount, sizeof(record->argCount));
+    cacheAppend(&buffer, record->args, sizeof(int64_t) * record->argCount);
+
+    for (int j = 0; j < ECMC_EC_CFG_CACHE_MAX_STRINGS; j++) {
+      uint32_t length = (uint32_t)record->str[j].size();
+      cacheAppend(&buffer, &length, sizeof(length));
+      cacheAppend(&buffer, record->str[j].data(), length);
+    }
+  }
+
+  uint32_t checksum = cacheChecksum(buffer.data(), buffer.size());
+  cacheAppend(&buffer, &checksum, sizeof(checksum));
+
+  // Write to temporary file and rename to never leave a partial cache
+  std::string tempFileName = fileName_ + ".tmp";
+  FILE *file = fopen(tempFileName.c_str(), "wb");
+
+  if (!file) {
+    LOGERR("%s/%s:%d: ERROR: Failed to open %s (%s) (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           tempFileName.c_str(),
+           strerror(errno),
+           ERROR_EC_CFG_CACHE_FILE_OPEN_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_CFG_CACHE_FILE_OPEN_FAIL);
+  }
+
+  bool written = fwrite(buffer.data(), 1, buffer.size(), file) == buffer.size();
+  written = (fclose(file) == 0) && written;
+
+  if (!written || rename(tempFileName.c_str(), fileName_.c_str())) {
+    remove(tempFileName.c_str());
+    LOGERR("%s/%s:%d: ERROR: Failed to write %s (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           fileName_.c_str(),
+           ERROR_EC_CFG_CACHE_FILE_WRITE_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_CFG_CACHE_FILE_WRITE_FAIL);
+  }
+
+  LOGINFO4("%s/%s:%d: INFO: Config cache %s saved (%zu slaves, %zu commands).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           fileName_.c_str(),
+           slaves.size(),
+           records_.size());
+  return 0;
+}
+
+bool ecmcEcConfigCache::compare(const ecmcEcCfgCacheRecord *record1,
+                                const ecmcEcCfgCacheRecord *record2) {
+  if ((record1->op != record2->op) ||
+      (record1->argCount != record2->argCount)) {
+    return false;
+  }
+
+  for (int i = 0; i < record1->argCount; i++) {
+    if (record1->args[i] != record2->args[i]) {
+      return false;
+    }
+  }
+
+  for (int i = 0; i < ECMC_EC_CFG_CACHE_MAX_STRINGS; i++) {
+    if (record1->str[i] != record2->str[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int ecmcEcConfigCache::handle(const ecmcEcCfgCacheRecord *record,
+                              bool                       *skip) {
+  *skip = false;
+
+  switch (state_) {
+  case ECMC_EC_CFG_CACHE_RECORDING:
+    records_.push_back(*record);
+    break;
+
+  case ECMC_EC_CFG_CACHE_LOADED:
+
+    if ((checkIndex_ >= records_.size()) ||
+        !compare(record, &records_[checkIndex_])) {
+      LOGERR("%s/%s:%d: ERROR: Command %zu differs from config cache %s. Remove the file to rebuild the cache (0x%x).\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             checkIndex_,
+             fileName_.c_str(),
+             ERROR_EC_CFG_CACHE_CONFIG_MISMATCH);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_EC_CFG_CACHE_CONFIG_MISMATCH);
+    }
+    checkIndex_++;
+    *skip = true;
+    break;
+
+  default:
+    break;
+  }
+  return 0;
+}
+
+int ecmcEcConfigCache::getState() {
+  return state_;
+}
+
+void ecmcEcConfigCache::setState(int state) {
+  state_ = state;
+
+  if (state_ == ECMC_EC_CFG_CACHE_RECORDING) {
+    records_.clear();
+  }
+}
+
+size_t ecmcEcConfigCache::getRecordCount() {
+  return records_.size();
+}
+
+const ecmcEcCfgCacheRecord * ecmcEcConfigCache::getRecord(size_t index) {
+  if (index >= records_.size()) {
+    return NULL;
+  }
+  return &records_[index];
+}
+
+const char * ecmcEcConfigCache::getFileName() {
+  return fileName_.c_str();
+}
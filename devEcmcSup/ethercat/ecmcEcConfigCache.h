@@ -0,0 +1,128 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcEcConfigCache.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCECCONFIGCACHE_H_
+#define ECMCECCONFIGCACHE_H_
+
+#include <string>
+#include <vector>
+#include "stdio.h"
+#include "ecrt.h"
+#include "../main/ecmcDefinitions.h"
+#include "../main/ecmcError.h"
+
+// ECCONFIGCACHE
+#define ERROR_EC_CFG_CACHE_FILE_OPEN_FAIL 0x26100
+#define ERROR_EC_CFG_CACHE_FILE_WRITE_FAIL 0x26101
+#define ERROR_EC_CFG_CACHE_FILE_INVALID 0x26102
+#define ERROR_EC_CFG_CACHE_BUS_MISMATCH 0x26103
+#define ERROR_EC_CFG_CACHE_CONFIG_MISMATCH 0x26104
+#define ERROR_EC_CFG_CACHE_BUS_SCAN_FAIL 0x26105
+#define ERROR_EC_CFG_CACHE_ALREADY_DEFINED 0x26106
+#define ERROR_EC_CFG_CACHE_REPLAY_FAIL 0x26107
+
+#define ECMC_EC_CFG_CACHE_MAGIC "ECMCBUSC"
+#define ECMC_EC_CFG_CACHE_VERSION 1
+#define ECMC_EC_CFG_CACHE_MAX_ARGS 12
+#define ECMC_EC_CFG_CACHE_MAX_STRINGS 3
+
+enum ecmcEcCfgCacheState {
+  ECMC_EC_CFG_CACHE_OFF       = 0,
+  // No valid cache, commands are recorded and saved after activation
+  ECMC_EC_CFG_CACHE_RECORDING = 1,
+  // Cached commands are applied
+  ECMC_EC_CFG_CACHE_REPLAYING = 2,
+  // Cache applied, commands still issued are checked against the cache
+  ECMC_EC_CFG_CACHE_LOADED    = 3,
+};
+
+// Cached configuration commands (ecmcEthercat.h)
+enum ecmcEcCfgCacheOp {
+  ECMC_EC_CFG_OP_ADD_DOMAIN              = 1,
+  ECMC_EC_CFG_OP_SELECT_DOMAIN           = 2,
+  ECMC_EC_CFG_OP_ADD_SLAVE               = 3,
+  ECMC_EC_CFG_OP_SLAVE_CONFIG_DC         = 4,
+  ECMC_EC_CFG_OP_SELECT_REFERENCE_DC     = 5,
+  ECMC_EC_CFG_OP_ADD_SYNC_MANAGER        = 6,
+  ECMC_EC_CFG_OP_ADD_PDO                 = 7,
+  ECMC_EC_CFG_OP_ADD_ENTRY_COMPLETE      = 8,
+  ECMC_EC_CFG_OP_ADD_ENTRY               = 9,
+  ECMC_EC_CFG_OP_SET_ENTRY_UPDATE_IN_RT  = 10,
+  ECMC_EC_CFG_OP_ADD_MEM_MAP_DT          = 11,
+  ECMC_EC_CFG_OP_ADD_MEM_MAP             = 12,
+  ECMC_EC_CFG_OP_ADD_SDO                 = 13,
+  ECMC_EC_CFG_OP_ADD_SDO_COMPLETE        = 14,
+  ECMC_EC_CFG_OP_ADD_SDO_BUFFER          = 15,
+  ECMC_EC_CFG_OP_ADD_SDO_REQUEST         = 16,
+  ECMC_EC_CFG_OP_SLAVE_CONFIG_WATCHDOG   = 17,
+  ECMC_EC_CFG_OP_VERIFY_SLAVE            = 18,
+  ECMC_EC_CFG_OP_LINK_EC_STATUS_OUTPUT   = 19,
+};
+
+typedef struct {
+  int32_t     op;
+  int32_t     argCount;
+  int64_t     args[ECMC_EC_CFG_CACHE_MAX_ARGS];
+  std::string str[ECMC_EC_CFG_CACHE_MAX_STRINGS];
+} ecmcEcCfgCacheRecord;
+
+typedef struct {
+  uint32_t vendorId;
+  uint32_t productCode;
+  uint32_t revisionNum;
+} ecmcEcCfgCacheSlave;
+
+/**
+ * Binary cache of the EtherCAT bus configuration.
+ *
+ * The resolved configuration commands (slaves, entries, sdo init lists,
+ * memmaps, domains..) are recorded while configuring and saved to file
+ * together with the identity (vendor id, product code, revision) of all
+ * slaves on the bus when the master has been activated successfully.
+ *
+ * At next start the file is loaded if it is valid and the bus still
+ * matches. The recorded commands are then applied directly (no parsing,
+ * see ecmcEthercat.cpp) and the startup scripts can skip the hardware
+ * configuration. Configuration commands issued after a cache has been
+ * applied must match the cache (in order) and are skipped, otherwise an
+ * error is returned (remove the cache file to rebuild it).
+ */
+class ecmcEcConfigCache : public ecmcError {
+ public:
+  ecmcEcConfigCache(ec_master_t *master,
+                    const char  *fileName);
+  ~ecmcEcConfigCache();
+  // Load file and compare with bus (0 if valid and matching)
+  int                         load();
+  int                         save();
+  // Record (or check against loaded cache). skip set if already applied.
+  int                         handle(const ecmcEcCfgCacheRecord *record,
+                                     bool                       *skip);
+  int                         getState();
+  void                        setState(int state);
+  size_t                      getRecordCount();
+  const ecmcEcCfgCacheRecord* getRecord(size_t index);
+  const char*                 getFileName();
+
+ private:
+  void initVars();
+  int  scanBus(std::vector<ecmcEcCfgCacheSlave> *slaves);
+  bool compare(const ecmcEcCfgCacheRecord *record1,
+               const ecmcEcCfgCacheRecord *record2);
+  ec_master_t                      *master_;
+  std::string                       fileName_;
+  int                               state_;
+  std::vector<ecmcEcCfgCacheRecord> records_;
+  // Next loaded record to check (ECMC_EC_CFG_CACHE_LOADED)
+  size_t                            checkIndex_;
+};
+
+#endif  /* ECMCECCONFIGCACHE_H_ */
@@ -0,0 +1,140 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcEcCopyTable.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcEcCopyTable.h"
+
+// Read all entries in table with EC_READ_X macro
+#define ECMC_COPY_TABLE_IN(TABLE, EC_READ_X)                  \
+  do {                                                        \
+    uint8_t  **adr   = (TABLE).adr.data();                    \
+    uint64_t **buf   = (TABLE).buf.data();                    \
+    size_t     count = (TABLE).adr.size();                    \
+    for (size_t i = 0; i < count; i++) {                      \
+      *buf[i] = (uint64_t)EC_READ_X(adr[i]);                  \
+    }                                                         \
+  } while (0)
+
+// Write all entries in table with EC_WRITE_X macro
+#define ECMC_COPY_TABLE_OUT(TABLE, EC_WRITE_X)                \
+  do {                                                        \
+    uint8_t  **adr   = (TABLE).adr.data();                    \
+    uint64_t **buf   = (TABLE).buf.data();                    \
+    size_t     count = (TABLE).adr.size();                    \
+    for (size_t i = 0; i < count; i++) {                      \
+      EC_WRITE_X(adr[i], *buf[i]);                            \
+    }                                                         \
+  } while (0)
+
+void ecmcEcCopyTableClear(ecmcEcCopyTable *table) {
+  table->adr.clear();
+  table->buf.clear();
+  table->bitOffset.clear();
+}
+
+void ecmcEcCopyTableAdd(ecmcEcCopyTable *table,
+                        uint8_t         *adr,
+                        uint64_t        *buf,
+                        unsigned int     bitOffset) {
+  table->adr.push_back(adr);
+  table->buf.push_back(buf);
+  table->bitOffset.push_back(bitOffset);
+}
+
+void ecmcEcCopyTablesIn(ecmcEcCopyTable *tables) {
+  // 1 bit entries
+  uint8_t     **adr    = tables[ECMC_EC_B1].adr.data();
+  uint64_t    **buf    = tables[ECMC_EC_B1].buf.data();
+  unsigned int *bitOff = tables[ECMC_EC_B1].bitOffset.data();
+  size_t        count  = tables[ECMC_EC_B1].adr.size();
+
+  for (size_t i = 0; i < count; i++) {
+    *buf[i] = (uint64_t)EC_READ_BIT(adr[i], bitOff[i]);
+  }
+
+  ECMC_COPY_TABLE_IN(tables[ECMC_EC_U8], EC_READ_U8);
+  ECMC_COPY_TABLE_IN(tables[ECMC_EC_S8], EC_READ_S8);
+  ECMC_COPY_TABLE_IN(tables[ECMC_EC_U16], EC_READ_U16);
+  ECMC_COPY_TABLE_IN(tables[ECMC_EC_S16], EC_READ_S16);
+  ECMC_COPY_TABLE_IN(tables[ECMC_EC_U32], EC_READ_U32);
+  ECMC_COPY_TABLE_IN(tables[ECMC_EC_S32], EC_READ_S32);
+#ifdef EC_READ_U64
+  ECMC_COPY_TABLE_IN(tables[ECMC_EC_U64], EC_READ_U64);
+#endif
+#ifdef EC_READ_S64
+  ECMC_COPY_TABLE_IN(tables[ECMC_EC_S64], EC_READ_S64);
+#endif
+
+#ifdef EC_READ_REAL
+  adr   = tables[ECMC_EC_F32].adr.data();
+  buf   = tables[ECMC_EC_F32].buf.data();
+  count = tables[ECMC_EC_F32].adr.size();
+
+  for (size_t i = 0; i < count; i++) {
+    *buf[i]          = 0;
+    *(float *)buf[i] = EC_READ_REAL(adr[i]);
+  }
+#endif
+
+#ifdef EC_READ_LREAL
+  adr   = tables[ECMC_EC_F64].adr.data();
+  buf   = tables[ECMC_EC_F64].buf.data();
+  count = tables[ECMC_EC_F64].adr.size();
+
+  for (size_t i = 0; i < count; i++) {
+    *(double *)buf[i] = EC_READ_LREAL(adr[i]);
+  }
+#endif
+}
+
+void ecmcEcCopyTablesOut(ecmcEcCopyTable *tables) {
+  // 1 bit entries
+  uint8_t     **adr    = tables[ECMC_EC_B1].adr.data();
+  uint64_t    **buf    = tables[ECMC_EC_B1].buf.data();
+  unsigned int *bitOff = tables[ECMC_EC_B1].bitOffset.data();
+  size_t        count  = tables[ECMC_EC_B1].adr.size();
+
+  for (size_t i = 0; i < count; i++) {
+    EC_WRITE_BIT(adr[i], bitOff[i], *buf[i]);
+  }
+
+  ECMC_COPY_TABLE_OUT(tables[ECMC_EC_U8], EC_WRITE_U8);
+  ECMC_COPY_TABLE_OUT(tables[ECMC_EC_S8], EC_WRITE_S8);
+  ECMC_COPY_TABLE_OUT(tables[ECMC_EC_U16], EC_WRITE_U16);
+  ECMC_COPY_TABLE_OUT(tables[ECMC_EC_S16], EC_WRITE_S16);
+  ECMC_COPY_TABLE_OUT(tables[ECMC_EC_U32], EC_WRITE_U32);
+  ECMC_COPY_TABLE_OUT(tables[ECMC_EC_S32], EC_WRITE_S32);
+#ifdef EC_WRITE_U64
+  ECMC_COPY_TABLE_OUT(tables[ECMC_EC_U64], EC_WRITE_U64);
+#endif
+#ifdef EC_WRITE_S64
+  ECMC_COPY_TABLE_OUT(tables[ECMC_EC_S64], EC_WRITE_S64);
+#endif
+
+#ifdef EC_WRITE_REAL
+  adr   = tables[ECMC_EC_F32].adr.data();
+  buf   = tables[ECMC_EC_F32].buf.data();
+  count = tables[ECMC_EC_F32].adr.size();
+
+  for (size_t i = 0; i < count; i++) {
+    EC_WRITE_REAL(adr[i], *(float *)buf[i]);
+  }
+#endif
+
+#ifdef EC_WRITE_LREAL
+  adr   = tables[ECMC_EC_F64].adr.data();
+  buf   = tables[ECMC_EC_F64].buf.data();
+  count = tables[ECMC_EC_F64].adr.size();
+
+  for (size_t i = 0; i < count; i++) {
+    EC_WRITE_LREAL(adr[i], *(double *)buf[i]);
+  }
+#endif
+}
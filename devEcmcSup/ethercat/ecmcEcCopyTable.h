@@ -0,0 +1,48 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcEcCopyTable.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCECCOPYTABLE_H_
+#define ECMCECCOPYTABLE_H_
+
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+#include "ecrt.h"
+#include "../main/ecmcDefinitions.h"
+
+// One table per data type (index is ecmcEcDataType)
+#define ECMC_EC_COPY_TABLES (ECMC_EC_F64 + 1)
+
+/**
+ * Flat copy table for all entries of one data type.
+ * adr[i] is the address in domain memory and buf[i] the buffer of the entry.
+ * bitOffset[i] is only used for 1-bit entries.
+ */
+typedef struct {
+  std::vector<uint8_t*>      adr;
+  std::vector<uint64_t*>     buf;
+  std::vector<unsigned int>  bitOffset;
+} ecmcEcCopyTable;
+
+void ecmcEcCopyTableClear(ecmcEcCopyTable *table);
+
+void ecmcEcCopyTableAdd(ecmcEcCopyTable *table,
+                        uint8_t         *adr,
+                        uint64_t        *buf,
+                        unsigned int     bitOffset);
+
+// Domain memory to buffers. Tables of 2..4 bit types are not mapped
+void ecmcEcCopyTablesIn(ecmcEcCopyTable *tables);
+
+// Buffers to domain memory. Tables of 2..4 bit types are not mapped
+void ecmcEcCopyTablesOut(ecmcEcCopyTable *tables);
+
+#endif  /* ECMCECCOPYTABLE_H_ */
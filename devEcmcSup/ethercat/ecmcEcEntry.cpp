@@ -11,6 +11,7 @@
 \*************************************************************************/
 
 #include "ecmcEcEntry.h"
+#include "ecmcEcProcessImage.h"
 #include <stdlib.h> 
 #include "../main/ecmcErrorsList.h"
 
@@ -142,6 +143,9 @@ void ecmcEcEntry::initVars() {
   asynPortDriver_         = NULL;
   updateInRealTime_       = 1;
   domain_                 = NULL;
+  domainIndex_            = 0;
+  processImage_           = NULL;
+  dirty_                  = false;
   pdoIndex_               = 0;
   slave_                  = NULL;
   buffer_                  = 0;
@@ -206,11 +210,15 @@ int ecmcEcEntry::getBits() {
 }
 
 int ecmcEcEntry::writeValue(uint64_t value) {
-  buffer_ = value;
+  if (buffer_ != value) {
+    buffer_ = value;
+    markDirty();
+  }
   return updateAsyn(0);
 }
 
 int ecmcEcEntry::writeDouble(double value) {
+  uint64_t oldValue = buffer_;
 
   switch(dataType_) {
     case ECMC_EC_S8:
@@ -243,21 +251,32 @@ int ecmcEcEntry::writeDouble(double value) {
       break;
   }
 
+  if (buffer_ != oldValue) {
+    markDirty();
+  }
+
   return updateAsyn(0);
 }
 
 int ecmcEcEntry::writeValueForce(uint64_t value) {
   buffer_ = value;
+  markDirty();
   return updateAsyn(1);
 }
 
 int ecmcEcEntry::writeBit(int bitNumber, uint64_t value) {
+  uint64_t oldValue = buffer_;
+
   if (value) {
     BIT_SET(buffer_, bitNumber);
   } else {
     BIT_CLEAR(buffer_, bitNumber);
   }
 
+  if (buffer_ != oldValue) {
+    markDirty();
+  }
+
   return 0;
 }
 
@@ -404,6 +423,12 @@ int ecmcEcEntry::updateOutProcessImage() {
     return 0;
   }
 
+  writeOutProcessImage();
+  updateAsyn(0);
+  return 0;
+}
+
+int ecmcEcEntry::writeOutProcessImage() {
   switch(dataType_) {
     case ECMC_EC_NONE:
       buffer_ = 0;
@@ -478,7 +503,6 @@ int ecmcEcEntry::updateOutProcessImage() {
       break;
   }
 
-  updateAsyn(0);
   return 0;
 }
 
@@ -680,6 +704,9 @@ int ecmcEcEntry::initAsyn() {
                       ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
   }
 
+  // Writes from asyn or plugins
+  entryAsynParam_->setDataWrittenCallback(dataWrittenCallback, this);
+
   //Add supported types
   switch(dataType_) {
     case ECMC_EC_NONE:
@@ -827,4 +854,55 @@ ecmcEcDataType ecmcEcEntry::getDataType() {
 
 int ecmcEcEntry::getSlaveId() {
   return slaveId_;
+}
+
+void ecmcEcEntry::setDomainIndex(int domainIndex) {
+  domainIndex_ = domainIndex;
+}
+
+int ecmcEcEntry::getDomainIndex() {
+  return domainIndex_;
+}
+
+uint8_t * ecmcEcEntry::getAdr() {
+  return adr_;
+}
+
+uint ecmcEcEntry::getBitOffset() {
+  return bitOffset_;
+}
+
+uint64_t * ecmcEcEntry::getBufferPointer() {
+  return &buffer_;
+}
+
+ec_direction_t ecmcEcEntry::getDirection() {
+  return direction_;
+}
+
+void ecmcEcEntry::setProcessImage(ecmcEcProcessImage *image) {
+  processImage_ = image;
+}
+
+bool ecmcEcEntry::getDirty() {
+  return dirty_;
+}
+
+void ecmcEcEntry::setDirty(bool dirty) {
+  dirty_ = dirty;
+}
+
+/*
+* Change only output mode: Notify process image that buffer needs to be
+* written to domain.
+*/
+void ecmcEcEntry::markDirty() {
+  if (!processImage_ || dirty_) {
+    return;
+  }
+  processImage_->addDirtyEntry(this);
+}
+
+void ecmcEcEntry::dataWrittenCallback(void *entry) {
+  ((ecmcEcEntry*)entry)->markDirty();
 }
\ No newline at end of file
@@ -52,6 +52,8 @@
 #define ERROR_EC_ENTRY_VALUE_OUT_OF_RANGE 0x2100C
 #define ERROR_EC_ENTRY_SET_ALARM_STATE_FAIL 0x2100D
 
+class ecmcEcProcessImage;
+
 class ecmcEcEntry : public ecmcError {
  public:
   ecmcEcEntry(ecmcAsynPortDriver *asynPortDriver,
@@ -105,9 +107,24 @@ class ecmcEcEntry : public ecmcError {
   int         validate();
   int         setComAlarm(bool alarm);
   int         getSlaveId();
+  void        setDomainIndex(int domainIndex);
+  int         getDomainIndex();
+  // Used by ecmcEcProcessImage (valid after validate())
+  uint8_t*    getAdr();
+  uint        getBitOffset();
+  uint64_t*   getBufferPointer();
+  ec_direction_t getDirection();
+  // Change only output mode: process image to notify when written
+  void        setProcessImage(ecmcEcProcessImage *image);
+  bool        getDirty();
+  void        setDirty(bool dirty);
+  // Write buffer to domain memory (no asyn update)
+  int         writeOutProcessImage();
   
  private:
   int                 initAsyn();
+  void                markDirty();
+  static void         dataWrittenCallback(void *entry);
   uint8_t            *domainAdr_;
   uint8_t            *adr_;
   uint16_t            entryIndex_;
@@ -127,6 +144,9 @@ class ecmcEcEntry : public ecmcError {
   ecmcEcDataType      dataType_;
   ec_slave_config_t  *slave_;
   ec_domain_t        *domain_;
+  int                 domainIndex_;
+  ecmcEcProcessImage *processImage_;
+  volatile bool       dirty_;
   ec_direction_t      direction_;
   uint64_t            buffer_;
   int8_t             *int8Ptr_;
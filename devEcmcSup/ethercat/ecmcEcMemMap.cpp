@@ -131,6 +131,11 @@ int ecmcEcMemMap::setDomainSize(size_t size) {
   return 0;
 }
 
+// A memmap is always exchanged in the same domain as its start entry
+int ecmcEcMemMap::getDomainIndex() {
+  return startEntry_->getDomainIndex();
+}
+
 int ecmcEcMemMap::updateAsyn(bool force) {
   memMapAsynParam_->refreshParamRT(force);
   return 0;
@@ -49,6 +49,7 @@ class ecmcEcMemMap : public ecmcError {
   int         updateOutProcessImage();
   std::string getIdentificationName();
   int         setDomainSize(size_t size);
+  int         getDomainIndex();
   int         validate();
   int         getByteSize();
   uint8_t*    getBufferPointer();
@@ -0,0 +1,226 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcEcProcessImage.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcEcProcessImage.h"
+
+ecmcEcProcessImage::ecmcEcProcessImage() {
+  changeOnly_        = false;
+  fullRefreshCycles_ = 1;
+  cycleCounter_      = 0;
+  asynInIndex_       = 0;
+  asynOutIndex_      = 0;
+  dirtyIndex_        = 0;
+  dirtyLock_         = epicsSpinMustCreate();
+  clear();
+}
+
+ecmcEcProcessImage::~ecmcEcProcessImage() {
+  setOutputChangeOnly(false, 1);
+  epicsSpinDestroy(dirtyLock_);
+}
+
+void ecmcEcProcessImage::clear() {
+  for (int i = 0; i < ECMC_EC_COPY_TABLES; i++) {
+    ecmcEcCopyTableClear(&inTables_[i]);
+    ecmcEcCopyTableClear(&outTables_[i]);
+  }
+  inOtherEntries_.clear();
+  outOtherEntries_.clear();
+  inEntries_.clear();
+  outEntries_.clear();
+  dirtyEntries_[0].clear();
+  dirtyEntries_[1].clear();
+}
+
+void ecmcEcProcessImage::addToTable(ecmcEcCopyTable *table,
+                                    ecmcEcEntry     *entry) {
+  ecmcEcCopyTableAdd(table,
+                     entry->getAdr(),
+                     entry->getBufferPointer(),
+                     entry->getBitOffset());
+}
+
+void ecmcEcProcessImage::addEntry(ecmcEcEntry *entry) {
+  if (!entry || !entry->getUpdateInRealtime() || entry->getSimEntry()) {
+    return;
+  }
+
+  bool input = entry->getDirection() == EC_DIR_INPUT;
+
+  if (!input && (entry->getDirection() != EC_DIR_OUTPUT)) {
+    return;
+  }
+
+  switch (entry->getDataType()) {
+  case ECMC_EC_B1:
+  case ECMC_EC_U8:
+  case ECMC_EC_S8:
+  case ECMC_EC_U16:
+  case ECMC_EC_S16:
+  case ECMC_EC_U32:
+  case ECMC_EC_S32:
+  case ECMC_EC_U64:
+  case ECMC_EC_S64:
+  case ECMC_EC_F32:
+  case ECMC_EC_F64:
+    addToTable(input ? &inTables_[entry->getDataType()] :
+               &outTables_[entry->getDataType()],
+               entry);
+
+    if (input) {
+      inEntries_.push_back(entry);
+    }
+    break;
+
+  default:
+    // B2..B4 handled by entry
+    if (input) {
+      inOtherEntries_.push_back(entry);
+    } else {
+      outOtherEntries_.push_back(entry);
+    }
+    break;
+  }
+
+  if (!input) {
+    outEntries_.push_back(entry);
+  }
+}
+
+size_t ecmcEcProcessImage::getEntryCount() {
+  return inEntries_.size() + inOtherEntries_.size() + outEntries_.size();
+}
+
+void ecmcEcProcessImage::setOutputChangeOnly(bool changeOnly,
+                                             int  fullRefreshCycles) {
+  changeOnly_        = changeOnly;
+  fullRefreshCycles_ = fullRefreshCycles > 0 ? fullRefreshCycles : 1;
+  cycleCounter_      = 0;
+  asynInIndex_       = 0;
+  asynOutIndex_      = 0;
+
+  // Allocate here since no allocation is allowed when entries are written
+  dirtyEntries_[0].reserve(outEntries_.size());
+  dirtyEntries_[1].reserve(outEntries_.size());
+
+  for (size_t i = 0; i < outEntries_.size(); i++) {
+    outEntries_[i]->setDirty(false);
+    outEntries_[i]->setProcessImage(changeOnly_ ? this : NULL);
+  }
+}
+
+void ecmcEcProcessImage::addDirtyEntry(ecmcEcEntry *entry) {
+  epicsSpinLock(dirtyLock_);
+
+  // Each entry only once in list
+  if (!entry->getDirty()) {
+    entry->setDirty(true);
+    dirtyEntries_[dirtyIndex_].push_back(entry);
+  }
+  epicsSpinUnlock(dirtyLock_);
+}
+
+/*
+* Swap dirty lists and return list of entries written since last call.
+* Entries written after this call will be added to the other list.
+*/
+std::vector<ecmcEcEntry*>* ecmcEcProcessImage::takeDirtyEntries() {
+  epicsSpinLock(dirtyLock_);
+  std::vector<ecmcEcEntry*> *dirty = &dirtyEntries_[dirtyIndex_];
+  dirtyIndex_ = dirtyIndex_ ? 0 : 1;
+
+  for (size_t i = 0; i < dirty->size(); i++) {
+    (*dirty)[i]->setDirty(false);
+  }
+  epicsSpinUnlock(dirtyLock_);
+  return dirty;
+}
+
+void ecmcEcProcessImage::updateInputProcessImage() {
+  ecmcEcCopyTablesIn(inTables_);
+
+  for (size_t i = 0; i < inOtherEntries_.size(); i++) {
+    inOtherEntries_[i]->updateInputProcessImage();
+  }
+
+  if (changeOnly_) {
+    refreshAsynSlice(&inEntries_, &asynInIndex_);
+    return;
+  }
+
+  for (size_t i = 0; i < inEntries_.size(); i++) {
+    inEntries_[i]->updateAsyn(0);
+  }
+}
+
+void ecmcEcProcessImage::updateOutProcessImage() {
+  if (!changeOnly_) {
+    writeAllOutputs();
+
+    for (size_t i = 0; i < outEntries_.size(); i++) {
+      outEntries_[i]->updateAsyn(0);
+    }
+    return;
+  }
+
+  std::vector<ecmcEcEntry*> *dirty = takeDirtyEntries();
+
+  if (cycleCounter_ == 0) {
+    writeAllOutputs();
+  } else {
+    for (size_t i = 0; i < dirty->size(); i++) {
+      (*dirty)[i]->writeOutProcessImage();
+    }
+  }
+
+  // Written entries now, the others round robin
+  for (size_t i = 0; i < dirty->size(); i++) {
+    (*dirty)[i]->updateAsyn(0);
+  }
+  dirty->clear();
+  refreshAsynSlice(&outEntries_, &asynOutIndex_);
+
+  cycleCounter_++;
+  if (cycleCounter_ >= fullRefreshCycles_) {
+    cycleCounter_ = 0;
+  }
+}
+
+/*
+* Refresh asyn values of the next slice of entries (all entries within
+* fullRefreshCycles_ calls).
+*/
+void ecmcEcProcessImage::refreshAsynSlice(std::vector<ecmcEcEntry*> *entries,
+                                          size_t                    *index) {
+  size_t size = entries->size();
+
+  if (size == 0) {
+    return;
+  }
+
+  size_t count = (size + fullRefreshCycles_ - 1) / fullRefreshCycles_;
+
+  for (size_t i = 0; i < count; i++) {
+    if (*index >= size) {
+      *index = 0;
+    }
+    (*entries)[*index]->updateAsyn(0);
+    (*index)++;
+  }
+}
+
+void ecmcEcProcessImage::writeAllOutputs() {
+  ecmcEcCopyTablesOut(outTables_);
+
+  for (size_t i = 0; i < outOtherEntries_.size(); i++) {
+    outOtherEntries_[i]->writeOutProcessImage();
+  }
+}
@@ -0,0 +1,82 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcEcProcessImage.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCECPROCESSIMAGE_H_
+#define ECMCECPROCESSIMAGE_H_
+
+#include <vector>
+#include "stdio.h"
+#include "ecrt.h"
+#include <epicsSpin.h>
+#include "../main/ecmcDefinitions.h"
+#include "ecmcEcEntry.h"
+#include "ecmcEcCopyTable.h"
+
+/**
+ * Process image mapping of all realtime entries in one domain.
+ *
+ * The entries are compiled at activation into type sorted copy tables so
+ * that the cyclic mapping is a few tight loops without a data type switch
+ * per entry. Entries of data types without a table (2..4 bits) are mapped
+ * by the entry itself.
+ *
+ * In change only output mode only entries written since the last cycle are
+ * written to the domain (all outputs are written every fullRefreshCycles
+ * cycle). The asyn values of written outputs are refreshed in the same
+ * cycle. All other entries (inputs and outputs) are refreshed round robin,
+ * a slice each cycle, so each entry at least once per fullRefreshCycles
+ * cycles (instead of all entries each cycle).
+ */
+class ecmcEcProcessImage {
+ public:
+  ecmcEcProcessImage();
+  ~ecmcEcProcessImage();
+  void   clear();
+  // Entry must be validated (address calculated) before added
+  void   addEntry(ecmcEcEntry *entry);
+  size_t getEntryCount();
+  void   updateInputProcessImage();
+  void   updateOutProcessImage();
+  // Call after all entries are added
+  void   setOutputChangeOnly(bool changeOnly,
+                             int  fullRefreshCycles);
+  // Thread safe. Called by entries when written in change only mode
+  void   addDirtyEntry(ecmcEcEntry *entry);
+
+ private:
+  void addToTable(ecmcEcCopyTable *table,
+                  ecmcEcEntry     *entry);
+  void writeAllOutputs();
+  void refreshAsynSlice(std::vector<ecmcEcEntry*> *entries,
+                        size_t                    *index);
+  std::vector<ecmcEcEntry*>* takeDirtyEntries();
+  ecmcEcCopyTable inTables_[ECMC_EC_COPY_TABLES];
+  ecmcEcCopyTable outTables_[ECMC_EC_COPY_TABLES];
+  // Entries mapped by the entry object
+  std::vector<ecmcEcEntry*> inOtherEntries_;
+  std::vector<ecmcEcEntry*> outOtherEntries_;
+  // Entries in copy tables (for asyn updates)
+  std::vector<ecmcEcEntry*> inEntries_;
+  // All output entries
+  std::vector<ecmcEcEntry*> outEntries_;
+  // Change only output mode (double buffered list of written entries)
+  bool                      changeOnly_;
+  int                       fullRefreshCycles_;
+  int                       cycleCounter_;
+  // Next entry of round robin asyn refresh
+  size_t                    asynInIndex_;
+  size_t                    asynOutIndex_;
+  std::vector<ecmcEcEntry*> dirtyEntries_[2];
+  int                       dirtyIndex_;
+  epicsSpinId               dirtyLock_;
+};
+
+#endif  /* ECMCECPROCESSIMAGE_H_ */
@@ -0,0 +1,410 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcEcSdoRequest.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcEcSdoRequest.h"
+#include <string.h>
+#include <epicsAtomic.h>
+#include "../main/ecmcErrorsList.h"
+
+ecmcEcSdoRequest::ecmcEcSdoRequest(ecmcAsynPortDriver *asynPortDriver,
+                                   int                 masterId,
+                                   ec_slave_config_t  *slaveConfig,
+                                   uint16_t            slavePosition,
+                                   int                 index,
+                                   uint16_t            sdoIndex,
+                                   uint8_t             sdoSubIndex,
+                                   size_t              byteSize) {
+  initVars();
+  asynPortDriver_ = asynPortDriver;
+  masterId_       = masterId;
+  slavePosition_  = slavePosition;
+  index_          = index;
+  sdoIndex_       = sdoIndex;
+  sdoSubIndex_    = sdoSubIndex;
+  byteSize_       = byteSize;
+
+  if ((byteSize != 1) && (byteSize != 2) && (byteSize != 4)) {
+    LOGERR("%s/%s:%d: ERROR: Invalid byte size %zu (1, 2 or 4) (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           byteSize,
+           ERROR_EC_SDO_REQUEST_SIZE_INVALID);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_EC_SDO_REQUEST_SIZE_INVALID);
+    return;
+  }
+
+  if (slaveConfig) {
+    request_ = ecrt_slave_config_create_sdo_request(slaveConfig,
+                                                    sdoIndex,
+                                                    sdoSubIndex,
+                                                    byteSize);
+  }
+
+  if (!request_) {
+    LOGERR("%s/%s:%d: ERROR: Slave %d: Create sdo request 0x%x:0x%x failed (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           slavePosition,
+           sdoIndex,
+           sdoSubIndex,
+           ERROR_EC_SDO_REQUEST_CREATE_FAILED);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_EC_SDO_REQUEST_CREATE_FAILED);
+    return;
+  }
+
+  ecrt_sdo_request_timeout(request_, EC_SDO_REQUEST_TIMEOUT_MS);
+  initAsyn();
+}
+
+ecmcEcSdoRequest::~ecmcEcSdoRequest() {
+  // Request object is owned (and freed) by the etherlab master
+  request_ = NULL;
+}
+
+void ecmcEcSdoRequest::initVars() {
+  errorReset();
+  asynPortDriver_ = NULL;
+  masterId_       = 0;
+  slavePosition_  = 0;
+  index_          = 0;
+  sdoIndex_       = 0;
+  sdoSubIndex_    = 0;
+  byteSize_       = 0;
+  request_        = NULL;
+  cmd_            = ECMC_SDO_REQ_CMD_NONE;
+  cmdValue_       = 0;
+  activeCmd_      = ECMC_SDO_REQ_CMD_NONE;
+  value_          = 0;
+  status_         = ECMC_SDO_REQ_STATUS_IDLE;
+  requestError_   = 0;
+  readCmd_        = 0;
+  asynValue_      = NULL;
+  asynRead_       = NULL;
+  asynStatus_     = NULL;
+  asynError_      = NULL;
+}
+
+ecmcAsynDataItem * ecmcEcSdoRequest::addAsynParam(const char    *name,
+                                                  asynParamType  asynType,
+                                                  uint8_t       *data,
+                                                  size_t         bytes,
+                                                  ecmcEcDataType dt) {
+  char buffer[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
+
+  // "ec%d.s%d.sdoreq%d.%s"
+  unsigned int charCount = snprintf(buffer,
+                                    sizeof(buffer),
+                                    ECMC_EC_STR "%d." ECMC_SLAVE_CHAR "%d."
+                                    ECMC_ASYN_EC_SDO_REQ_STR "%d.%s",
+                                    masterId_,
+                                    slavePosition_,
+                                    index_,
+                                    name);
+
+  if (charCount >= sizeof(buffer) - 1) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Failed to generate param name. Buffer to small (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      ERROR_EC_SDO_REQUEST_ASYN_PARAM_REGISTER_FAIL);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_EC_SDO_REQUEST_ASYN_PARAM_REGISTER_FAIL);
+    return NULL;
+  }
+
+  ecmcAsynDataItem *paramTemp = asynPortDriver_->addNewAvailParam(buffer,
+                                                                   asynType,
+                                                                   data,
+                                                                   bytes,
+                                                                   dt,
+                                                                   0);
+
+  if (!paramTemp) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Add create default parameter for %s failed.\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      buffer);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
+    return NULL;
+  }
+  paramTemp->setAllowWriteToEcmc(false);
+  paramTemp->refreshParam(1);
+  return paramTemp;
+}
+
+int ecmcEcSdoRequest::initAsyn() {
+  if (!asynPortDriver_) {
+    return 0;
+  }
+
+  asynValue_ = addAsynParam(ECMC_ASYN_EC_SDO_REQ_PAR_VALUE_NAME,
+                            asynParamInt32,
+                            (uint8_t *)&value_,
+                            sizeof(value_),
+                            ECMC_EC_U32);
+  asynRead_ = addAsynParam(ECMC_ASYN_EC_SDO_REQ_PAR_READ_NAME,
+                           asynParamInt32,
+                           (uint8_t *)&readCmd_,
+                           sizeof(readCmd_),
+                           ECMC_EC_S32);
+  asynStatus_ = addAsynParam(ECMC_ASYN_EC_SDO_REQ_PAR_STATUS_NAME,
+                             asynParamInt32,
+                             (uint8_t *)&status_,
+                             sizeof(status_),
+                             ECMC_EC_S32);
+  asynError_ = addAsynParam(ECMC_ASYN_EC_SDO_REQ_PAR_ERROR_NAME,
+                            asynParamInt32,
+                            (uint8_t *)&requestError_,
+                            sizeof(requestError_),
+                            ECMC_EC_S32);
+
+  if (!asynValue_ || !asynRead_ || !asynStatus_ || !asynError_) {
+    return getErrorID();
+  }
+
+  // Writes are not copied to value_, instead a download is queued
+  asynValue_->setAllowWriteToEcmc(true);
+  asynValue_->setExeCmdFunctPtr(asynWriteValue, this);
+  asynRead_->setAllowWriteToEcmc(true);
+  asynRead_->setExeCmdFunctPtr(asynRead, this);
+  return 0;
+}
+
+asynStatus ecmcEcSdoRequest::asynWriteValue(void         *data,
+                                            size_t        bytes,
+                                            asynParamType asynParType,
+                                            void         *userObj) {
+  ecmcEcSdoRequest *request = (ecmcEcSdoRequest *)userObj;
+
+  if (!request || (bytes < sizeof(uint32_t))) {
+    return asynError;
+  }
+  uint32_t value = 0;
+  memcpy(&value, data, sizeof(value));
+  return request->write(value) ? asynError : asynSuccess;
+}
+
+asynStatus ecmcEcSdoRequest::asynRead(void         *data,
+                                      size_t        bytes,
+                                      asynParamType asynParType,
+                                      void         *userObj) {
+  ecmcEcSdoRequest *request = (ecmcEcSdoRequest *)userObj;
+
+  if (!request) {
+    return asynError;
+  }
+  return request->read() ? asynError : asynSuccess;
+}
+
+int ecmcEcSdoRequest::queueCmd(int cmd, uint32_t value) {
+  if (!request_) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_SDO_REQUEST_CREATE_FAILED);
+  }
+
+  // Reserve the command slot before the value is stored so that concurrent
+  // callers can not overwrite the value of an already queued write
+  if (epicsAtomicCmpAndSwapIntT(&cmd_,
+                                ECMC_SDO_REQ_CMD_NONE,
+                                ECMC_SDO_REQ_CMD_LOCKED) !=
+      ECMC_SDO_REQ_CMD_NONE) {
+    LOGERR("%s/%s:%d: ERROR: Slave %d: Sdo request 0x%x:0x%x already queued (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           slavePosition_,
+           sdoIndex_,
+           sdoSubIndex_,
+           ERROR_EC_SDO_REQUEST_BUSY);
+    return ERROR_EC_SDO_REQUEST_BUSY;
+  }
+
+  cmdValue_ = value;
+  epicsAtomicWriteMemoryBarrier();
+  epicsAtomicSetIntT(&cmd_, cmd);
+  return 0;
+}
+
+int ecmcEcSdoRequest::read() {
+  return queueCmd(ECMC_SDO_REQ_CMD_READ, 0);
+}
+
+int ecmcEcSdoRequest::write(uint32_t value) {
+  return queueCmd(ECMC_SDO_REQ_CMD_WRITE, value);
+}
+
+/*
+* Status of last command, QUEUED from the call to read() or write() until the
+* realtime thread starts the transfer (status_ is only written by ecmc_rt).
+*/
+int ecmcEcSdoRequest::getStatus() {
+  // Command slot before status (see start())
+  int cmd = epicsAtomicGetIntT(&cmd_);
+  epicsAtomicReadMemoryBarrier();
+  int status = status_;
+
+  if ((status != ECMC_SDO_REQ_STATUS_BUSY) &&
+      (cmd != ECMC_SDO_REQ_CMD_NONE)) {
+    return ECMC_SDO_REQ_STATUS_QUEUED;
+  }
+  return status;
+}
+
+uint32_t ecmcEcSdoRequest::getValue() {
+  return value_;
+}
+
+int ecmcEcSdoRequest::getRequestError() {
+  return requestError_;
+}
+
+bool ecmcEcSdoRequest::getBusy() {
+  return status_ == ECMC_SDO_REQ_STATUS_BUSY;
+}
+
+bool ecmcEcSdoRequest::getQueued() {
+  int cmd = epicsAtomicGetIntT(&cmd_);
+
+  return cmd == ECMC_SDO_REQ_CMD_READ || cmd == ECMC_SDO_REQ_CMD_WRITE;
+}
+
+void ecmcEcSdoRequest::setStatus(int status, int error) {
+  bool errorChanged = requestError_ != error;
+
+  requestError_ = error;
+
+  if (errorChanged && asynError_) {
+    asynError_->refreshParamRT(1);
+  }
+
+  if (status_ == status) {
+    return;
+  }
+  status_ = status;
+
+  if (asynStatus_) {
+    asynStatus_->refreshParamRT(1);
+  }
+}
+
+int ecmcEcSdoRequest::poll() {
+  if (!getBusy()) {
+    return 0;
+  }
+
+  switch (ecrt_sdo_request_state(request_)) {
+  case EC_REQUEST_BUSY:
+    return 1;
+
+  case EC_REQUEST_SUCCESS:
+
+    if (activeCmd_ == ECMC_SDO_REQ_CMD_READ) {
+      uint8_t *data = ecrt_sdo_request_data(request_);
+
+      switch (byteSize_) {
+      case 1:
+        value_ = EC_READ_U8(data);
+        break;
+
+      case 2:
+        value_ = EC_READ_U16(data);
+        break;
+
+      default:
+        value_ = EC_READ_U32(data);
+        break;
+      }
+
+      if (asynValue_) {
+        asynValue_->refreshParamRT(1);
+      }
+    }
+    setStatus(ECMC_SDO_REQ_STATUS_DONE, 0);
+    break;
+
+  default:
+    LOGERR("%s/%s:%d: ERROR: Slave %d: Sdo request 0x%x:0x%x failed (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           slavePosition_,
+           sdoIndex_,
+           sdoSubIndex_,
+           ERROR_EC_SDO_REQUEST_FAILED);
+    setStatus(ECMC_SDO_REQ_STATUS_ERROR, ERROR_EC_SDO_REQUEST_FAILED);
+    break;
+  }
+  activeCmd_ = ECMC_SDO_REQ_CMD_NONE;
+  return 0;
+}
+
+int ecmcEcSdoRequest::start(bool allowStart) {
+  if (getBusy() || !getQueued()) {
+    return 0;
+  }
+
+  if (!allowStart) {
+    setStatus(ECMC_SDO_REQ_STATUS_QUEUED, 0);
+    return 0;
+  }
+
+  int cmd = epicsAtomicGetIntT(&cmd_);
+  epicsAtomicReadMemoryBarrier();
+
+  if (cmd == ECMC_SDO_REQ_CMD_WRITE) {
+    uint8_t *data = ecrt_sdo_request_data(request_);
+
+    switch (byteSize_) {
+    case 1:
+      EC_WRITE_U8(data, cmdValue_);
+      break;
+
+    case 2:
+      EC_WRITE_U16(data, cmdValue_);
+      break;
+
+    default:
+      EC_WRITE_U32(data, cmdValue_);
+      break;
+    }
+    ecrt_sdo_request_write(request_);
+  } else {
+    ecrt_sdo_request_read(request_);
+  }
+  activeCmd_ = cmd;
+
+  // BUSY visible before the slot is free (getStatus() never sees an old
+  // status without a queued command)
+  setStatus(ECMC_SDO_REQ_STATUS_BUSY, 0);
+  epicsAtomicWriteMemoryBarrier();
+
+  // Slot free for next command
+  epicsAtomicSetIntT(&cmd_, ECMC_SDO_REQ_CMD_NONE);
+  return 1;
+}
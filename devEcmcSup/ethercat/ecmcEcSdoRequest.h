@@ -0,0 +1,131 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcEcSdoRequest.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCECSDOREQUEST_H_
+#define ECMCECSDOREQUEST_H_
+
+#include "stdio.h"
+#include "ecrt.h"
+#include "../main/ecmcDefinitions.h"
+#include "../main/ecmcError.h"
+#include "../com/ecmcAsynPortDriver.h"
+
+// ECSDOREQUEST
+#define ERROR_EC_SDO_REQUEST_CREATE_FAILED 0x23010
+#define ERROR_EC_SDO_REQUEST_SIZE_INVALID 0x23011
+#define ERROR_EC_SDO_REQUEST_BUSY 0x23012
+#define ERROR_EC_SDO_REQUEST_FAILED 0x23013
+#define ERROR_EC_SDO_REQUEST_ASYN_PARAM_REGISTER_FAIL 0x23014
+#define ERROR_EC_SDO_REQUEST_INDEX_OUT_OF_RANGE 0x23015
+#define ERROR_EC_SDO_REQUEST_ARRAY_FULL 0x23016
+
+enum ecmcEcSdoRequestStatus {
+  ECMC_SDO_REQ_STATUS_IDLE   = 0,
+  ECMC_SDO_REQ_STATUS_QUEUED = 1,
+  ECMC_SDO_REQ_STATUS_BUSY   = 2,
+  ECMC_SDO_REQ_STATUS_DONE   = 3,
+  ECMC_SDO_REQ_STATUS_ERROR  = 4,
+};
+
+enum ecmcEcSdoRequestCmd {
+  ECMC_SDO_REQ_CMD_NONE   = 0,
+  ECMC_SDO_REQ_CMD_READ   = 1,
+  ECMC_SDO_REQ_CMD_WRITE  = 2,
+  // Command being queued (write value not yet stored)
+  ECMC_SDO_REQ_CMD_LOCKED = 3,
+};
+
+/**
+ * Non blocking access to one SDO of a slave.
+ *
+ * Wraps an etherlab sdo request object (must be created before the master
+ * is activated). read() and write() only queue a command and can be called
+ * from any thread (asyn, PLC or configuration). The transfer is started and
+ * polled by the realtime thread through ecmcEc (see ecmcEc::receive()), so
+ * neither side blocks while the mailbox transfer is in progress. One command
+ * can be queued while a transfer is in progress.
+ *
+ * Asyn parameters: "ec<m>.s<pos>.sdoreq<id>.value" (write triggers download),
+ * ".read" (write triggers upload), ".status" (ecmcEcSdoRequestStatus) and
+ * ".error".
+ */
+class ecmcEcSdoRequest : public ecmcError {
+ public:
+  ecmcEcSdoRequest(ecmcAsynPortDriver *asynPortDriver,
+                   int                 masterId,
+                   ec_slave_config_t  *slaveConfig,
+                   uint16_t            slavePosition,
+                   int                 index,
+                   uint16_t            sdoIndex,
+                   uint8_t             sdoSubIndex,
+                   size_t              byteSize);
+  ~ecmcEcSdoRequest();
+
+  // Any thread
+  int      read();
+  int      write(uint32_t value);
+  int      getStatus();
+  uint32_t getValue();
+  int      getRequestError();
+
+  // Realtime (ecmc_rt). Returns 1 if transfer still in progress.
+  int      poll();
+  // Realtime (ecmc_rt). Returns 1 if a queued transfer was started
+  // (if not allowed, a queued transfer is only reported as queued).
+  int      start(bool allowStart);
+  bool     getBusy();
+  bool     getQueued();
+
+ private:
+  void              initVars();
+  int               initAsyn();
+  ecmcAsynDataItem* addAsynParam(const char   *name,
+                                 asynParamType asynType,
+                                 uint8_t      *data,
+                                 size_t        bytes,
+                                 ecmcEcDataType dt);
+  int               queueCmd(int      cmd,
+                             uint32_t value);
+  void              setStatus(int status,
+                              int error);
+  static asynStatus asynWriteValue(void         *data,
+                                   size_t        bytes,
+                                   asynParamType asynParType,
+                                   void         *userObj);
+  static asynStatus asynRead(void         *data,
+                             size_t        bytes,
+                             asynParamType asynParType,
+                             void         *userObj);
+  ecmcAsynPortDriver *asynPortDriver_;
+  int                 masterId_;
+  uint16_t            slavePosition_;
+  int                 index_;
+  uint16_t            sdoIndex_;
+  uint8_t             sdoSubIndex_;
+  size_t              byteSize_;
+  ec_sdo_request_t   *request_;
+  // Pending command (any thread sets, ecmc_rt clears when started)
+  int                 cmd_;
+  uint32_t            cmdValue_;
+  // Command of transfer in progress (ecmc_rt)
+  int                 activeCmd_;
+  // Asyn data (written by ecmc_rt)
+  uint32_t            value_;
+  int32_t             status_;
+  int32_t             requestError_;
+  int32_t             readCmd_;
+  ecmcAsynDataItem   *asynValue_;
+  ecmcAsynDataItem   *asynRead_;
+  ecmcAsynDataItem   *asynStatus_;
+  ecmcAsynDataItem   *asynError_;
+};
+
+#endif  /* ECMCECSDOREQUEST_H_ */
@@ -166,6 +166,12 @@ int ecmcEcSlave::getEntryCount() {
 
 int ecmcEcSlave::addSyncManager(ec_direction_t direction,
                                 uint8_t        syncMangerIndex) {
+  return addSyncManager(direction, syncMangerIndex, domain_);
+}
+
+int ecmcEcSlave::addSyncManager(ec_direction_t direction,
+                                uint8_t        syncMangerIndex,
+                                ec_domain_t   *domain) {
   if (simSlave_) {
     LOGERR(
       "%s/%s:%d: ERROR: Slave %d (0x%x,0x%x): Simulation slave: Functionality not supported (0x%x).\n",
@@ -201,7 +207,7 @@ int ecmcEcSlave::addSyncManager(ec_direction_t direction,
   syncManagerArray_[syncManCounter_] = new ecmcEcSyncManager(asynPortDriver_,
                                                              masterId_,
                                                              slavePosition_,
-                                                             domain_,
+                                                             domain,
                                                              slaveConfig_,
                                                              direction,
                                                              syncMangerIndex);
@@ -559,7 +565,9 @@ int ecmcEcSlave::addEntry(
   uint8_t        entrySubIndex,
   ecmcEcDataType dt,
   std::string    id,
-  int            useInRealTime) {
+  int            useInRealTime,
+  ec_domain_t   *domain,
+  int            domainIndex) {
 
   if(entryCounter_>=EC_MAX_ENTRIES) {
     return ERROR_EC_SLAVE_ENTRY_INDEX_OUT_OF_RANGE;
@@ -569,7 +577,7 @@ int ecmcEcSlave::addEntry(
   ecmcEcSyncManager *syncManager = findSyncMan(syncMangerIndex);
 
   if (syncManager == NULL) {
-    err = addSyncManager(direction, syncMangerIndex);
+    err = addSyncManager(direction, syncMangerIndex, domain);
 
     if (err) {
       LOGERR(
@@ -586,6 +594,24 @@ int ecmcEcSlave::addEntry(
     syncManager = syncManagerArray_[syncManCounter_ - 1];  // last added sync manager
   }
 
+  // All entries of a sync manager must be exchanged in the same domain
+  if (syncManager->getDomain() != domain) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Slave %d (0x%x,0x%x): Sync manager %d already assigned to another domain (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      slavePosition_,
+      vendorId_,
+      productCode_,
+      syncMangerIndex,
+      ERROR_EC_SLAVE_SM_DOMAIN_MISSMATCH);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_EC_SLAVE_SM_DOMAIN_MISSMATCH);
+  }
+
   ecmcEcEntry *entry = syncManager->addEntry(pdoIndex,
                                              entryIndex,
                                              entrySubIndex,
@@ -610,6 +636,8 @@ int ecmcEcSlave::addEntry(
     return entry->getErrorID();
   }
 
+  entry->setDomainIndex(domainIndex);
+
   return appendEntryToList(entry,useInRealTime);
 }
 
@@ -769,6 +797,10 @@ int ecmcEcSlave::getSlaveState(ec_slave_config_state_t *state) {
   return 0;
 }
 
+ec_slave_config_t* ecmcEcSlave::getSlaveConfig() {
+  return slaveConfig_;
+}
+
 int ecmcEcSlave::initAsyn() {
   
   char buffer[EC_MAX_OBJECT_PATH_CHAR_LENGTH];  
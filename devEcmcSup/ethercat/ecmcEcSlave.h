@@ -50,6 +50,7 @@
 #define ERROR_EC_SLAVE_NOT_OPERATIONAL 0x24011
 #define ERROR_EC_SLAVE_NOT_ONLINE 0x24012
 #define ERROR_EC_SLAVE_REG_ASYN_PAR_BUFFER_OVERFLOW 0x24013
+#define ERROR_EC_SLAVE_SM_DOMAIN_MISSMATCH 0x24014
 
 typedef struct {
   uint16_t position;   /**< Offset of the slave in the ring. */
@@ -89,7 +90,9 @@ class ecmcEcSlave : public ecmcError {
                        uint8_t        entrySubIndex,
                        ecmcEcDataType dt,
                        std::string    id,
-                       int            useInRealTime);
+                       int            useInRealTime,
+                       ec_domain_t   *domain,
+                       int            domainIndex);
   int configDC(
     // AssignActivate word.
     uint16_t assignActivate,
@@ -124,12 +127,16 @@ class ecmcEcSlave : public ecmcError {
                         const char* dataBuffer,
                         int         byteSize);
   int getSlaveState(ec_slave_config_state_t *state);
+  ec_slave_config_t* getSlaveConfig();
   int validate();
 
  private:
   void  initVars();
   int   initAsyn();
   int   appendEntryToList(ecmcEcEntry *entry, bool useInRealTime);
+  int   addSyncManager(ec_direction_t direction,
+                       uint8_t        syncMangerIndex,
+                       ec_domain_t   *domain);
   ecmcEcSyncManager* findSyncMan(uint8_t syncMangerIndex);
   ec_master_t *master_;     // EtherCAT master
   uint16_t alias_;          // Slave alias.
@@ -151,6 +151,10 @@ uint8_t ecmcEcSyncManager::getSyncMangerIndex() {
   return syncMangerIndex_;
 }
 
+ec_domain_t * ecmcEcSyncManager::getDomain() {
+  return domain_;
+}
+
 ecmcEcEntry * ecmcEcSyncManager::addEntry(
   uint16_t       pdoIndex,
   uint16_t       entryIndex,
@@ -46,6 +46,7 @@ class ecmcEcSyncManager : public ecmcError {
   int            getInfo(ec_sync_info_t *info);
   ec_direction_t getDirection();
   uint8_t        getSyncMangerIndex();
+  ec_domain_t  * getDomain();
   ecmcEcEntry  * addEntry(
     uint16_t       pdoIndex,
     uint16_t       entryIndex,
@@ -20,9 +20,54 @@
 #include "ecmcEcSlave.h"
 #include "ecmcEcSyncManager.h"
 #include "ecmcEcEntry.h"
+#include "ecmcEcConfigCache.h"
 
 #include "ecmcGlobalsExtern.h"
 
+// Record command in (or check against) the bus config cache.
+// Returns from calling function if already applied from cache.
+#define EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(OP, STR0, STR1, STR2, ...) { \
+    int64_t cacheArgs[] = { __VA_ARGS__ };                              \
+    bool    cacheSkip   = false;                                        \
+    int     cacheError  = ecConfigCacheHandle(                          \
+      OP, cacheArgs, sizeof(cacheArgs) / sizeof(int64_t),               \
+      STR0, STR1, STR2, &cacheSkip);                                    \
+    if (cacheError || cacheSkip) {                                      \
+      return cacheError;                                                \
+    }                                                                   \
+}                                                                       \
+
+static int ecConfigCacheHandle(int            op,
+                               const int64_t *args,
+                               int            argCount,
+                               const char    *str0,
+                               const char    *str1,
+                               const char    *str2,
+                               bool          *skip) {
+  ecmcEcConfigCache *cache = ec->getConfigCache();
+
+  *skip = false;
+
+  if (!cache) {
+    return 0;
+  }
+
+  ecmcEcCfgCacheRecord record;
+  const char *strs[ECMC_EC_CFG_CACHE_MAX_STRINGS] = { str0, str1, str2 };
+
+  record.op       = op;
+  record.argCount = argCount;
+  memset(record.args, 0, sizeof(record.args));
+  memcpy(record.args, args, sizeof(int64_t) * argCount);
+
+  for (int i = 0; i < ECMC_EC_CFG_CACHE_MAX_STRINGS; i++) {
+    if (strs[i]) {
+      record.str[i] = strs[i];
+    }
+  }
+  return cache->handle(&record, skip);
+}
+
 int ecSetMaster(int masterIndex) {
   LOGINFO4("%s/%s:%d masterIndex=%d \n",
            __FILE__,
@@ -54,6 +99,37 @@ int ecResetMaster(int masterIndex) {
   return ec->reset();
 }
 
+int ecAddDomain(int rateDivider, int rateOffset) {
+  LOGINFO4("%s/%s:%d rateDivider=%d rateOffset=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           rateDivider,
+           rateOffset);
+
+  if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_DOMAIN, NULL, NULL, NULL,
+                                     rateDivider, rateOffset);
+
+  return ec->addDomain(rateDivider, rateOffset);
+}
+
+int ecSelectDomain(int domainIndex) {
+  LOGINFO4("%s/%s:%d domainIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           domainIndex);
+
+  if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_SELECT_DOMAIN, NULL, NULL, NULL,
+                                     domainIndex);
+
+  return ec->selectDomain(domainIndex);
+}
+
 int ecResetError() {
   LOGINFO4("%s/%s:%d\n", __FILE__, __FUNCTION__, __LINE__);
 
@@ -75,6 +151,9 @@ int ecAddSlave(uint16_t alias,
            productCode);
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_SLAVE, NULL, NULL, NULL,
+                                     alias, position, vendorId, productCode);
   
   ec->addSlave(alias, position, vendorId, productCode);
   return 0;
@@ -99,6 +178,11 @@ int ecSlaveConfigDC(
     sync1Cycle,
     sync1Shift);
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_SLAVE_CONFIG_DC, NULL, NULL, NULL,
+                                     slaveBusPosition, assignActivate,
+                                     sync0Cycle, sync0Shift,
+                                     sync1Cycle, sync1Shift);
+
   ecmcEcSlave *slave = ec->findSlave(slaveBusPosition);
 
   if (slave == NULL) {
@@ -120,6 +204,9 @@ int ecSelectReferenceDC(int masterIndex, int slaveBusPosition) {
            masterIndex,
            slaveBusPosition);
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_SELECT_REFERENCE_DC, NULL, NULL, NULL,
+                                     masterIndex, slaveBusPosition);
+
   ecmcEcSlave *slave = ec->findSlave(slaveBusPosition);
 
   if (slave == NULL) {
@@ -164,6 +251,13 @@ int ecAddEntryComplete(
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_ENTRY_COMPLETE,
+                                     entryIDString, NULL, NULL,
+                                     position, vendorId, productCode,
+                                     direction, syncMangerIndex, pdoIndex,
+                                     entryIndex, entrySubIndex, bits,
+                                     signedValue);
+
   // Old syntax only vaid for integers use "Cfg.EcAddEntry()" for double, real
   ecmcEcDataType dataType = getEcDataType(bits,signedValue);
 
@@ -215,6 +309,13 @@ int ecAddEntry(
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_ENTRY,
+                                     datatype, entryIDString, NULL,
+                                     position, vendorId, productCode,
+                                     direction, syncMangerIndex, pdoIndex,
+                                     entryIndex, entrySubIndex,
+                                     updateInRealtime);
+
   ecmcEcDataType dt = getEcDataTypeFromStr(datatype);
 
   return ec->addEntry(position,
@@ -245,6 +346,10 @@ int ecSetEntryUpdateInRealtime(
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_SET_ENTRY_UPDATE_IN_RT,
+                                     entryIDString, NULL, NULL,
+                                     slavePosition, updateInRealtime);
+
   ecmcEcSlave *slave = NULL;
 
   if (slavePosition >= 0) {
@@ -286,6 +391,10 @@ int ecAddMemMapDT(
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_MEM_MAP_DT,
+                                     ecPath, dataType, memMapIDString,
+                                     (int64_t)byteSize, direction);
+
   int  masterId   = -1;
   int  slaveIndex = -1;
   char alias[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
@@ -329,6 +438,11 @@ int ecAddMemMap(
     memMapIDString);
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_MEM_MAP,
+                                     startEntryIDString, memMapIDString, NULL,
+                                     startEntryBusPosition, (int64_t)byteSize,
+                                     direction);
   
     return ec->addMemMap(startEntryBusPosition, startEntryId, byteSize,
                       (ec_direction_t)direction, ECMC_EC_NONE, memMapId);
@@ -358,6 +472,9 @@ int ecAddPdo(int slaveIndex, int syncManager, uint16_t pdoIndex) {
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_PDO, NULL, NULL, NULL,
+                                     slaveIndex, syncManager, pdoIndex);
+
   if (ec->getSlave(slaveIndex) == NULL) return ERROR_MAIN_EC_SLAVE_NULL;
 
   if (ec->getSlave(slaveIndex)->getSyncManager(syncManager) ==
@@ -377,6 +494,9 @@ int ecAddSyncManager(int slaveIndex, int direction, uint8_t syncMangerIndex) {
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_SYNC_MANAGER, NULL, NULL, NULL,
+                                     slaveIndex, direction, syncMangerIndex);
+
   if (ec->getSlave(slaveIndex) == NULL) return ERROR_MAIN_EC_SLAVE_NULL;
 
   return ec->getSlave(slaveIndex)->addSyncManager((ec_direction_t)direction,
@@ -401,6 +521,10 @@ int ecAddSdo(uint16_t slavePosition,
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_SDO, NULL, NULL, NULL,
+                                     slavePosition, sdoIndex, sdoSubIndex,
+                                     value, byteSize);
+
   return  ec->addSDOWrite(slavePosition,
                          sdoIndex,
                          sdoSubIndex,
@@ -425,6 +549,10 @@ int ecAddSdoComplete(uint16_t    slavePosition,
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_SDO_COMPLETE,
+                                     valueBuffer, NULL, NULL,
+                                     slavePosition, sdoIndex, byteSize);
+
   return  ec->addSDOWriteComplete(slavePosition,
                                   sdoIndex,
                                   valueBuffer,
@@ -449,6 +577,11 @@ int ecAddSdoBuffer(uint16_t    slavePosition,
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_SDO_BUFFER,
+                                     valueBuffer, NULL, NULL,
+                                     slavePosition, sdoIndex, sdoSubIndex,
+                                     byteSize);
+
   return  ec->addSDOWriteBuffer(slavePosition,
                                 sdoIndex,
                                 sdoSubIndex,
@@ -554,6 +687,111 @@ int ecVerifySdo(uint16_t  slavePosition,
   return 0;
 }
 
+int ecAddSdoRequest(uint16_t slavePosition,
+                    uint16_t sdoIndex,
+                    uint8_t  sdoSubIndex,
+                    int      byteSize) {
+  LOGINFO4(
+    "%s/%s:%d slave_position=%d sdo_index=%d sdo_subindex=%d bytesize=%d\n",
+    __FILE__,
+    __FUNCTION__,
+    __LINE__,
+    slavePosition,
+    sdoIndex,
+    sdoSubIndex,
+    byteSize);
+
+  if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_ADD_SDO_REQUEST, NULL, NULL, NULL,
+                                     slavePosition, sdoIndex, sdoSubIndex,
+                                     byteSize);
+
+  int requestIndex = 0;
+  int errorCode    = ec->addSdoRequest(slavePosition,
+                                       sdoIndex,
+                                       sdoSubIndex,
+                                       byteSize,
+                                       &requestIndex);
+  if (errorCode) {
+    return errorCode;
+  }
+
+  LOGINFO4("%s/%s:%d: INFO: Sdo request %d added.\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           requestIndex);
+  return 0;
+}
+
+int ecSdoRequestRead(int requestIndex) {
+  LOGINFO4("%s/%s:%d request_index=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           requestIndex);
+
+  if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  ecmcEcSdoRequest *request = ec->getSdoRequest(requestIndex);
+
+  if (!request) return ERROR_EC_SDO_REQUEST_INDEX_OUT_OF_RANGE;
+
+  return request->read();
+}
+
+int ecSdoRequestWrite(int requestIndex, uint32_t value) {
+  LOGINFO4("%s/%s:%d request_index=%d value=0x%x\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           requestIndex,
+           value);
+
+  if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  ecmcEcSdoRequest *request = ec->getSdoRequest(requestIndex);
+
+  if (!request) return ERROR_EC_SDO_REQUEST_INDEX_OUT_OF_RANGE;
+
+  return request->write(value);
+}
+
+int ecGetSdoRequestStatus(int requestIndex, int *status) {
+  LOGINFO4("%s/%s:%d request_index=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           requestIndex);
+
+  if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  ecmcEcSdoRequest *request = ec->getSdoRequest(requestIndex);
+
+  if (!request) return ERROR_EC_SDO_REQUEST_INDEX_OUT_OF_RANGE;
+
+  *status = request->getStatus();
+  return 0;
+}
+
+int ecGetSdoRequestValue(int requestIndex, uint32_t *value) {
+  LOGINFO4("%s/%s:%d request_index=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           requestIndex);
+
+  if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  ecmcEcSdoRequest *request = ec->getSdoRequest(requestIndex);
+
+  if (!request) return ERROR_EC_SDO_REQUEST_INDEX_OUT_OF_RANGE;
+
+  *value = request->getValue();
+  return 0;
+}
+
 int ecReadSoE(uint16_t  slavePosition, /**< Slave position. */
                    uint8_t   driveNo, /**< Drive number. */
                    uint16_t  idn, /**< SoE IDN (see ecrt_slave_config_idn()). */
@@ -607,6 +845,10 @@ int ecSlaveConfigWatchDog(int slaveBusPosition,
            watchdogDivider,
            watchdogIntervals);
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_SLAVE_CONFIG_WATCHDOG, NULL, NULL, NULL,
+                                     slaveBusPosition, watchdogDivider,
+                                     watchdogIntervals);
+
   ecmcEcSlave *slave = ec->findSlave(slaveBusPosition);
 
   if (slave == NULL) {
@@ -806,6 +1048,17 @@ int ecSetDomainFailedCyclesLimit(int value) {
   return ec->setDomainFailedCyclesLimitInterlock(value);
 }
 
+int ecSetOutputChangeOnly(int enable, int fullRefreshCycles) {
+  LOGINFO4("%s/%s:%d enable=%d fullRefreshCycles=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           enable,
+           fullRefreshCycles);
+
+  return ec->setOutputChangeOnly(enable, fullRefreshCycles);
+}
+
 int ecEnablePrintouts(int value) {
   LOGINFO4("%s/%s:%d value=%d\n", __FILE__, __FUNCTION__, __LINE__, value);
 
@@ -834,6 +1087,10 @@ int linkEcEntryToEcStatusOutput(int slaveIndex, char *entryIDString) {
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_LINK_EC_STATUS_OUTPUT,
+                                     entryIDString, NULL, NULL,
+                                     slaveIndex);
+
   ecmcEcSlave *slave = NULL;
 
   if (slaveIndex >= 0) {
@@ -874,6 +1131,10 @@ int ecVerifySlave(uint16_t alias,  /**< Slave alias. */
 
   if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
 
+  EC_CFG_CACHE_HANDLE_RETURN_IF_SKIP(ECMC_EC_CFG_OP_VERIFY_SLAVE, NULL, NULL, NULL,
+                                     alias, slavePos, vendorId, productCode,
+                                     revisionNum);
+
   return ec->verifySlave(alias,slavePos,vendorId,productCode, revisionNum);
 }
 
@@ -923,3 +1184,163 @@ int ecUseClockRealtime(int useClkRT) {
   
   return ec->useClockRealtime(useClkRT);
 }
+
+// Apply commands of a loaded bus config cache (no parsing or checks)
+static int ecConfigCacheReplay(ecmcEcConfigCache *cache) {
+  int errorCode = 0;
+
+  for (size_t i = 0; i < cache->getRecordCount(); i++) {
+    const ecmcEcCfgCacheRecord *r = cache->getRecord(i);
+    const int64_t *a = r->args;
+
+    switch (r->op) {
+    case ECMC_EC_CFG_OP_ADD_DOMAIN:
+      errorCode = ecAddDomain(a[0], a[1]);
+      break;
+
+    case ECMC_EC_CFG_OP_SELECT_DOMAIN:
+      errorCode = ecSelectDomain(a[0]);
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_SLAVE:
+      errorCode = ecAddSlave(a[0], a[1], a[2], a[3]);
+      break;
+
+    case ECMC_EC_CFG_OP_SLAVE_CONFIG_DC:
+      errorCode = ecSlaveConfigDC(a[0], a[1], a[2], a[3], a[4], a[5]);
+      break;
+
+    case ECMC_EC_CFG_OP_SELECT_REFERENCE_DC:
+      errorCode = ecSelectReferenceDC(a[0], a[1]);
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_SYNC_MANAGER:
+      errorCode = ecAddSyncManager(a[0], a[1], a[2]);
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_PDO:
+      errorCode = ecAddPdo(a[0], a[1], a[2]);
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_ENTRY_COMPLETE:
+      errorCode = ecAddEntryComplete(a[0], a[1], a[2], a[3], a[4], a[5], a[6],
+                                     a[7], a[8], (char *)r->str[0].c_str(),
+                                     a[9]);
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_ENTRY:
+      errorCode = ecAddEntry(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7],
+                             (char *)r->str[0].c_str(),
+                             (char *)r->str[1].c_str(), a[8]);
+      break;
+
+    case ECMC_EC_CFG_OP_SET_ENTRY_UPDATE_IN_RT:
+      errorCode = ecSetEntryUpdateInRealtime(a[0],
+                                             (char *)r->str[0].c_str(),
+                                             a[1]);
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_MEM_MAP_DT:
+      errorCode = ecAddMemMapDT((char *)r->str[0].c_str(), a[0], a[1],
+                                (char *)r->str[1].c_str(),
+                                (char *)r->str[2].c_str());
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_MEM_MAP:
+      errorCode = ecAddMemMap(a[0], (char *)r->str[0].c_str(), a[1], a[2],
+                              (char *)r->str[1].c_str());
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_SDO:
+      errorCode = ecAddSdo(a[0], a[1], a[2], a[3], a[4]);
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_SDO_COMPLETE:
+      errorCode = ecAddSdoComplete(a[0], a[1], r->str[0].c_str(), a[2]);
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_SDO_BUFFER:
+      errorCode = ecAddSdoBuffer(a[0], a[1], a[2], r->str[0].c_str(), a[3]);
+      break;
+
+    case ECMC_EC_CFG_OP_ADD_SDO_REQUEST:
+      errorCode = ecAddSdoRequest(a[0], a[1], a[2], a[3]);
+      break;
+
+    case ECMC_EC_CFG_OP_SLAVE_CONFIG_WATCHDOG:
+      errorCode = ecSlaveConfigWatchDog(a[0], a[1], a[2]);
+      break;
+
+    case ECMC_EC_CFG_OP_VERIFY_SLAVE:
+      errorCode = ecVerifySlave(a[0], a[1], a[2], a[3], a[4]);
+      break;
+
+    case ECMC_EC_CFG_OP_LINK_EC_STATUS_OUTPUT:
+      errorCode = linkEcEntryToEcStatusOutput(a[0],
+                                              (char *)r->str[0].c_str());
+      break;
+
+    default:
+      errorCode = ERROR_EC_CFG_CACHE_FILE_INVALID;
+      break;
+    }
+
+    if (errorCode) {
+      LOGERR("%s/%s:%d: ERROR: Command %zu (op %d) of config cache %s failed (0x%x). Remove the file to rebuild the cache (0x%x).\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             i,
+             r->op,
+             cache->getFileName(),
+             errorCode,
+             ERROR_EC_CFG_CACHE_REPLAY_FAIL);
+      return ERROR_EC_CFG_CACHE_REPLAY_FAIL;
+    }
+  }
+  return 0;
+}
+
+int ecSetConfigCache(const char *fileName) {
+  LOGINFO4("%s/%s:%d fileName=%s\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           fileName);
+
+  if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  bool loaded    = false;
+  int  errorCode = ec->initConfigCache(fileName, &loaded);
+
+  if (errorCode || !loaded) {
+    return errorCode;
+  }
+
+  ecmcEcConfigCache *cache = ec->getConfigCache();
+
+  cache->setState(ECMC_EC_CFG_CACHE_REPLAYING);
+  errorCode = ecConfigCacheReplay(cache);
+  cache->setState(ECMC_EC_CFG_CACHE_LOADED);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  LOGINFO("%s/%s:%d: INFO: Bus configuration applied from cache %s (%zu commands).\n",
+          __FILE__,
+          __FUNCTION__,
+          __LINE__,
+          fileName,
+          cache->getRecordCount());
+  return 0;
+}
+
+int ecGetConfigCacheLoaded(int *loaded) {
+  if (!ec->getInitDone()) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  ecmcEcConfigCache *cache = ec->getConfigCache();
+
+  *loaded = cache && cache->getState() == ECMC_EC_CFG_CACHE_LOADED;
+  return 0;
+}
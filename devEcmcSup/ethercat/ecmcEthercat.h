@@ -47,6 +47,38 @@ int ecSetMaster(int masterIndex);
  */
 int ecResetMaster(int masterIndex);
 
+/** \brief Adds an EtherCAT domain exchanged at a reduced rate.\n
+ *
+ * Domain 0 is created by "Cfg.EcSetMaster()" and is exchanged every cycle.
+ * Each added domain is exchanged every rateDivider cycle which reduces frame
+ * size and process image work for slow I/O (temperatures, monitoring).
+ * The new domain is selected for all entries added after this call (see
+ * "Cfg.EcSelectDomain()"). All entries in one sync manager must be
+ * registered in the same domain. Memory maps are exchanged in the same domain
+ * as their start entry.\n
+ *
+ *  \param[in] rateDivider Exchange domain every rateDivider cycle (>=1).\n
+ *  \param[in] rateOffset Cycle offset (0..rateDivider-1). Use to spread load
+ *                        of several slow domains over different cycles.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Add a domain exchanged every 10th cycle.\n
+ *  "Cfg.EcAddDomain(10,0)" //Command string to ecmcCmdParser.c\n
+ */
+int ecAddDomain(int rateDivider, int rateOffset);
+
+/** \brief Selects domain for entries added after this call.\n
+ *
+ *  \param[in] domainIndex Domain index (0 = default domain).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Add entries to the default domain again.\n
+ *  "Cfg.EcSelectDomain(0)" //Command string to ecmcCmdParser.c\n
+ */
+int ecSelectDomain(int domainIndex);
+
 /** \brief Adds an EtherCAT slave to the hardware configuration.\n
  *
  * Each added slave will be assigned an additional index which will be zero for
@@ -567,6 +599,91 @@ int ecVerifySdo(uint16_t  slavePosition,
                 uint32_t  verValue,
                 int       byteSize);
 
+/** \brief Add a non blocking Service Data Object request.
+ *
+ * Creates an sdo request object for the slave. Transfers are started and
+ * polled by the realtime thread, without blocking, when queued with
+ * "Cfg.EcSdoRequestRead()" or "Cfg.EcSdoRequestWrite()", from PLC code
+ * (ec_sdo_req_rd(), ec_sdo_req_wrt()) or by writing to the asyn parameters
+ * "ec<master>.s<slave>.sdoreq<id>.read" and "ec<master>.s<slave>.sdoreq<id>.value".\n
+ * Max EC_MAX_SDO_REQUESTS_ACTIVE transfers are in progress at the same
+ * time, the remaining queued requests are started when transfers finish.\n
+ * Requests are indexed (id) in the order they are added, starting at 0.\n
+ *
+ * \note This command can only be used in configuration mode.\n
+ *
+ *  \param[in] slaveBusPosition Position of the EtherCAT slave on the bus.\n
+ *    slaveBusPosition = 0..65535: Addressing of EtherCAT slaves.\n
+ *  \param[in] sdoIndex Index of service data object. Needs to be
+ *                           entered in hex format.\n
+ *  \param[in] sdoSubIndex Sub index of service data object .
+ *                           Needs to be entered in hex format.\n
+ *  \param[in] byteSize Byte count of data (1, 2 or 4).\n
+ *
+ * \return 0 if success other wise an error code.\n
+ *
+ * \note Example: Add request for maximum current setting of the EL7037
+ * stepper drive card on slave position 2.\n
+ * "Cfg.EcAddSdoRequest(2,0x8010,0x1,2)" //Command string to ecmcCmdParser.c\n
+ */
+int ecAddSdoRequest(uint16_t slavePosition,
+                    uint16_t sdoIndex,
+                    uint8_t  sdoSubIndex,
+                    int      byteSize);
+
+/** \brief Queue upload of a non blocking sdo request.
+ *
+ * The read value is available when the request status is done
+ * (ecmcEcSdoRequestStatus).\n
+ *
+ *  \param[in] requestIndex Index of sdo request.\n
+ *
+ * \return 0 if success other wise an error code.\n
+ *
+ * \note Example: Read sdo request 0.\n
+ * "Cfg.EcSdoRequestRead(0)" //Command string to ecmcCmdParser.c\n
+ */
+int ecSdoRequestRead(int requestIndex);
+
+/** \brief Queue download of a non blocking sdo request.
+ *
+ *  \param[in] requestIndex Index of sdo request.\n
+ *  \param[in] value Value to write.\n
+ *
+ * \return 0 if success other wise an error code.\n
+ *
+ * \note Example: Write 1000 to sdo request 0.\n
+ * "Cfg.EcSdoRequestWrite(0,1000)" //Command string to ecmcCmdParser.c\n
+ */
+int ecSdoRequestWrite(int      requestIndex,
+                      uint32_t value);
+
+/** \brief Get status of a non blocking sdo request.
+ *
+ *  \param[in] requestIndex Index of sdo request.\n
+ *  \param[out] status Status (0=idle, 1=queued, 2=busy, 3=done, 4=error).\n
+ *
+ * \return 0 if success other wise an error code.\n
+ *
+ * \note Example: Get status of sdo request 0.\n
+ * "EcGetSdoRequestStatus(0)" //Command string to ecmcCmdParser.c\n
+ */
+int ecGetSdoRequestStatus(int  requestIndex,
+                          int *status);
+
+/** \brief Get last read value of a non blocking sdo request.
+ *
+ *  \param[in] requestIndex Index of sdo request.\n
+ *  \param[out] value Value.\n
+ *
+ * \return 0 if success other wise an error code.\n
+ *
+ * \note Example: Get value of sdo request 0.\n
+ * "EcGetSdoRequestValue(0)" //Command string to ecmcCmdParser.c\n
+ */
+int ecGetSdoRequestValue(int       requestIndex,
+                         uint32_t *value);
+
 /** \brief Read SoE \n
  *
  * \note This command can only be used in configuration mode.\n
@@ -894,6 +1011,26 @@ int ecSetDiagnostics(int enable);
   */
 int ecSetDomainFailedCyclesLimit(int cycles);
 
+/** \brief Only write changed outputs to the EtherCAT domains.\n
+ *
+ * When enabled, only output entries written since the previous cycle are
+ * copied to domain memory. All outputs are written every fullRefreshCycles
+ * cycle for safety. Must be set before the configuration is applied.\n
+ * The asyn parameters of written outputs are refreshed in the same cycle,
+ * all other entry asyn parameters (inputs included) only once per
+ * fullRefreshCycles cycles (a slice of the entries each cycle).\n
+ *
+ *  \param[in] enable Enable change only output writes.\n
+ *  \param[in] fullRefreshCycles Write all outputs every fullRefreshCycles
+ *                               domain cycle (>=1).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Enable and write all outputs every 1000 cycles.\n
+ *  "Cfg.EcSetOutputChangeOnly(1,1000)" //Command string to ecmcCmdParser.c\n
+ */
+int ecSetOutputChangeOnly(int enable, int fullRefreshCycles);
+
 /** \brief Reset error on all EtherCat objects.\n
  *
  * Resets error on the following object types:\n
@@ -1083,6 +1220,40 @@ int ecGetSlaveSerialNum(uint16_t alias,  /**< Slave alias. */
  */
 int ecUseClockRealtime(int useClkRT);
 
+/** \brief Use a binary cache of the bus configuration.
+ *
+ *  Must be called after "Cfg.EcSetMaster()" and before any slave is
+ *  configured.\n
+ *  If the file exists, is valid and the slaves on the bus still match
+ *  (vendor id, product code and revision for each position), the cached
+ *  configuration (domains, slaves, entries, sdo init lists, memmaps,
+ *  sdo requests..) is applied directly. Use "EcGetConfigCacheLoaded()" to
+ *  skip the hardware configuration in the startup scripts. Configuration
+ *  commands still issued must match the cache (in order) and are then
+ *  ignored, otherwise an error is returned (remove the file to rebuild).\n
+ *  If not loaded, the configuration commands are recorded and written to
+ *  the file when the master has been activated successfully.\n
+ *
+ *  \param[in] fileName Cache file name.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Use cache file /tmp/ecmc_bus.cache:\n
+ *   "Cfg.EcSetConfigCache(/tmp/ecmc_bus.cache)" //Command string to ecmcCmdParser.c\n
+ */
+int ecSetConfigCache(const char *fileName);
+
+/** \brief Check if the bus configuration was applied from cache.
+ *
+ *  \param[out] loaded 1 if applied from cache, otherwise 0.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example:\n
+ *   "EcGetConfigCacheLoaded()" //Command string to ecmcCmdParser.c\n
+ */
+int ecGetConfigCacheLoaded(int *loaded);
+
 # ifdef __cplusplus
 }
 # endif  // ifdef __cplusplus
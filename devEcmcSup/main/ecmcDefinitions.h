@@ -46,6 +46,49 @@
 #define ECMC_PRE_ALLOCATION_SIZE (10*1024*1024) /* 1MB pagefault free buffer */
 
 #define ECMC_RT_THREAD_NAME "ecmc_rt" 
+#define ECMC_MAX_RT_TASK_GROUPS 8  /* worker threads in sync with ecmc_rt*/
+#define ECMC_RT_TASK_GROUP_THREAD_NAME "ecmc_rt_grp"
+#define ECMC_MAX_AXIS_GROUPS 8  /* coordinated motion (executed in ecmc_rt)*/
+#define ECMC_AXIS_GROUP_MAX_AXES 8
+#define ECMC_AXIS_GROUP_CMD_QUEUE_SIZE 16  /* must be a power of 2*/
+
+// Realtime handoff (commands to and status from ecmc_rt)
+#define ECMC_AXIS_CMD_QUEUE_SIZE 16  /* must be a power of 2*/
+#define ECMC_AXIS_CMD_TIMEOUT_S 1.0
+#define ECMC_RT_SNAPSHOT_MAX_RETRIES 1000
+#define ECMC_SEQ_MOTION_QUEUE_SIZE 4096  /* must be a power of 2*/
+
+// Asyn publisher (param callbacks outside ecmc_rt)
+#define ECMC_ASYN_PUBLISHER_THREAD_NAME "ecmc_asyn_pub"
+#define ECMC_ASYN_PUBLISHER_SLEEP_S 0.001
+#define ECMC_ASYN_PUBLISHER_DATA_ALIGN 8
+// Max entries per asyn port lock hold (lock released between batches)
+#define ECMC_ASYN_PUBLISHER_BATCH_ENTRIES 64
+
+// Timing histograms (log buckets)
+#define ECMC_LATENCY_HIST_BUCKETS 64
+#define ECMC_LATENCY_HIST_MIN_NS 1000
+#define ECMC_LATENCY_HIST_MAX_NS 10000000
+
+// Execution time profiler (power of two buckets, first edge 2^10 ns)
+#define ECMC_PROF_HIST_BUCKETS 16
+#define ECMC_PROF_HIST_FIRST_EXP 10
+
+// Command lists (executed outside ecmc_rt)
+#define ECMC_COMMAND_LIST_THREAD_NAME "ecmc_cmdlist"
+
+// Data streams (written to file outside ecmc_rt)
+#define ECMC_DATA_STREAM_THREAD_NAME "ecmc_stream"
+#define ECMC_DATA_STREAM_FILE_BUFFER_SIZE (1024*1024)
+// Retry period of writer thread while producer appends (flush)
+#define ECMC_DATA_STREAM_FLUSH_RETRY_S 0.001
+
+// PLC file IO (buffered, written and read outside ecmc_rt)
+#define ECMC_PLC_FILE_IO_THREAD_NAME "ecmc_plcio"
+#define ECMC_PLC_FILE_IO_MAX_CHANNELS 4
+#define ECMC_PLC_FILE_IO_WRITE_BUFFER_SIZE (64*1024)  /* must be a power of 2*/
+#define ECMC_PLC_FILE_IO_READ_BUFFER_SIZE 1024  /* values*/
+#define ECMC_PLC_FILE_IO_LINE_LENGTH 1024
 
 // Buffer size
 #define EC_MAX_OBJECT_PATH_CHAR_LENGTH 256
@@ -60,6 +103,11 @@
 #define EC_MAX_ENTRIES 8192
 #define EC_MAX_MEM_MAPS 64
 #define EC_MAX_SLAVES 512
+#define EC_MAX_DOMAINS 8
+#define EC_MAX_SDO_REQUESTS 128
+// Max number of sdo requests transferring at the same time (per master)
+#define EC_MAX_SDO_REQUESTS_ACTIVE 4
+#define EC_SDO_REQUEST_TIMEOUT_MS 1000
 #define EC_START_TIMEOUT_S 30
 
 #define ECMC_OVER_UNDER_FLOW_FACTOR (0.7)
@@ -108,6 +156,9 @@
 #define ECMC_MAX_EVENT_CONSUMERS 10
 #define ECMC_MAX_COMMANDS_LISTS 10
 #define ECMC_MAX_COMMANDS_IN_COMMANDS_LISTS 100
+#define ECMC_MAX_MULTI_RECORDERS 4
+#define ECMC_MAX_MULTI_RECORDER_CHANNELS 64
+#define ECMC_MAX_DATA_STREAMS 4
 
 // Plugins
 #define ECMC_MAX_PLUGINS 16
@@ -150,6 +201,59 @@
 #define ECMC_ASYN_MAIN_PAR_UPDATE_READY_NAME "ecmc.updated"
 #define ECMC_ASYN_MAIN_PAR_COUNT 13
 
+// Timing histograms of ecmc_rt (prefix of histogram params)
+#define ECMC_ASYN_MAIN_HIST_LATENCY_NAME "ecmc.thread.latency"
+#define ECMC_ASYN_MAIN_HIST_PERIOD_NAME "ecmc.thread.period"
+#define ECMC_ASYN_MAIN_HIST_EXECUTE_NAME "ecmc.thread.execute"
+#define ECMC_ASYN_MAIN_HIST_SEND_NAME "ecmc.thread.send"
+
+// Asyn  parameters in histograms (prefix "<histogram>.")
+#define ECMC_ASYN_HIST_PAR_COUNTS_NAME "hist"
+#define ECMC_ASYN_HIST_PAR_EDGES_NAME "hist.edges"
+#define ECMC_ASYN_HIST_PAR_RESET_NAME "hist.reset"
+#define ECMC_ASYN_HIST_PAR_P50_NAME "p50"
+#define ECMC_ASYN_HIST_PAR_P99_NAME "p99"
+#define ECMC_ASYN_HIST_PAR_P999_NAME "p999"
+
+// Execution time profiler of ecmc_rt (prefix "ecmc.thread.prof.")
+#define ECMC_ASYN_MAIN_PROF_NAME "ecmc.thread.prof"
+#define ECMC_ASYN_PROF_PAR_ENABLE_NAME "enable"
+#define ECMC_ASYN_PROF_PAR_RESET_NAME "reset"
+#define ECMC_ASYN_PROF_PAR_MIN_NAME "min"
+#define ECMC_ASYN_PROF_PAR_MAX_NAME "max"
+#define ECMC_ASYN_PROF_PAR_AVG_NAME "avg"
+#define ECMC_ASYN_PROF_PAR_COUNTS_NAME "hist"
+#define ECMC_ASYN_PROF_PAR_EDGES_NAME "hist.edges"
+
+// Asyn  parameters in rt task groups (prefix "ecmc.thread.grp<index>.")
+#define ECMC_ASYN_RT_GRP_PAR_EXECUTE_NAME "execute"
+#define ECMC_ASYN_RT_GRP_PAR_EXECUTE_MAX_NAME "execute.max"
+
+// Asyn  parameters in asyn publisher
+#define ECMC_ASYN_PUB_PAR_OVERFLOW_NAME "ecmc.asyn.pub.overflow"
+#define ECMC_ASYN_PUB_PAR_DATA_OVERFLOW_NAME "ecmc.asyn.pub.overflow.data"
+#define ECMC_ASYN_PUB_PAR_USED_MAX_NAME "ecmc.asyn.pub.used.max"
+
+// Asyn  parameters in command lists (prefix "ecmc.cmdlist<index>.")
+#define ECMC_ASYN_CMD_LIST_PAR_STATUS_NAME "status"
+#define ECMC_ASYN_CMD_LIST_PAR_ERROR_NAME "error"
+#define ECMC_ASYN_CMD_LIST_PAR_EXECUTE_NAME "execute"
+#define ECMC_ASYN_CMD_LIST_PAR_OVERRUNS_NAME "overruns"
+
+// Asyn  parameters in multi channel recorders (prefix "ecmc.mrec<index>.")
+#define ECMC_ASYN_MULTI_REC_PAR_CHANNEL_NAME "ch"
+#define ECMC_ASYN_MULTI_REC_PAR_TIME_NAME "time"
+#define ECMC_ASYN_MULTI_REC_PAR_INDEX_NAME "index"
+#define ECMC_ASYN_MULTI_REC_PAR_FULL_NAME "full"
+#define ECMC_ASYN_MULTI_REC_PAR_CLEAR_NAME "clear"
+#define ECMC_ASYN_MULTI_REC_PAR_CAPTURE_STATE_NAME "capture.state"
+#define ECMC_ASYN_MULTI_REC_PAR_CAPTURE_PRE_NAME "capture.pre"
+
+// Asyn  parameters in data streams (prefix "ecmc.stream<index>.")
+#define ECMC_ASYN_DATA_STREAM_PAR_BLOCKS_NAME "blocks"
+#define ECMC_ASYN_DATA_STREAM_PAR_OVERFLOWS_NAME "overflows"
+#define ECMC_ASYN_DATA_STREAM_PAR_ERROR_NAME "error"
+
 // Asyn  parameters in ec
 #define ECMC_ASYN_EC_PAR_MASTER_STAT_ID 0
 #define ECMC_ASYN_EC_PAR_MASTER_STAT_NAME "masterstatus"
@@ -172,6 +276,13 @@
 #define ECMC_ASYN_EC_SLAVE_PAR_STATUS_NAME "slavestatus"
 #define ECMC_ASYN_EC_SLAVE_PAR_COUNT 1
 
+// Asyn  parameters in ec sdo request ("ec0.s1.sdoreq0.value")
+#define ECMC_ASYN_EC_SDO_REQ_STR "sdoreq"
+#define ECMC_ASYN_EC_SDO_REQ_PAR_VALUE_NAME "value"
+#define ECMC_ASYN_EC_SDO_REQ_PAR_READ_NAME "read"
+#define ECMC_ASYN_EC_SDO_REQ_PAR_STATUS_NAME "status"
+#define ECMC_ASYN_EC_SDO_REQ_PAR_ERROR_NAME "error"
+
 // Asyn  parameters in axis
 #define ECMC_ASYN_AX_ACT_POS_ID 0
 #define ECMC_ASYN_AX_ACT_POS_NAME "actpos"
@@ -188,7 +299,22 @@
 #define ECMC_ASYN_AX_SOFTLIM_BWD_ID 6
 #define ECMC_ASYN_AX_STATUS_BIN_ID 7
 #define ECMC_ASYN_AX_STATUS_BIN_NAME "statusbin"
-#define ECMC_ASYN_AX_PAR_COUNT 8
+#define ECMC_ASYN_AX_QUEUE_ADD_ID 8
+#define ECMC_ASYN_AX_QUEUE_ADD_NAME "queue.add"
+#define ECMC_ASYN_AX_QUEUE_ITEM_VALUES 5  /* pos, vel, acc, dec, blend */
+#define ECMC_ASYN_AX_QUEUE_COUNT_ID 9
+#define ECMC_ASYN_AX_QUEUE_COUNT_NAME "queue.count"
+#define ECMC_ASYN_AX_QUEUE_ENABLE_ID 10
+#define ECMC_ASYN_AX_QUEUE_ENABLE_NAME "queue.enable"
+#define ECMC_ASYN_AX_QUEUE_CLEAR_ID 11
+#define ECMC_ASYN_AX_QUEUE_CLEAR_NAME "queue.clear"
+#define ECMC_ASYN_AX_PVT_ADD_ID 12
+#define ECMC_ASYN_AX_PVT_ADD_NAME "pvt.add"
+#define ECMC_ASYN_AX_PVT_FREE_ID 13
+#define ECMC_ASYN_AX_PVT_FREE_NAME "pvt.free"
+#define ECMC_ASYN_AX_PVT_START_ID 14
+#define ECMC_ASYN_AX_PVT_START_NAME "pvt.start"
+#define ECMC_ASYN_AX_PAR_COUNT 15
 
 
 // Motion
@@ -239,6 +365,11 @@ enum motionMode {
   ECMC_MOVE_MODE_VEL = 1,
 };
 
+enum trajProfileType {
+  ECMC_TRAJ_PROFILE_TRAPETZ = 0,
+  ECMC_TRAJ_PROFILE_SCURVE  = 1,
+};
+
 enum dataSource {
   ECMC_DATA_SOURCE_INTERNAL           = 0,
   ECMC_DATA_SOURCE_EXTERNAL           = 1
@@ -336,6 +467,11 @@ enum axisSubObjectType {
                                    
 #define ECMC_MAIN_STR "main"
 #define ECMC_THREAD_STR "thread"
+#define ECMC_RT_TASK_GROUP_STR "grp"
+#define ECMC_AXIS_GROUP_STR "axgrp"
+#define ECMC_COMMAND_LIST_STR "cmdlist"
+#define ECMC_MULTI_RECORDER_STR "mrec"
+#define ECMC_DATA_STREAM_STR "stream"
 
 #define ECMC_AX_PATH_BUFFER_SIZE 256
 #define ECMC_EC_PATH_BUFFER_SIZE 256
@@ -358,6 +494,7 @@ enum axisSubObjectType {
 #define ECMC_DATA_STORAGE_DATA_DATA_STR "data"
 #define ECMC_DATA_STORAGE_DATA_CLEAR_STR "clear"
 #define ECMC_DATA_STORAGE_DATA_FULL_STR "full"
+#define ECMC_DATA_STORAGE_DATA_VECTOR_STR "vec"
 #define ECMC_DATA_STORAGE_STATUS_STR "status"
 
 #define ECMC_STATIC_VAR "static."
@@ -543,6 +680,14 @@ typedef struct ecmcMainThreadDiag{
   uint32_t send_max_ns;
 }ecmcMainThreadDiag;
 
+enum ecmcMainThreadHistType {
+  ECMC_THREAD_HIST_LATENCY = 0,
+  ECMC_THREAD_HIST_PERIOD  = 1,
+  ECMC_THREAD_HIST_EXECUTE = 2,
+  ECMC_THREAD_HIST_SEND    = 3,
+  ECMC_THREAD_HIST_COUNT   = 4,
+};
+
 #define BIT_SET(a, b) ((a) |= (1 << (b)))
 #define BIT_CLEAR(a, b) ((a) &= ~(1 << (b)))
 #define BIT_FLIP(a, b) ((a) ^= (1 << (b)))
@@ -313,6 +313,31 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x14326:
+    return "ERROR_AXIS_CMD_QUEUE_FULL";
+
+    break;
+
+  case 0x14327:
+    return "ERROR_AXIS_CMD_QUEUE_TIMEOUT";
+
+    break;
+
+  case 0x14328:
+    return "ERROR_AXIS_CMD_TYPE_INVALID";
+
+    break;
+
+  case 0x14329:
+    return "ERROR_AXIS_STATUS_SNAPSHOT_FAIL";
+
+    break;
+
+  case 0x1432A:
+    return "ERROR_AXIS_GROUP_CONTROLLED";
+
+    break;
+
   case 0x14600:   // DRIVE
     return "ERROR_DRV_DRIVE_INTERLOCKED";
 
@@ -438,6 +463,171 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x14700:
+    return "ERROR_AXIS_GROUP_AXIS_NULL";
+
+    break;
+
+  case 0x14701:
+    return "ERROR_AXIS_GROUP_AXIS_LIST_FULL";
+
+    break;
+
+  case 0x14702:
+    return "ERROR_AXIS_GROUP_AXIS_ALREADY_MEMBER";
+
+    break;
+
+  case 0x14703:
+    return "ERROR_AXIS_GROUP_AXIS_COUNT_MISMATCH";
+
+    break;
+
+  case 0x14704:
+    return "ERROR_AXIS_GROUP_BUSY";
+
+    break;
+
+  case 0x14705:
+    return "ERROR_AXIS_GROUP_AXIS_NOT_READY";
+
+    break;
+
+  case 0x14706:
+    return "ERROR_AXIS_GROUP_CIRCLE_INVALID";
+
+    break;
+
+  case 0x14707:
+    return "ERROR_AXIS_GROUP_VEL_ACC_INVALID";
+
+    break;
+
+  case 0x14708:
+    return "ERROR_AXIS_GROUP_INTERLOCK";
+
+    break;
+
+  case 0x14709:
+    return "ERROR_AXIS_GROUP_CMD_QUEUE_FULL";
+
+    break;
+
+  case 0x1470A:
+    return "ERROR_AXIS_GROUP_MOD_AXIS_NOT_SUPPORTED";
+
+    break;
+
+  case 0x1470B:
+    return "ERROR_AXIS_GROUP_ASYN_PAR_BUFFER_OVERFLOW";
+
+    break;
+
+  case 0x1470C:
+    return "ERROR_AXIS_GROUP_OVERRIDE_OUT_OF_RANGE";
+
+    break;
+
+  case 0x1470D:
+    return "ERROR_AXIS_GROUP_SOFT_LIMIT";
+
+    break;
+
+  case 0x14800:
+    return "ERROR_AXIS_CAM_MASTER_NULL";
+
+    break;
+
+  case 0x14801:
+    return "ERROR_AXIS_CAM_TABLE_FILE_OPEN_FAIL";
+
+    break;
+
+  case 0x14802:
+    return "ERROR_AXIS_CAM_TABLE_PARSE_FAIL";
+
+    break;
+
+  case 0x14803:
+    return "ERROR_AXIS_CAM_TABLE_SIZE_INVALID";
+
+    break;
+
+  case 0x14804:
+    return "ERROR_AXIS_CAM_TABLE_NOT_INCREASING";
+
+    break;
+
+  case 0x14805:
+    return "ERROR_AXIS_CAM_INTERP_TYPE_INVALID";
+
+    break;
+
+  case 0x14806:
+    return "ERROR_AXIS_CAM_MODULO_INVALID";
+
+    break;
+
+  case 0x14807:
+    return "ERROR_AXIS_CAM_MASTER_SOURCE_INVALID";
+
+    break;
+
+  case 0x14808:
+    return "ERROR_AXIS_CAM_MASTER_SELF";
+
+    break;
+
+  case 0x14809:
+    return "ERROR_AXIS_CAM_MASTER_ORDER";
+
+    break;
+
+  case 0x1480A:
+    return "ERROR_AXIS_CAM_MASTER_RT_TASK_GROUP";
+
+    break;
+
+  case 0x14900:
+    return "ERROR_AXIS_PVT_BUFFER_SIZE_INVALID";
+
+    break;
+
+  case 0x14901:
+    return "ERROR_AXIS_PVT_BUFFER_FULL";
+
+    break;
+
+  case 0x14902:
+    return "ERROR_AXIS_PVT_BUFFER_EMPTY";
+
+    break;
+
+  case 0x14903:
+    return "ERROR_AXIS_PVT_BUFFER_UNDERRUN";
+
+    break;
+
+  case 0x14904:
+    return "ERROR_AXIS_PVT_POINT_INVALID";
+
+    break;
+
+  case 0x14905:
+    return "ERROR_AXIS_PVT_AXIS_NOT_READY";
+
+    break;
+
+  case 0x14906:
+    return "ERROR_AXIS_PVT_INTERLOCK";
+
+    break;
+
+  case 0x14907:
+    return "ERROR_AXIS_PVT_MOD_AXIS_NOT_SUPPORTED";
+
+    break;
+
   case 0x14400:    // ENCODER
     return "ERROR_ENC_ASSIGN_ENTRY_FAILED";
 
@@ -780,6 +970,16 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x14D18:
+    return "ERROR_SEQ_MOTION_QUEUE_FULL";
+
+    break;
+
+  case 0x14D19:
+    return "ERROR_SEQ_MOTION_QUEUE_ITEM_INVALID";
+
+    break;
+
   case 0x14E00:    // TRAJECTORY
     return "ERROR_TRAJ_EXT_ENC_NULL";
 
@@ -900,6 +1100,31 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x14E18:
+    return "ERROR_TRAJ_PROFILE_TYPE_OUT_OF_RANGE";
+
+    break;
+
+  case 0x14E20:
+    return "ERROR_TRAJ_SCURVE_JERK_INVALID";
+
+    break;
+
+  case 0x14E21:
+    return "ERROR_TRAJ_SCURVE_ACC_INVALID";
+
+    break;
+
+  case 0x14E22:
+    return "ERROR_TRAJ_SCURVE_VEL_INVALID";
+
+    break;
+
+  case 0x14E23:
+    return "ERROR_TRAJ_SCURVE_SEGMENT_OVERFLOW";
+
+    break;
+
   case 0x14F00:    // VIRTUAL AXIS
     return "ERROR_VIRT_AXIS_TRAJ_NULL";
 
@@ -1113,6 +1338,41 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
     return "ERROR_EC_SDO_BUFFER_ALLOC_FAIL";
 
     break;
+
+  case 0x23010:
+    return "ERROR_EC_SDO_REQUEST_CREATE_FAILED";
+
+    break;
+
+  case 0x23011:
+    return "ERROR_EC_SDO_REQUEST_SIZE_INVALID";
+
+    break;
+
+  case 0x23012:
+    return "ERROR_EC_SDO_REQUEST_BUSY";
+
+    break;
+
+  case 0x23013:
+    return "ERROR_EC_SDO_REQUEST_FAILED";
+
+    break;
+
+  case 0x23014:
+    return "ERROR_EC_SDO_REQUEST_ASYN_PARAM_REGISTER_FAIL";
+
+    break;
+
+  case 0x23015:
+    return "ERROR_EC_SDO_REQUEST_INDEX_OUT_OF_RANGE";
+
+    break;
+
+  case 0x23016:
+    return "ERROR_EC_SDO_REQUEST_ARRAY_FULL";
+
+    break;
     
   case 0x24000:  // ECSLAVE
     return "ERROR_EC_SLAVE_CONFIG_FAILED";
@@ -1214,6 +1474,11 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x24014:
+    return "ERROR_EC_SLAVE_SM_DOMAIN_MISSMATCH";
+
+    break;
+
   case 0x25000:  // ECSYNCMANAGER
     return "ERROR_EC_SM_PDO_ARRAY_FULL";
 
@@ -1443,6 +1708,66 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x26029:
+    return "ERROR_EC_DOMAIN_INDEX_OUT_OF_RANGE";
+
+    break;
+
+  case 0x2602A:
+    return "ERROR_EC_DOMAIN_RATE_DIVIDER_INVALID";
+
+    break;
+
+  case 0x2602B:
+    return "ERROR_EC_DOMAIN_ARRAY_FULL";
+
+    break;
+
+  case 0x2602C:
+    return "ERROR_EC_FULL_REFRESH_CYCLES_INVALID";
+
+    break;
+
+  case 0x26100:
+    return "ERROR_EC_CFG_CACHE_FILE_OPEN_FAIL";
+
+    break;
+
+  case 0x26101:
+    return "ERROR_EC_CFG_CACHE_FILE_WRITE_FAIL";
+
+    break;
+
+  case 0x26102:
+    return "ERROR_EC_CFG_CACHE_FILE_INVALID";
+
+    break;
+
+  case 0x26103:
+    return "ERROR_EC_CFG_CACHE_BUS_MISMATCH";
+
+    break;
+
+  case 0x26104:
+    return "ERROR_EC_CFG_CACHE_CONFIG_MISMATCH";
+
+    break;
+
+  case 0x26105:
+    return "ERROR_EC_CFG_CACHE_BUS_SCAN_FAIL";
+
+    break;
+
+  case 0x26106:
+    return "ERROR_EC_CFG_CACHE_ALREADY_DEFINED";
+
+    break;
+
+  case 0x26107:
+    return "ERROR_EC_CFG_CACHE_REPLAY_FAIL";
+
+    break;
+
   case 0x20000:
     return "ERROR_MAIN_DEMO_EC_ACITVATE_FAILED";
 
@@ -1852,6 +2177,46 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x20054:
+    return "ERROR_MAIN_RT_TASK_GROUP_INDEX_OUT_OF_RANGE";
+
+    break;
+
+  case 0x20055:
+    return "ERROR_MAIN_RT_TASK_GROUP_NULL";
+
+    break;
+
+  case 0x20056:
+    return "ERROR_MAIN_RT_TASK_GROUP_OBJ_ALREADY_ASSIGNED";
+
+    break;
+
+  case 0x20057:
+    return "ERROR_MAIN_ASYN_PUBLISHER_ALREADY_CREATED";
+
+    break;
+
+  case 0x20058:
+    return "ERROR_MAIN_EXEC_PROFILER_NULL";
+
+    break;
+
+  case 0x20059:
+    return "ERROR_MAIN_AXIS_GROUP_INDEX_OUT_OF_RANGE";
+
+    break;
+
+  case 0x2005A:
+    return "ERROR_MAIN_AXIS_GROUP_NULL";
+
+    break;
+
+  case 0x2005B:
+    return "ERROR_MAIN_AXIS_GROUP_OBJ_ALREADY_ASSIGNED";
+
+    break;
+
   case 0x20100:   // Data Recorder
     return "ERROR_DATA_RECORDER_BUFFER_NULL";
 
@@ -1912,6 +2277,16 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x20205:
+    return "ERROR_DATA_STORAGE_VECTOR_SIZE_LOCKED";
+
+    break;
+
+  case 0x20206:
+    return "ERROR_DATA_STORAGE_VECTOR_FIFO_NOT_SUPPORTED";
+
+    break;
+
   case 0x20300:   // Event
     return "ERROR_EVENT_DATA_ECENTRY_NULL";
 
@@ -1992,6 +2367,26 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x20408:
+    return "ERROR_COMMAND_LIST_BUSY";
+
+    break;
+
+  case 0x20409:
+    return "ERROR_COMMAND_LIST_SEM_INIT_FAIL";
+
+    break;
+
+  case 0x2040A:
+    return "ERROR_COMMAND_LIST_THREAD_CREATE_FAIL";
+
+    break;
+
+  case 0x2040B:
+    return "ERROR_COMMAND_LIST_ASYN_PAR_BUFFER_OVERFLOW";
+
+    break;
+
   case 0x20500:   // ecmcPLC
     return "ERROR_PLC_EXPRTK_ALLOCATION_FAILED";
 
@@ -2072,6 +2467,61 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
 
     break;
 
+  case 0x20510:
+    return "ERROR_PLC_FILE_IO_CHANNEL_OUT_OF_RANGE";
+
+    break;
+
+  case 0x20511:
+    return "ERROR_PLC_FILE_IO_CHANNEL_NOT_OPEN";
+
+    break;
+
+  case 0x20512:
+    return "ERROR_PLC_FILE_IO_CHANNEL_ALREADY_OPEN";
+
+    break;
+
+  case 0x20513:
+    return "ERROR_PLC_FILE_IO_MODE_INVALID";
+
+    break;
+
+  case 0x20514:
+    return "ERROR_PLC_FILE_IO_WRONG_MODE";
+
+    break;
+
+  case 0x20515:
+    return "ERROR_PLC_FILE_IO_FILE_OPEN_FAIL";
+
+    break;
+
+  case 0x20516:
+    return "ERROR_PLC_FILE_IO_WRITE_FAIL";
+
+    break;
+
+  case 0x20517:
+    return "ERROR_PLC_FILE_IO_BUFFER_OVERFLOW";
+
+    break;
+
+  case 0x20518:
+    return "ERROR_PLC_FILE_IO_NO_DATA";
+
+    break;
+
+  case 0x20519:
+    return "ERROR_PLC_FILE_IO_SEM_INIT_FAIL";
+
+    break;
+
+  case 0x2051A:
+    return "ERROR_PLC_FILE_IO_THREAD_CREATE_FAIL";
+
+    break;
+
   case 0x20600:   // ecmcPLCDataIF
     return "ERROR_PLC_AXIS_DATA_TYPE_ERROR";
 
@@ -2258,6 +2708,26 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
   case 0x220009:
     return "ERROR_ASYN_CMD_FAIL";
 
+    break;
+  case 0x221000:
+    return "ERROR_ASYN_PUBLISHER_INVALID_SIZE";
+
+    break;
+  case 0x221001:
+    return "ERROR_ASYN_PUBLISHER_QUEUE_FULL";
+
+    break;
+  case 0x221002:
+    return "ERROR_ASYN_PUBLISHER_DATA_BUFFER_FULL";
+
+    break;
+  case 0x221003:
+    return "ERROR_ASYN_PUBLISHER_THREAD_CREATE_FAIL";
+
+    break;
+  case 0x221004:
+    return "ERROR_ASYN_PUBLISHER_ALREADY_STARTED";
+
     break;
 
   case 0x230000:
@@ -2303,6 +2773,181 @@ const char * ecmcError::convertErrorIdToString(int errorId) {
   case 0x231007:
     return "ERROR_PLUGIN_DATA_ARG_VS_FUNC_MISSMATCH";
 
+    break;
+
+  case 0x232000:
+    return "ERROR_RT_TASK_GROUP_AXIS_NULL";
+
+    break;
+
+  case 0x232001:
+    return "ERROR_RT_TASK_GROUP_PLC_NULL";
+
+    break;
+
+  case 0x232002:
+    return "ERROR_RT_TASK_GROUP_PLUGIN_NULL";
+
+    break;
+
+  case 0x232003:
+    return "ERROR_RT_TASK_GROUP_LIST_FULL";
+
+    break;
+
+  case 0x232004:
+    return "ERROR_RT_TASK_GROUP_SEM_INIT_FAIL";
+
+    break;
+
+  case 0x232005:
+    return "ERROR_RT_TASK_GROUP_THREAD_CREATE_FAIL";
+
+    break;
+
+  case 0x232006:
+    return "ERROR_RT_TASK_GROUP_AFFINITY_FAIL";
+
+    break;
+
+  case 0x232007:
+    return "ERROR_RT_TASK_GROUP_ALREADY_STARTED";
+
+    break;
+
+  case 0x232008:
+    return "ERROR_RT_TASK_GROUP_ASYN_PAR_BUFFER_OVERFLOW";
+
+    break;
+
+  case 0x233000:
+    return "ERROR_LATENCY_HIST_ASYN_PAR_BUFFER_OVERFLOW";
+
+    break;
+
+  case 0x233100:
+    return "ERROR_EXEC_PROF_ASYN_PAR_BUFFER_OVERFLOW";
+
+    break;
+
+  case 0x234000:
+    return "ERROR_MULTI_RECORDER_NULL";
+
+    break;
+
+  case 0x234001:
+    return "ERROR_MULTI_RECORDER_INDEX_OUT_OF_RANGE";
+
+    break;
+
+  case 0x234002:
+    return "ERROR_MULTI_RECORDER_CHANNELS_FULL";
+
+    break;
+
+  case 0x234003:
+    return "ERROR_MULTI_RECORDER_DATA_ITEM_NULL";
+
+    break;
+
+  case 0x234004:
+    return "ERROR_MULTI_RECORDER_DATA_TYPE_NOT_SUPPORTED";
+
+    break;
+
+  case 0x234005:
+    return "ERROR_MULTI_RECORDER_HARDWARE_STATUS_NOT_OK";
+
+    break;
+
+  case 0x234006:
+    return "ERROR_MULTI_RECORDER_INVALID_SIZE";
+
+    break;
+
+  case 0x234007:
+    return "ERROR_MULTI_RECORDER_BUFFER_TYPE_NOT_SUPPORTED";
+
+    break;
+
+  case 0x234008:
+    return "ERROR_MULTI_RECORDER_ASYN_PARAM_REGISTER_FAIL";
+
+    break;
+
+  case 0x234009:
+    return "ERROR_MULTI_RECORDER_NO_CHANNELS";
+
+    break;
+
+  case 0x23400A:
+    return "ERROR_MULTI_RECORDER_ENABLED";
+
+    break;
+
+  case 0x23400B:
+    return "ERROR_MULTI_RECORDER_CAPTURE_INVALID_WINDOW";
+
+    break;
+
+  case 0x23400C:
+    return "ERROR_MULTI_RECORDER_CAPTURE_NOT_ENABLED";
+
+    break;
+
+  case 0x23400D:
+    return "ERROR_MULTI_RECORDER_TRIGGER_CHANNEL_OUT_OF_RANGE";
+
+    break;
+
+  case 0x235000:
+    return "ERROR_DATA_STREAM_NULL";
+
+    break;
+
+  case 0x235001:
+    return "ERROR_DATA_STREAM_INDEX_OUT_OF_RANGE";
+
+    break;
+
+  case 0x235002:
+    return "ERROR_DATA_STREAM_INVALID_SIZE";
+
+    break;
+
+  case 0x235003:
+    return "ERROR_DATA_STREAM_FILE_OPEN_FAIL";
+
+    break;
+
+  case 0x235004:
+    return "ERROR_DATA_STREAM_FILE_WRITE_FAIL";
+
+    break;
+
+  case 0x235005:
+    return "ERROR_DATA_STREAM_SEM_INIT_FAIL";
+
+    break;
+
+  case 0x235006:
+    return "ERROR_DATA_STREAM_THREAD_CREATE_FAIL";
+
+    break;
+
+  case 0x235007:
+    return "ERROR_DATA_STREAM_ALREADY_LINKED";
+
+    break;
+
+  case 0x235008:
+    return "ERROR_DATA_STREAM_CHANNEL_COUNT_MISMATCH";
+
+    break;
+
+  case 0x235009:
+    return "ERROR_DATA_STREAM_ASYN_PARAM_REGISTER_FAIL";
+
     break;
   }
 
@@ -97,5 +97,13 @@
 #define ERROR_MAIN_PLUGIN_INDEX_OUT_OF_RANGE 0x20051
 #define ERROR_MAIN_TRAJ_SOURCE_NOT_INTERNAL 0x20052
 #define ERROR_MAIN_AXIS_COM_BLOCKED 0x20053
+#define ERROR_MAIN_RT_TASK_GROUP_INDEX_OUT_OF_RANGE 0x20054
+#define ERROR_MAIN_RT_TASK_GROUP_NULL 0x20055
+#define ERROR_MAIN_RT_TASK_GROUP_OBJ_ALREADY_ASSIGNED 0x20056
+#define ERROR_MAIN_ASYN_PUBLISHER_ALREADY_CREATED 0x20057
+#define ERROR_MAIN_EXEC_PROFILER_NULL 0x20058
+#define ERROR_MAIN_AXIS_GROUP_INDEX_OUT_OF_RANGE 0x20059
+#define ERROR_MAIN_AXIS_GROUP_NULL 0x2005A
+#define ERROR_MAIN_AXIS_GROUP_OBJ_ALREADY_ASSIGNED 0x2005B
 
 #endif  /* ECMCERRORSLIST_H_ */
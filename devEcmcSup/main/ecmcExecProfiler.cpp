@@ -0,0 +1,324 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcExecProfiler.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcExecProfiler.h"
+#include <string.h>
+#include <time.h>
+#include <epicsAtomic.h>
+#include "ecmcErrorsList.h"
+
+ecmcExecProfiler::ecmcExecProfiler(ecmcAsynPortDriver *asynPortDriver,
+                                   const char         *prefix) {
+  initVars();
+  asynPortDriver_ = asynPortDriver;
+
+  edges_[0] = 0;
+
+  for (int i = 1; i < ECMC_PROF_HIST_BUCKETS; i++) {
+    edges_[i] = (int32_t)(1u << (ECMC_PROF_HIST_FIRST_EXP + i - 1));
+  }
+
+  initAsyn(prefix);
+}
+
+ecmcExecProfiler::~ecmcExecProfiler() {}
+
+void ecmcExecProfiler::initVars() {
+  errorReset();
+  asynPortDriver_ = NULL;
+  asynEnable_     = NULL;
+  asynReset_      = NULL;
+  asynMin_        = NULL;
+  asynMax_        = NULL;
+  asynAvg_        = NULL;
+  asynHist_       = NULL;
+  asynEdges_      = NULL;
+  memset(edges_, 0, sizeof(edges_));
+  reset();
+  enableCmd_    = 0;
+  resetCmd_     = 0;
+  resetRequest_ = 0;
+  enable_       = false;
+  refreshed_    = false;
+}
+
+void ecmcExecProfiler::reset() {
+  memset(max_,   0, sizeof(max_));
+  memset(avg_,   0, sizeof(avg_));
+  memset(sum_,   0, sizeof(sum_));
+  memset(count_, 0, sizeof(count_));
+  memset(hist_,  0, sizeof(hist_));
+  memset(min_,   0, sizeof(min_));
+}
+
+ecmcAsynDataItem* ecmcExecProfiler::addParam(const char   *prefix,
+                                             const char   *name,
+                                             asynParamType type,
+                                             uint8_t      *data,
+                                             size_t        bytes) {
+  char buffer[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
+  unsigned int charCount = snprintf(buffer,
+                                    sizeof(buffer),
+                                    "%s.%s",
+                                    prefix,
+                                    name);
+
+  if (charCount >= sizeof(buffer) - 1) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Failed to generate param name. Buffer to small (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      ERROR_EXEC_PROF_ASYN_PAR_BUFFER_OVERFLOW);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_EXEC_PROF_ASYN_PAR_BUFFER_OVERFLOW);
+    return NULL;
+  }
+
+  ecmcAsynDataItem *paramTemp = asynPortDriver_->addNewAvailParam(buffer,
+                                                                  type,
+                                                                  data,
+                                                                  bytes,
+                                                                  ECMC_EC_S32,
+                                                                  0);
+
+  if (!paramTemp) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Add create default parameter for %s failed.\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      buffer);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
+    return NULL;
+  }
+  paramTemp->setAllowWriteToEcmc(false);
+  paramTemp->refreshParam(1);
+  return paramTemp;
+}
+
+int ecmcExecProfiler::initAsyn(const char *prefix) {
+  if (!asynPortDriver_) {
+    return 0;
+  }
+
+  asynMin_ = addParam(prefix,
+                      ECMC_ASYN_PROF_PAR_MIN_NAME,
+                      asynParamInt32Array,
+                      (uint8_t *)min_,
+                      sizeof(min_));
+
+  asynMax_ = addParam(prefix,
+                      ECMC_ASYN_PROF_PAR_MAX_NAME,
+                      asynParamInt32Array,
+                      (uint8_t *)max_,
+                      sizeof(max_));
+
+  asynAvg_ = addParam(prefix,
+                      ECMC_ASYN_PROF_PAR_AVG_NAME,
+                      asynParamInt32Array,
+                      (uint8_t *)avg_,
+                      sizeof(avg_));
+
+  asynHist_ = addParam(prefix,
+                       ECMC_ASYN_PROF_PAR_COUNTS_NAME,
+                       asynParamInt32Array,
+                       (uint8_t *)hist_,
+                       sizeof(hist_));
+
+  asynEdges_ = addParam(prefix,
+                        ECMC_ASYN_PROF_PAR_EDGES_NAME,
+                        asynParamInt32Array,
+                        (uint8_t *)edges_,
+                        sizeof(edges_));
+
+  asynEnable_ = addParam(prefix,
+                         ECMC_ASYN_PROF_PAR_ENABLE_NAME,
+                         asynParamInt32,
+                         (uint8_t *)&enableCmd_,
+                         sizeof(enableCmd_));
+
+  if (asynEnable_) {
+    asynEnable_->setAllowWriteToEcmc(true);
+    asynEnable_->setExeCmdFunctPtr(asynWriteEnable, this);
+  }
+
+  asynReset_ = addParam(prefix,
+                        ECMC_ASYN_PROF_PAR_RESET_NAME,
+                        asynParamInt32,
+                        (uint8_t *)&resetCmd_,
+                        sizeof(resetCmd_));
+
+  if (asynReset_) {
+    asynReset_->setAllowWriteToEcmc(true);
+    asynReset_->setExeCmdFunctPtr(asynWriteReset, this);
+  }
+  return getErrorID();
+}
+
+asynStatus ecmcExecProfiler::asynWriteEnable(void         *data,
+                                             size_t        bytes,
+                                             asynParamType asynParType,
+                                             void         *userObj) {
+  if (!userObj || (asynParType != asynParamInt32) ||
+      (bytes != sizeof(int32_t))) {
+    return asynError;
+  }
+
+  ((ecmcExecProfiler *)userObj)->setEnable(*(int32_t *)data);
+  return asynSuccess;
+}
+
+asynStatus ecmcExecProfiler::asynWriteReset(void         *data,
+                                            size_t        bytes,
+                                            asynParamType asynParType,
+                                            void         *userObj) {
+  if (!userObj || (asynParType != asynParamInt32) ||
+      (bytes != sizeof(int32_t))) {
+    return asynError;
+  }
+
+  if (*(int32_t *)data) {
+    ((ecmcExecProfiler *)userObj)->requestReset();
+  }
+  return asynSuccess;
+}
+
+void ecmcExecProfiler::setEnable(int enable) {
+  epicsAtomicSetIntT(&enableCmd_, enable != 0);
+}
+
+void ecmcExecProfiler::requestReset() {
+  epicsAtomicSetIntT(&resetRequest_, 1);
+}
+
+/*
+* Realtime (ecmc_rt, before rt task groups are triggered)
+*/
+bool ecmcExecProfiler::beginCycle() {
+  if (epicsAtomicGetIntT(&resetRequest_)) {
+    reset();
+    refreshed_ = false;
+    epicsAtomicSetIntT(&resetRequest_, 0);
+  }
+
+  bool enable = epicsAtomicGetIntT(&enableCmd_) != 0;
+
+  if (enable != enable_) {
+    refreshed_ = false;
+  }
+  enable_ = enable;
+  return enable_;
+}
+
+bool ecmcExecProfiler::getEnable() {
+  return enable_;
+}
+
+uint64_t ecmcExecProfiler::now() {
+  struct timespec time;
+
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * MCU_NSEC_PER_SEC + time.tv_nsec;
+}
+
+/*
+* Realtime (thread executing the object)
+*/
+uint64_t ecmcExecProfiler::add(int slot, uint64_t startNs) {
+  uint64_t timeNs = now();
+
+  if ((slot < 0) || (slot >= ECMC_PROF_SLOT_COUNT)) {
+    return timeNs;
+  }
+
+  uint64_t diffNs  = timeNs - startNs;
+  int32_t  valueNs = diffNs > INT32_MAX ? INT32_MAX : (int32_t)diffNs;
+
+  if ((valueNs < min_[slot]) || (count_[slot] == 0)) {
+    min_[slot] = valueNs;
+  }
+
+  if (valueNs > max_[slot]) {
+    max_[slot] = valueNs;
+  }
+
+  // Keep average if count saturates
+  if (count_[slot] == UINT32_MAX) {
+    sum_[slot]   /= 2;
+    count_[slot] /= 2;
+  }
+  sum_[slot] += valueNs;
+  count_[slot]++;
+
+  // Power of two buckets (index of highest bit set)
+  int bucket = 0;
+
+  if (valueNs >> ECMC_PROF_HIST_FIRST_EXP) {
+    bucket = 31 - __builtin_clz((uint32_t)valueNs) -
+             ECMC_PROF_HIST_FIRST_EXP + 1;
+
+    if (bucket >= ECMC_PROF_HIST_BUCKETS) {
+      bucket = ECMC_PROF_HIST_BUCKETS - 1;
+    }
+  }
+
+  int32_t *counts = &hist_[slot * ECMC_PROF_HIST_BUCKETS];
+
+  // Keep shape of histogram if saturated
+  if (counts[bucket] == INT32_MAX) {
+    for (int i = 0; i < ECMC_PROF_HIST_BUCKETS; i++) {
+      counts[i] /= 2;
+    }
+  }
+  counts[bucket]++;
+
+  return timeNs;
+}
+
+/*
+* Realtime (ecmc_rt, no rt task group executing). Only while enabled and
+* once after disable or reset.
+*/
+void ecmcExecProfiler::refreshAsyn(int force) {
+  if (!asynPortDriver_) {
+    return;
+  }
+
+  if (!enable_ && refreshed_ && !force) {
+    return;
+  }
+
+  for (int i = 0; i < ECMC_PROF_SLOT_COUNT; i++) {
+    avg_[i] = count_[i] ? (int32_t)(sum_[i] / count_[i]) : 0;
+  }
+
+  int forceRefresh = force || !enable_;
+
+  ecmcAsynDataItem *params[4] = { asynMin_, asynMax_, asynAvg_, asynHist_ };
+
+  for (int i = 0; i < 4; i++) {
+    if (params[i]) {
+      params[i]->refreshParamRT(forceRefresh);
+    }
+  }
+
+  if (force && asynEdges_) {
+    asynEdges_->refreshParamRT(1);
+  }
+
+  refreshed_ = !enable_;
+}
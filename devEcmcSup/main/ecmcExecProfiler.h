@@ -0,0 +1,121 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcExecProfiler.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMC_EXEC_PROFILER_H_
+#define ECMC_EXEC_PROFILER_H_
+
+#include <stdint.h>
+#include "ecmcError.h"
+#include "ecmcDefinitions.h"
+#include "../com/ecmcAsynPortDriver.h"
+#include "../com/ecmcAsynDataItem.h"
+
+#define ERROR_EXEC_PROF_ASYN_PAR_BUFFER_OVERFLOW 0x233100
+
+// Profiled objects (index in all asyn arrays)
+enum ecmcExecProfilerSlot {
+  ECMC_PROF_SLOT_EC_RECEIVE   = 0,
+  ECMC_PROF_SLOT_EC_SEND      = 1,
+  ECMC_PROF_SLOT_ASYN         = 2,
+  ECMC_PROF_SLOT_AXIS_FIRST   = 3,
+  ECMC_PROF_SLOT_EVENT_FIRST  = ECMC_PROF_SLOT_AXIS_FIRST + ECMC_MAX_AXES,
+  ECMC_PROF_SLOT_PLUGIN_FIRST = ECMC_PROF_SLOT_EVENT_FIRST +
+                                ECMC_MAX_EVENT_OBJECTS,
+  // PLC index (axis PLCs at AXIS_PLC_ID_TO_PLC_ID(axisId))
+  ECMC_PROF_SLOT_PLC_FIRST    = ECMC_PROF_SLOT_PLUGIN_FIRST + ECMC_MAX_PLUGINS,
+  ECMC_PROF_SLOT_COUNT        = ECMC_PROF_SLOT_PLC_FIRST + ECMC_MAX_PLCS +
+                                ECMC_MAX_AXES,
+};
+
+/**
+ * Execution time of the objects executed in the realtime loop (axes, PLCs,
+ * events, plugins, EtherCAT receive/send and asyn update).
+ *
+ * Disabled by default. When disabled the only cost is one call to
+ * beginCycle() per cycle (and one getEnable() per PLC execute).
+ *
+ * Each slot (ecmcExecProfilerSlot) accumulates min, max, average and a
+ * histogram with ECMC_PROF_HIST_BUCKETS power of two buckets: bucket 0 holds
+ * values below 2^ECMC_PROF_HIST_FIRST_EXP ns, bucket n values from
+ * 2^(ECMC_PROF_HIST_FIRST_EXP+n-1) ns and the last bucket all values above.
+ *
+ * Threads: beginCycle() and refreshAsyn() are called by ecmc_rt while no rt
+ * task group is executing. add() is called by the thread executing the
+ * object (ecmc_rt or rt task group), each slot has one writer. Enable and
+ * reset requests (asyn or configuration) are handled in beginCycle().
+ *
+ * Asyn parameters ("ecmc.thread.prof.<param>"):
+ *   enable     : Enable profiling
+ *   reset      : Clear all slots
+ *   min, max, avg : Execution time per slot [ns] (waveform)
+ *   hist       : Counts per slot and bucket, slot major (waveform)
+ *   hist.edges : Lower edge of each bucket [ns] (waveform)
+ */
+class ecmcExecProfiler : public ecmcError {
+ public:
+  ecmcExecProfiler(ecmcAsynPortDriver *asynPortDriver,
+                   const char         *prefix);
+  ~ecmcExecProfiler();
+  // Realtime (ecmc_rt). Returns enable state for this cycle.
+  bool            beginCycle();
+  bool            getEnable();
+  // Any thread
+  void            setEnable(int enable);
+  void            requestReset();
+  // Add execution time (now - startNs) to slot. Returns now.
+  uint64_t        add(int      slot,
+                      uint64_t startNs);
+  void            refreshAsyn(int force);
+  static uint64_t now();
+
+ private:
+  void              initVars();
+  void              reset();
+  int               initAsyn(const char *prefix);
+  ecmcAsynDataItem* addParam(const char   *prefix,
+                             const char   *name,
+                             asynParamType type,
+                             uint8_t      *data,
+                             size_t        bytes);
+  static asynStatus asynWriteEnable(void         *data,
+                                    size_t        bytes,
+                                    asynParamType asynParType,
+                                    void         *userObj);
+  static asynStatus asynWriteReset(void         *data,
+                                   size_t        bytes,
+                                   asynParamType asynParType,
+                                   void         *userObj);
+
+  ecmcAsynPortDriver *asynPortDriver_;
+  ecmcAsynDataItem   *asynEnable_;
+  ecmcAsynDataItem   *asynReset_;
+  ecmcAsynDataItem   *asynMin_;
+  ecmcAsynDataItem   *asynMax_;
+  ecmcAsynDataItem   *asynAvg_;
+  ecmcAsynDataItem   *asynHist_;
+  ecmcAsynDataItem   *asynEdges_;
+  int32_t             min_[ECMC_PROF_SLOT_COUNT];
+  int32_t             max_[ECMC_PROF_SLOT_COUNT];
+  int32_t             avg_[ECMC_PROF_SLOT_COUNT];
+  uint64_t            sum_[ECMC_PROF_SLOT_COUNT];
+  uint32_t            count_[ECMC_PROF_SLOT_COUNT];
+  int32_t             hist_[ECMC_PROF_SLOT_COUNT * ECMC_PROF_HIST_BUCKETS];
+  int32_t             edges_[ECMC_PROF_HIST_BUCKETS];
+  // Requests (any thread)
+  int32_t             enableCmd_;
+  int32_t             resetCmd_;
+  int                 resetRequest_;
+  // Latched in beginCycle()
+  bool                enable_;
+  bool                refreshed_;
+};
+
+#endif  /* ECMC_EXEC_PROFILER_H_ */
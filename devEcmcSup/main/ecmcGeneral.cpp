@@ -81,6 +81,15 @@ int getControllerError() {
     }
   }
 
+  // Axis groups
+  for (int i = 0; i < ECMC_MAX_AXIS_GROUPS; i++) {
+    if (axisGroups[i] != NULL) {
+      if (axisGroups[i]->getError()) {
+        return axisGroups[i]->getErrorID();
+      }
+    }
+  }
+
   // Plugin objects
   for (int i = 0; i < ECMC_MAX_PLUGINS; i++) {
     if (plugins[i]) {
@@ -139,6 +148,13 @@ int controllerErrorReset() {
     }
   }
 
+  // Axis groups
+  for (int i = 0; i < ECMC_MAX_AXIS_GROUPS; i++) {
+    if (axisGroups[i] != NULL) {
+      axisGroups[i]->errorReset();
+    }
+  }
+
   // Plugin objects
   for (int i = 0; i < ECMC_MAX_PLUGINS; i++) {
     if (plugins[i]) {
@@ -190,6 +206,18 @@ int setEnableFunctionCallDiag(int value) {
   return 0;
 }
 
+int setEnableExecProfiler(int enable) {
+  LOGINFO4("%s/%s:%d enable=%d\n", __FILE__, __FUNCTION__, __LINE__, enable);
+
+  if (!execProfiler) {
+    return ERROR_MAIN_EXEC_PROFILER_NULL;
+  }
+
+  execProfiler->setEnable(enable);
+
+  return 0;
+}
+
 int linkEcEntryToObject(char *ecPath, char *objPath) {
   LOGINFO4("%s/%s:%d ecPath=%s axPath=%s\n",
            __FILE__,
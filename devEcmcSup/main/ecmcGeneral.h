@@ -112,6 +112,22 @@ int setEnableTimeDiag(int value);
  *  "Cfg.SetEnableFuncCallDiag(1)" //Command string to ecmcCmdParser.c\n
  */
 int setEnableFunctionCallDiag(int value);
+
+/** \brief Enable measurement of execution time of each object (axis, PLC,
+ * event, plugin, EtherCAT receive/send, asyn update) in the realtime
+ * thread.\n
+ *
+ * Min, max, average and histograms are published as asyn arrays
+ * ("ecmc.thread.prof.*"), see ecmcExecProfiler.h for the layout.\n
+ *
+ * \param[in] enable Enable profiling.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Enable execution time profiling.\n
+ *  "Cfg.SetEnableExecProfiler(1)" //Command string to ecmcCmdParser.c\n
+ */
+int setEnableExecProfiler(int enable);
                        
 # ifdef __cplusplus
 }
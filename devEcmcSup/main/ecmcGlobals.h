@@ -18,11 +18,18 @@
 #include "../misc/ecmcDataRecorder.h"
 #include "../misc/ecmcDataStorage.h"
 #include "../misc/ecmcCommandList.h"
+#include "../misc/ecmcMultiRecorder.h"
+#include "../misc/ecmcDataStream.h"
 #include "../plc/ecmcPLCMain.h"
 #include "../motion/ecmcMotion.h"
 #include "../com/ecmcAsynDataItem.h"
 #include "../motor/ecmcMotorRecordController.h"
 #include "../plugin/ecmcPluginLib.h"
+#include "ecmcRtTaskGroup.h"
+#include "../com/ecmcAsynPublisher.h"
+#include "ecmcLatencyHistogram.h"
+#include "ecmcExecProfiler.h"
+#include "../motion/ecmcAxisGroup.h"
 #include "epicsMutex.h"
 
 ecmcAxisBase *axes[ECMC_MAX_AXES];
@@ -31,6 +38,8 @@ ecmcEvent                 *events[ECMC_MAX_EVENT_OBJECTS];
 ecmcDataRecorder          *dataRecorders[ECMC_MAX_DATA_RECORDERS_OBJECTS];
 ecmcDataStorage           *dataStorages[ECMC_MAX_DATA_STORAGE_OBJECTS];
 ecmcCommandList           *commandLists[ECMC_MAX_COMMANDS_LISTS];
+ecmcMultiRecorder         *multiRecorders[ECMC_MAX_MULTI_RECORDERS];
+ecmcDataStream            *dataStreams[ECMC_MAX_DATA_STREAMS];
 ecmcPLCMain               *plcs;
 ecmcAsynPortDriver        *asynPort = NULL;
 ecmcAsynDataItem          *mainAsynParams[ECMC_ASYN_MAIN_PAR_COUNT];
@@ -38,9 +47,12 @@ ecmcMainThreadDiag         threadDiag={0};
 app_mode_type              appModeCmd, appModeCmdOld, appModeStat;
 ecmcMotorRecordController *asynPortMotorRecord;
 ecmcPluginLib             *plugins[ECMC_MAX_PLUGINS];
+ecmcRtTaskGroup           *rtTaskGroups[ECMC_MAX_RT_TASK_GROUPS];
+ecmcAsynPublisher         *asynPublisher = NULL;
+ecmcLatencyHistogram      *threadHistograms[ECMC_THREAD_HIST_COUNT];
+ecmcExecProfiler          *execProfiler = NULL;
+ecmcAxisGroup             *axisGroups[ECMC_MAX_AXIS_GROUPS];
 
-// Mutex for motor record access
-epicsMutexId               ecmcRTMutex;
 int                        axisDiagIndex;
 int                        axisDiagFreq;
 int                        controllerError = -1;
@@ -21,11 +21,18 @@
 #include "../misc/ecmcDataRecorder.h"
 #include "../misc/ecmcDataStorage.h"
 #include "../misc/ecmcCommandList.h"
+#include "../misc/ecmcMultiRecorder.h"
+#include "../misc/ecmcDataStream.h"
 #include "../plc/ecmcPLCMain.h"
 #include "../motion/ecmcMotion.h"
 #include "../ethercat/ecmcEthercat.h"
 #include "../motor/ecmcMotorRecordController.h"
 #include "../plugin/ecmcPluginLib.h"
+#include "ecmcRtTaskGroup.h"
+#include "../com/ecmcAsynPublisher.h"
+#include "ecmcLatencyHistogram.h"
+#include "ecmcExecProfiler.h"
+#include "../motion/ecmcAxisGroup.h"
 #include "epicsMutex.h"
 
 extern ecmcAxisBase              *axes[ECMC_MAX_AXES];
@@ -34,6 +41,8 @@ extern ecmcEvent                 *events[ECMC_MAX_EVENT_OBJECTS];
 extern ecmcDataRecorder          *dataRecorders[ECMC_MAX_DATA_RECORDERS_OBJECTS];
 extern ecmcDataStorage           *dataStorages[ECMC_MAX_DATA_STORAGE_OBJECTS];
 extern ecmcCommandList           *commandLists[ECMC_MAX_COMMANDS_LISTS];
+extern ecmcMultiRecorder         *multiRecorders[ECMC_MAX_MULTI_RECORDERS];
+extern ecmcDataStream            *dataStreams[ECMC_MAX_DATA_STREAMS];
 extern ecmcPLCMain               *plcs;
 extern ecmcAsynPortDriver        *asynPort;
 extern ecmcAsynDataItem          *mainAsynParams[ECMC_ASYN_MAIN_PAR_COUNT];
@@ -41,9 +50,12 @@ extern ecmcMainThreadDiag         threadDiag;
 extern app_mode_type              appModeCmd, appModeCmdOld, appModeStat;
 extern ecmcMotorRecordController *asynPortMotorRecord;
 extern ecmcPluginLib             *plugins[ECMC_MAX_PLUGINS];
+extern ecmcRtTaskGroup           *rtTaskGroups[ECMC_MAX_RT_TASK_GROUPS];
+extern ecmcAsynPublisher         *asynPublisher;
+extern ecmcLatencyHistogram      *threadHistograms[ECMC_THREAD_HIST_COUNT];
+extern ecmcExecProfiler          *execProfiler;
+extern ecmcAxisGroup             *axisGroups[ECMC_MAX_AXIS_GROUPS];
 
-// Mutex for motor record access
-extern epicsMutexId               ecmcRTMutex;
 extern int                        axisDiagIndex;
 extern int                        axisDiagFreq;
 extern int                        controllerError;
@@ -0,0 +1,281 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcLatencyHistogram.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcLatencyHistogram.h"
+#include <math.h>
+#include <string.h>
+#include <epicsAtomic.h>
+#include "ecmcErrorsList.h"
+
+ecmcLatencyHistogram::ecmcLatencyHistogram(ecmcAsynPortDriver *asynPortDriver,
+                                           const char         *prefix) {
+  initVars();
+  asynPortDriver_ = asynPortDriver;
+  initEdges();
+  initAsyn(prefix);
+}
+
+ecmcLatencyHistogram::~ecmcLatencyHistogram() {}
+
+void ecmcLatencyHistogram::initVars() {
+  errorReset();
+  asynPortDriver_ = NULL;
+  asynHist_       = NULL;
+  asynEdges_      = NULL;
+  asynReset_      = NULL;
+  asynP50_        = NULL;
+  asynP99_        = NULL;
+  asynP999_       = NULL;
+  memset(upperEdges_, 0, sizeof(upperEdges_));
+  memset(lowerEdges_, 0, sizeof(lowerEdges_));
+  memset(counts_,     0, sizeof(counts_));
+  maxNs_        = 0;
+  p50Ns_        = 0;
+  p99Ns_        = 0;
+  p999Ns_       = 0;
+  resetCmd_     = 0;
+  resetRequest_ = 0;
+}
+
+/*
+* Logarithmic edges from ECMC_LATENCY_HIST_MIN_NS to ECMC_LATENCY_HIST_MAX_NS.
+*/
+void ecmcLatencyHistogram::initEdges() {
+  const int edgeCount = ECMC_LATENCY_HIST_BUCKETS - 1;
+  double    ratio     = (double)ECMC_LATENCY_HIST_MAX_NS /
+                        (double)ECMC_LATENCY_HIST_MIN_NS;
+
+  for (int i = 0; i < edgeCount; i++) {
+    upperEdges_[i] = (uint32_t)(ECMC_LATENCY_HIST_MIN_NS *
+                                pow(ratio, (double)i / (edgeCount - 1)) + 0.5);
+  }
+
+  lowerEdges_[0] = 0;
+
+  for (int i = 1; i < ECMC_LATENCY_HIST_BUCKETS; i++) {
+    lowerEdges_[i] = (int32_t)upperEdges_[i - 1];
+  }
+}
+
+ecmcAsynDataItem* ecmcLatencyHistogram::addParam(const char   *prefix,
+                                                 const char   *name,
+                                                 asynParamType type,
+                                                 uint8_t      *data,
+                                                 size_t        bytes) {
+  char buffer[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
+  unsigned int charCount = snprintf(buffer,
+                                    sizeof(buffer),
+                                    "%s.%s",
+                                    prefix,
+                                    name);
+
+  if (charCount >= sizeof(buffer) - 1) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Failed to generate param name. Buffer to small (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      ERROR_LATENCY_HIST_ASYN_PAR_BUFFER_OVERFLOW);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_LATENCY_HIST_ASYN_PAR_BUFFER_OVERFLOW);
+    return NULL;
+  }
+
+  ecmcAsynDataItem *paramTemp = asynPortDriver_->addNewAvailParam(buffer,
+                                                                  type,
+                                                                  data,
+                                                                  bytes,
+                                                                  ECMC_EC_S32,
+                                                                  0);
+
+  if (!paramTemp) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Add create default parameter for %s failed.\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      buffer);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
+    return NULL;
+  }
+  paramTemp->setAllowWriteToEcmc(false);
+  paramTemp->refreshParam(1);
+  return paramTemp;
+}
+
+int ecmcLatencyHistogram::initAsyn(const char *prefix) {
+  if (!asynPortDriver_) {
+    return 0;
+  }
+
+  asynHist_ = addParam(prefix,
+                       ECMC_ASYN_HIST_PAR_COUNTS_NAME,
+                       asynParamInt32Array,
+                       (uint8_t *)counts_,
+                       sizeof(counts_));
+
+  asynEdges_ = addParam(prefix,
+                        ECMC_ASYN_HIST_PAR_EDGES_NAME,
+                        asynParamInt32Array,
+                        (uint8_t *)lowerEdges_,
+                        sizeof(lowerEdges_));
+
+  asynP50_ = addParam(prefix,
+                      ECMC_ASYN_HIST_PAR_P50_NAME,
+                      asynParamInt32,
+                      (uint8_t *)&p50Ns_,
+                      sizeof(p50Ns_));
+
+  asynP99_ = addParam(prefix,
+                      ECMC_ASYN_HIST_PAR_P99_NAME,
+                      asynParamInt32,
+                      (uint8_t *)&p99Ns_,
+                      sizeof(p99Ns_));
+
+  asynP999_ = addParam(prefix,
+                       ECMC_ASYN_HIST_PAR_P999_NAME,
+                       asynParamInt32,
+                       (uint8_t *)&p999Ns_,
+                       sizeof(p999Ns_));
+
+  asynReset_ = addParam(prefix,
+                        ECMC_ASYN_HIST_PAR_RESET_NAME,
+                        asynParamInt32,
+                        (uint8_t *)&resetCmd_,
+                        sizeof(resetCmd_));
+
+  if (asynReset_) {
+    asynReset_->setAllowWriteToEcmc(true);
+    asynReset_->setExeCmdFunctPtr(asynWriteReset, this);
+  }
+  return getErrorID();
+}
+
+/*
+* Asyn thread: Request reset (executed in realtime by next add()).
+*/
+asynStatus ecmcLatencyHistogram::asynWriteReset(void         *data,
+                                                size_t        bytes,
+                                                asynParamType asynParType,
+                                                void         *userObj) {
+  if (!userObj || (asynParType != asynParamInt32) ||
+      (bytes != sizeof(int32_t))) {
+    return asynError;
+  }
+
+  if (*(int32_t *)data) {
+    ecmcLatencyHistogram *hist = (ecmcLatencyHistogram *)userObj;
+    epicsAtomicSetIntT(&hist->resetRequest_, 1);
+  }
+  return asynSuccess;
+}
+
+void ecmcLatencyHistogram::reset() {
+  memset(counts_, 0, sizeof(counts_));
+  maxNs_ = 0;
+}
+
+void ecmcLatencyHistogram::add(uint32_t valueNs) {
+  if (epicsAtomicGetIntT(&resetRequest_)) {
+    reset();
+    epicsAtomicSetIntT(&resetRequest_, 0);
+  }
+
+  // Binary search for first upper edge above value
+  int low  = 0;
+  int high = ECMC_LATENCY_HIST_BUCKETS - 1;
+
+  while (low < high) {
+    int mid = (low + high) / 2;
+
+    if (valueNs < upperEdges_[mid]) {
+      high = mid;
+    } else {
+      low = mid + 1;
+    }
+  }
+
+  if (valueNs > maxNs_) {
+    maxNs_ = valueNs;
+  }
+
+  // Keep shape of histogram if saturated
+  if (counts_[low] == INT32_MAX) {
+    for (int i = 0; i < ECMC_LATENCY_HIST_BUCKETS; i++) {
+      counts_[i] /= 2;
+    }
+  }
+  counts_[low]++;
+}
+
+/*
+* Percentile = upper edge of the bucket where the accumulated count reaches
+* the limit (max value for last bucket). One pass for all percentiles.
+*/
+void ecmcLatencyHistogram::updatePercentiles() {
+  const int perMille[3] = { 500, 990, 999 };
+  int32_t  *result[3]   = { &p50Ns_, &p99Ns_, &p999Ns_ };
+  uint64_t  limit[3];
+  uint64_t  total = 0;
+  uint64_t  sum   = 0;
+  int       next  = 0;
+
+  for (int i = 0; i < ECMC_LATENCY_HIST_BUCKETS; i++) {
+    total += counts_[i];
+  }
+
+  for (int j = 0; j < 3; j++) {
+    limit[j]   = (total * perMille[j] + 999) / 1000;
+    *result[j] = 0;
+  }
+
+  if (total == 0) {
+    return;
+  }
+
+  for (int i = 0; i < ECMC_LATENCY_HIST_BUCKETS && next < 3; i++) {
+    sum += counts_[i];
+
+    while (next < 3 && sum >= limit[next]) {
+      *result[next] = i < ECMC_LATENCY_HIST_BUCKETS - 1 ?
+                      (int32_t)upperEdges_[i] : (int32_t)maxNs_;
+      next++;
+    }
+  }
+}
+
+/*
+* Realtime
+*/
+void ecmcLatencyHistogram::refreshAsyn(int force) {
+  if (!asynPortDriver_) {
+    return;
+  }
+
+  updatePercentiles();
+
+  ecmcAsynDataItem *params[4] = { asynHist_, asynP50_, asynP99_, asynP999_ };
+
+  for (int i = 0; i < 4; i++) {
+    if (params[i]) {
+      params[i]->refreshParamRT(force);
+    }
+  }
+
+  if (force && asynEdges_) {
+    asynEdges_->refreshParamRT(1);
+  }
+}
@@ -0,0 +1,83 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcLatencyHistogram.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMC_LATENCY_HISTOGRAM_H_
+#define ECMC_LATENCY_HISTOGRAM_H_
+
+#include <stdint.h>
+#include "ecmcError.h"
+#include "ecmcDefinitions.h"
+#include "../com/ecmcAsynPortDriver.h"
+#include "../com/ecmcAsynDataItem.h"
+
+#define ERROR_LATENCY_HIST_ASYN_PAR_BUFFER_OVERFLOW 0x233000
+
+/**
+ * Histogram of timing values (latency, period, execution time..) in ns.
+ *
+ * ECMC_LATENCY_HIST_BUCKETS logarithmic buckets. Bucket 0 holds values below
+ * ECMC_LATENCY_HIST_MIN_NS and the last bucket values above
+ * ECMC_LATENCY_HIST_MAX_NS.
+ *
+ * add() and refreshAsyn() are called from the realtime thread only (single
+ * writer, no locking). Reset requests (asyn) are handled in the next add().
+ * If a bucket count saturates all buckets are halved.
+ *
+ * Asyn parameters ("<prefix>.<param>"):
+ *   hist       : Counts per bucket (waveform)
+ *   hist.edges : Lower edge of each bucket [ns] (waveform)
+ *   hist.reset : Clear histogram
+ *   p50, p99, p999 : Percentiles [ns] (upper edge of bucket)
+ */
+class ecmcLatencyHistogram : public ecmcError {
+ public:
+  ecmcLatencyHistogram(ecmcAsynPortDriver *asynPortDriver,
+                       const char         *prefix);
+  ~ecmcLatencyHistogram();
+  void add(uint32_t valueNs);
+  void refreshAsyn(int force);
+  void reset();
+
+ private:
+  void              initVars();
+  void              initEdges();
+  int               initAsyn(const char *prefix);
+  ecmcAsynDataItem* addParam(const char   *prefix,
+                             const char   *name,
+                             asynParamType type,
+                             uint8_t      *data,
+                             size_t        bytes);
+  void              updatePercentiles();
+  static asynStatus asynWriteReset(void         *data,
+                                   size_t        bytes,
+                                   asynParamType asynParType,
+                                   void         *userObj);
+
+  ecmcAsynPortDriver *asynPortDriver_;
+  ecmcAsynDataItem   *asynHist_;
+  ecmcAsynDataItem   *asynEdges_;
+  ecmcAsynDataItem   *asynReset_;
+  ecmcAsynDataItem   *asynP50_;
+  ecmcAsynDataItem   *asynP99_;
+  ecmcAsynDataItem   *asynP999_;
+  // Upper edge of all buckets except the last
+  uint32_t            upperEdges_[ECMC_LATENCY_HIST_BUCKETS - 1];
+  int32_t             lowerEdges_[ECMC_LATENCY_HIST_BUCKETS];
+  int32_t             counts_[ECMC_LATENCY_HIST_BUCKETS];
+  uint32_t            maxNs_;
+  int32_t             p50Ns_;
+  int32_t             p99Ns_;
+  int32_t             p999Ns_;
+  int32_t             resetCmd_;
+  int                 resetRequest_;
+};
+
+#endif  /* ECMC_LATENCY_HISTOGRAM_H_ */
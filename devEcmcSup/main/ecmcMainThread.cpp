@@ -50,6 +50,13 @@ static unsigned int    counter = 0;
 static struct timespec masterActivationTimeMonotonic = {};
 static struct timespec masterActivationTimeOffset    = {};
 static struct timespec masterActivationTimeRealtime  = {};
+// Objects executed by rt task groups are skipped in ecmc_rt
+// (axes: group index + 1, 0 = ecmc_rt)
+static int axisInRtTaskGroup[ECMC_MAX_AXES]     = {};
+// Execution order of axes within their rt task group
+static int axisRtTaskGroupOrder[ECMC_MAX_AXES]  = {};
+static int plcInRtTaskGroup[ECMC_MAX_PLCS]      = {};
+static int pluginInRtTaskGroup[ECMC_MAX_PLUGINS] = {};
 
 /*****************************************************************************/
 
@@ -63,6 +70,19 @@ void printStatus() {
   }
 }
 
+void addThreadHistograms() {
+  uint32_t values[ECMC_THREAD_HIST_COUNT] = { threadDiag.latency_ns,
+                                              threadDiag.period_ns,
+                                              threadDiag.exec_ns,
+                                              threadDiag.sendperiod_ns };
+
+  for (int i = 0; i < ECMC_THREAD_HIST_COUNT; i++) {
+    if (threadHistograms[i] != NULL) {
+      threadHistograms[i]->add(values[i]);
+    }
+  }
+}
+
 void updateAsynParams(int force) {
   
   if(!asynPort->getAllowRtThreadCom()){
@@ -102,6 +122,23 @@ void updateAsynParams(int force) {
     threadDiag.send_max_ns  = 0;    
   }
   
+  for (int i = 0; i < ECMC_THREAD_HIST_COUNT; i++) {
+    if (threadHistograms[i] != NULL) {
+      threadHistograms[i]->refreshAsyn(force);
+    }
+  }
+
+  for (int i = 0; i < ECMC_MAX_RT_TASK_GROUPS; i++) {
+    if (rtTaskGroups[i] != NULL) {
+      rtTaskGroups[i]->refreshAsyn();
+    }
+  }
+
+  // Rt task groups done for this cycle
+  if (execProfiler != NULL) {
+    execProfiler->refreshAsyn(force);
+  }
+
   controllerErrorOld = controllerError;
   controllerError = getControllerError();
   if(controllerErrorOld != controllerError || force) { // update on change
@@ -120,7 +157,12 @@ void updateAsynParams(int force) {
         asynSkipUpdateCounterFastest = 0;
       }
       if (asynPort->getAllowRtThreadCom()) {
-        asynPort->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST, ECMC_ASYN_DEFAULT_ADDR);
+        ecmcAsynPublisher *publisher = asynPort->getRtPublisher();
+        if (publisher) {
+          publisher->pushCallbacks();
+        } else {
+          asynPort->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST, ECMC_ASYN_DEFAULT_ADDR);
+        }
         /* refresh updated counter (To know in epics when refresh have been made)
         waveform*/
         ecmcUpdatedCounter++;
@@ -240,8 +282,13 @@ void cyclic_task(void *usr) {
   // start 100ms + 1 period after  master activate (in setAppMode())
   wakeupTime = timespec_add(masterActivationTimeMonotonic, offsetStartTime);
 
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-  
+  // Asyn param refreshes are queued to publisher (if any)
+  ecmcAsynPublisher::setRtContext(true);
+  bool diagValid    = false;
+  // Execution time per object (ecmcExecProfiler)
+  bool     prof   = false;
+  uint64_t profNs = 0;
+
   while (appModeCmd == ECMC_MODE_RUNTIME) {
     wakeupTime = timespec_add(wakeupTime, cycletime);
 
@@ -249,12 +296,16 @@ void cyclic_task(void *usr) {
      * otherwise deadlock in stratup phase
      * (sleep in waitforstartup() this is called
      * in asyn thread) .
+     * Also needed with asyn publisher since asyn writes, drvUserCreate
+     * and runtime commands (ecmcCom, command lists) still access the
+     * realtime objects directly with the port locked (the publisher only
+     * moves the callbacks out of ecmc_rt). Only motor record access and
+     * axis control word writes are lock free. A non realtime thread that
+     * holds the port lock at wakeup therefore still delays this cycle.
      * */
     if (appModeStat == ECMC_MODE_RUNTIME) {
       if(asynPort) asynPort->unlock();      
     }
-    // Mutex for motor record access
-    if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
     clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeupTime, NULL);
 
     if (appModeStat == ECMC_MODE_RUNTIME) {      
@@ -262,8 +313,8 @@ void cyclic_task(void *usr) {
         asynPort->lock();        
       }
     }
-    // Mutex for motor record access
-    if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
+    // Motor record access through axis command queues and status snapshots
+    // (without port lock, see ecmcAxisBase::queueCmd())
 
     clock_gettime(CLOCK_MONOTONIC, &startTime);
     
@@ -274,6 +325,12 @@ void cyclic_task(void *usr) {
     lastStartTime = startTime;
     lastSendTime  = sendTime;
 
+    // Histograms (first cycle has no valid period)
+    if (diagValid) {
+      addThreadHistograms();
+    }
+    diagValid = true;
+
     if (threadDiag.latency_ns > threadDiag.latency_max_ns) {
       threadDiag.latency_max_ns = threadDiag.latency_ns;
     }
@@ -305,33 +362,92 @@ void cyclic_task(void *usr) {
     if (threadDiag.sendperiod_ns < threadDiag.send_min_ns) {
       threadDiag.send_min_ns = threadDiag.sendperiod_ns;
     }
+    prof = execProfiler && execProfiler->beginCycle();
+    if (prof) {
+      profNs = ecmcExecProfiler::now();
+    }
+
     if(ec->getInitDone()) {
       ec->receive();
       ec->checkDomainState();
     }
     ecStat = ec->statusOK() || !ec->getInitDone();
+
+    if (prof) {
+      execProfiler->add(ECMC_PROF_SLOT_EC_RECEIVE, profNs);
+    }
+
+    // Axis groups (setpoints to member axes, before axes are executed)
+    for (i = 0; i < ECMC_MAX_AXIS_GROUPS; i++) {
+      if (axisGroups[i] != NULL) {
+        axisGroups[i]->execute();
+      }
+    }
+
+    // Start rt task groups (executes in parallel with the axes below)
+    for (i = 0; i < ECMC_MAX_RT_TASK_GROUPS; i++) {
+      if (rtTaskGroups[i] != NULL) {
+        rtTaskGroups[i]->trigger(ecStat, controllerError);
+      }
+    }
+
     // Motion
     for (i = 0; i < ECMC_MAX_AXES; i++) {
-      if (axes[i] != NULL) {
+      if (axes[i] != NULL && !axisInRtTaskGroup[i]) {
         plcs->execute(AXIS_PLC_ID_TO_PLC_ID(i),ecStat);
-        axes[i]->execute(ecStat);        
+        if (prof) {
+          profNs = ecmcExecProfiler::now();
+        }
+        axes[i]->execute(ecStat);
+        if (prof) {
+          execProfiler->add(ECMC_PROF_SLOT_AXIS_FIRST + i, profNs);
+        }
+      }
+    }
+
+    // Wait for rt task groups before events, plugins and PLCs (same order
+    // as without groups, these may access any axis)
+    int groupPluginsError = 0;
+
+    for (i = 0; i < ECMC_MAX_RT_TASK_GROUPS; i++) {
+      if (rtTaskGroups[i] != NULL) {
+        rtTaskGroups[i]->waitDone();
+        if (rtTaskGroups[i]->getPluginsError()) {
+          groupPluginsError = rtTaskGroups[i]->getPluginsError();
+        }
       }
     }
 
     // Data events
     for (i = 0; i < ECMC_MAX_EVENT_OBJECTS; i++) {
       if (events[i] != NULL) {
+        if (prof) {
+          profNs = ecmcExecProfiler::now();
+        }
         events[i]->execute(ecStat);
+        if (prof) {
+          execProfiler->add(ECMC_PROF_SLOT_EVENT_FIRST + i, profNs);
+        }
       }
     }
 
     // Plugins
     for (i = 0; i < ECMC_MAX_PLUGINS; i++) {
-      if (plugins[i] != NULL) {
+      if (plugins[i] != NULL && !pluginInRtTaskGroup[i]) {
+        if (prof) {
+          profNs = ecmcExecProfiler::now();
+        }
         pluginsError=plugins[i]->exeRTFunc(controllerError);
+        if (prof) {
+          execProfiler->add(ECMC_PROF_SLOT_PLUGIN_FIRST + i, profNs);
+        }
       }
     }
 
+    if (groupPluginsError) {
+      pluginsError = groupPluginsError;
+    }
+
     // PLCs
     if (plcs) {
       plcs->execute(ecStat);
@@ -359,7 +475,13 @@ void cyclic_task(void *usr) {
       }
     }
     if(asynPort->getEpicsState()>=14){
+      if (prof) {
+        profNs = ecmcExecProfiler::now();
+      }
       updateAsynParams(0);
+      if (prof) {
+        execProfiler->add(ECMC_PROF_SLOT_ASYN, profNs);
+      }
     }
     
     clock_gettime(CLOCK_MONOTONIC, &sendTime);
@@ -367,6 +489,19 @@ void cyclic_task(void *usr) {
       ec->send(masterActivationTimeOffset);
     }
     clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+    if (prof) {
+      execProfiler->add(ECMC_PROF_SLOT_EC_SEND,
+                        (uint64_t)sendTime.tv_sec * MCU_NSEC_PER_SEC +
+                        sendTime.tv_nsec);
+    }
+  }
+
+  // Stop rt task groups from this thread (no trigger in progress)
+  for (i = 0; i < ECMC_MAX_RT_TASK_GROUPS; i++) {
+    if (rtTaskGroups[i] != NULL) {
+      rtTaskGroups[i]->stop();
+    }
   }
   appModeStat = ECMC_MODE_CONFIG;
 }
@@ -408,8 +543,34 @@ int ecmcInitThread(void) {
     commandLists[i] = NULL;
   }
 
+  for (int i = 0; i < ECMC_MAX_MULTI_RECORDERS; i++) {
+    multiRecorders[i] = NULL;
+  }
+
+  for (int i = 0; i < ECMC_MAX_DATA_STREAMS; i++) {
+    dataStreams[i] = NULL;
+  }
+
   for (int i = 0; i < ECMC_MAX_PLUGINS; i++) {
     plugins[i] = NULL;
+    pluginInRtTaskGroup[i] = 0;
+  }
+
+  for (int i = 0; i < ECMC_MAX_RT_TASK_GROUPS; i++) {
+    rtTaskGroups[i] = NULL;
+  }
+
+  for (int i = 0; i < ECMC_MAX_AXIS_GROUPS; i++) {
+    axisGroups[i] = NULL;
+  }
+
+  for (int i = 0; i < ECMC_MAX_AXES; i++) {
+    axisInRtTaskGroup[i]    = 0;
+    axisRtTaskGroupOrder[i] = 0;
+  }
+
+  for (int i = 0; i < ECMC_MAX_PLCS; i++) {
+    plcInRtTaskGroup[i] = 0;
   }
   
   plcs = NULL;
@@ -471,10 +632,44 @@ int lockMem(int size) {
     return 0;
 }
 
+int startRtTaskGroups() {
+  LOGINFO4("%s/%s:%d\n", __FILE__, __FUNCTION__, __LINE__);
+  bool groupsUsed = false;
+
+  for (int i = 0; i < ECMC_MAX_RT_TASK_GROUPS; i++) {
+    if (rtTaskGroups[i] != NULL) {
+      // Axis PLCs might have been created after the axis was added
+      rtTaskGroups[i]->setPLCMain(plcs);
+      rtTaskGroups[i]->setExecProfiler(execProfiler);
+      int errorCode = rtTaskGroups[i]->start();
+      if (errorCode) {
+        return errorCode;
+      }
+      groupsUsed = true;
+    }
+  }
+
+  // Asyn params refreshed from several threads
+  if (asynPort) {
+    asynPort->setRtParamLockEnable(groupsUsed);
+  }
+
+  return 0;
+}
+
 int startRTthread() {
   LOGINFO4("%s/%s:%d\n", __FILE__, __FUNCTION__, __LINE__);
   int prio = ECMC_PRIO_HIGH;
 
+  if (plcs) {
+    plcs->setExecProfiler(execProfiler);
+  }
+
+  int errorCode = startRtTaskGroups();
+  if (errorCode) {
+    return errorCode;
+  }
+
   if(epicsThreadCreate(ECMC_RT_THREAD_NAME, prio, ECMC_STACK_SIZE, cyclic_task, NULL) == NULL) {
   
     LOGERR(
@@ -516,6 +711,12 @@ int setAppModeCfg(int mode) {
     }
   }
 
+  for (int i = 0; i < ECMC_MAX_AXIS_GROUPS; i++) {
+    if (axisGroups[i] != NULL) {
+      axisGroups[i]->setRealTimeStarted(false);
+    }
+  }
+
   munlockall();
   return 0;
 }
@@ -590,6 +791,12 @@ int setAppModeRun(int mode) {
     }
   }
 
+  for (int i = 0; i < ECMC_MAX_AXIS_GROUPS; i++) {
+    if (axisGroups[i] != NULL) {
+      axisGroups[i]->setRealTimeStarted(true);
+    }
+  }
+
   errorCode = waitForThreadToStart(ecTimeoutSeconds > 0 ? ecTimeoutSeconds : EC_START_TIMEOUT_S);
 
   if (errorCode) {
@@ -708,6 +915,56 @@ int setSamplePeriodMs(double samplePeriodMs) {
   return 0;
 }
 
+/*
+ * Cam master axes must be executed before the slave in the same thread:
+ * in ecmc_rt in index order, in an rt task group in the order added.
+ */
+static int validateAxisCamMasters() {
+  for (int i = 0; i < ECMC_MAX_AXES; i++) {
+    if (axes[i] == NULL) {
+      continue;
+    }
+
+    ecmcAxisBase *master = axes[i]->getCam()->getMasterAxis();
+
+    if (master == NULL) {
+      continue;
+    }
+
+    int masterIndex = -1;
+
+    for (int j = 0; j < ECMC_MAX_AXES; j++) {
+      if (axes[j] == master) {
+        masterIndex = j;
+        break;
+      }
+    }
+
+    int errorCode = 0;
+
+    if (masterIndex == i) {
+      errorCode = ERROR_AXIS_CAM_MASTER_SELF;
+    } else if ((masterIndex < 0) ||
+               (axisInRtTaskGroup[masterIndex] != axisInRtTaskGroup[i])) {
+      errorCode = ERROR_AXIS_CAM_MASTER_RT_TASK_GROUP;
+    } else if (axisInRtTaskGroup[i] ?
+               axisRtTaskGroupOrder[masterIndex] > axisRtTaskGroupOrder[i] :
+               masterIndex > i) {
+      errorCode = ERROR_AXIS_CAM_MASTER_ORDER;
+    }
+
+    if (errorCode) {
+      LOGERR(
+        "ERROR: Cam master axis %d of axis %d must execute before the slave in the same thread (0x%x).\n",
+        masterIndex,
+        i,
+        errorCode);
+      return errorCode;
+    }
+  }
+  return 0;
+}
+
 int validateConfig() {
   LOGINFO4("%s/%s:%d\n", __FILE__, __FUNCTION__, __LINE__);
 
@@ -734,6 +991,25 @@ int validateConfig() {
     }
   }
 
+  errorCode = validateAxisCamMasters();
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  for (int i = 0; i < ECMC_MAX_AXIS_GROUPS; i++) {
+    if (axisGroups[i] != NULL) {
+      errorCode = axisGroups[i]->validate();
+
+      if (errorCode) {
+        LOGERR("ERROR: Validation failed on axis group %d with error code %x.",
+               i,
+               errorCode);
+        return errorCode;
+      }
+    }
+  }
+
   for (int i = 0; i < ECMC_MAX_EVENT_OBJECTS; i++) {
     if (events[i] != NULL) {
       errorCode = events[i]->validate();
@@ -772,4 +1048,244 @@ int validateConfig() {
   }
   
   return 0;
-}
\ No newline at end of file
+}
+int createRtTaskGroup(int groupIndex, int priority, int cpu) {
+  LOGINFO4("%s/%s:%d groupIndex=%d, priority=%d, cpu=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           priority,
+           cpu);
+
+  if (groupIndex < 0 || groupIndex >= ECMC_MAX_RT_TASK_GROUPS) {
+    return ERROR_MAIN_RT_TASK_GROUP_INDEX_OUT_OF_RANGE;
+  }
+
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  if (rtTaskGroups[groupIndex]) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d already created (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           ERROR_MAIN_RT_TASK_GROUP_OBJ_ALREADY_ASSIGNED);
+    return ERROR_MAIN_RT_TASK_GROUP_OBJ_ALREADY_ASSIGNED;
+  }
+
+  rtTaskGroups[groupIndex] = new ecmcRtTaskGroup(asynPort,
+                                                 groupIndex,
+                                                 priority,
+                                                 cpu);
+  if (!rtTaskGroups[groupIndex]) {
+    return ERROR_MAIN_RT_TASK_GROUP_NULL;
+  }
+
+  int errorCode = rtTaskGroups[groupIndex]->getErrorID();
+  if (errorCode) {
+    delete rtTaskGroups[groupIndex];
+    rtTaskGroups[groupIndex] = NULL;
+    return errorCode;
+  }
+
+  return 0;
+}
+
+int createAsynPublisher(int queueDepth, int dataBufferBytes) {
+  LOGINFO4("%s/%s:%d queueDepth=%d, dataBufferBytes=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           queueDepth,
+           dataBufferBytes);
+
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  if (asynPublisher) {
+    LOGERR("%s/%s:%d: ERROR: Asyn publisher already created (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_MAIN_ASYN_PUBLISHER_ALREADY_CREATED);
+    return ERROR_MAIN_ASYN_PUBLISHER_ALREADY_CREATED;
+  }
+
+  if (!asynPort) {
+    return ERROR_MAIN_ASYN_PORT_DRIVER_NULL;
+  }
+
+  asynPublisher = new ecmcAsynPublisher(asynPort, queueDepth, dataBufferBytes);
+
+  int errorCode = asynPublisher->getErrorID();
+  if (!errorCode) {
+    errorCode = asynPublisher->start();
+  }
+
+  if (errorCode) {
+    delete asynPublisher;
+    asynPublisher = NULL;
+    return errorCode;
+  }
+
+  asynPort->setPublisher(asynPublisher);
+  return 0;
+}
+
+int addAxisToRtTaskGroup(int groupIndex, int axisIndex) {
+  LOGINFO4("%s/%s:%d groupIndex=%d, axisIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           axisIndex);
+
+  if (groupIndex < 0 || groupIndex >= ECMC_MAX_RT_TASK_GROUPS) {
+    return ERROR_MAIN_RT_TASK_GROUP_INDEX_OUT_OF_RANGE;
+  }
+
+  if (!rtTaskGroups[groupIndex]) {
+    return ERROR_MAIN_RT_TASK_GROUP_NULL;
+  }
+
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  if (axisIndex < 0 || axisIndex >= ECMC_MAX_AXES) {
+    return ERROR_MAIN_AXIS_INDEX_OUT_OF_RANGE;
+  }
+
+  if (!axes[axisIndex]) {
+    return ERROR_MAIN_AXIS_OBJECT_NULL;
+  }
+
+  if (axisInRtTaskGroup[axisIndex]) {
+    return ERROR_MAIN_RT_TASK_GROUP_OBJ_ALREADY_ASSIGNED;
+  }
+
+  int errorCode = rtTaskGroups[groupIndex]->addAxis(axes[axisIndex],
+                                                    axisIndex);
+  if (errorCode) {
+    return errorCode;
+  }
+
+  int order = 0;
+
+  for (int i = 0; i < ECMC_MAX_AXES; i++) {
+    if (axisInRtTaskGroup[i] == groupIndex + 1) {
+      order++;
+    }
+  }
+
+  axisInRtTaskGroup[axisIndex]    = groupIndex + 1;
+  axisRtTaskGroupOrder[axisIndex] = order;
+  return 0;
+}
+
+int addPLCToRtTaskGroup(int groupIndex, int plcIndex) {
+  LOGINFO4("%s/%s:%d groupIndex=%d, plcIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           plcIndex);
+
+  if (groupIndex < 0 || groupIndex >= ECMC_MAX_RT_TASK_GROUPS) {
+    return ERROR_MAIN_RT_TASK_GROUP_INDEX_OUT_OF_RANGE;
+  }
+
+  if (!rtTaskGroups[groupIndex]) {
+    return ERROR_MAIN_RT_TASK_GROUP_NULL;
+  }
+
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  if (plcIndex < 0 || plcIndex >= ECMC_MAX_PLCS) {
+    return ERROR_PLCS_INDEX_OUT_OF_RANGE;
+  }
+
+  if (plcInRtTaskGroup[plcIndex]) {
+    return ERROR_MAIN_RT_TASK_GROUP_OBJ_ALREADY_ASSIGNED;
+  }
+
+  int errorCode = rtTaskGroups[groupIndex]->addPLC(plcs, plcIndex);
+  if (errorCode) {
+    return errorCode;
+  }
+
+  errorCode = plcs->setExecuteExternal(plcIndex, 1);
+  if (errorCode) {
+    return errorCode;
+  }
+
+  plcInRtTaskGroup[plcIndex] = 1;
+  return 0;
+}
+
+int addPluginToRtTaskGroup(int groupIndex, int pluginIndex) {
+  LOGINFO4("%s/%s:%d groupIndex=%d, pluginIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           pluginIndex);
+
+  if (groupIndex < 0 || groupIndex >= ECMC_MAX_RT_TASK_GROUPS) {
+    return ERROR_MAIN_RT_TASK_GROUP_INDEX_OUT_OF_RANGE;
+  }
+
+  if (!rtTaskGroups[groupIndex]) {
+    return ERROR_MAIN_RT_TASK_GROUP_NULL;
+  }
+
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  if (pluginIndex < 0 || pluginIndex >= ECMC_MAX_PLUGINS) {
+    return ERROR_MAIN_PLUGIN_INDEX_OUT_OF_RANGE;
+  }
+
+  if (!plugins[pluginIndex]) {
+    return ERROR_MAIN_PLUGIN_OBJECT_NULL;
+  }
+
+  if (pluginInRtTaskGroup[pluginIndex]) {
+    return ERROR_MAIN_RT_TASK_GROUP_OBJ_ALREADY_ASSIGNED;
+  }
+
+  int errorCode = rtTaskGroups[groupIndex]->addPlugin(plugins[pluginIndex],
+                                                      pluginIndex);
+  if (errorCode) {
+    return errorCode;
+  }
+
+  pluginInRtTaskGroup[pluginIndex] = 1;
+  return 0;
+}
+
+int reportRtTaskGroup(int groupIndex) {
+  LOGINFO4("%s/%s:%d groupIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex);
+
+  if (groupIndex < 0 || groupIndex >= ECMC_MAX_RT_TASK_GROUPS) {
+    return ERROR_MAIN_RT_TASK_GROUP_INDEX_OUT_OF_RANGE;
+  }
+
+  if (!rtTaskGroups[groupIndex]) {
+    return ERROR_MAIN_RT_TASK_GROUP_NULL;
+  }
+
+  rtTaskGroups[groupIndex]->report();
+  return 0;
+}
@@ -97,6 +97,99 @@ int setSampleRate(double sampleRate);
  */
 int setSamplePeriodMs(double samplePeriodMs);
 
+/** \brief Create a realtime task group.
+ *
+ * A task group is a worker thread that executes a subset of the axes, PLCs
+ * and plugins in parallel with the main realtime thread. All task groups are
+ * triggered after EtherCAT receive and the main realtime thread waits for
+ * all groups to finish before EtherCAT send. Objects that exchange data
+ * (synchronized axes, PLCs accessing several axes) should be executed in the
+ * same task group.\n
+ *
+ * \param[in] groupIndex Index of task group.\n
+ * \param[in] priority Thread priority (SCHED_FIFO 1..99, 0 = not realtime).\n
+ * \param[in] cpu Cpu to bind the thread to (-1 = no affinity).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Create task group 0 with priority 70 running on cpu 2.\n
+ * "Cfg.CreateRtTaskGroup(0,70,2)" //Command string to ecmcCmdParser.c
+ */
+int createRtTaskGroup(int groupIndex, int priority, int cpu);
+
+/** \brief Execute axis (and axis PLC) in a realtime task group.
+ *
+ * \param[in] groupIndex Index of task group.\n
+ * \param[in] axisIndex Index of axis.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Execute axis 5 in task group 0.\n
+ * "Cfg.AddAxisToRtTaskGroup(0,5)" //Command string to ecmcCmdParser.c
+ */
+int addAxisToRtTaskGroup(int groupIndex, int axisIndex);
+
+/** \brief Execute PLC in a realtime task group.
+ *
+ * \param[in] groupIndex Index of task group.\n
+ * \param[in] plcIndex Index of PLC.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Execute PLC 1 in task group 0.\n
+ * "Cfg.AddPLCToRtTaskGroup(0,1)" //Command string to ecmcCmdParser.c
+ */
+int addPLCToRtTaskGroup(int groupIndex, int plcIndex);
+
+/** \brief Execute plugin realtime function in a realtime task group.
+ *
+ * \param[in] groupIndex Index of task group.\n
+ * \param[in] pluginIndex Index of plugin.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Execute plugin 0 in task group 1.\n
+ * "Cfg.AddPluginToRtTaskGroup(1,0)" //Command string to ecmcCmdParser.c
+ */
+int addPluginToRtTaskGroup(int groupIndex, int pluginIndex);
+
+/** \brief Printout details of realtime task group.
+ *
+ * \param[in] groupIndex Index of task group.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Printout information about task group 0.\n
+ * "Cfg.ReportRtTaskGroup(0)" //Command string to ecmcCmdParser.c
+ */
+int reportRtTaskGroup(int groupIndex);
+
+/** \brief Create asyn publisher.
+ *
+ * Moves asyn parameter callbacks out of the realtime threads. The realtime
+ * threads (ecmc_rt and rt task groups) only copy refreshed values into a
+ * ring buffer and a separate normal priority thread writes them to the
+ * asyn parameter library and does the callbacks (EPICS record processing).\n
+ * If the ring buffer is full the values are dropped, see parameters
+ * "ecmc.asyn.pub.overflow", "ecmc.asyn.pub.overflow.data" and
+ * "ecmc.asyn.pub.used.max".\n
+ *
+ * \param[in] queueDepth Max number of queued refreshes.\n
+ * \param[in] dataBufferBytes Size of buffer for queued data (sum of all
+ *                            queued values and arrays).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note ecmc_rt still locks the asyn port while executing, so asyn writes
+ * and runtime commands are synchronized with the realtime objects as
+ * without publisher. The publisher thread takes the same lock and is
+ * therefore only executed between the realtime cycles.\n
+ *
+ * \note Example: Create asyn publisher with 4096 entries and 256kB data.\n
+ * "Cfg.CreateAsynPublisher(4096,262144)" //Command string to ecmcCmdParser.c
+ */
+int createAsynPublisher(int queueDepth, int dataBufferBytes);
+
 /** \brief Update main asyn parameters
  *
  * \param[in] force Force update\n
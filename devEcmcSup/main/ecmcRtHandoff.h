@@ -0,0 +1,229 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcRtHandoff.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMC_RT_HANDOFF_H_
+#define ECMC_RT_HANDOFF_H_
+
+#include <string.h>
+#include <stddef.h>
+#include <epicsAtomic.h>
+
+/**
+ * Sequence lock snapshot of data published by the realtime thread.
+ *
+ * One writer (realtime) and any number of readers (non realtime).
+ * The writer never waits. A reader retries the copy if the writer
+ * published new data while the copy was made.
+ */
+template <typename T>
+class ecmcRtSnapshot {
+ public:
+  ecmcRtSnapshot() {
+    sequence_ = 0;
+    memset(&data_, 0, sizeof(T));
+  }
+
+  // Realtime (single writer)
+  void publish(const T *data) {
+    size_t seq = sequence_;
+    // Odd sequence = write in progress
+    epicsAtomicSetSizeT(&sequence_, seq + 1);
+    epicsAtomicWriteMemoryBarrier();
+    memcpy(&data_, data, sizeof(T));
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&sequence_, seq + 2);
+  }
+
+  // Non realtime. Returns 0 if a consistent copy was made within maxRetries
+  int read(T *data, int maxRetries) const {
+    for (int i = 0; i < maxRetries; i++) {
+      size_t seqStart = epicsAtomicGetSizeT(&sequence_);
+
+      if (seqStart & 1) {
+        continue;
+      }
+      epicsAtomicReadMemoryBarrier();
+      memcpy(data, &data_, sizeof(T));
+      epicsAtomicReadMemoryBarrier();
+
+      if (epicsAtomicGetSizeT(&sequence_) == seqStart) {
+        return 0;
+      }
+    }
+    return -1;
+  }
+
+  // Number of publish() calls
+  size_t getPublishCount() const {
+    return epicsAtomicGetSizeT(&sequence_) / 2;
+  }
+
+ private:
+  size_t sequence_;
+  T      data_;
+};
+
+/**
+ * Lock free single producer single consumer command queue.
+ *
+ * The consumer (realtime) never waits. Several non realtime producers
+ * must serialize push() with a lock of their own (the consumer is not
+ * affected by that lock). SIZE must be a power of 2.
+ */
+template <typename T, size_t SIZE>
+class ecmcRtCmdQueue {
+ public:
+  ecmcRtCmdQueue() {
+    head_ = 0;
+    tail_ = 0;
+    memset(&items_[0], 0, sizeof(items_));
+  }
+
+  // Producer. Returns false if queue is full
+  bool push(const T *item) {
+    size_t head = head_;
+
+    if (head - epicsAtomicGetSizeT(&tail_) >= SIZE) {
+      return false;
+    }
+    items_[head & (SIZE - 1)] = *item;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&head_, head + 1);
+    return true;
+  }
+
+  // Consumer. Returns false if queue is empty
+  bool pop(T *item) {
+    size_t tail = tail_;
+
+    if (tail == epicsAtomicGetSizeT(&head_)) {
+      return false;
+    }
+    epicsAtomicReadMemoryBarrier();
+    *item = items_[tail & (SIZE - 1)];
+    epicsAtomicReadMemoryBarrier();
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&tail_, tail + 1);
+    return true;
+  }
+
+  // Consumer. Copy of next item without removing it (false if empty)
+  bool peek(T *item) const {
+    size_t tail = tail_;
+
+    if (tail == epicsAtomicGetSizeT(&head_)) {
+      return false;
+    }
+    epicsAtomicReadMemoryBarrier();
+    *item = items_[tail & (SIZE - 1)];
+    return true;
+  }
+
+  // Sequence number of the next pushed item
+  size_t getPushCount() const {
+    return epicsAtomicGetSizeT(&head_);
+  }
+
+  // Sequence number of the next popped item
+  size_t getPopCount() const {
+    return epicsAtomicGetSizeT(&tail_);
+  }
+
+ private:
+  T      items_[SIZE];
+  size_t head_;
+  size_t tail_;
+};
+
+/**
+ * Same as ecmcRtCmdQueue but with the size set at configuration (for large
+ * buffers that only some objects use). The size is rounded up to a power
+ * of 2. init() must not be called while the buffer is in use.
+ */
+template <typename T>
+class ecmcRtRingBuffer {
+ public:
+  ecmcRtRingBuffer() {
+    items_ = NULL;
+    size_  = 0;
+    head_  = 0;
+    tail_  = 0;
+  }
+
+  ~ecmcRtRingBuffer() {
+    delete[] items_;
+  }
+
+  // Configuration. Returns the allocated size
+  size_t init(size_t size) {
+    size_t allocSize = 1;
+
+    while (allocSize < size) {
+      allocSize <<= 1;
+    }
+    delete[] items_;
+    items_ = new T[allocSize];
+    memset(items_, 0, sizeof(T) * allocSize);
+    size_ = allocSize;
+    head_ = 0;
+    tail_ = 0;
+    return size_;
+  }
+
+  size_t getSize() const {
+    return size_;
+  }
+
+  // Producer. Returns false if buffer is full
+  bool push(const T *item) {
+    size_t head = head_;
+
+    if (head - epicsAtomicGetSizeT(&tail_) >= size_) {
+      return false;
+    }
+    items_[head & (size_ - 1)] = *item;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&head_, head + 1);
+    return true;
+  }
+
+  // Consumer. Returns false if buffer is empty
+  bool pop(T *item) {
+    size_t tail = tail_;
+
+    if (tail == epicsAtomicGetSizeT(&head_)) {
+      return false;
+    }
+    epicsAtomicReadMemoryBarrier();
+    *item = items_[tail & (size_ - 1)];
+    epicsAtomicReadMemoryBarrier();
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&tail_, tail + 1);
+    return true;
+  }
+
+  // Items in buffer
+  size_t getCount() const {
+    return epicsAtomicGetSizeT(&head_) - epicsAtomicGetSizeT(&tail_);
+  }
+
+  size_t getFree() const {
+    return size_ - getCount();
+  }
+
+ private:
+  T     *items_;
+  size_t size_;
+  size_t head_;
+  size_t tail_;
+};
+
+#endif  /* ECMC_RT_HANDOFF_H_ */
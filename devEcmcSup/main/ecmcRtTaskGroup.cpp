@@ -0,0 +1,489 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcRtTaskGroup.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // pthread_attr_setaffinity_np
+#endif
+#include "ecmcRtTaskGroup.h"
+#include <errno.h>
+#include <limits.h>
+#include <sched.h>
+#include <time.h>
+#include "ecmcErrorsList.h"
+#include "../com/ecmcAsynPublisher.h"
+
+ecmcRtTaskGroup::ecmcRtTaskGroup(ecmcAsynPortDriver *asynPortDriver,
+                                 int                 index,
+                                 int                 priority,
+                                 int                 cpu) {
+  initVars();
+  asynPortDriver_ = asynPortDriver;
+  index_          = index;
+  priority_       = priority;
+  cpu_            = cpu;
+
+  if (sem_init(&startSem_, 0, 0) || sem_init(&doneSem_, 0, 0)) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d: Semaphore init failed (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_RT_TASK_GROUP_SEM_INIT_FAIL);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_RT_TASK_GROUP_SEM_INIT_FAIL);
+    return;
+  }
+  semInit_ = true;
+
+  initAsyn();
+}
+
+ecmcRtTaskGroup::~ecmcRtTaskGroup() {
+  stop();
+
+  if (semInit_) {
+    sem_destroy(&startSem_);
+    sem_destroy(&doneSem_);
+  }
+}
+
+void ecmcRtTaskGroup::initVars() {
+  errorReset();
+  asynPortDriver_  = NULL;
+  asynExecTime_    = NULL;
+  asynExecTimeMax_ = NULL;
+
+  for (int i = 0; i < ECMC_MAX_AXES; i++) {
+    axes_[i]      = NULL;
+    axisIndex_[i] = -1;
+  }
+  axisCounter_ = 0;
+  plcs_        = NULL;
+
+  for (int i = 0; i < ECMC_MAX_PLCS; i++) {
+    plcIndex_[i] = -1;
+  }
+  plcCounter_ = 0;
+
+  for (int i = 0; i < ECMC_MAX_PLUGINS; i++) {
+    plugins_[i]     = NULL;
+    pluginIndex_[i] = -1;
+  }
+  pluginCounter_   = 0;
+  execProfiler_    = NULL;
+  index_           = 0;
+  priority_        = 0;
+  cpu_             = -1;
+  semInit_         = false;
+  threadRunning_   = false;
+  stop_            = false;
+  ecOK_            = 0;
+  controllerError_ = 0;
+  pluginsError_    = 0;
+  execTimeNs_      = 0;
+  execTimeMaxNs_   = 0;
+  waitCounter_     = 0;
+}
+
+int ecmcRtTaskGroup::initAsyn() {
+  if (!asynPortDriver_) {
+    return 0;
+  }
+
+  char buffer[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
+  const char *names[2] = { ECMC_ASYN_RT_GRP_PAR_EXECUTE_NAME,
+                           ECMC_ASYN_RT_GRP_PAR_EXECUTE_MAX_NAME };
+  int32_t    *data[2] = { &execTimeNs_, &execTimeMaxNs_ };
+  ecmcAsynDataItem **params[2] = { &asynExecTime_, &asynExecTimeMax_ };
+
+  for (int i = 0; i < 2; i++) {
+    unsigned int charCount = snprintf(buffer,
+                                      sizeof(buffer),
+                                      "ecmc." ECMC_THREAD_STR "."
+                                      ECMC_RT_TASK_GROUP_STR "%d.%s",
+                                      index_,
+                                      names[i]);
+
+    if (charCount >= sizeof(buffer) - 1) {
+      LOGERR(
+        "%s/%s:%d: ERROR: Failed to generate param name. Buffer to small (0x%x).\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        ERROR_RT_TASK_GROUP_ASYN_PAR_BUFFER_OVERFLOW);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_RT_TASK_GROUP_ASYN_PAR_BUFFER_OVERFLOW);
+    }
+
+    ecmcAsynDataItem *paramTemp = asynPortDriver_->addNewAvailParam(
+      buffer,
+      asynParamInt32,
+      (uint8_t *)data[i],
+      sizeof(int32_t),
+      ECMC_EC_S32,
+      0);
+
+    if (!paramTemp) {
+      LOGERR(
+        "%s/%s:%d: ERROR: Add create default parameter for %s failed.\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        buffer);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
+    }
+    paramTemp->setAllowWriteToEcmc(false);
+    paramTemp->refreshParam(1);
+    *params[i] = paramTemp;
+  }
+  return 0;
+}
+
+int ecmcRtTaskGroup::addAxis(ecmcAxisBase *axis, int axisIndex) {
+  if (!axis) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d: Axis %d NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           axisIndex,
+           ERROR_RT_TASK_GROUP_AXIS_NULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_RT_TASK_GROUP_AXIS_NULL);
+  }
+
+  if (axisCounter_ >= ECMC_MAX_AXES) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d: Axis list full (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_RT_TASK_GROUP_LIST_FULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_RT_TASK_GROUP_LIST_FULL);
+  }
+
+  axes_[axisCounter_]      = axis;
+  axisIndex_[axisCounter_] = axisIndex;
+  axisCounter_++;
+  return 0;
+}
+
+int ecmcRtTaskGroup::addPLC(ecmcPLCMain *plcs, int plcIndex) {
+  if (!plcs) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d: PLC object NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_RT_TASK_GROUP_PLC_NULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_RT_TASK_GROUP_PLC_NULL);
+  }
+
+  if (plcCounter_ >= ECMC_MAX_PLCS) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d: PLC list full (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_RT_TASK_GROUP_LIST_FULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_RT_TASK_GROUP_LIST_FULL);
+  }
+
+  plcs_                  = plcs;
+  plcIndex_[plcCounter_] = plcIndex;
+  plcCounter_++;
+  return 0;
+}
+
+int ecmcRtTaskGroup::addPlugin(ecmcPluginLib *plugin, int pluginIndex) {
+  if (!plugin) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d: Plugin %d NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           pluginIndex,
+           ERROR_RT_TASK_GROUP_PLUGIN_NULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_RT_TASK_GROUP_PLUGIN_NULL);
+  }
+
+  if (pluginCounter_ >= ECMC_MAX_PLUGINS) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d: Plugin list full (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_RT_TASK_GROUP_LIST_FULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_RT_TASK_GROUP_LIST_FULL);
+  }
+
+  plugins_[pluginCounter_]     = plugin;
+  pluginIndex_[pluginCounter_] = pluginIndex;
+  pluginCounter_++;
+  return 0;
+}
+
+void ecmcRtTaskGroup::setPLCMain(ecmcPLCMain *plcs) {
+  plcs_ = plcs;
+}
+
+void ecmcRtTaskGroup::setExecProfiler(ecmcExecProfiler *profiler) {
+  execProfiler_ = profiler;
+}
+
+void* ecmcRtTaskGroup::threadFunc(void *arg) {
+  ecmcRtTaskGroup *group = (ecmcRtTaskGroup *)arg;
+
+  // Asyn param refreshes are queued to publisher (if any)
+  ecmcAsynPublisher::setRtContext(true);
+
+  while (true) {
+    while (sem_wait(&group->startSem_) != 0 && errno == EINTR) {}
+
+    if (group->stop_) {
+      break;
+    }
+    group->execute();
+    sem_post(&group->doneSem_);
+  }
+  return NULL;
+}
+
+int ecmcRtTaskGroup::start() {
+  if (threadRunning_) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d: Already started (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_RT_TASK_GROUP_ALREADY_STARTED);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_RT_TASK_GROUP_ALREADY_STARTED);
+  }
+
+  if (!semInit_) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_RT_TASK_GROUP_SEM_INIT_FAIL);
+  }
+
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, PTHREAD_STACK_MIN + ECMC_STACK_SIZE);
+
+  if (priority_ > 0) {
+    struct sched_param sched = { 0 };
+    sched.sched_priority = priority_;
+    pthread_attr_setinheritsched(&attr, PTHREAD_EXPLICIT_SCHED);
+    pthread_attr_setschedpolicy(&attr, SCHED_FIFO);
+    pthread_attr_setschedparam(&attr, &sched);
+  }
+
+  if (cpu_ >= 0) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu_, &cpuSet);
+
+    if (pthread_attr_setaffinity_np(&attr, sizeof(cpuSet), &cpuSet)) {
+      pthread_attr_destroy(&attr);
+      LOGERR("%s/%s:%d: ERROR: Task group %d: Set affinity to cpu %d failed (0x%x).\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             index_,
+             cpu_,
+             ERROR_RT_TASK_GROUP_AFFINITY_FAIL);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_RT_TASK_GROUP_AFFINITY_FAIL);
+    }
+  }
+
+  stop_ = false;
+  int result = pthread_create(&thread_, &attr, threadFunc, this);
+  pthread_attr_destroy(&attr);
+
+  if (result) {
+    LOGERR("%s/%s:%d: ERROR: Task group %d: Thread create failed with %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           result,
+           ERROR_RT_TASK_GROUP_THREAD_CREATE_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_RT_TASK_GROUP_THREAD_CREATE_FAIL);
+  }
+
+  char name[16];
+  snprintf(name, sizeof(name), ECMC_RT_TASK_GROUP_THREAD_NAME "%d", index_);
+  pthread_setname_np(thread_, name);
+  threadRunning_ = true;
+
+  LOGINFO4("%s/%s:%d: INFO: Task group %d started (prio %d, cpu %d).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           priority_,
+           cpu_);
+  return 0;
+}
+
+void ecmcRtTaskGroup::stop() {
+  if (!threadRunning_) {
+    return;
+  }
+  stop_ = true;
+  sem_post(&startSem_);
+  pthread_join(thread_, NULL);
+  threadRunning_ = false;
+}
+
+void ecmcRtTaskGroup::trigger(int ecOK, int controllerError) {
+  ecOK_            = ecOK;
+  controllerError_ = controllerError;
+
+  if (!threadRunning_) {
+    // No thread, execute in callers context
+    execute();
+    sem_post(&doneSem_);
+    return;
+  }
+  sem_post(&startSem_);
+}
+
+void ecmcRtTaskGroup::waitDone() {
+  if (sem_trywait(&doneSem_) == 0) {
+    return;
+  }
+
+  // ecmc_rt needs to wait for this group
+  waitCounter_++;
+  while (sem_wait(&doneSem_) != 0 && errno == EINTR) {}
+}
+
+void ecmcRtTaskGroup::execute() {
+  struct timespec startTime, endTime;
+
+  clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+  // Enable latched by ecmc_rt before trigger
+  bool     profile = execProfiler_ && execProfiler_->getEnable();
+  uint64_t profNs  = 0;
+
+  for (int i = 0; i < axisCounter_; i++) {
+    if (plcs_) {
+      plcs_->execute(AXIS_PLC_ID_TO_PLC_ID(axisIndex_[i]), ecOK_);
+    }
+    if (profile) {
+      profNs = ecmcExecProfiler::now();
+    }
+    axes_[i]->execute(ecOK_);
+    if (profile) {
+      execProfiler_->add(ECMC_PROF_SLOT_AXIS_FIRST + axisIndex_[i], profNs);
+    }
+  }
+
+  if (plcs_) {
+    for (int i = 0; i < plcCounter_; i++) {
+      plcs_->execute(plcIndex_[i], ecOK_);
+    }
+  }
+
+  for (int i = 0; i < pluginCounter_; i++) {
+    if (profile) {
+      profNs = ecmcExecProfiler::now();
+    }
+    pluginsError_ = plugins_[i]->exeRTFunc(controllerError_);
+    if (profile) {
+      execProfiler_->add(ECMC_PROF_SLOT_PLUGIN_FIRST + pluginIndex_[i],
+                         profNs);
+    }
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &endTime);
+  execTimeNs_ = DIFF_NS(startTime, endTime);
+
+  if (execTimeNs_ > execTimeMaxNs_) {
+    execTimeMaxNs_ = execTimeNs_;
+  }
+}
+
+void ecmcRtTaskGroup::refreshAsyn() {
+  if (asynExecTime_) {
+    asynExecTime_->refreshParamRT(0);
+  }
+
+  if (asynExecTimeMax_) {
+    if (asynExecTimeMax_->refreshParamRT(0) == 0) {
+      execTimeMaxNs_ = 0;  // Reset after successfull write
+    }
+  }
+}
+
+int ecmcRtTaskGroup::getPluginsError() {
+  return pluginsError_;
+}
+
+int ecmcRtTaskGroup::getIndex() {
+  return index_;
+}
+
+void ecmcRtTaskGroup::report() {
+  LOGINFO("Task group %d:\n", index_);
+  LOGINFO("  Priority:       %d\n", priority_);
+  LOGINFO("  Cpu:            %d\n", cpu_);
+  LOGINFO("  Thread running: %d\n", threadRunning_);
+  LOGINFO("  Axes:          ");
+
+  for (int i = 0; i < axisCounter_; i++) {
+    LOGINFO(" %d", axisIndex_[i]);
+  }
+  LOGINFO("\n  PLCs:          ");
+
+  for (int i = 0; i < plcCounter_; i++) {
+    LOGINFO(" %d", plcIndex_[i]);
+  }
+  LOGINFO("\n  Plugins:        %d\n", pluginCounter_);
+  LOGINFO("  Exec time max:  %d ns\n", execTimeMaxNs_);
+  LOGINFO("  Wait counter:   %u\n", waitCounter_);
+}
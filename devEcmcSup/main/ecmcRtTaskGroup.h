@@ -0,0 +1,106 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcRtTaskGroup.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMC_RT_TASK_GROUP_H_
+#define ECMC_RT_TASK_GROUP_H_
+
+#include <pthread.h>
+#include <semaphore.h>
+#include "ecmcError.h"
+#include "ecmcDefinitions.h"
+#include "../motion/ecmcAxisBase.h"
+#include "../plc/ecmcPLCMain.h"
+#include "../plugin/ecmcPluginLib.h"
+#include "../com/ecmcAsynPortDriver.h"
+#include "ecmcExecProfiler.h"
+
+#define ERROR_RT_TASK_GROUP_AXIS_NULL 0x232000
+#define ERROR_RT_TASK_GROUP_PLC_NULL 0x232001
+#define ERROR_RT_TASK_GROUP_PLUGIN_NULL 0x232002
+#define ERROR_RT_TASK_GROUP_LIST_FULL 0x232003
+#define ERROR_RT_TASK_GROUP_SEM_INIT_FAIL 0x232004
+#define ERROR_RT_TASK_GROUP_THREAD_CREATE_FAIL 0x232005
+#define ERROR_RT_TASK_GROUP_AFFINITY_FAIL 0x232006
+#define ERROR_RT_TASK_GROUP_ALREADY_STARTED 0x232007
+#define ERROR_RT_TASK_GROUP_ASYN_PAR_BUFFER_OVERFLOW 0x232008
+
+/**
+ * Worker thread executing a subset of the axes, PLCs and plugins in parallel
+ * with the main realtime thread (ecmc_rt).
+ *
+ * Each cycle ecmc_rt triggers all groups after EtherCAT receive and executes
+ * the axes (and axis PLCs) not in any group in parallel. It then waits for
+ * all groups to finish before events, plugins and PLCs not in any group are
+ * executed, so these see the grouped axes in the same state as without
+ * groups. Objects that exchange data with each other (axis sync, PLCs
+ * accessing several axes) must be placed in the same group since no
+ * additional locking is made between groups (or the ungrouped axes).
+ */
+class ecmcRtTaskGroup : public ecmcError {
+ public:
+  ecmcRtTaskGroup(ecmcAsynPortDriver *asynPortDriver,
+                  int                 index,
+                  int                 priority,
+                  int                 cpu);
+  ~ecmcRtTaskGroup();
+  int  addAxis(ecmcAxisBase *axis, int axisIndex);
+  int  addPLC(ecmcPLCMain *plcs, int plcIndex);
+  int  addPlugin(ecmcPluginLib *plugin, int pluginIndex);
+  void setPLCMain(ecmcPLCMain *plcs);
+  void setExecProfiler(ecmcExecProfiler *profiler);
+  int  start();
+  void stop();
+  // Called from ecmc_rt: start execution of one cycle
+  void trigger(int ecOK, int controllerError);
+  // Called from ecmc_rt: wait for execution of the cycle to finish
+  void waitDone();
+  void refreshAsyn();
+  int  getPluginsError();
+  int  getIndex();
+  void report();
+
+ private:
+  void         initVars();
+  int          initAsyn();
+  void         execute();
+  static void* threadFunc(void *arg);
+
+  ecmcAsynPortDriver *asynPortDriver_;
+  ecmcAsynDataItem   *asynExecTime_;
+  ecmcAsynDataItem   *asynExecTimeMax_;
+  ecmcAxisBase       *axes_[ECMC_MAX_AXES];
+  int                 axisIndex_[ECMC_MAX_AXES];
+  int                 axisCounter_;
+  ecmcPLCMain        *plcs_;
+  int                 plcIndex_[ECMC_MAX_PLCS];
+  int                 plcCounter_;
+  ecmcPluginLib      *plugins_[ECMC_MAX_PLUGINS];
+  int                 pluginIndex_[ECMC_MAX_PLUGINS];
+  int                 pluginCounter_;
+  ecmcExecProfiler   *execProfiler_;
+  int                 index_;
+  int                 priority_;
+  int                 cpu_;
+  pthread_t           thread_;
+  sem_t               startSem_;
+  sem_t               doneSem_;
+  bool                semInit_;
+  volatile bool       threadRunning_;
+  volatile bool       stop_;
+  int                 ecOK_;
+  int                 controllerError_;
+  int                 pluginsError_;
+  int32_t             execTimeNs_;
+  int32_t             execTimeMaxNs_;
+  uint32_t            waitCounter_;
+};
+
+#endif  /* ECMC_RT_TASK_GROUP_H_ */
@@ -10,21 +10,56 @@
 *
 \*************************************************************************/
 
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // pthread_setname_np
+#endif
 #include "ecmcCommandList.h"
+#include <errno.h>
+#include <limits.h>
+#include <time.h>
+#include <epicsAtomic.h>
+#include "../main/ecmcErrorsList.h"
 
-ecmcCommandList::ecmcCommandList(int index) {
+ecmcCommandList::ecmcCommandList(ecmcAsynPortDriver *asynPortDriver,
+                                 int                 index) {
   PRINT_ERROR_PATH("commandList[%d].error", index);
   initVars();
-  index_ = index;
+  index_          = index;
+  asynPortDriver_ = asynPortDriver;
   LOGINFO8("%s/%s:%d: commandList[%d]=new;\n",
            __FILE__,
            __FUNCTION__,
            __LINE__,
            index);
   printCurrentState();
+
+  if (sem_init(&triggerSem_, 0, 0)) {
+    LOGERR("%s/%s:%d: ERROR: Command list %d: Semaphore init failed (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_COMMAND_LIST_SEM_INIT_FAIL);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_COMMAND_LIST_SEM_INIT_FAIL);
+    return;
+  }
+  semInit_ = true;
+
+  if (initAsyn()) {
+    return;
+  }
+  start();
 }
 
 ecmcCommandList::~ecmcCommandList() {
+  stop();
+
+  if (semInit_) {
+    sem_destroy(&triggerSem_);
+  }
   clearCommandList();
 }
 
@@ -53,7 +88,20 @@ void ecmcCommandList::initVars() {
   errorReset();
   commandCounter_ = 0;
   clearCommandList();
-  enable_ = false;
+  enable_         = false;
+  asynPortDriver_ = NULL;
+  asynStatus_     = NULL;
+  asynError_      = NULL;
+  asynExecTime_   = NULL;
+  asynOverruns_   = NULL;
+  semInit_        = false;
+  threadRunning_  = false;
+  stop_           = false;
+  busy_           = 0;
+  status_         = ECMC_COMMAND_LIST_IDLE;
+  lastError_      = 0;
+  execTimeUs_     = 0;
+  overruns_       = 0;
 
   try {
     commandList_.reserve(ECMC_MAX_COMMANDS_IN_COMMANDS_LISTS);
@@ -74,14 +122,192 @@ void ecmcCommandList::initVars() {
   }
 }
 
+int ecmcCommandList::initAsyn() {
+  if (!asynPortDriver_) {
+    return 0;
+  }
+
+  char buffer[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
+  const char *names[4] = { ECMC_ASYN_CMD_LIST_PAR_STATUS_NAME,
+                           ECMC_ASYN_CMD_LIST_PAR_ERROR_NAME,
+                           ECMC_ASYN_CMD_LIST_PAR_EXECUTE_NAME,
+                           ECMC_ASYN_CMD_LIST_PAR_OVERRUNS_NAME };
+  int32_t    *data[4] = { &status_, &lastError_, &execTimeUs_, &overruns_ };
+  ecmcAsynDataItem **params[4] = { &asynStatus_,
+                                   &asynError_,
+                                   &asynExecTime_,
+                                   &asynOverruns_ };
+
+  for (int i = 0; i < 4; i++) {
+    unsigned int charCount = snprintf(buffer,
+                                      sizeof(buffer),
+                                      "ecmc." ECMC_COMMAND_LIST_STR "%d.%s",
+                                      index_,
+                                      names[i]);
+
+    if (charCount >= sizeof(buffer) - 1) {
+      LOGERR(
+        "%s/%s:%d: ERROR: Failed to generate param name. Buffer to small (0x%x).\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        ERROR_COMMAND_LIST_ASYN_PAR_BUFFER_OVERFLOW);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_COMMAND_LIST_ASYN_PAR_BUFFER_OVERFLOW);
+    }
+
+    ecmcAsynDataItem *paramTemp = asynPortDriver_->addNewAvailParam(
+      buffer,
+      asynParamInt32,
+      (uint8_t *)data[i],
+      sizeof(int32_t),
+      ECMC_EC_S32,
+      0);
+
+    if (!paramTemp) {
+      LOGERR(
+        "%s/%s:%d: ERROR: Add create default parameter for %s failed.\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        buffer);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
+    }
+    paramTemp->setAllowWriteToEcmc(false);
+    paramTemp->refreshParam(1);
+    *params[i] = paramTemp;
+  }
+  return 0;
+}
+
+int ecmcCommandList::start() {
+  // Normal priority (inherited from caller), not realtime
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, PTHREAD_STACK_MIN + ECMC_STACK_SIZE);
+
+  stop_ = false;
+  int result = pthread_create(&thread_, &attr, threadFunc, this);
+  pthread_attr_destroy(&attr);
+
+  if (result) {
+    LOGERR("%s/%s:%d: ERROR: Command list %d: Thread create failed with %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           result,
+           ERROR_COMMAND_LIST_THREAD_CREATE_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_COMMAND_LIST_THREAD_CREATE_FAIL);
+  }
+
+  char name[16];
+  snprintf(name, sizeof(name), ECMC_COMMAND_LIST_THREAD_NAME "%d", index_);
+  pthread_setname_np(thread_, name);
+  threadRunning_ = true;
+  return 0;
+}
+
+void ecmcCommandList::stop() {
+  if (!threadRunning_) {
+    return;
+  }
+  stop_ = true;
+  sem_post(&triggerSem_);
+  pthread_join(thread_, NULL);
+  threadRunning_ = false;
+}
+
+void* ecmcCommandList::threadFunc(void *arg) {
+  ecmcCommandList *list = (ecmcCommandList *)arg;
+
+  while (true) {
+    while (sem_wait(&list->triggerSem_) != 0 && errno == EINTR) {}
+
+    if (list->stop_) {
+      break;
+    }
+    list->executeCommands(true);
+    epicsAtomicSetIntT(&list->busy_, 0);
+  }
+  return NULL;
+}
+
+/*
+* Called from event (realtime). Only wakes the worker thread.
+*/
 int ecmcCommandList::executeEvent(int masterOK) {
-  // TODO consider running this in low prio thread in order to
-  // not disturbe realtime
+  if (getError() || !enable_) {
+    return getErrorID();
+  }
+
+  if (!threadRunning_) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_COMMAND_LIST_THREAD_CREATE_FAIL);
+  }
+
+  // Still executing previous trigger
+  if (epicsAtomicCmpAndSwapIntT(&busy_, 0, 1) != 0) {
+    overruns_++;
+    return 0;
+  }
+  status_ = ECMC_COMMAND_LIST_BUSY;
+  sem_post(&triggerSem_);
+  return 0;
+}
 
+int ecmcCommandList::execute() {
   if (getError() || !enable_) {
     return getErrorID();
   }
 
+  if (epicsAtomicCmpAndSwapIntT(&busy_, 0, 1) != 0) {
+    LOGERR("%s/%s:%d: ERROR: Command list %d: Busy (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_COMMAND_LIST_BUSY);
+    return ERROR_COMMAND_LIST_BUSY;
+  }
+
+  int errorCode = executeCommands(false);
+  epicsAtomicSetIntT(&busy_, 0);
+  return errorCode;
+}
+
+/*
+* Execute all commands. The command parser is not reentrant so the asyn port
+* is locked for each command (if lockAsyn). The lock is released between
+* commands, but ecmc_rt waits for the lock while a command executes.
+*/
+int ecmcCommandList::executeCommands(bool lockAsyn) {
+  struct timespec startTime, endTime;
+  int errorCode = 0;
+
+  lockAsyn = lockAsyn && asynPortDriver_;
+  clock_gettime(CLOCK_MONOTONIC, &startTime);
+  status_ = ECMC_COMMAND_LIST_BUSY;
+
+  if (lockAsyn) {
+    asynPortDriver_->lock();
+  }
+  refreshAsyn();
+
+  if (lockAsyn) {
+    asynPortDriver_->unlock();
+  }
+
   clearBuffer(&resultBuffer_);
 
   for (unsigned int i = 0; i < commandList_.size(); i++) {
@@ -91,7 +317,15 @@ int ecmcCommandList::executeEvent(int masterOK) {
              __LINE__,
              index_,
              commandList_[i].c_str());
-    int errorCode = motorHandleOneArg(commandList_[i].c_str(), &resultBuffer_);
+
+    if (lockAsyn) {
+      asynPortDriver_->lock();
+    }
+    errorCode = motorHandleOneArg(commandList_[i].c_str(), &resultBuffer_);
+
+    if (lockAsyn) {
+      asynPortDriver_->unlock();
+    }
 
     if (errorCode) {
       LOGINFO8(
@@ -101,10 +335,8 @@ int ecmcCommandList::executeEvent(int masterOK) {
         __LINE__,
         commandList_[i].c_str(),
         resultBuffer_.buffer);
-      return setErrorID(__FILE__,
-                        __FUNCTION__,
-                        __LINE__,
-                        ERROR_COMMAND_LIST_COMMAND_RETURN_VALUE_NOT_OK);
+      errorCode = ERROR_COMMAND_LIST_COMMAND_RETURN_VALUE_NOT_OK;
+      break;
     }
 
     LOGINFO8("%s/%s:%d: INFO: Command %s returned: %s.\n",
@@ -116,16 +348,56 @@ int ecmcCommandList::executeEvent(int masterOK) {
 
     // Check return value
     if (strcmp(resultBuffer_.buffer, "OK")) {
-      return setErrorID(__FILE__,
-                        __FUNCTION__,
-                        __LINE__,
-                        ERROR_COMMAND_LIST_COMMAND_RETURN_VALUE_NOT_OK);
+      errorCode = ERROR_COMMAND_LIST_COMMAND_RETURN_VALUE_NOT_OK;
+      break;
     }
     clearBuffer(&resultBuffer_);
   }
+
+  clock_gettime(CLOCK_MONOTONIC, &endTime);
+  execTimeUs_ = (int32_t)(DIFF_NS(startTime, endTime) / 1000);
+  lastError_  = errorCode;
+  status_     = errorCode ? ECMC_COMMAND_LIST_ERROR : ECMC_COMMAND_LIST_DONE;
+
+  if (lockAsyn) {
+    asynPortDriver_->lock();
+  }
+  refreshAsyn();
+
+  if (lockAsyn) {
+    asynPortDriver_->unlock();
+  }
+
+  if (errorCode) {
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
   return 0;
 }
 
+/*
+* Asyn port must be locked.
+*/
+void ecmcCommandList::refreshAsyn() {
+  ecmcAsynDataItem *params[4] = { asynStatus_,
+                                  asynError_,
+                                  asynExecTime_,
+                                  asynOverruns_ };
+  int32_t values[4] = { status_, lastError_, execTimeUs_, overruns_ };
+  bool    doCallbacks = false;
+
+  for (int i = 0; i < 4; i++) {
+    if (params[i]) {
+      params[i]->writeParam((uint8_t *)&values[i], sizeof(int32_t));
+      doCallbacks = true;
+    }
+  }
+
+  if (doCallbacks) {
+    asynPortDriver_->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST,
+                                        ECMC_ASYN_DEFAULT_ADDR);
+  }
+}
+
 int ecmcCommandList::clearCommandList() {
   commandList_.clear();
   commandCounter_ = 0;
@@ -15,12 +15,15 @@
 
 #include <string>
 #include <vector>
+#include <pthread.h>
+#include <semaphore.h>
 #include "stdio.h"
 
 #include "../main/ecmcError.h"
 #include "../main/ecmcDefinitions.h"
 #include "../com/ecmcCmdParser.h"
 #include "../com/ecmcOctetIF.h"
+#include "../com/ecmcAsynPortDriver.h"
 #include "ecmcEventConsumer.h"
 
 // Command List
@@ -32,27 +35,80 @@
 #define ERROR_COMMAND_LIST_VECTOR_ALLOCATION_FAILED 0x20405
 #define ERROR_COMMAND_LIST_VECTOR_FULL 0x20406
 #define ERROR_COMMAND_LIST_RESULT_BUFFER_OVERFLOW 0x20407
+#define ERROR_COMMAND_LIST_BUSY 0x20408
+#define ERROR_COMMAND_LIST_SEM_INIT_FAIL 0x20409
+#define ERROR_COMMAND_LIST_THREAD_CREATE_FAIL 0x2040A
+#define ERROR_COMMAND_LIST_ASYN_PAR_BUFFER_OVERFLOW 0x2040B
+
+enum ecmcCommandListStatus {
+  ECMC_COMMAND_LIST_IDLE  = 0,
+  ECMC_COMMAND_LIST_BUSY  = 1,
+  ECMC_COMMAND_LIST_DONE  = 2,
+  ECMC_COMMAND_LIST_ERROR = 3,
+};
+
+/**
+ * Command list.
+ *
+ * When triggered by an event (from the realtime thread) the commands are
+ * executed in a low priority worker thread. The realtime thread only posts a
+ * semaphore. Triggers while the list is busy are counted as overruns.
+ * Each command is executed with the asyn port locked (the command parser
+ * accesses the realtime objects directly), and ecmc_rt takes the same lock
+ * each cycle. A slow command (blocking SDO read, large readback) therefore
+ * still delays the realtime cycle by its execution time. Use only short
+ * commands in lists triggered while running (non blocking SDO requests
+ * instead of blocking SDO access).
+ * Status (ecmcCommandListStatus), last error, execution time [us] and
+ * overruns are available as asyn parameters ("ecmc.cmdlist<index>.<param>"),
+ * updated by the worker thread.
+ */
 
 class ecmcCommandList : public ecmcEventConsumer, public ecmcError {
  public:
-  ecmcCommandList(int index);
+  ecmcCommandList(ecmcAsynPortDriver *asynPortDriver,
+                  int                 index);
   ~ecmcCommandList();
   int  setEnable(int enable);
   int  validate();
   int  executeEvent(int masterOK);  // Override ecmcEventConsumer
+  // Execute in callers context (asyn port must be locked by caller)
+  int  execute();
   int  addCommand(std::string command);
   int  clearCommandList();
   int  getCommandCount();
   void printCurrentState();
 
  private:
-  void initVars();
-  void printStatus();
+  void         initVars();
+  int          initAsyn();
+  int          start();
+  void         stop();
+  int          executeCommands(bool lockAsyn);
+  void         refreshAsyn();
+  void         printStatus();
+  static void* threadFunc(void *arg);
   std::vector<std::string>commandList_;
   int commandCounter_;
   int enable_;
   int index_;
   ecmcOutputBufferType resultBuffer_;
+  ecmcAsynPortDriver *asynPortDriver_;
+  ecmcAsynDataItem   *asynStatus_;
+  ecmcAsynDataItem   *asynError_;
+  ecmcAsynDataItem   *asynExecTime_;
+  ecmcAsynDataItem   *asynOverruns_;
+  pthread_t           thread_;
+  sem_t               triggerSem_;
+  bool                semInit_;
+  volatile bool       threadRunning_;
+  volatile bool       stop_;
+  // Set by trigger, cleared by worker when done
+  int                 busy_;
+  int32_t             status_;
+  int32_t             lastError_;
+  int32_t             execTimeUs_;
+  int32_t             overruns_;
 };
 
 #endif  /* ECMCCOMMANDLIST_H_ */
@@ -586,136 +586,141 @@ int ecmcDataRecorder::getAxisData(double *data) {
                       ERROR_DATA_RECORDER_AXIS_DATA_NULL);
   }
 
-  switch (axisDataTypeToRecord_) {
+  int errorCode = readAxisData(axisData_, axisDataTypeToRecord_, data);
+
+  if (errorCode) {
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
+  return 0;
+}
+
+int ecmcDataRecorder::readAxisData(ecmcAxisStatusType *axisData,
+                                   ecmcAxisDataType    dataType,
+                                   double             *data) {
+  switch (dataType) {
   case ECMC_AXIS_DATA_NONE:
-    return setErrorID(__FILE__,
-                      __FUNCTION__,
-                      __LINE__,
-                      ERROR_DATA_RECORDER_AXIS_DATA_TYPE_NOT_CHOOSEN);
+    return ERROR_DATA_RECORDER_AXIS_DATA_TYPE_NOT_CHOOSEN;
 
     break;
 
   case ECMC_AXIS_DATA_AXIS_ID:
-    *data = static_cast<double>(axisData_->axisID);
+    *data = static_cast<double>(axisData->axisID);
     break;
 
   case ECMC_AXIS_DATA_POS_SET:
-    *data = axisData_->onChangeData.positionSetpoint;
+    *data = axisData->onChangeData.positionSetpoint;
     break;
 
   case ECMC_AXIS_DATA_POS_ACT:
-    *data = axisData_->onChangeData.positionActual;
+    *data = axisData->onChangeData.positionActual;
     break;
 
   case ECMC_AXIS_DATA_CNTRL_ERROR:
-    *data = axisData_->onChangeData.cntrlError;
+    *data = axisData->onChangeData.cntrlError;
     break;
 
   case ECMC_AXIS_DATA_POS_TARGET:
-    *data = axisData_->onChangeData.positionTarget;
+    *data = axisData->onChangeData.positionTarget;
     break;
 
   case ECMC_AXIS_DATA_POS_ERROR:
-    *data = axisData_->onChangeData.positionError;
+    *data = axisData->onChangeData.positionError;
     break;
 
   case ECMC_AXIS_DATA_POS_RAW:
-    *data = static_cast<double>(axisData_->onChangeData.positionRaw);
+    *data = static_cast<double>(axisData->onChangeData.positionRaw);
     break;
 
   case ECMC_AXIS_DATA_CNTRL_OUT:
-    *data = axisData_->onChangeData.cntrlOutput;
+    *data = axisData->onChangeData.cntrlOutput;
     break;
 
   case ECMC_AXIS_DATA_VEL_SET:
-    *data = axisData_->onChangeData.velocitySetpoint;
+    *data = axisData->onChangeData.velocitySetpoint;
     break;
 
   case ECMC_AXIS_DATA_VEL_ACT:
-    *data = axisData_->onChangeData.velocityActual;
+    *data = axisData->onChangeData.velocityActual;
     break;
 
   case ECMC_AXIS_DATA_VEL_SET_FF_RAW:
-    *data = axisData_->onChangeData.velocityFFRaw;
+    *data = axisData->onChangeData.velocityFFRaw;
     break;
 
   case ECMC_AXIS_DATA_VEL_SET_RAW:
-    *data = static_cast<double>(axisData_->onChangeData.velocitySetpointRaw);
+    *data = static_cast<double>(axisData->onChangeData.velocitySetpointRaw);
     break;
 
   case ECMC_AXIS_DATA_CYCLE_COUNTER:
-    *data = static_cast<double>(axisData_->cycleCounter);
+    *data = static_cast<double>(axisData->cycleCounter);
     break;
 
   case ECMC_AXIS_DATA_ERROR:
-    *data = static_cast<double>(axisData_->onChangeData.error);
+    *data = static_cast<double>(axisData->onChangeData.error);
     break;
 
   case ECMC_AXIS_DATA_COMMAND:
-    *data = static_cast<double>(axisData_->onChangeData.command);
+    *data = static_cast<double>(axisData->onChangeData.command);
     break;
 
   case ECMC_AXIS_DATA_CMD_DATA:
-    *data = static_cast<double>(axisData_->onChangeData.cmdData);
+    *data = static_cast<double>(axisData->onChangeData.cmdData);
     break;
 
   case ECMC_AXIS_DATA_SEQ_STATE:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.seqstate);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.seqstate);
     break;
 
   case ECMC_AXIS_DATA_INTERLOCK_TYPE:
-    *data = static_cast<double>(axisData_->onChangeData.trajInterlock);
+    *data = static_cast<double>(axisData->onChangeData.trajInterlock);
     break;
 
   case ECMC_AXIS_DATA_TRAJ_SOURCE:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.trajsource);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.trajsource);
     break;
 
   case ECMC_AXIS_DATA_ENC_SOURCE:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.encsource);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.encsource);
     break;
 
   case ECMC_AXIS_DATA_ENABLE:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.enable);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.enable);
     break;
 
   case ECMC_AXIS_DATA_ENABLED:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.enabled);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.enabled);
     break;
 
   case ECMC_AXIS_DATA_EXECUTE:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.execute);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.execute);
     break;
 
   case ECMC_AXIS_DATA_BUSY:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.busy);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.busy);
     break;
 
   case ECMC_AXIS_DATA_AT_TARGET:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.attarget);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.attarget);
     break;
 
   case ECMC_AXIS_DATA_HOMED:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.homed);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.homed);
     break;
 
   case ECMC_AXIS_DATA_LIMIT_BWD:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.limitbwd);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.limitbwd);
     break;
 
   case ECMC_AXIS_DATA_LIMIT_FWD:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.limitfwd);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.limitfwd);
     break;
 
   case ECMC_AXIS_DATA_HOME_SWITCH:
-    *data = static_cast<double>(axisData_->onChangeData.statusWd.homeswitch);
+    *data = static_cast<double>(axisData->onChangeData.statusWd.homeswitch);
     break;
 
   default:
-    return setErrorID(__FILE__,
-                      __FUNCTION__,
-                      __LINE__,
-                      ERROR_DATA_RECORDER_AXIS_DATA_TYPE_NOT_CHOOSEN);
+    return ERROR_DATA_RECORDER_AXIS_DATA_TYPE_NOT_CHOOSEN;
 
     break;
   }
@@ -46,6 +46,10 @@ class ecmcDataRecorder : public ecmcEventConsumer, public ecmcEcEntryLink {
                          ecmcAxisDataType    dataTypeToRecord);
   int  setDataSourceType(ecmcDataSourceType type);
   void printCurrentState();
+  // Returns error code (no error state set)
+  static int readAxisData(ecmcAxisStatusType *axisData,
+                          ecmcAxisDataType    dataType,
+                          double             *data);
 
  private:
   void initVars();
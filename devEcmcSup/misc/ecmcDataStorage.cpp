@@ -20,9 +20,9 @@ ecmcDataStorage::ecmcDataStorage(ecmcAsynPortDriver *asynPortDriver,
   PRINT_ERROR_PATH("dataStorage[%d].error", index);
   initVars();
   index_=index;
+  bufferType_         = bufferType;
   setBufferSize(size);
   bufferSize_ = size;
-  bufferType_         = bufferType;
   asynPortDriver_ = asynPortDriver;
   LOGINFO9("%s/%s:%d: dataStorage[%d]=new;\n",
            __FILE__,
@@ -34,7 +34,8 @@ ecmcDataStorage::ecmcDataStorage(ecmcAsynPortDriver *asynPortDriver,
 }
 
 ecmcDataStorage::~ecmcDataStorage() {
-  delete buffer_;
+  delete[] buffer_;
+  delete stats_;
 }
 
 void ecmcDataStorage::printCurrentState() {
@@ -93,6 +94,9 @@ void ecmcDataStorage::initVars() {
   bufferType_         = ECMC_STORAGE_NORMAL_BUFFER;
   bufferSize_ = ECMC_DEFAULT_DATA_STORAGE_SIZE;
   buffer_             = NULL;
+  fifoHead_           = 0;
+  stats_              = NULL;
+  statsValid_         = false;
   currentBufferIndex_ = 0;
   dataCountInBuffer_          = 0;
   index_              = 0;
@@ -102,6 +106,8 @@ void ecmcDataStorage::initVars() {
   indexAsynDataItem_  = NULL;
   sizeAsynDataItem_   = NULL;
   statusWord_         = 0;
+  stream_             = NULL;
+  vectorLocked_       = false;
 }
 
 int ecmcDataStorage::clearBuffer() {
@@ -116,18 +122,51 @@ int ecmcDataStorage::clearBuffer() {
     return setErrorID(__FILE__, __FUNCTION__, __LINE__,
                       ERROR_DATA_STORAGE_NULL);
   }
-  memset(buffer_, 0, bufferSize_ * sizeof(double));
+  int elements = bufferSize_;
+
+  if (bufferType_ == ECMC_STORAGE_FIFO_BUFFER) {
+    elements = 2 * bufferSize_;  // Mirrored
+  }
+  memset(buffer_, 0, elements * sizeof(double));
+  fifoHead_           = 0;
   currentBufferIndex_ = 0;
   dataCountInBuffer_  = 0;
   isFull_ = 0;
+
+  if (stats_) {
+    stats_->clear();
+    statsValid_ = true;
+  }
+
+  if(dataAsynDataItem_){
+    dataAsynDataItem_->setEcmcDataPointer((uint8_t*)getDataBuffer(),bufferSize_*sizeof(double));
+  }
   updateAsyn(0);
   return 0;
 }
 
 int ecmcDataStorage::setBufferSize(int elements) {  
+  if (vectorLocked_ && (elements != bufferSize_)) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Data storage %d. Size locked by vector view (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      index_,
+      ERROR_DATA_STORAGE_VECTOR_SIZE_LOCKED);
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__,
+                      ERROR_DATA_STORAGE_VECTOR_SIZE_LOCKED);
+  }
   bufferSize_ = elements;
   dataCountInBuffer_  = 0;
   isFull_ = 0;
+  fifoHead_ = 0;
+
+  // FIFO: Data mirrored in second half
+  if (bufferType_ == ECMC_STORAGE_FIFO_BUFFER) {
+    elements = 2 * elements;
+  }
+
   double * tempBuffer = new double[elements];
   if (tempBuffer == NULL) {
     LOGERR("%s/%s:%d: FAILED TO ALLOCATE MEMORY FOR DATA STORAGE OBJECT.\n",
@@ -137,17 +176,48 @@ int ecmcDataStorage::setBufferSize(int elements) {
     setErrorID(__FILE__, __FUNCTION__, __LINE__, ERROR_DATA_STORAGE_NULL);
     exit(EXIT_FAILURE);  
   }  
+  memset(tempBuffer, 0, elements * sizeof(double));
+
   //Set new adress to asyn interface
   if(dataAsynDataItem_){
     dataAsynDataItem_->setEcmcDataPointer((uint8_t*)tempBuffer,bufferSize_*sizeof(double));
     updateAsyn(1);
   }
-  delete buffer_;
+  delete[] buffer_;
   buffer_ = tempBuffer;
+
+  // Window size changed (allocated here, not in realtime at first use)
+  delete stats_;
+  stats_ = new ecmcRunningStats(bufferSize_);
+  stats_->clear();
+  statsValid_ = true;
   
   return 0;
 }
 
+/*
+* Start of data (newest value last for FIFO).
+*/
+double* ecmcDataStorage::getDataBuffer() {
+  return buffer_ + fifoHead_;
+}
+
+/*
+* Write element (FIFO: both copies).
+*/
+void ecmcDataStorage::writeElement(int index, double data) {
+  statsValid_ = false;
+
+  if (bufferType_ != ECMC_STORAGE_FIFO_BUFFER) {
+    buffer_[index] = data;
+    return;
+  }
+
+  int pos = (fifoHead_ + index) % bufferSize_;
+  buffer_[pos]               = data;
+  buffer_[pos + bufferSize_] = data;
+}
+
 int ecmcDataStorage::isStorageFull() {
   isFull_=dataCountInBuffer_ >= bufferSize_;
   return isFull_;
@@ -170,15 +240,17 @@ int ecmcDataStorage::printBuffer() {
   }
   printf("Printout of data storage buffer %d.\n", index_);
 
+  double *buffer = getDataBuffer();
+
   for (int i = start; i < end; i++) {
-    printf("%lf, ", buffer_[i]);
+    printf("%lf, ", buffer[i]);
   }
   printf("\n");
   return 0;
 }
 
 int ecmcDataStorage::getData(double **data, int *size) {
-  *data = buffer_;
+  *data = getDataBuffer();
   *size = bufferSize_;
   return 0;
 }
@@ -190,7 +262,7 @@ int ecmcDataStorage::getDataElement(int index, double *data) {
                       __LINE__,
                       ERROR_DATA_STORAGE_POSITION_OUT_OF_RANGE);
   }
-  *data = buffer_[index];
+  *data = getDataBuffer()[index];
   return 0;
 }
 
@@ -205,7 +277,7 @@ int ecmcDataStorage::getDataElementPtr(int index, double **data) {
                       __LINE__,
                       ERROR_DATA_STORAGE_POSITION_OUT_OF_RANGE);
   }
-  *data = &buffer_[index];
+  *data = &getDataBuffer()[index];
   return 0;
 }
 
@@ -216,7 +288,7 @@ int ecmcDataStorage::setDataElement(int index, double data) {
                       __LINE__,
                       ERROR_DATA_STORAGE_POSITION_OUT_OF_RANGE);
   }
-  buffer_[index] = data;
+  writeElement(index, data);
   return 0;
 }
 
@@ -226,6 +298,7 @@ int ecmcDataStorage::setDataElement(double data) {
 
 int ecmcDataStorage::setData(double *data, int size) {
   currentBufferIndex_ = 0;  // Start from beginning
+  statsValid_         = false;
   return appendData(data, size);
 }
 
@@ -243,6 +316,7 @@ int ecmcDataStorage::appendDataNormal(double *data, int size) {
   }
 
   if (sizeToCopy > 0) {
+    updateStats(buffer_ + currentBufferIndex_, data, sizeToCopy);
     memcpy(buffer_ + currentBufferIndex_, data, sizeToCopy * sizeof(double));
     currentBufferIndex_ = currentBufferIndex_ + sizeToCopy;
   }
@@ -284,12 +358,14 @@ int ecmcDataStorage::appendDataRing(double *data, int size) {
   }
 
   if (sizeToCopy > 0) {
+    updateStats(buffer_ + currentBufferIndex_, data, sizeToCopy);
     memcpy(buffer_ + currentBufferIndex_, data, sizeToCopy * sizeof(double));
     currentBufferIndex_ = currentBufferIndex_ + sizeToCopy;
   }
 
   if (sizeToCopy < size) {
     // If ring buffer then copy rest of data to the beginning of the buffer
+    updateStats(buffer_, data + sizeToCopy, size - sizeToCopy);
     memcpy(buffer_, data + sizeToCopy, (size - sizeToCopy) * sizeof(double));
     currentBufferIndex_ = (size - sizeToCopy);
   }
@@ -305,22 +381,44 @@ int ecmcDataStorage::appendDataRing(double *data, int size) {
 }
 
 int ecmcDataStorage::appendDataFifo(double *data, int size) {
-  // Always add in end
-  if (size < bufferSize_) {
-    // Move old data left
-    int bytesToMove = sizeof(double) * (bufferSize_ - size);
-    memmove(buffer_, buffer_ + size, bytesToMove);
-  }
-
+  // Always add in end (overwrite oldest values and move start of data)
   int sizeToCopy = size;
 
   if (sizeToCopy >= bufferSize_) {
     sizeToCopy = bufferSize_;
   }
 
-  memcpy(buffer_ + (bufferSize_ - sizeToCopy),
-         data,
-         sizeof(double) * sizeToCopy);
+  if (sizeToCopy <= 0) {
+    return 0;
+  }
+
+  int firstPart = bufferSize_ - fifoHead_;
+
+  if (firstPart > sizeToCopy) {
+    firstPart = sizeToCopy;
+  }
+
+  // Oldest values are overwritten
+  updateStats(buffer_ + fifoHead_, data, sizeToCopy);
+
+  // Write both copies
+  memcpy(buffer_ + fifoHead_, data, sizeof(double) * firstPart);
+  memcpy(buffer_ + fifoHead_ + bufferSize_, data, sizeof(double) * firstPart);
+
+  if (sizeToCopy > firstPart) {
+    memcpy(buffer_,
+           data + firstPart,
+           sizeof(double) * (sizeToCopy - firstPart));
+    memcpy(buffer_ + bufferSize_,
+           data + firstPart,
+           sizeof(double) * (sizeToCopy - firstPart));
+  }
+  fifoHead_ = (fifoHead_ + sizeToCopy) % bufferSize_;
+
+  if (dataAsynDataItem_) {
+    dataAsynDataItem_->setEcmcDataPointer((uint8_t *)getDataBuffer(),
+                                          bufferSize_ * sizeof(double));
+  }
 
   dataCountInBuffer_ = dataCountInBuffer_ + sizeToCopy;
   if(dataCountInBuffer_ > bufferSize_){
@@ -378,6 +476,12 @@ int ecmcDataStorage::appendData(double *data, int size, bool refreshAsyn) {
   if(errorCode) {
     return errorCode;
   }
+
+  if (stream_) {
+    for (int i = 0; i < size; i++) {
+      stream_->appendRow(&data[i], 1);
+    }
+  }
   
   if (refreshAsyn) {
     errorCode=updateAsyn(0);
@@ -412,6 +516,7 @@ int ecmcDataStorage::setCurrentPosition(int position) {
   }
 
   currentBufferIndex_ = position;
+  statsValid_         = false;
   return 0;
 }
 
@@ -439,7 +544,7 @@ int ecmcDataStorage::initAsyn() {
 
   dataAsynDataItem_ = asynPortDriver_->addNewAvailParam(name,
                                     asynParamFloat64Array, //default type
-                                    (uint8_t *)(buffer_),
+                                    (uint8_t *)(getDataBuffer()),
                                     bufferSize_*sizeof(double),
                                     ECMC_EC_F64,
                                     0);
@@ -454,6 +559,8 @@ int ecmcDataStorage::initAsyn() {
     return ERROR_MAIN_ASYN_CREATE_PARAM_FAIL;
   }
   dataAsynDataItem_->setAllowWriteToEcmc(true);
+  // Statistics must be invalidated (and both copies of FIFO written)
+  dataAsynDataItem_->setExeCmdFunctPtr(asynWriteData, this);
   dataAsynDataItem_->refreshParam(1);
   
   // "ds%d.index"
@@ -565,6 +672,29 @@ int ecmcDataStorage::initAsyn() {
   return 0;
 }
 
+asynStatus ecmcDataStorage::asynWriteData(void         *data,
+                                          size_t        bytes,
+                                          asynParamType asynParType,
+                                          void         *userObj) {
+  ecmcDataStorage *ds = (ecmcDataStorage *)userObj;
+
+  if (!ds || (asynParType != asynParamFloat64Array)) {
+    return asynError;
+  }
+
+  int elements = bytes / sizeof(double);
+
+  if (elements > ds->bufferSize_) {
+    elements = ds->bufferSize_;
+  }
+
+  for (int i = 0; i < elements; i++) {
+    ds->writeElement(i, ((double *)data)[i]);
+  }
+
+  return ds->dataAsynDataItem_->refreshParamRT(1) ? asynError : asynSuccess;
+}
+
 int ecmcDataStorage::updateAsyn(bool force) {
   statusWord_ = 0;
   //bit 0
@@ -578,79 +708,164 @@ int ecmcDataStorage::updateAsyn(bool force) {
   return 0;
 }
 
-double ecmcDataStorage::getAvg() {
-  int elements = dataCountInBuffer_;
+/*
+* Incremental update of statistics before oldData is overwritten with newData
+* (O(1) per value, rounding of removals bounded by ecmcRunningStats).
+* Normal and ring buffers must write at the end of the current data (or over
+* the oldest data if full), otherwise full recalculation is needed (random
+* writes of elements, new write position).
+*/
+void ecmcDataStorage::updateStats(double *oldData, double *newData, int size) {
+  if (!statsValid_) {
+    return;
+  }
 
-  if(elements == 0 || bufferSize_ == 0) {
-    return 0;
+  int count = stats_->getCount();
+
+  if ((bufferType_ != ECMC_STORAGE_FIFO_BUFFER) && (count < bufferSize_) &&
+      (currentBufferIndex_ != count)) {
+    statsValid_ = false;
+    return;
   }
 
-  double sum = 0;
-  if(bufferType_ == ECMC_STORAGE_NORMAL_BUFFER || bufferType_ == ECMC_STORAGE_RING_BUFFER) {
-    for(int i=0; i<elements;i++) {
-      sum = sum + buffer_[i];
-    }
-  } else if(bufferType_ == ECMC_STORAGE_FIFO_BUFFER) {
-    for(int i=bufferSize_-elements; i<bufferSize_;i++) {
-      sum = sum + buffer_[i];
+  for (int i = 0; i < size; i++) {
+    if (stats_->getCount() >= bufferSize_) {
+      if (bufferType_ == ECMC_STORAGE_NORMAL_BUFFER) {
+        return;  // Full, data discarded
+      }
+      stats_->remove(oldData[i]);
     }
+    stats_->add(newData[i]);
   }
-  
-  return sum / elements;
 }
 
-double ecmcDataStorage::getMin() {
+/*
+* Recalculate statistics if invalidated (oldest first).
+*/
+ecmcRunningStats* ecmcDataStorage::getStats() {
+  if (statsValid_) {
+    return stats_;
+  }
 
+  stats_->clear();
   int elements = dataCountInBuffer_;
-  
-  if(elements == 0 || bufferSize_ == 0) {
-    return 0;
-  }
 
-  double min = 0;
-  if(bufferType_ == ECMC_STORAGE_NORMAL_BUFFER || bufferType_ == ECMC_STORAGE_RING_BUFFER) {
-    min = buffer_[0];
-    for(int i=0; i<elements;i++) {
-      if(buffer_[i] < min) {
-        min = buffer_[i];
-      }
+  switch (bufferType_) {
+  case ECMC_STORAGE_NORMAL_BUFFER:
+    for (int i = 0; i < elements; i++) {
+      stats_->add(buffer_[i]);
     }
-  } else if(bufferType_ == ECMC_STORAGE_FIFO_BUFFER) {
-    min = buffer_[bufferSize_-elements];
-    for(int i=bufferSize_-elements; i<bufferSize_;i++) {
-      if(buffer_[i] < min) {
-        min = buffer_[i];
+    break;
+
+  case ECMC_STORAGE_RING_BUFFER:
+    if (elements < bufferSize_) {
+      for (int i = 0; i < elements; i++) {
+        stats_->add(buffer_[i]);
+      }
+    } else {
+      // Full, next write position holds oldest value
+      for (int i = 0; i < bufferSize_; i++) {
+        stats_->add(buffer_[(currentBufferIndex_ + i) % bufferSize_]);
       }
     }
+    break;
+
+  case ECMC_STORAGE_FIFO_BUFFER:
+    for (int i = bufferSize_ - elements; i < bufferSize_; i++) {
+      stats_->add(getDataBuffer()[i]);
+    }
+    break;
   }
-  
-  return min;
+  statsValid_ = true;
+  return stats_;
 }
 
-double ecmcDataStorage::getMax() {
+double ecmcDataStorage::getAvg() {
+  if(dataCountInBuffer_ == 0 || bufferSize_ == 0) {
+    return 0;
+  }
+  return getStats()->getAvg();
+}
 
-  int elements = dataCountInBuffer_;
-  
-  if(elements == 0 || bufferSize_ == 0) {
+double ecmcDataStorage::getStd() {
+  if(dataCountInBuffer_ == 0 || bufferSize_ == 0) {
     return 0;
   }
+  return getStats()->getStd();
+}
 
-  double max = 0;
-  if(bufferType_ == ECMC_STORAGE_NORMAL_BUFFER || bufferType_ == ECMC_STORAGE_RING_BUFFER) {
-    max = buffer_[0];
-    for(int i=0; i<elements;i++) {
-      if(buffer_[i] > max) {
-        max = buffer_[i];
-      }
-    }
-  } else if(bufferType_ == ECMC_STORAGE_FIFO_BUFFER) {
-    max = buffer_[bufferSize_-elements];
-    for(int i=bufferSize_-elements; i<bufferSize_;i++) {
-      if(buffer_[i] > max) {
-        max = buffer_[i];
-      }
-    }
+double ecmcDataStorage::getMin() {
+  if(dataCountInBuffer_ == 0 || bufferSize_ == 0) {
+    return 0;
   }
-  
-  return max;
+  return getStats()->getMin();
+}
+
+double ecmcDataStorage::getMax() {
+  if(dataCountInBuffer_ == 0 || bufferSize_ == 0) {
+    return 0;
+  }
+  return getStats()->getMax();
+}
+
+int ecmcDataStorage::setDataStream(ecmcDataStream *stream) {
+  if (!stream) {
+    LOGERR("%s/%s:%d: ERROR: Data storage %d. Data stream NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_DATA_STREAM_NULL);
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__,
+                      ERROR_DATA_STREAM_NULL);
+  }
+
+  if (stream->getChannelCount() != 1) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Data storage %d. Stream must have one channel (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      index_,
+      ERROR_DATA_STREAM_CHANNEL_COUNT_MISMATCH);
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__,
+                      ERROR_DATA_STREAM_CHANNEL_COUNT_MISMATCH);
+  }
+
+  int errorCode = stream->linkProducer();
+
+  if (errorCode) {
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
+  stream_ = stream;
+  return 0;
+}
+
+int ecmcDataStorage::getVectorView(double **data, int *size) {
+  if (buffer_ == NULL) {
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__,
+                      ERROR_DATA_STORAGE_NULL);
+  }
+
+  // Mirrored data would get out of sync
+  if (bufferType_ == ECMC_STORAGE_FIFO_BUFFER) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Data storage %d. Vector view of FIFO buffer not supported (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      index_,
+      ERROR_DATA_STORAGE_VECTOR_FIFO_NOT_SUPPORTED);
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__,
+                      ERROR_DATA_STORAGE_VECTOR_FIFO_NOT_SUPPORTED);
+  }
+
+  vectorLocked_ = true;
+  *data         = buffer_;
+  *size         = bufferSize_;
+  return 0;
+}
+
+void ecmcDataStorage::vectorViewWritten() {
+  statsValid_ = false;
 }
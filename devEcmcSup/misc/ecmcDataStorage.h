@@ -18,6 +18,8 @@
 #include "../main/ecmcError.h"
 #include "../main/ecmcDefinitions.h"
 #include "../com/ecmcAsynPortDriver.h"
+#include "ecmcRunningStats.h"
+#include "ecmcDataStream.h"
 
 // Data storage
 #define ERROR_DATA_STORAGE_FULL 0x20200
@@ -25,6 +27,8 @@
 #define ERROR_DATA_STORAGE_SIZE_TO_SMALL 0x20202
 #define ERROR_DATA_STORAGE_POSITION_OUT_OF_RANGE 0x20203
 #define ERROR_DATA_STORAGE_ASYN_PARAM_REGISTER_FAIL 0x20204
+#define ERROR_DATA_STORAGE_VECTOR_SIZE_LOCKED 0x20205
+#define ERROR_DATA_STORAGE_VECTOR_FIFO_NOT_SUPPORTED 0x20206
 
 enum ecmcDSBufferType {
   // Fill from beginning. Stop when full.
@@ -35,6 +39,23 @@ enum ecmcDSBufferType {
   ECMC_STORAGE_FIFO_BUFFER   = 2,
 };
 
+/**
+ * FIFO buffers are stored as a ring buffer with a mirrored copy of the data
+ * (twice the size). The newest last view of the data is always contiguous at
+ * buffer_ + fifoHead_ so append is O(1) and the asyn waveform and getData()
+ * need no linearisation.
+ *
+ * Statistics (getAvg(), getStd(), getMin(), getMax()) are updated
+ * incrementally on append once any of them has been used. Other writes to the
+ * buffer (setDataElement(), setCurrentPosition(), asyn writes..) trigger a
+ * full recalculation at next access.
+ *
+ * Normal and ring buffers can be exposed as a vector (PLC "ds<index>.vec"),
+ * see getVectorView(). The buffer is then used in place (storage order, for
+ * ring buffers the oldest value is at getCurrentIndex() when full) and the
+ * size is locked.
+ */
+
 class ecmcDataStorage : public ecmcError {
  public:
   ecmcDataStorage(ecmcAsynPortDriver *asynPortDriver,
@@ -75,6 +96,13 @@ class ecmcDataStorage : public ecmcError {
   double getStd();
   double getMin();
   double getMax();
+  // Buffer in place (normal and ring buffers). Locks size.
+  int  getVectorView(double **data,
+                     int     *size);
+  // Buffer written through vector view
+  void vectorViewWritten();
+  // Appended values are also pushed to stream (one channel)
+  int  setDataStream(ecmcDataStream *stream);
 
  private:
   int  appendDataFifo(double *data,
@@ -85,8 +113,23 @@ class ecmcDataStorage : public ecmcError {
                         int     size);
   void initVars();
   int  initAsyn();
+  double* getDataBuffer();
+  void writeElement(int    index,
+                    double data);
+  ecmcRunningStats* getStats();
+  void updateStats(double *oldData,
+                   double *newData,
+                   int     size);
+  static asynStatus asynWriteData(void         *data,
+                                  size_t        bytes,
+                                  asynParamType asynParType,
+                                  void         *userObj);
   int currentBufferIndex_;
   double *buffer_;
+  // Start of data in FIFO buffer (oldest value)
+  int fifoHead_;
+  ecmcRunningStats *stats_;
+  bool statsValid_;
   int bufferSize_;
   ecmcDSBufferType bufferType_;
   int index_;
@@ -98,6 +141,8 @@ class ecmcDataStorage : public ecmcError {
   ecmcAsynDataItem  *sizeAsynDataItem_;
   int isFull_;
   uint32_t statusWord_;
+  ecmcDataStream *stream_;
+  bool vectorLocked_;
 };
 
 #endif  /* ECMCDATASTORAGE_H_ */
@@ -0,0 +1,562 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcDataStream.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // pthread_setname_np
+#endif
+#include "ecmcDataStream.h"
+#include <errno.h>
+#include <limits.h>
+#include <string.h>
+#include <epicsAtomic.h>
+#include <epicsThread.h>
+#include "../main/ecmcErrorsList.h"
+
+ecmcDataStream::ecmcDataStream(ecmcAsynPortDriver *asynPortDriver,
+                               ecmcEc             *ec,
+                               int                 index,
+                               const char         *fileName,
+                               int                 channelCount,
+                               int                 blockRows,
+                               int                 blockCount) {
+  initVars();
+  index_          = index;
+  asynPortDriver_ = asynPortDriver;
+  ec_             = ec;
+  PRINT_ERROR_PATH("dataStream[%d].error", index_);
+
+  if ((channelCount <= 0) || (blockRows <= 0) || (blockCount < 2)) {
+    LOGERR("%s/%s:%d: ERROR: Invalid channels %d, block rows %d or blocks %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           channelCount,
+           blockRows,
+           blockCount,
+           ERROR_DATA_STREAM_INVALID_SIZE);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_DATA_STREAM_INVALID_SIZE);
+    return;
+  }
+
+  channelCount_ = channelCount;
+  blockRows_    = blockRows;
+  blockCount_   = blockCount;
+  blocks_       = new ecmcDataStreamBlock[blockCount_];
+
+  for (int i = 0; i < blockCount_; i++) {
+    memset(&blocks_[i].header, 0, sizeof(ecmcDataStreamBlockHeader));
+    blocks_[i].time = new int64_t[blockRows_];
+    blocks_[i].data = new double[channelCount_ * blockRows_];
+  }
+
+  file_ = fopen(fileName, "wb");
+
+  if (!file_) {
+    LOGERR("%s/%s:%d: ERROR: Open file %s failed with %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           fileName,
+           errno,
+           ERROR_DATA_STREAM_FILE_OPEN_FAIL);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_DATA_STREAM_FILE_OPEN_FAIL);
+    return;
+  }
+  setvbuf(file_, NULL, _IOFBF, ECMC_DATA_STREAM_FILE_BUFFER_SIZE);
+
+  ecmcDataStreamFileHeader fileHeader;
+  memset(&fileHeader, 0, sizeof(fileHeader));
+  memcpy(fileHeader.magic, ECMC_DATA_STREAM_FILE_MAGIC,
+         sizeof(fileHeader.magic));
+  fileHeader.version   = ECMC_DATA_STREAM_FILE_VERSION;
+  fileHeader.channels  = channelCount_;
+  fileHeader.blockRows = blockRows_;
+
+  if (fwrite(&fileHeader, sizeof(fileHeader), 1, file_) != 1) {
+    LOGERR("%s/%s:%d: ERROR: Write to file %s failed (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           fileName,
+           ERROR_DATA_STREAM_FILE_WRITE_FAIL);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_DATA_STREAM_FILE_WRITE_FAIL);
+    return;
+  }
+
+  if (sem_init(&writeSem_, 0, 0)) {
+    LOGERR("%s/%s:%d: ERROR: Data stream %d: Semaphore init failed (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_DATA_STREAM_SEM_INIT_FAIL);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_DATA_STREAM_SEM_INIT_FAIL);
+    return;
+  }
+  semInit_ = true;
+
+  if (initAsyn()) {
+    return;
+  }
+  start();
+  printCurrentState();
+}
+
+ecmcDataStream::~ecmcDataStream() {
+  // Realtime stopped. Write what is left.
+  if (fillRows_ > 0 && (head_ - tail_ < (size_t)blockCount_)) {
+    commitBlock();
+  }
+  stop();
+
+  if (semInit_) {
+    sem_destroy(&writeSem_);
+  }
+
+  if (file_) {
+    fclose(file_);
+  }
+
+  if (blocks_) {
+    for (int i = 0; i < blockCount_; i++) {
+      delete[] blocks_[i].time;
+      delete[] blocks_[i].data;
+    }
+  }
+  delete[] blocks_;
+}
+
+void ecmcDataStream::initVars() {
+  errorReset();
+  asynPortDriver_ = NULL;
+  ec_             = NULL;
+  index_          = 0;
+  file_           = NULL;
+  channelCount_   = 0;
+  blockRows_      = 0;
+  blockCount_     = 0;
+  blocks_         = NULL;
+  head_           = 0;
+  tail_           = 0;
+  fillRows_       = 0;
+  dropped_        = 0;
+  lockDropped_    = 0;
+  fillLock_       = 0;
+  enable_         = 0;
+  flushRequest_   = false;
+  disableRequest_ = false;
+  linked_         = false;
+  semInit_        = false;
+  threadRunning_  = false;
+  stop_           = false;
+  blocksWritten_  = 0;
+  overflows_      = 0;
+  lastError_      = 0;
+  asynBlocks_     = NULL;
+  asynOverflows_  = NULL;
+  asynError_      = NULL;
+}
+
+void ecmcDataStream::printCurrentState() {
+  LOGINFO11("%s/%s:%d: dataStream[%d].channels=%d;\n",
+            __FILE__,
+            __FUNCTION__,
+            __LINE__,
+            index_,
+            channelCount_);
+  LOGINFO11("%s/%s:%d: dataStream[%d].blocks=%d*%d;\n",
+            __FILE__,
+            __FUNCTION__,
+            __LINE__,
+            index_,
+            blockCount_,
+            blockRows_);
+  LOGINFO11("%s/%s:%d: dataStream[%d].enable=%d;\n",
+            __FILE__,
+            __FUNCTION__,
+            __LINE__,
+            index_,
+            enable_);
+}
+
+int ecmcDataStream::initAsyn() {
+  if (!asynPortDriver_) {
+    return 0;
+  }
+
+  char buffer[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
+  const char *names[3] = { ECMC_ASYN_DATA_STREAM_PAR_BLOCKS_NAME,
+                           ECMC_ASYN_DATA_STREAM_PAR_OVERFLOWS_NAME,
+                           ECMC_ASYN_DATA_STREAM_PAR_ERROR_NAME };
+  int32_t    *data[3] = { &blocksWritten_, &overflows_, &lastError_ };
+  ecmcAsynDataItem **params[3] = { &asynBlocks_,
+                                   &asynOverflows_,
+                                   &asynError_ };
+
+  for (int i = 0; i < 3; i++) {
+    unsigned int charCount = snprintf(buffer,
+                                      sizeof(buffer),
+                                      "ecmc." ECMC_DATA_STREAM_STR "%d.%s",
+                                      index_,
+                                      names[i]);
+
+    if (charCount >= sizeof(buffer) - 1) {
+      LOGERR(
+        "%s/%s:%d: ERROR: Failed to generate param name. Buffer to small (0x%x).\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        ERROR_DATA_STREAM_ASYN_PARAM_REGISTER_FAIL);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_DATA_STREAM_ASYN_PARAM_REGISTER_FAIL);
+    }
+
+    ecmcAsynDataItem *paramTemp = asynPortDriver_->addNewAvailParam(
+      buffer,
+      asynParamInt32,
+      (uint8_t *)data[i],
+      sizeof(int32_t),
+      ECMC_EC_S32,
+      0);
+
+    if (!paramTemp) {
+      LOGERR(
+        "%s/%s:%d: ERROR: Add create default parameter for %s failed.\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        buffer);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
+    }
+    paramTemp->setAllowWriteToEcmc(false);
+    paramTemp->refreshParam(1);
+    *params[i] = paramTemp;
+  }
+  return 0;
+}
+
+int ecmcDataStream::start() {
+  // Normal priority (inherited from caller), not realtime
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, PTHREAD_STACK_MIN + ECMC_STACK_SIZE);
+
+  stop_ = false;
+  int result = pthread_create(&thread_, &attr, threadFunc, this);
+  pthread_attr_destroy(&attr);
+
+  if (result) {
+    LOGERR("%s/%s:%d: ERROR: Data stream %d: Thread create failed with %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           result,
+           ERROR_DATA_STREAM_THREAD_CREATE_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_DATA_STREAM_THREAD_CREATE_FAIL);
+  }
+
+  char name[16];
+  snprintf(name, sizeof(name), ECMC_DATA_STREAM_THREAD_NAME "%d", index_);
+  pthread_setname_np(thread_, name);
+  threadRunning_ = true;
+  return 0;
+}
+
+void ecmcDataStream::stop() {
+  if (!threadRunning_) {
+    return;
+  }
+  stop_ = true;
+  sem_post(&writeSem_);
+  pthread_join(thread_, NULL);
+  threadRunning_ = false;
+}
+
+void* ecmcDataStream::threadFunc(void *arg) {
+  ecmcDataStream *stream = (ecmcDataStream *)arg;
+
+  while (true) {
+    while (sem_wait(&stream->writeSem_) != 0 && errno == EINTR) {}
+
+    stream->commitRequested();
+
+    // Drain before exit
+    stream->writeBlocks();
+
+    if (stream->stop_) {
+      break;
+    }
+  }
+  return NULL;
+}
+
+int ecmcDataStream::linkProducer() {
+  if (linked_) {
+    LOGERR("%s/%s:%d: ERROR: Data stream %d already linked (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_DATA_STREAM_ALREADY_LINKED);
+    return ERROR_DATA_STREAM_ALREADY_LINKED;
+  }
+  linked_ = true;
+  return 0;
+}
+
+int ecmcDataStream::getChannelCount() {
+  return channelCount_;
+}
+
+int ecmcDataStream::setEnable(int enable) {
+  if (enable_ != enable) {
+    LOGINFO11("%s/%s:%d: dataStream[%d].enable=%d;\n",
+              __FILE__,
+              __FUNCTION__,
+              __LINE__,
+              index_,
+              enable);
+  }
+
+  if (enable) {
+    disableRequest_ = false;
+    enable_         = 1;
+  } else if (enable_) {
+    // Partial block written by producer or writer thread
+    disableRequest_ = true;
+    flushRequest_   = true;
+
+    if (semInit_) {
+      sem_post(&writeSem_);
+    }
+  }
+  return 0;
+}
+
+int ecmcDataStream::getEnabled(int *enabled) {
+  *enabled = enable_ && !disableRequest_;
+  return 0;
+}
+
+int ecmcDataStream::flush() {
+  flushRequest_ = true;
+
+  if (semInit_) {
+    sem_post(&writeSem_);
+  }
+  return 0;
+}
+
+/*
+* Realtime (single producer). Never blocks. Missing values are written as 0.
+*/
+int ecmcDataStream::appendRow(double *values, int count) {
+  if (!enable_ || !threadRunning_) {
+    return 0;
+  }
+
+  if (epicsAtomicCmpAndSwapIntT(&fillLock_, 0, 1) != 0) {
+    // Writer thread commits the block (flush)
+    lockDropped_++;
+    overflows_++;
+    return 0;
+  }
+  dropped_    += lockDropped_;
+  lockDropped_ = 0;
+
+  if (head_ - epicsAtomicGetSizeT(&tail_) >= (size_t)blockCount_) {
+    // All blocks queued for writing
+    dropped_++;
+    overflows_++;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetIntT(&fillLock_, 0);
+    return 0;
+  }
+
+  ecmcDataStreamBlock *block = &blocks_[head_ % blockCount_];
+
+  if (count > channelCount_) {
+    count = channelCount_;
+  }
+
+  block->time[fillRows_] = ec_ ? (int64_t)ec_->getDcTimeNs() : 0;
+
+  double *data = &block->data[fillRows_];
+
+  for (int i = 0; i < channelCount_; i++) {
+    *data = i < count ? values[i] : 0;
+    data += blockRows_;
+  }
+  fillRows_++;
+
+  if ((fillRows_ >= blockRows_) || flushRequest_) {
+    commitBlock();
+  }
+
+  if (disableRequest_) {
+    disableRequest_ = false;
+    enable_         = 0;
+  }
+  epicsAtomicWriteMemoryBarrier();
+  epicsAtomicSetIntT(&fillLock_, 0);
+  return 0;
+}
+
+/*
+* Writer thread: Commit the partial block on flush or disable request (the
+* producer might not append any more rows). If the producer holds the lock
+* it handles the request itself.
+*/
+void ecmcDataStream::commitRequested() {
+  while (flushRequest_ || disableRequest_) {
+    if (epicsAtomicCmpAndSwapIntT(&fillLock_, 0, 1) == 0) {
+      if (flushRequest_) {
+        commitBlock();
+      }
+
+      if (disableRequest_) {
+        disableRequest_ = false;
+        enable_         = 0;
+      }
+      epicsAtomicWriteMemoryBarrier();
+      epicsAtomicSetIntT(&fillLock_, 0);
+      return;
+    }
+    epicsThreadSleep(ECMC_DATA_STREAM_FLUSH_RETRY_S);
+  }
+}
+
+/*
+* Holder of fillLock_ (or destructor): Hand current block to writer thread.
+*/
+void ecmcDataStream::commitBlock() {
+  ecmcDataStreamBlock *block = &blocks_[head_ % blockCount_];
+
+  flushRequest_ = false;
+
+  if (fillRows_ <= 0) {
+    return;
+  }
+
+  block->header.magic    = ECMC_DATA_STREAM_BLOCK_MAGIC;
+  block->header.rows     = fillRows_;
+  block->header.dropped  = dropped_;
+  block->header.reserved = 0;
+  block->header.seq      = head_;
+  fillRows_              = 0;
+  dropped_               = 0;
+
+  epicsAtomicWriteMemoryBarrier();
+  epicsAtomicSetSizeT(&head_, head_ + 1);
+
+  if (semInit_) {
+    sem_post(&writeSem_);
+  }
+}
+
+/*
+* Writer thread: Write all committed blocks.
+*/
+void ecmcDataStream::writeBlocks() {
+  size_t head = epicsAtomicGetSizeT(&head_);
+
+  if (tail_ == head) {
+    return;
+  }
+  epicsAtomicReadMemoryBarrier();
+
+  while (tail_ != head) {
+    int errorCode = writeBlock(&blocks_[tail_ % blockCount_]);
+
+    if (errorCode) {
+      lastError_ = errorCode;
+    } else {
+      blocksWritten_++;
+    }
+
+    // Release block to producer
+    epicsAtomicReadMemoryBarrier();
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&tail_, tail_ + 1);
+  }
+
+  if (fflush(file_)) {
+    lastError_ = ERROR_DATA_STREAM_FILE_WRITE_FAIL;
+  }
+  refreshAsyn();
+}
+
+int ecmcDataStream::writeBlock(ecmcDataStreamBlock *block) {
+  size_t rows = block->header.rows;
+
+  if (fwrite(&block->header, sizeof(ecmcDataStreamBlockHeader), 1,
+             file_) != 1) {
+    return ERROR_DATA_STREAM_FILE_WRITE_FAIL;
+  }
+
+  if (fwrite(block->time, sizeof(int64_t), rows, file_) != rows) {
+    return ERROR_DATA_STREAM_FILE_WRITE_FAIL;
+  }
+
+  for (int i = 0; i < channelCount_; i++) {
+    if (fwrite(&block->data[i * blockRows_], sizeof(double), rows,
+               file_) != rows) {
+      return ERROR_DATA_STREAM_FILE_WRITE_FAIL;
+    }
+  }
+  return 0;
+}
+
+/*
+* Writer thread
+*/
+void ecmcDataStream::refreshAsyn() {
+  if (!asynPortDriver_ || !asynBlocks_) {
+    return;
+  }
+
+  ecmcAsynDataItem *params[3] = { asynBlocks_,
+                                  asynOverflows_,
+                                  asynError_ };
+  int32_t values[3] = { blocksWritten_,
+                        overflows_,
+                        lastError_ };
+
+  asynPortDriver_->lock();
+
+  for (int i = 0; i < 3; i++) {
+    params[i]->writeParam((uint8_t *)&values[i], sizeof(int32_t));
+  }
+  asynPortDriver_->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST,
+                                      ECMC_ASYN_DEFAULT_ADDR);
+  asynPortDriver_->unlock();
+}
@@ -0,0 +1,165 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcDataStream.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCDATASTREAM_H_
+#define ECMCDATASTREAM_H_
+
+#include <pthread.h>
+#include <semaphore.h>
+#include "stdio.h"
+
+#include "../main/ecmcDefinitions.h"
+#include "../main/ecmcError.h"
+#include "../com/ecmcAsynPortDriver.h"
+#include "../ethercat/ecmcEc.h"
+
+// Data stream
+#define ERROR_DATA_STREAM_NULL 0x235000
+#define ERROR_DATA_STREAM_INDEX_OUT_OF_RANGE 0x235001
+#define ERROR_DATA_STREAM_INVALID_SIZE 0x235002
+#define ERROR_DATA_STREAM_FILE_OPEN_FAIL 0x235003
+#define ERROR_DATA_STREAM_FILE_WRITE_FAIL 0x235004
+#define ERROR_DATA_STREAM_SEM_INIT_FAIL 0x235005
+#define ERROR_DATA_STREAM_THREAD_CREATE_FAIL 0x235006
+#define ERROR_DATA_STREAM_ALREADY_LINKED 0x235007
+#define ERROR_DATA_STREAM_CHANNEL_COUNT_MISMATCH 0x235008
+#define ERROR_DATA_STREAM_ASYN_PARAM_REGISTER_FAIL 0x235009
+
+#define ECMC_DATA_STREAM_FILE_MAGIC "ECMCSTRM"
+#define ECMC_DATA_STREAM_FILE_VERSION 1
+#define ECMC_DATA_STREAM_BLOCK_MAGIC 0x4b4c4245  // "EBLK"
+
+/**
+ * File header (native byte order, written once).
+ */
+typedef struct {
+  char     magic[8];
+  uint32_t version;
+  uint32_t channels;
+  uint32_t blockRows;
+  uint32_t reserved;
+} ecmcDataStreamFileHeader;
+
+/**
+ * Block header, followed by int64 time[rows] and then double data[rows] for
+ * each channel.
+ */
+typedef struct {
+  uint32_t magic;
+  uint32_t rows;
+  // Rows dropped (queue full) since previous block
+  uint32_t dropped;
+  uint32_t reserved;
+  uint64_t seq;
+} ecmcDataStreamBlockHeader;
+
+typedef struct {
+  ecmcDataStreamBlockHeader header;
+  int64_t *time;
+  // channels * blockRows (channel by channel)
+  double  *data;
+} ecmcDataStreamBlock;
+
+/**
+ * Streams recorded data to a binary file.
+ *
+ * The producer (realtime, one data storage or multi recorder) fills
+ * preallocated blocks of rows (one time stamp and one value per channel).
+ * Filled blocks are handed to a low priority writer thread through a lock
+ * free single producer / single consumer ring of blocks and the writer is
+ * woken with a semaphore. The producer never blocks or allocates. If all
+ * blocks are queued the rows are dropped and counted (in the next block
+ * header and the "overflows" asyn parameter).
+ *
+ * The block being filled is owned by whoever holds fillLock_ (try lock, the
+ * producer never waits). Flush and disable requests are handled by the
+ * producer at the next append or, if it does not append any more, by the
+ * writer thread. Rows appended while the writer thread holds the lock are
+ * dropped.
+ *
+ * The time stamp of each row is the DC application time of the frame that
+ * latched the inputs (same as ecmcMultiRecorder).
+ *
+ * Asyn parameters ("ecmc.stream<index>.<param>"):
+ *  blocks:    Blocks written to file
+ *  overflows: Rows dropped
+ *  error:     Last write error
+ */
+class ecmcDataStream : public ecmcError {
+ public:
+  ecmcDataStream(ecmcAsynPortDriver *asynPortDriver,
+                 ecmcEc             *ec,
+                 int                 index,
+                 const char         *fileName,
+                 int                 channelCount,
+                 int                 blockRows,
+                 int                 blockCount);
+  ~ecmcDataStream();
+  // Realtime (single producer)
+  int  appendRow(double *values,
+                 int     count);
+  int  setEnable(int enable);
+  int  getEnabled(int *enabled);
+  // Write current (partial) block
+  int  flush();
+  int  getChannelCount();
+  // Only one producer can be linked
+  int  linkProducer();
+  void printCurrentState();
+
+ private:
+  void         initVars();
+  int          initAsyn();
+  int          start();
+  void         stop();
+  void         commitBlock();
+  void         commitRequested();
+  void         writeBlocks();
+  int          writeBlock(ecmcDataStreamBlock *block);
+  void         refreshAsyn();
+  static void* threadFunc(void *arg);
+  ecmcAsynPortDriver  *asynPortDriver_;
+  ecmcEc              *ec_;
+  int                  index_;
+  FILE                *file_;
+  int                  channelCount_;
+  int                  blockRows_;
+  int                  blockCount_;
+  ecmcDataStreamBlock *blocks_;
+  // Committed blocks (written by producer)
+  size_t               head_;
+  // Written blocks (written by writer thread)
+  size_t               tail_;
+  // Rows in block being filled (producer)
+  int                  fillRows_;
+  uint32_t             dropped_;
+  // Rows dropped while block was locked by writer (producer)
+  uint32_t             lockDropped_;
+  // Block being filled locked (producer or writer thread)
+  int                  fillLock_;
+  volatile int         enable_;
+  volatile bool        flushRequest_;
+  volatile bool        disableRequest_;
+  bool                 linked_;
+  pthread_t            thread_;
+  sem_t                writeSem_;
+  bool                 semInit_;
+  volatile bool        threadRunning_;
+  volatile bool        stop_;
+  int32_t              blocksWritten_;
+  int32_t              overflows_;
+  int32_t              lastError_;
+  ecmcAsynDataItem    *asynBlocks_;
+  ecmcAsynDataItem    *asynOverflows_;
+  ecmcAsynDataItem    *asynError_;
+};
+
+#endif  /* ECMCDATASTREAM_H_ */
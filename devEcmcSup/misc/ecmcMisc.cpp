@@ -536,7 +536,8 @@ int createCommandList(int indexCommandList) {
   sampleRateChangeAllowed = 0;
 
   delete commandLists[indexCommandList];
-  commandLists[indexCommandList] = new ecmcCommandList(indexCommandList);
+  commandLists[indexCommandList] = new ecmcCommandList(asynPort,
+                                                      indexCommandList);
 
   if (!commandLists[indexCommandList]) {
     LOGERR("%s/%s:%d: FAILED TO ALLOCATE MEMORY FOR COMAMND-LIST OBJECT.\n",
@@ -617,6 +618,305 @@ int triggerCommandList(int indexCommandList) {
            indexCommandList);
 
   CHECK_COMMAND_LIST_RETURN_IF_ERROR(commandListIndex);
-  // No need for state of ethercat master
-  return commandLists[indexCommandList]->executeEvent(1);
+  // Execute in callers context (asyn port already locked)
+  return commandLists[indexCommandList]->execute();
+}
+
+int createMultiRecorder(int indexRecorder,
+                        int channelCount,
+                        int sampleCount,
+                        int bufferType) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d channelCount=%d sampleCount=%d bufferType=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder,
+           channelCount,
+           sampleCount,
+           bufferType);
+
+  if ((indexRecorder >= ECMC_MAX_MULTI_RECORDERS) || (indexRecorder < 0)) {
+    return ERROR_MULTI_RECORDER_INDEX_OUT_OF_RANGE;
+  }
+
+  // Sample rate fixed
+  sampleRateChangeAllowed = 0;
+
+  delete multiRecorders[indexRecorder];
+  multiRecorders[indexRecorder] = new ecmcMultiRecorder(
+    asynPort,
+    ec,
+    indexRecorder,
+    channelCount,
+    sampleCount,
+    (ecmcDSBufferType)bufferType);
+
+  if (!multiRecorders[indexRecorder]) {
+    LOGERR("%s/%s:%d: FAILED TO ALLOCATE MEMORY FOR MULTI RECORDER OBJECT.\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__);
+    exit(EXIT_FAILURE);
+  }
+
+  return multiRecorders[indexRecorder]->getErrorID();
+}
+
+int addMultiRecorderChannel(int indexRecorder, char *dataItemName) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d dataItemName=%s\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder,
+           dataItemName);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+
+  if (!asynPort) return ERROR_MAIN_ASYN_PORT_DRIVER_NULL;
+
+  ecmcDataItem *dataItem = asynPort->findAvailDataItem(dataItemName);
+
+  if (!dataItem) {
+    LOGERR("%s/%s:%d: ERROR: Data item %s not found (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           dataItemName,
+           ERROR_MULTI_RECORDER_DATA_ITEM_NULL);
+    return ERROR_MULTI_RECORDER_DATA_ITEM_NULL;
+  }
+
+  return multiRecorders[indexRecorder]->addDataItemChannel(dataItem);
+}
+
+int addMultiRecorderAxisChannel(int indexRecorder,
+                                int axisIndex,
+                                int dataToStore) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d axisIndex=%d dataToStore=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder,
+           axisIndex,
+           dataToStore);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  return multiRecorders[indexRecorder]->addAxisChannel(
+    axes[axisIndex]->getDebugInfoDataPointer(),
+    (ecmcAxisDataType)dataToStore);
+}
+
+int linkMultiRecorderToEvent(int indexRecorder,
+                             int indexEvent,
+                             int consumerIndex) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d indexEvent=%d consumerIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder,
+           indexEvent,
+           consumerIndex);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+  CHECK_EVENT_RETURN_IF_ERROR(indexEvent);
+
+  return events[indexEvent]->linkEventConsumer(multiRecorders[indexRecorder],
+                                               consumerIndex);
+}
+
+int setMultiRecorderEnable(int indexRecorder, int enable) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d enable=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder,
+           enable);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+
+  return multiRecorders[indexRecorder]->setEnable(enable);
+}
+
+int clearMultiRecorder(int indexRecorder) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+
+  return multiRecorders[indexRecorder]->clear();
+}
+
+int triggerMultiRecorder(int indexRecorder) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+
+  if (!ec) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  return multiRecorders[indexRecorder]->executeEvent(ec->statusOK());
+}
+
+int setMultiRecorderCaptureMode(int indexRecorder,
+                                int preSamples,
+                                int postSamples) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d preSamples=%d postSamples=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder,
+           preSamples,
+           postSamples);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+
+  return multiRecorders[indexRecorder]->setCaptureMode(preSamples,
+                                                       postSamples);
+}
+
+int setMultiRecorderCaptureTrigger(int indexRecorder, int channel, int edge) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d channel=%d edge=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder,
+           channel,
+           edge);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+
+  return multiRecorders[indexRecorder]->setCaptureTriggerChannel(
+    channel,
+    (triggerEdgeType)edge);
+}
+
+int linkMultiRecorderCaptureToEvent(int indexRecorder,
+                                    int indexEvent,
+                                    int consumerIndex) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d indexEvent=%d consumerIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder,
+           indexEvent,
+           consumerIndex);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+  CHECK_EVENT_RETURN_IF_ERROR(indexEvent);
+
+  return events[indexEvent]->linkEventConsumer(
+    multiRecorders[indexRecorder]->getCaptureTrigger(),
+    consumerIndex);
+}
+
+int triggerMultiRecorderCapture(int indexRecorder) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+
+  return multiRecorders[indexRecorder]->triggerCapture();
+}
+
+int createDataStream(int   indexStream,
+                     int   channelCount,
+                     int   blockRows,
+                     int   blockCount,
+                     char *fileName) {
+  LOGINFO4("%s/%s:%d indexStream=%d channelCount=%d blockRows=%d blockCount=%d fileName=%s\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexStream,
+           channelCount,
+           blockRows,
+           blockCount,
+           fileName);
+
+  if ((indexStream >= ECMC_MAX_DATA_STREAMS) || (indexStream < 0)) {
+    return ERROR_DATA_STREAM_INDEX_OUT_OF_RANGE;
+  }
+
+  delete dataStreams[indexStream];
+  dataStreams[indexStream] = new ecmcDataStream(asynPort,
+                                                ec,
+                                                indexStream,
+                                                fileName,
+                                                channelCount,
+                                                blockRows,
+                                                blockCount);
+
+  if (!dataStreams[indexStream]) {
+    LOGERR("%s/%s:%d: FAILED TO ALLOCATE MEMORY FOR DATA STREAM OBJECT.\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__);
+    exit(EXIT_FAILURE);
+  }
+
+  return dataStreams[indexStream]->getErrorID();
+}
+
+int linkStorageToDataStream(int indexStorage, int indexStream) {
+  LOGINFO4("%s/%s:%d indexStorage=%d indexStream=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexStorage,
+           indexStream);
+
+  CHECK_STORAGE_RETURN_IF_ERROR(indexStorage);
+  CHECK_DATA_STREAM_RETURN_IF_ERROR(indexStream);
+
+  return dataStorages[indexStorage]->setDataStream(dataStreams[indexStream]);
+}
+
+int linkMultiRecorderToDataStream(int indexRecorder, int indexStream) {
+  LOGINFO4("%s/%s:%d indexRecorder=%d indexStream=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexRecorder,
+           indexStream);
+
+  CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder);
+  CHECK_DATA_STREAM_RETURN_IF_ERROR(indexStream);
+
+  return multiRecorders[indexRecorder]->setDataStream(dataStreams[indexStream]);
+}
+
+int setDataStreamEnable(int indexStream, int enable) {
+  LOGINFO4("%s/%s:%d indexStream=%d enable=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexStream,
+           enable);
+
+  CHECK_DATA_STREAM_RETURN_IF_ERROR(indexStream);
+
+  return dataStreams[indexStream]->setEnable(enable);
+}
+
+int flushDataStream(int indexStream) {
+  LOGINFO4("%s/%s:%d indexStream=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           indexStream);
+
+  CHECK_DATA_STREAM_RETURN_IF_ERROR(indexStream);
+
+  return dataStreams[indexStream]->flush();
 }
@@ -61,6 +61,30 @@
   }                                                                           \
 }                                                                             \
 
+#define CHECK_MULTI_RECORDER_RETURN_IF_ERROR(indexRecorder)                   \
+{                                                                             \
+  if (indexRecorder >= ECMC_MAX_MULTI_RECORDERS || indexRecorder < 0) {       \
+    LOGERR("ERROR: Multi recorder index out of range.\n");                    \
+    return ERROR_MULTI_RECORDER_INDEX_OUT_OF_RANGE;                           \
+  }                                                                           \
+  if (multiRecorders[indexRecorder] == NULL) {                                \
+    LOGERR("ERROR: Multi recorder object NULL.\n");                           \
+    return ERROR_MULTI_RECORDER_NULL;                                         \
+  }                                                                           \
+}                                                                             \
+
+#define CHECK_DATA_STREAM_RETURN_IF_ERROR(indexStream)                       \
+{                                                                             \
+  if (indexStream >= ECMC_MAX_DATA_STREAMS || indexStream < 0) {             \
+    LOGERR("ERROR: Data stream index out of range.\n");                       \
+    return ERROR_DATA_STREAM_INDEX_OUT_OF_RANGE;                              \
+  }                                                                           \
+  if (dataStreams[indexStream] == NULL) {                                     \
+    LOGERR("ERROR: Data stream object NULL.\n");                              \
+    return ERROR_DATA_STREAM_NULL;                                            \
+  }                                                                           \
+}                                                                             \
+
 # ifdef __cplusplus
 extern "C" {
 # endif  // ifdef __cplusplus
@@ -602,11 +626,14 @@ int triggerRecorder(int indexRecorder);
  * command list can be triggered by an event or by the command
  * triggerCommandList().\n
  *
- * \note If the command list is triggered by a hardware event. The command
- * list will be executed from the realtime thread. In this case special
- * consideration needs to be taken so that the jitter of realtime thread is not
- * worsen. Normal motion commands are normally no issue to use but commands
- * that creates new axis or takes long time to return should be avoided.\n
+ * \note If the command list is triggered by an event the commands are
+ * executed in a low priority worker thread (the realtime thread only wakes
+ * the worker). Triggers while the list is still executing are counted as
+ * overruns. The result is available as asyn parameters:\n
+ *   ecmc.cmdlist<index>.status:   0=idle, 1=busy, 2=done, 3=error\n
+ *   ecmc.cmdlist<index>.error:    Error code of last execution\n
+ *   ecmc.cmdlist<index>.execute:  Execution time of last execution [us]\n
+ *   ecmc.cmdlist<index>.overruns: Triggers while busy\n
  *
  * \param[in] index Index of command list object to create.\n
  *
@@ -677,7 +704,8 @@ int addCommandListCommand(int   indexCommandList,
 
 /** \brief Force trigger command list.\n
  *
- * All commands in the command list object will be executed.\n
+ * All commands in the command list object will be executed (in the
+ * callers context, not in the worker thread).\n
  *
  * \param[in] indexCommandList Index of command list to address.\n
  *
@@ -688,6 +716,312 @@ int addCommandListCommand(int   indexCommandList,
  */
 int triggerCommandList(int indexCommandList);
 
+/** \brief Create multi channel recorder object.
+ *
+ * The multi channel recorder stores several channels at the same trigger
+ * (event or the command triggerMultiRecorder()). Each sample also gets a
+ * time stamp (DC application time of the frame that latched the inputs, ns
+ * since 2000-01-01). All memory is allocated here.\n
+ * Channels are added with addMultiRecorderChannel() (any ecmc data item,
+ * like EtherCAT entries and PLC variables) or with
+ * addMultiRecorderAxisChannel() (axis status fields).\n
+ *
+ * The data is available as asyn parameters:\n
+ *   ecmc.mrec<index>.ch<channel>: Channel data (Float64Array)\n
+ *   ecmc.mrec<index>.time:        Time stamps [ns] (Int64Array)\n
+ *   ecmc.mrec<index>.index:       Next sample index\n
+ *   ecmc.mrec<index>.full:        Buffer full (or wrapped)\n
+ *   ecmc.mrec<index>.clear:       Write to clear buffer\n
+ * The arrays are updated when the buffer is full (or wraps) and at clear.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder object to create.\n
+ * \param[in] channelCount Max number of channels.\n
+ * \param[in] sampleCount Number of samples per channel.\n
+ * \param[in] bufferType Buffer type.\n
+ *   bufferType = 0: Normal buffer (stop when full).\n
+ *   bufferType = 1: Ring buffer (wrap when full).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Create a multi recorder object at index 0 with 32 channels
+ * and 10000 samples in a ring buffer.\n
+ * "Cfg.CreateMultiRecorder(0,32,10000,1)" //Command string to ecmcCmdParser.c\n
+ */
+int createMultiRecorder(int indexRecorder,
+                        int channelCount,
+                        int sampleCount,
+                        int bufferType);
+
+/** \brief Add a data item channel to a multi recorder object.\n
+ *
+ * Any registered ecmc data item can be recorded (the first element is
+ * recorded for arrays). Channels are numbered in the order they are added.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder object to address.\n
+ * \param[in] dataItemName Name of data item.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Add the entry "positionActual01" of slave 3 to multi
+ * recorder 0.\n
+ *  "Cfg.AddMultiRecorderChannel(0,ec0.s3.positionActual01)" //Command string to ecmcCmdParser.c\n
+ */
+int addMultiRecorderChannel(int   indexRecorder,
+                            char *dataItemName);
+
+/** \brief Add an axis data channel to a multi recorder object.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder object to address.\n
+ * \param[in] axisIndex Index of axis.\n
+ * \param[in] dataToStore Axis data to record (same as for
+ * linkAxisDataToRecorder()).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Add actual position of axis 4 to multi recorder 0.\n
+ *  "Cfg.AddMultiRecorderAxisChannel(0,4,2)" //Command string to ecmcCmdParser.c\n
+ */
+int addMultiRecorderAxisChannel(int indexRecorder,
+                                int axisIndex,
+                                int dataToStore);
+
+/** \brief Link multi recorder object to event object.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder object to address.\n
+ * \param[in] indexEvent Index of event object to address.\n
+ * \param[in] consumerIndex Event consumer index (one event can have a
+ * list with consumers).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Link multi recorder object 0 with event object 4, event
+ * consumer index 1.\n
+ *  "Cfg.LinkMultiRecorderToEvent(0,4,1)" //Command string to ecmcCmdParser.c\n
+ */
+int linkMultiRecorderToEvent(int indexRecorder,
+                             int indexEvent,
+                             int consumerIndex);
+
+/** \brief Enable multi recorder.\n
+ *
+ * Data will only be recorded when enabled. Channels can only be added when
+ * disabled.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder to address.\n
+ * \param[in] enable Enable.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Start data recording of multi recorder object 0.\n
+ *  "Cfg.SetMultiRecorderEnable(0,1)" //Command string to ecmcCmdParser.c\n
+ */
+int setMultiRecorderEnable(int indexRecorder,
+                           int enable);
+
+/** \brief Clear multi recorder buffer.\n
+ *
+ * If enabled, the buffer is cleared at next trigger.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder to address.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Clear multi recorder 0.\n
+ *  "Cfg.ClearMultiRecorder(0)" //Command string to ecmcCmdParser.c\n
+ */
+int clearMultiRecorder(int indexRecorder);
+
+/** \brief Force trigger multi recorder.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder to address.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Force trigger multi recorder 0.\n
+ *  "Cfg.TriggerMultiRecorder(0)" //Command string to ecmcCmdParser.c\n
+ */
+int triggerMultiRecorder(int indexRecorder);
+
+/** \brief Set multi recorder in triggered capture mode.\n
+ *
+ * The multi recorder records continuously (ring buffer) and freezes a window
+ * of preSamples + postSamples samples around a capture trigger. The window
+ * is published once (oldest sample first) when the last post trigger sample
+ * has been recorded. The recorder then stops until cleared (see
+ * clearMultiRecorder() or asyn parameter ecmc.mrec<index>.clear), which
+ * re-arms the capture.\n
+ * Capture triggers:\n
+ *   1. Event linked with linkMultiRecorderCaptureToEvent().\n
+ *   2. Edge of a channel, see setMultiRecorderCaptureTrigger().\n
+ *   3. triggerMultiRecorderCapture().\n
+ * The capture state is available as asyn parameter
+ * ecmc.mrec<index>.capture.state (0=off, 1=armed, 2=triggered, 3=done).\n
+ *
+ * The window length in time is given by the rate of the sampling event (for
+ * instance 1000 pre trigger samples is 1s at 1kHz).\n
+ *
+ * \note The buffer memory is doubled in capture mode.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder object to address.\n
+ * \param[in] preSamples Samples before the trigger sample.\n
+ * \param[in] postSamples Samples after trigger, including the trigger
+ * sample (atleast 1).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Capture 900 samples before and 100 samples after trigger.\n
+ *  "Cfg.SetMultiRecorderCaptureMode(0,900,100)" //Command string to ecmcCmdParser.c\n
+ */
+int setMultiRecorderCaptureMode(int indexRecorder,
+                                int preSamples,
+                                int postSamples);
+
+/** \brief Trigger capture on edge of a multi recorder channel.\n
+ *
+ * The channel value is evaluated as zero / non zero. Typical use is a limit
+ * switch (negative edge) or the error id of an axis (positive edge).\n
+ *
+ * \param[in] indexRecorder Index of multi recorder object to address.\n
+ * \param[in] channel Channel index (-1 to disable).\n
+ * \param[in] edge Trigger edge.\n
+ *   edge = 0: Positive edge.\n
+ *   edge = 1: Negative edge.\n
+ *   edge = 2: On change.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Trigger capture of multi recorder 0 at negative edge of
+ * channel 5.\n
+ *  "Cfg.SetMultiRecorderCaptureTrigger(0,5,1)" //Command string to ecmcCmdParser.c\n
+ */
+int setMultiRecorderCaptureTrigger(int indexRecorder,
+                                   int channel,
+                                   int edge);
+
+/** \brief Link capture trigger of multi recorder object to event object.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder object to address.\n
+ * \param[in] indexEvent Index of event object to address.\n
+ * \param[in] consumerIndex Event consumer index (one event can have a
+ * list with consumers).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Trigger capture of multi recorder 0 with event object 2,
+ * event consumer index 0.\n
+ *  "Cfg.LinkMultiRecorderCaptureToEvent(0,2,0)" //Command string to ecmcCmdParser.c\n
+ */
+int linkMultiRecorderCaptureToEvent(int indexRecorder,
+                                    int indexEvent,
+                                    int consumerIndex);
+
+/** \brief Force capture trigger of multi recorder.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder to address.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Force capture trigger of multi recorder 0.\n
+ *  "Cfg.TriggerMultiRecorderCapture(0)" //Command string to ecmcCmdParser.c\n
+ */
+int triggerMultiRecorderCapture(int indexRecorder);
+
+/** \brief Create data stream object (stream recorded data to file).
+ *
+ * Recorded data is written to a binary file by a low priority writer thread.
+ * The realtime thread fills preallocated blocks of rows (time stamp and one
+ * value per channel) and queues them to the writer without blocking. If the
+ * writer can not keep up, rows are dropped and counted.\n
+ * A data stream is fed by one producer, see linkStorageToDataStream() and
+ * linkMultiRecorderToDataStream().\n
+ *
+ * File format (native byte order):\n
+ *   File header: char magic[8]="ECMCSTRM", uint32 version, uint32 channels,
+ *                uint32 blockRows, uint32 reserved.\n
+ *   Blocks:      uint32 magic, uint32 rows, uint32 dropped, uint32 reserved,
+ *                uint64 seq, int64 time[rows], double data[rows] for each
+ *                channel.\n
+ *
+ * Asyn parameters:\n
+ *   ecmc.stream<index>.blocks:    Blocks written\n
+ *   ecmc.stream<index>.overflows: Rows dropped\n
+ *   ecmc.stream<index>.error:     Last write error\n
+ *
+ * \param[in] indexStream Index of data stream object to create.\n
+ * \param[in] channelCount Number of channels (values per row).\n
+ * \param[in] blockRows Rows per block.\n
+ * \param[in] blockCount Number of blocks (at least 2).\n
+ * \param[in] fileName File name (overwritten).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Create data stream 0 with 8 channels, 16 blocks of 1000 rows
+ * writing to file /tmp/rec.bin.\n
+ * "Cfg.CreateDataStream(0,8,1000,16,/tmp/rec.bin)" //Command string to ecmcCmdParser.c\n
+ */
+int createDataStream(int   indexStream,
+                     int   channelCount,
+                     int   blockRows,
+                     int   blockCount,
+                     char *fileName);
+
+/** \brief Stream data appended to a data storage.\n
+ *
+ * The data stream must have one channel.\n
+ *
+ * \param[in] indexStorage Index of data storage object to address.\n
+ * \param[in] indexStream Index of data stream object.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Stream data storage 3 with data stream 0.\n
+ *  "Cfg.LinkStorageToDataStream(3,0)" //Command string to ecmcCmdParser.c\n
+ */
+int linkStorageToDataStream(int indexStorage,
+                            int indexStream);
+
+/** \brief Stream samples of a multi recorder.\n
+ *
+ * The channel count of the data stream must match the number of added
+ * channels of the multi recorder.\n
+ *
+ * \param[in] indexRecorder Index of multi recorder object to address.\n
+ * \param[in] indexStream Index of data stream object.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Stream multi recorder 0 with data stream 1.\n
+ *  "Cfg.LinkMultiRecorderToDataStream(0,1)" //Command string to ecmcCmdParser.c\n
+ */
+int linkMultiRecorderToDataStream(int indexRecorder,
+                                  int indexStream);
+
+/** \brief Enable data stream.\n
+ *
+ * When disabled, the current (partial) block is written.\n
+ *
+ * \param[in] indexStream Index of data stream object to address.\n
+ * \param[in] enable Enable.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Enable data stream 0.\n
+ *  "Cfg.SetDataStreamEnable(0,1)" //Command string to ecmcCmdParser.c\n
+ */
+int setDataStreamEnable(int indexStream,
+                        int enable);
+
+/** \brief Write current (partial) block of data stream at next row.\n
+ *
+ * \param[in] indexStream Index of data stream object to address.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Flush data stream 0.\n
+ *  "Cfg.FlushDataStream(0)" //Command string to ecmcCmdParser.c\n
+ */
+int flushDataStream(int indexStream);
+
 # ifdef __cplusplus
 }
 # endif  // ifdef __cplusplus
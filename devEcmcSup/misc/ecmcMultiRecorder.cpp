@@ -0,0 +1,904 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcMultiRecorder.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcMultiRecorder.h"
+#include <string.h>
+#include "ecmcDataRecorder.h"
+#include "../main/ecmcErrorsList.h"
+
+ecmcMultiRecorder::ecmcMultiRecorder(ecmcAsynPortDriver *asynPortDriver,
+                                     ecmcEc             *ec,
+                                     int                 index,
+                                     int                 channelCount,
+                                     int                 sampleCount,
+                                     ecmcDSBufferType    bufferType) {
+  initVars();
+  index_          = index;
+  asynPortDriver_ = asynPortDriver;
+  ec_             = ec;
+  PRINT_ERROR_PATH("multiRecorder[%d].error", index_);
+
+  if ((channelCount <= 0) ||
+      (channelCount > ECMC_MAX_MULTI_RECORDER_CHANNELS) ||
+      (sampleCount <= 0)) {
+    LOGERR("%s/%s:%d: ERROR: Invalid channel count %d or sample count %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           channelCount,
+           sampleCount,
+           ERROR_MULTI_RECORDER_INVALID_SIZE);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_MULTI_RECORDER_INVALID_SIZE);
+    return;
+  }
+
+  if ((bufferType != ECMC_STORAGE_NORMAL_BUFFER) &&
+      (bufferType != ECMC_STORAGE_RING_BUFFER)) {
+    LOGERR("%s/%s:%d: ERROR: Buffer type %d not supported (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           bufferType,
+           ERROR_MULTI_RECORDER_BUFFER_TYPE_NOT_SUPPORTED);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_MULTI_RECORDER_BUFFER_TYPE_NOT_SUPPORTED);
+    return;
+  }
+
+  channelCountMax_ = channelCount;
+  sampleCount_     = sampleCount;
+  bufferType_      = bufferType;
+  channels_        = new ecmcMultiRecorderChannel[channelCountMax_];
+  memset(channels_, 0, sizeof(ecmcMultiRecorderChannel) * channelCountMax_);
+  allocateBuffers(sampleCount_);
+
+  if (initAsyn()) {
+    return;
+  }
+  printCurrentState();
+}
+
+ecmcMultiRecorder::~ecmcMultiRecorder() {
+  delete captureTrigger_;
+  delete[] channels_;
+  delete[] data_;
+  delete[] time_;
+  delete[] streamRow_;
+}
+
+void ecmcMultiRecorder::initVars() {
+  errorReset();
+  asynPortDriver_  = NULL;
+  ec_              = NULL;
+  index_           = 0;
+  enable_          = 0;
+  inStartupPhase_  = 1;
+  bufferType_      = ECMC_STORAGE_NORMAL_BUFFER;
+  channelCountMax_ = 0;
+  channelCount_    = 0;
+  sampleCount_     = 0;
+  stride_          = 0;
+  channels_        = NULL;
+  data_            = NULL;
+  time_            = NULL;
+  sampleIndex_     = 0;
+  captureMode_     = false;
+  preSamples_      = 0;
+  postSamples_     = 0;
+  postCounter_     = 0;
+  validSamples_    = 0;
+  captureState_    = ECMC_MULTI_REC_CAPTURE_OFF;
+  capturePre_      = 0;
+  triggerChannel_  = -1;
+  triggerEdge_     = ECMC_POSITIVE_EDGE;
+  triggerValueOld_ = -1;
+  triggerRequest_  = false;
+  captureTrigger_  = NULL;
+  full_            = 0;
+  clearCmd_        = 0;
+  clearRequest_    = false;
+  asynTime_        = NULL;
+  asynIndex_       = NULL;
+  asynFull_        = NULL;
+  asynClear_       = NULL;
+  asynCaptureState_ = NULL;
+  asynCapturePre_  = NULL;
+  stream_          = NULL;
+  streamRow_       = NULL;
+}
+
+void ecmcMultiRecorder::printCurrentState() {
+  LOGINFO11("%s/%s:%d: multiRecorder[%d].channels=%d/%d;\n",
+            __FILE__,
+            __FUNCTION__,
+            __LINE__,
+            index_,
+            channelCount_,
+            channelCountMax_);
+  LOGINFO11("%s/%s:%d: multiRecorder[%d].samples=%d;\n",
+            __FILE__,
+            __FUNCTION__,
+            __LINE__,
+            index_,
+            sampleCount_);
+  LOGINFO11("%s/%s:%d: multiRecorder[%d].enable=%d;\n",
+            __FILE__,
+            __FUNCTION__,
+            __LINE__,
+            index_,
+            enable_);
+}
+
+ecmcAsynDataItem * ecmcMultiRecorder::addAsynParam(const char    *name,
+                                                   asynParamType  asynType,
+                                                   uint8_t       *data,
+                                                   size_t         bytes,
+                                                   ecmcEcDataType dt) {
+  char buffer[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
+  unsigned int charCount = snprintf(buffer,
+                                    sizeof(buffer),
+                                    "ecmc." ECMC_MULTI_RECORDER_STR "%d.%s",
+                                    index_,
+                                    name);
+
+  if (charCount >= sizeof(buffer) - 1) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Failed to generate param name. Buffer to small (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      ERROR_MULTI_RECORDER_ASYN_PARAM_REGISTER_FAIL);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_MULTI_RECORDER_ASYN_PARAM_REGISTER_FAIL);
+    return NULL;
+  }
+
+  ecmcAsynDataItem *paramTemp = asynPortDriver_->addNewAvailParam(buffer,
+                                                                   asynType,
+                                                                   data,
+                                                                   bytes,
+                                                                   dt,
+                                                                   0);
+
+  if (!paramTemp) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Add create default parameter for %s failed.\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      buffer);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
+    return NULL;
+  }
+  paramTemp->setAllowWriteToEcmc(false);
+  paramTemp->refreshParam(1);
+  return paramTemp;
+}
+
+int ecmcMultiRecorder::initAsyn() {
+  if (!asynPortDriver_) {
+    return 0;
+  }
+
+  asynTime_ = addAsynParam(ECMC_ASYN_MULTI_REC_PAR_TIME_NAME,
+                           asynParamInt64Array,
+                           (uint8_t *)time_,
+                           sizeof(int64_t) * sampleCount_,
+                           ECMC_EC_S64);
+  asynIndex_ = addAsynParam(ECMC_ASYN_MULTI_REC_PAR_INDEX_NAME,
+                            asynParamInt32,
+                            (uint8_t *)&sampleIndex_,
+                            sizeof(int32_t),
+                            ECMC_EC_S32);
+  asynFull_ = addAsynParam(ECMC_ASYN_MULTI_REC_PAR_FULL_NAME,
+                           asynParamInt32,
+                           (uint8_t *)&full_,
+                           sizeof(int32_t),
+                           ECMC_EC_S32);
+  asynClear_ = addAsynParam(ECMC_ASYN_MULTI_REC_PAR_CLEAR_NAME,
+                            asynParamInt32,
+                            (uint8_t *)&clearCmd_,
+                            sizeof(int32_t),
+                            ECMC_EC_S32);
+  asynCaptureState_ = addAsynParam(ECMC_ASYN_MULTI_REC_PAR_CAPTURE_STATE_NAME,
+                                   asynParamInt32,
+                                   (uint8_t *)&captureState_,
+                                   sizeof(int32_t),
+                                   ECMC_EC_S32);
+  asynCapturePre_ = addAsynParam(ECMC_ASYN_MULTI_REC_PAR_CAPTURE_PRE_NAME,
+                                 asynParamInt32,
+                                 (uint8_t *)&capturePre_,
+                                 sizeof(int32_t),
+                                 ECMC_EC_S32);
+
+  if (!asynTime_ || !asynIndex_ || !asynFull_ || !asynClear_ ||
+      !asynCaptureState_ || !asynCapturePre_) {
+    return getErrorID();
+  }
+  asynClear_->setAllowWriteToEcmc(true);
+  asynClear_->setExeCmdFunctPtr(asynClear, this);
+  return 0;
+}
+
+asynStatus ecmcMultiRecorder::asynClear(void         *data,
+                                        size_t        bytes,
+                                        asynParamType asynParType,
+                                        void         *userObj) {
+  ecmcMultiRecorder *recorder = (ecmcMultiRecorder *)userObj;
+
+  if (!recorder) {
+    return asynError;
+  }
+  return recorder->clear() ? asynError : asynSuccess;
+}
+
+int ecmcMultiRecorder::addChannel(ecmcMultiRecorderChannel *channel) {
+  if (enable_) {
+    LOGERR("%s/%s:%d: ERROR: Channels can not be added when enabled (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_MULTI_RECORDER_ENABLED);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_ENABLED);
+  }
+
+  if (channelCount_ >= channelCountMax_) {
+    LOGERR("%s/%s:%d: ERROR: Channel list full (max %d) (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           channelCountMax_,
+           ERROR_MULTI_RECORDER_CHANNELS_FULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_CHANNELS_FULL);
+  }
+
+  double *channelData = &data_[channelCount_ * stride_];
+  double  value       = 0;
+  int     errorCode   = readChannel(channel, &value);
+
+  if (errorCode) {
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
+
+  if (asynPortDriver_) {
+    char name[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
+    snprintf(name,
+             sizeof(name),
+             ECMC_ASYN_MULTI_REC_PAR_CHANNEL_NAME "%d",
+             channelCount_);
+    channel->asynData = addAsynParam(name,
+                                     asynParamFloat64Array,
+                                     (uint8_t *)channelData,
+                                     sizeof(double) * sampleCount_,
+                                     ECMC_EC_F64);
+
+    if (!channel->asynData) {
+      return getErrorID();
+    }
+  }
+
+  channels_[channelCount_] = *channel;
+  channelCount_++;
+
+  if (captureMode_) {
+    setAsynDataPointers(0, preSamples_ + postSamples_);
+  }
+  return 0;
+}
+
+int ecmcMultiRecorder::addDataItemChannel(ecmcDataItem *dataItem) {
+  if (!dataItem) {
+    LOGERR("%s/%s:%d: ERROR: Data item NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_MULTI_RECORDER_DATA_ITEM_NULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_DATA_ITEM_NULL);
+  }
+
+  ecmcMultiRecorderChannel channel;
+  memset(&channel, 0, sizeof(channel));
+  channel.type     = ECMC_MULTI_REC_CHANNEL_DATA_ITEM;
+  channel.itemInfo = dataItem->getDataItemInfo();
+
+  LOGINFO11("%s/%s:%d: multiRecorder[%d].ch%d=%s;\n",
+            __FILE__,
+            __FUNCTION__,
+            __LINE__,
+            index_,
+            channelCount_,
+            dataItem->getName());
+
+  return addChannel(&channel);
+}
+
+int ecmcMultiRecorder::addAxisChannel(ecmcAxisStatusType *axisData,
+                                      ecmcAxisDataType    dataType) {
+  if (!axisData) {
+    LOGERR("%s/%s:%d: ERROR: Axis data NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_MULTI_RECORDER_DATA_ITEM_NULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_DATA_ITEM_NULL);
+  }
+
+  ecmcMultiRecorderChannel channel;
+  memset(&channel, 0, sizeof(channel));
+  channel.type         = ECMC_MULTI_REC_CHANNEL_AXIS;
+  channel.axisData     = axisData;
+  channel.axisDataType = dataType;
+
+  LOGINFO11("%s/%s:%d: multiRecorder[%d].ch%d=axis%d.%d;\n",
+            __FILE__,
+            __FUNCTION__,
+            __LINE__,
+            index_,
+            channelCount_,
+            axisData->axisID,
+            dataType);
+
+  return addChannel(&channel);
+}
+
+/*
+* Realtime. Returns error code (no error state set).
+* For arrays the first element is recorded.
+*/
+int ecmcMultiRecorder::readChannel(ecmcMultiRecorderChannel *channel,
+                                   double                   *data) {
+  if (channel->type == ECMC_MULTI_REC_CHANNEL_AXIS) {
+    return ecmcDataRecorder::readAxisData(channel->axisData,
+                                          channel->axisDataType,
+                                          data);
+  }
+
+  if ((channel->type != ECMC_MULTI_REC_CHANNEL_DATA_ITEM) ||
+      !channel->itemInfo || !channel->itemInfo->data) {
+    return ERROR_MULTI_RECORDER_DATA_ITEM_NULL;
+  }
+
+  uint8_t *source = channel->itemInfo->data;
+
+  switch (channel->itemInfo->dataType) {
+  case ECMC_EC_B1:
+  case ECMC_EC_B2:
+  case ECMC_EC_B3:
+  case ECMC_EC_B4:
+  case ECMC_EC_U8:
+    *data = static_cast<double>(*source);
+    break;
+
+  case ECMC_EC_S8:
+    *data = static_cast<double>(*(int8_t *)source);
+    break;
+
+  case ECMC_EC_U16:
+    *data = static_cast<double>(*(uint16_t *)source);
+    break;
+
+  case ECMC_EC_S16:
+    *data = static_cast<double>(*(int16_t *)source);
+    break;
+
+  case ECMC_EC_U32:
+    *data = static_cast<double>(*(uint32_t *)source);
+    break;
+
+  case ECMC_EC_S32:
+    *data = static_cast<double>(*(int32_t *)source);
+    break;
+
+  case ECMC_EC_U64:
+    *data = static_cast<double>(*(uint64_t *)source);
+    break;
+
+  case ECMC_EC_S64:
+    *data = static_cast<double>(*(int64_t *)source);
+    break;
+
+  case ECMC_EC_F32:
+    *data = static_cast<double>(*(float *)source);
+    break;
+
+  case ECMC_EC_F64:
+    *data = *(double *)source;
+    break;
+
+  default:
+    return ERROR_MULTI_RECORDER_DATA_TYPE_NOT_SUPPORTED;
+
+    break;
+  }
+  return 0;
+}
+
+int ecmcMultiRecorder::getChannelCount() {
+  return channelCount_;
+}
+
+int ecmcMultiRecorder::validate() {
+  if (getError()) {
+    return getErrorID();
+  }
+
+  if (channelCount_ <= 0) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_NO_CHANNELS);
+  }
+  return 0;
+}
+
+int ecmcMultiRecorder::setEnable(int enable) {
+  if (enable) {
+    int errorCode = validate();
+
+    if (errorCode) {
+      return errorCode;
+    }
+  }
+
+  if (enable_ != enable) {
+    LOGINFO11("%s/%s:%d: multiRecorder[%d].enable=%d;\n",
+              __FILE__,
+              __FUNCTION__,
+              __LINE__,
+              index_,
+              enable);
+  }
+  enable_ = enable;
+  return 0;
+}
+
+int ecmcMultiRecorder::getEnabled(int *enabled) {
+  *enabled = enable_;
+  return 0;
+}
+
+/*
+* Cleared at next trigger if enabled (realtime owns the buffer)
+*/
+int ecmcMultiRecorder::clear() {
+  if (enable_) {
+    clearRequest_ = true;
+    return 0;
+  }
+  clearBuffer();
+  refreshAsynArrays();
+  refreshAsyn(true);
+  return 0;
+}
+
+void ecmcMultiRecorder::clearBuffer() {
+  memset(data_, 0, sizeof(double) * channelCountMax_ * stride_);
+  memset(time_, 0, sizeof(int64_t) * stride_);
+  sampleIndex_     = 0;
+  full_            = 0;
+  postCounter_     = 0;
+  validSamples_    = 0;
+  capturePre_      = 0;
+  triggerValueOld_ = -1;
+  triggerRequest_  = false;
+  captureState_    = captureMode_ ? ECMC_MULTI_REC_CAPTURE_ARMED :
+                     ECMC_MULTI_REC_CAPTURE_OFF;
+}
+
+int ecmcMultiRecorder::allocateBuffers(int stride) {
+  delete[] data_;
+  delete[] time_;
+  stride_ = stride;
+  data_   = new double[channelCountMax_ * stride_];
+  time_   = new int64_t[stride_];
+  clearBuffer();
+  return 0;
+}
+
+/*
+* Point the asyn arrays to samples [start, start + samples) of each channel
+*/
+void ecmcMultiRecorder::setAsynDataPointers(int start, int samples) {
+  for (int i = 0; i < channelCount_; i++) {
+    if (channels_[i].asynData) {
+      channels_[i].asynData->setEcmcDataPointer(
+        (uint8_t *)&data_[i * stride_ + start],
+        sizeof(double) * samples);
+    }
+  }
+
+  if (asynTime_) {
+    asynTime_->setEcmcDataPointer((uint8_t *)&time_[start],
+                                  sizeof(int64_t) * samples);
+  }
+}
+
+int ecmcMultiRecorder::setCaptureMode(int preSamples, int postSamples) {
+  if (enable_) {
+    LOGERR("%s/%s:%d: ERROR: Capture mode can not be changed when enabled (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_MULTI_RECORDER_ENABLED);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_ENABLED);
+  }
+
+  if ((preSamples < 0) || (postSamples < 1) ||
+      (preSamples + postSamples > sampleCount_)) {
+    LOGERR("%s/%s:%d: ERROR: Invalid capture window %d + %d (buffer %d) (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           preSamples,
+           postSamples,
+           sampleCount_,
+           ERROR_MULTI_RECORDER_CAPTURE_INVALID_WINDOW);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_CAPTURE_INVALID_WINDOW);
+  }
+
+  captureMode_ = true;
+  preSamples_  = preSamples;
+  postSamples_ = postSamples;
+
+  // Mirrored ring
+  if (stride_ != 2 * sampleCount_) {
+    allocateBuffers(2 * sampleCount_);
+  } else {
+    clearBuffer();
+  }
+  setAsynDataPointers(0, preSamples_ + postSamples_);
+
+  LOGINFO11("%s/%s:%d: multiRecorder[%d].capture=%d,%d;\n",
+            __FILE__,
+            __FUNCTION__,
+            __LINE__,
+            index_,
+            preSamples_,
+            postSamples_);
+  return 0;
+}
+
+int ecmcMultiRecorder::setCaptureTriggerChannel(int             channel,
+                                                triggerEdgeType edge) {
+  if ((channel < -1) || (channel >= channelCount_)) {
+    LOGERR("%s/%s:%d: ERROR: Trigger channel %d out of range (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           channel,
+           ERROR_MULTI_RECORDER_TRIGGER_CHANNEL_OUT_OF_RANGE);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_TRIGGER_CHANNEL_OUT_OF_RANGE);
+  }
+  triggerChannel_  = channel;
+  triggerEdge_     = edge;
+  triggerValueOld_ = -1;
+  return 0;
+}
+
+int ecmcMultiRecorder::triggerCapture() {
+  if (!captureMode_) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_CAPTURE_NOT_ENABLED);
+  }
+  triggerRequest_ = true;
+  return 0;
+}
+
+ecmcEventConsumer * ecmcMultiRecorder::getCaptureTrigger() {
+  if (!captureTrigger_) {
+    captureTrigger_ = new ecmcMultiRecorderTrigger(this);
+  }
+  return captureTrigger_;
+}
+
+int ecmcMultiRecorder::setDataStream(ecmcDataStream *stream) {
+  if (!stream) {
+    LOGERR("%s/%s:%d: ERROR: Data stream NULL (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_DATA_STREAM_NULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_DATA_STREAM_NULL);
+  }
+
+  if (enable_) {
+    LOGERR("%s/%s:%d: ERROR: Recorder enabled (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_MULTI_RECORDER_ENABLED);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_ENABLED);
+  }
+
+  if (stream->getChannelCount() != channelCount_) {
+    LOGERR("%s/%s:%d: ERROR: Channel count mismatch (stream %d, recorder %d) (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           stream->getChannelCount(),
+           channelCount_,
+           ERROR_DATA_STREAM_CHANNEL_COUNT_MISMATCH);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_DATA_STREAM_CHANNEL_COUNT_MISMATCH);
+  }
+
+  int errorCode = stream->linkProducer();
+
+  if (errorCode) {
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
+
+  if (!streamRow_) {
+    streamRow_ = new double[channelCountMax_];
+    memset(streamRow_, 0, sizeof(double) * channelCountMax_);
+  }
+  stream_ = stream;
+  return 0;
+}
+
+/*
+* Realtime. Edge of last written sample of trigger channel (zero/non zero).
+*/
+bool ecmcMultiRecorder::checkChannelTrigger() {
+  if ((triggerChannel_ < 0) || (triggerChannel_ >= channelCount_)) {
+    return false;
+  }
+
+  int lastIndex = (sampleIndex_ + sampleCount_ - 1) % sampleCount_;
+  int value     = data_[triggerChannel_ * stride_ + lastIndex] != 0;
+  int valueOld  = triggerValueOld_;
+
+  triggerValueOld_ = value;
+
+  if (valueOld < 0) {
+    return false;
+  }
+
+  switch (triggerEdge_) {
+  case ECMC_POSITIVE_EDGE:
+    return value > valueOld;
+
+    break;
+
+  case ECMC_NEGATIVE_EDGE:
+    return value < valueOld;
+
+    break;
+
+  case ECMC_ON_CHANGE:
+    return value != valueOld;
+
+    break;
+  }
+  return false;
+}
+
+/*
+* Realtime. Called after each sample in capture mode.
+*/
+void ecmcMultiRecorder::updateCapture() {
+  bool triggered = checkChannelTrigger();
+
+  if (triggerRequest_) {
+    triggerRequest_ = false;
+    triggered       = true;
+  }
+
+  switch (captureState_) {
+  case ECMC_MULTI_REC_CAPTURE_ARMED:
+
+    if (!triggered) {
+      break;
+    }
+    // Trigger sample is the first post trigger sample
+    captureState_ = ECMC_MULTI_REC_CAPTURE_TRIGGERED;
+    postCounter_  = 0;
+
+  // fall through
+  case ECMC_MULTI_REC_CAPTURE_TRIGGERED:
+    postCounter_++;
+
+    if (postCounter_ >= postSamples_) {
+      // Only samples recorded before the trigger (not zeros after clear)
+      capturePre_ = validSamples_ - postSamples_;
+
+      if (capturePre_ > preSamples_) {
+        capturePre_ = preSamples_;
+      }
+
+      // Freeze: window ends at last written sample (contiguous, mirrored)
+      int window = capturePre_ + postSamples_;
+      int start  = (sampleIndex_ + sampleCount_ - window) % sampleCount_;
+      setAsynDataPointers(start, window);
+      captureState_ = ECMC_MULTI_REC_CAPTURE_DONE;
+      refreshAsynArrays();
+      refreshAsyn(true);
+    }
+    break;
+  }
+}
+
+int ecmcMultiRecorder::executeEvent(int masterOK) {
+  if (!masterOK) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_MULTI_RECORDER_HARDWARE_STATUS_NOT_OK);
+  }
+
+  if (inStartupPhase_) {
+    // Auto reset hardware error
+    if (getErrorID() == ERROR_MULTI_RECORDER_HARDWARE_STATUS_NOT_OK) {
+      setErrorID(0);
+    }
+    inStartupPhase_ = 0;
+  }
+
+  if (clearRequest_) {
+    clearBuffer();
+    clearRequest_ = false;
+    refreshAsynArrays();
+    refreshAsyn(true);
+  }
+
+  if (getError() || !enable_) {
+    return getErrorID();
+  }
+
+  if (captureMode_) {
+    // Frozen until cleared
+    if (captureState_ == ECMC_MULTI_REC_CAPTURE_DONE) {
+      return 0;
+    }
+  } else if (full_ && (bufferType_ == ECMC_STORAGE_NORMAL_BUFFER)) {
+    return 0;
+  }
+
+  // Time of the frame that latched the inputs read in this cycle
+  time_[sampleIndex_] = ec_ ? (int64_t)ec_->getDcTimeNs() : 0;
+
+  double *data = &data_[sampleIndex_];
+
+  for (int i = 0; i < channelCount_; i++) {
+    int errorCode = readChannel(&channels_[i], data);
+
+    if (errorCode) {
+      return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+    }
+
+    if (captureMode_) {
+      data[sampleCount_] = *data;
+    }
+
+    if (streamRow_) {
+      streamRow_[i] = *data;
+    }
+    data += stride_;
+  }
+
+  if (stream_) {
+    stream_->appendRow(streamRow_, channelCount_);
+  }
+
+  if (captureMode_) {
+    time_[sampleIndex_ + sampleCount_] = time_[sampleIndex_];
+  }
+
+  sampleIndex_++;
+
+  if (validSamples_ < sampleCount_) {
+    validSamples_++;
+  }
+
+  if (sampleIndex_ >= sampleCount_) {
+    full_ = 1;
+
+    if (captureMode_ || (bufferType_ == ECMC_STORAGE_RING_BUFFER)) {
+      sampleIndex_ = 0;
+    }
+
+    if (!captureMode_) {
+      refreshAsynArrays();
+    }
+  }
+
+  if (captureMode_) {
+    updateCapture();
+  }
+
+  refreshAsyn(false);
+  return 0;
+}
+
+void ecmcMultiRecorder::refreshAsyn(bool force) {
+  if (asynIndex_) {
+    asynIndex_->refreshParamRT(force);
+  }
+
+  if (asynFull_) {
+    asynFull_->refreshParamRT(force);
+  }
+
+  if (asynCaptureState_) {
+    asynCaptureState_->refreshParamRT(force);
+  }
+
+  if (asynCapturePre_) {
+    asynCapturePre_->refreshParamRT(force);
+  }
+}
+
+void ecmcMultiRecorder::refreshAsynArrays() {
+  for (int i = 0; i < channelCount_; i++) {
+    if (channels_[i].asynData) {
+      channels_[i].asynData->refreshParamRT(1);
+    }
+  }
+
+  if (asynTime_) {
+    asynTime_->refreshParamRT(1);
+  }
+}
+
+ecmcMultiRecorderTrigger::ecmcMultiRecorderTrigger(ecmcMultiRecorder *recorder) {
+  recorder_ = recorder;
+}
+
+ecmcMultiRecorderTrigger::~ecmcMultiRecorderTrigger()
+{}
+
+int ecmcMultiRecorderTrigger::executeEvent(int masterOK) {
+  if (!recorder_) {
+    return ERROR_MULTI_RECORDER_NULL;
+  }
+  return recorder_->triggerCapture();
+}
@@ -0,0 +1,221 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcMultiRecorder.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCMULTIRECORDER_H_
+#define ECMCMULTIRECORDER_H_
+
+#include "stdio.h"
+
+#include "../main/ecmcDefinitions.h"
+#include "../main/ecmcError.h"
+#include "../com/ecmcAsynPortDriver.h"
+#include "../ethercat/ecmcEc.h"
+#include "../motion/ecmcAxisBase.h"
+#include "ecmcDataStorage.h"
+#include "ecmcEventConsumer.h"
+#include "ecmcDataStream.h"
+
+// Multi channel recorder
+#define ERROR_MULTI_RECORDER_NULL 0x234000
+#define ERROR_MULTI_RECORDER_INDEX_OUT_OF_RANGE 0x234001
+#define ERROR_MULTI_RECORDER_CHANNELS_FULL 0x234002
+#define ERROR_MULTI_RECORDER_DATA_ITEM_NULL 0x234003
+#define ERROR_MULTI_RECORDER_DATA_TYPE_NOT_SUPPORTED 0x234004
+#define ERROR_MULTI_RECORDER_HARDWARE_STATUS_NOT_OK 0x234005
+#define ERROR_MULTI_RECORDER_INVALID_SIZE 0x234006
+#define ERROR_MULTI_RECORDER_BUFFER_TYPE_NOT_SUPPORTED 0x234007
+#define ERROR_MULTI_RECORDER_ASYN_PARAM_REGISTER_FAIL 0x234008
+#define ERROR_MULTI_RECORDER_NO_CHANNELS 0x234009
+#define ERROR_MULTI_RECORDER_ENABLED 0x23400A
+#define ERROR_MULTI_RECORDER_CAPTURE_INVALID_WINDOW 0x23400B
+#define ERROR_MULTI_RECORDER_CAPTURE_NOT_ENABLED 0x23400C
+#define ERROR_MULTI_RECORDER_TRIGGER_CHANNEL_OUT_OF_RANGE 0x23400D
+
+enum ecmcMultiRecorderChannelType {
+  ECMC_MULTI_REC_CHANNEL_NONE      = 0,
+  // Any registered data item (EtherCAT entry, PLC variable, axis param..)
+  ECMC_MULTI_REC_CHANNEL_DATA_ITEM = 1,
+  // Field of axis status (same as ecmcDataRecorder)
+  ECMC_MULTI_REC_CHANNEL_AXIS      = 2,
+};
+
+enum ecmcMultiRecorderCaptureState {
+  ECMC_MULTI_REC_CAPTURE_OFF       = 0,
+  // Recording, waiting for trigger
+  ECMC_MULTI_REC_CAPTURE_ARMED     = 1,
+  // Recording post trigger samples
+  ECMC_MULTI_REC_CAPTURE_TRIGGERED = 2,
+  // Window frozen and published (clear to re-arm)
+  ECMC_MULTI_REC_CAPTURE_DONE      = 3,
+};
+
+typedef struct {
+  ecmcMultiRecorderChannelType type;
+  ecmcDataItemInfo            *itemInfo;
+  ecmcAxisStatusType          *axisData;
+  ecmcAxisDataType             axisDataType;
+  ecmcAsynDataItem            *asynData;
+} ecmcMultiRecorderChannel;
+
+class ecmcMultiRecorder;
+
+/**
+ * Event consumer that triggers a capture of a multi recorder (the recorder
+ * itself is the event consumer for sampling).
+ */
+class ecmcMultiRecorderTrigger : public ecmcEventConsumer {
+ public:
+  explicit ecmcMultiRecorderTrigger(ecmcMultiRecorder *recorder);
+  ~ecmcMultiRecorderTrigger();
+  int executeEvent(int masterOK);  // Override ecmcEventConsumer
+
+ private:
+  ecmcMultiRecorder *recorder_;
+};
+
+/**
+ * Records several channels at the same trigger.
+ *
+ * Data is stored as struct of arrays: one array of doubles per channel and
+ * one array with the time stamp of each sample (DC application time of the
+ * frame that latched the inputs, ns since 2000-01-01). All memory is
+ * allocated during configuration.
+ *
+ * Buffer types:
+ *  ECMC_STORAGE_NORMAL_BUFFER: Stops when full (clear to restart).
+ *  ECMC_STORAGE_RING_BUFFER:   Wraps, "index" is the next sample to write.
+ *
+ * Asyn parameters ("ecmc.mrec<index>.<param>"):
+ *  ch<channel>: Float64Array with channel data
+ *  time:        Int64Array with time stamps
+ *  index:       Next sample index
+ *  full:        Buffer full (normal) or wrapped at least once (ring)
+ *  clear:       Write to clear (handled at next trigger)
+ * The arrays are published when the buffer gets full or wraps (and when
+ * cleared), not for each sample.
+ *
+ * Capture mode (setCaptureMode()):
+ *  Records continuously in a ring buffer and freezes a window of
+ *  pre + post trigger samples when triggered (by a linked event, an edge of
+ *  a channel or triggerCapture()). The trigger sample is the first post
+ *  trigger sample. Only the window is published (oldest sample first), once
+ *  when frozen. Clear re-arms. The ring is mirrored (each sample written
+ *  twice) so the window is always contiguous and nothing needs to be copied
+ *  in the realtime thread when freezing. If triggered before preSamples
+ *  samples were recorded, only the recorded pre trigger samples are
+ *  published (shorter arrays).
+ *  Extra asyn parameters "capture.state" (ecmcMultiRecorderCaptureState)
+ *  and "capture.pre" (pre trigger samples in published window).
+ *  The buffer type is ignored in capture mode.
+ *
+ * Data stream (setDataStream()):
+ *  Each sample is also pushed as one row to a data stream (written to file
+ *  by the stream writer thread). The channel count of the stream must match.
+ */
+class ecmcMultiRecorder : public ecmcEventConsumer, public ecmcError {
+ public:
+  ecmcMultiRecorder(ecmcAsynPortDriver *asynPortDriver,
+                    ecmcEc             *ec,
+                    int                 index,
+                    int                 channelCount,
+                    int                 sampleCount,
+                    ecmcDSBufferType    bufferType);
+  ~ecmcMultiRecorder();
+  int  addDataItemChannel(ecmcDataItem *dataItem);
+  int  addAxisChannel(ecmcAxisStatusType *axisData,
+                      ecmcAxisDataType    dataType);
+  int  setEnable(int enable);
+  int  getEnabled(int *enabled);
+  int  clear();
+  int  validate();
+  int  executeEvent(int masterOK);  // Override ecmcEventConsumer
+  int  getChannelCount();
+  // Pre + post must fit in the buffer, post includes the trigger sample
+  int  setCaptureMode(int preSamples,
+                      int postSamples);
+  // Trigger on edge of channel value (zero / non zero), -1 to disable
+  int  setCaptureTriggerChannel(int             channel,
+                                triggerEdgeType edge);
+  // Trigger at next sample (any context)
+  int  triggerCapture();
+  ecmcEventConsumer* getCaptureTrigger();
+  int  setDataStream(ecmcDataStream *stream);
+  void printCurrentState();
+
+ private:
+  void              initVars();
+  int               initAsyn();
+  ecmcAsynDataItem* addAsynParam(const char    *name,
+                                 asynParamType  asynType,
+                                 uint8_t       *data,
+                                 size_t         bytes,
+                                 ecmcEcDataType dt);
+  int               addChannel(ecmcMultiRecorderChannel *channel);
+  int               readChannel(ecmcMultiRecorderChannel *channel,
+                                double                   *data);
+  int               allocateBuffers(int stride);
+  void              setAsynDataPointers(int start,
+                                        int samples);
+  bool              checkChannelTrigger();
+  void              updateCapture();
+  void              clearBuffer();
+  void              refreshAsyn(bool force);
+  void              refreshAsynArrays();
+  static asynStatus asynClear(void         *data,
+                              size_t        bytes,
+                              asynParamType asynParType,
+                              void         *userObj);
+  ecmcAsynPortDriver *asynPortDriver_;
+  ecmcEc             *ec_;
+  int index_;
+  int enable_;
+  int inStartupPhase_;
+  ecmcDSBufferType bufferType_;
+  int channelCountMax_;
+  int channelCount_;
+  int sampleCount_;
+  // Distance between channels (2 * sampleCount_ if mirrored)
+  int stride_;
+  ecmcMultiRecorderChannel *channels_;
+  // channelCountMax_ * stride_ (channel by channel)
+  double   *data_;
+  int64_t  *time_;
+  int32_t   sampleIndex_;
+  bool      captureMode_;
+  int       preSamples_;
+  int       postSamples_;
+  int       postCounter_;
+  // Samples recorded since clear (max sampleCount_)
+  int       validSamples_;
+  int32_t   captureState_;
+  // Pre trigger samples in published window
+  int32_t   capturePre_;
+  int       triggerChannel_;
+  triggerEdgeType triggerEdge_;
+  // -1 until first sample
+  int       triggerValueOld_;
+  volatile bool triggerRequest_;
+  ecmcMultiRecorderTrigger *captureTrigger_;
+  int32_t   full_;
+  int32_t   clearCmd_;
+  volatile bool clearRequest_;
+  ecmcAsynDataItem *asynTime_;
+  ecmcAsynDataItem *asynIndex_;
+  ecmcAsynDataItem *asynFull_;
+  ecmcAsynDataItem *asynClear_;
+  ecmcAsynDataItem *asynCaptureState_;
+  ecmcAsynDataItem *asynCapturePre_;
+  ecmcDataStream   *stream_;
+  // One sample of all channels (for stream)
+  double           *streamRow_;
+};
+
+#endif  /* ECMCMULTIRECORDER_H_ */
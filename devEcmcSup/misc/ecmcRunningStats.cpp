@@ -0,0 +1,192 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcRunningStats.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcRunningStats.h"
+#include <math.h>
+#include <stddef.h>
+
+ecmcRunningStats::ecmcRunningStats(int windowSize) {
+  windowSize_ = windowSize > 0 ? windowSize : 1;
+
+  // A deque never holds more values than the window
+  minDeque_.entries = new ecmcRunningStatsEntry[windowSize_];
+  maxDeque_.entries = new ecmcRunningStatsEntry[windowSize_];
+  clear();
+}
+
+ecmcRunningStats::~ecmcRunningStats() {
+  delete[] minDeque_.entries;
+  delete[] maxDeque_.entries;
+}
+
+void ecmcRunningStats::clear() {
+  count_          = 0;
+  clearSums(&sums_);
+  clearSums(&shadowSums_);
+  firstSeq_       = 0;
+  nextSeq_        = 0;
+  minDeque_.head  = 0;
+  minDeque_.count = 0;
+  maxDeque_.head  = 0;
+  maxDeque_.count = 0;
+}
+
+void ecmcRunningStats::clearSums(ecmcRunningStatsSums *sums) {
+  sums->shift     = 0;
+  sums->sum       = 0;
+  sums->sumComp   = 0;
+  sums->sumSq     = 0;
+  sums->sumSqComp = 0;
+  sums->count     = 0;
+}
+
+static void compensatedAdd(double *sum, double *comp, double value) {
+  double t = *sum + value;
+
+  if (fabs(*sum) >= fabs(value)) {
+    *comp += (*sum - t) + value;
+  } else {
+    *comp += (value - t) + *sum;
+  }
+  *sum = t;
+}
+
+/*
+* Add (sign 1) or remove (sign -1) value. The first value of empty sums is
+* used as shift.
+*/
+void ecmcRunningStats::addSums(ecmcRunningStatsSums *sums,
+                               double                value,
+                               int                   sign) {
+  if (sums->count == 0) {
+    clearSums(sums);
+    sums->shift = value;
+  }
+
+  double delta = value - sums->shift;
+
+  compensatedAdd(&sums->sum, &sums->sumComp, sign * delta);
+  compensatedAdd(&sums->sumSq, &sums->sumSqComp, sign * delta * delta);
+  sums->count += sign;
+}
+
+/*
+* Remove values from back that can never be min (max) again.
+*/
+void ecmcRunningStats::push(ecmcRunningStatsDeque *deque,
+                            double                 value,
+                            bool                   keepMin) {
+  while (deque->count > 0) {
+    int back = (deque->head + deque->count - 1) % windowSize_;
+    double backValue = deque->entries[back].value;
+
+    if ((keepMin && backValue < value) || (!keepMin && backValue > value)) {
+      break;
+    }
+    deque->count--;
+  }
+
+  int pos = (deque->head + deque->count) % windowSize_;
+  deque->entries[pos].seq   = nextSeq_;
+  deque->entries[pos].value = value;
+  deque->count++;
+}
+
+/*
+* Drop front if it is the value leaving the window.
+*/
+void ecmcRunningStats::popOldest(ecmcRunningStatsDeque *deque) {
+  if ((deque->count > 0) && (deque->entries[deque->head].seq == firstSeq_)) {
+    deque->head = (deque->head + 1) % windowSize_;
+    deque->count--;
+  }
+}
+
+double ecmcRunningStats::front(ecmcRunningStatsDeque *deque) {
+  if (deque->count == 0) {
+    return 0;
+  }
+  return deque->entries[deque->head].value;
+}
+
+void ecmcRunningStats::add(double value) {
+  // Window full (remove() must be called first)
+  if (count_ >= windowSize_) {
+    return;
+  }
+
+  count_++;
+  addSums(&sums_, value, 1);
+  addSums(&shadowSums_, value, 1);
+
+  // Shadow holds the whole window (newest values only)
+  if (shadowSums_.count >= windowSize_) {
+    if (shadowSums_.count == count_) {
+      sums_ = shadowSums_;
+    }
+    clearSums(&shadowSums_);
+  }
+
+  push(&minDeque_, value, true);
+  push(&maxDeque_, value, false);
+  nextSeq_++;
+}
+
+void ecmcRunningStats::remove(double value) {
+  if (count_ == 0) {
+    return;
+  }
+
+  popOldest(&minDeque_);
+  popOldest(&maxDeque_);
+  firstSeq_++;
+
+  count_--;
+
+  if (count_ == 0) {
+    clearSums(&sums_);
+    return;
+  }
+  addSums(&sums_, value, -1);
+}
+
+int ecmcRunningStats::getCount() {
+  return count_;
+}
+
+double ecmcRunningStats::getAvg() {
+  if (count_ == 0) {
+    return 0;
+  }
+  return sums_.shift + (sums_.sum + sums_.sumComp) / count_;
+}
+
+/*
+* Population standard deviation.
+*/
+double ecmcRunningStats::getStd() {
+  if (count_ == 0) {
+    return 0;
+  }
+
+  double mean     = (sums_.sum + sums_.sumComp) / count_;
+  double variance = (sums_.sumSq + sums_.sumSqComp) / count_ - mean * mean;
+
+  return variance > 0 ? sqrt(variance) : 0;  // Rounding
+}
+
+double ecmcRunningStats::getMin() {
+  return front(&minDeque_);
+}
+
+double ecmcRunningStats::getMax() {
+  return front(&maxDeque_);
+}
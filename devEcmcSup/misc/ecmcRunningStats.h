@@ -0,0 +1,88 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcRunningStats.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMC_RUNNING_STATS_H_
+#define ECMC_RUNNING_STATS_H_
+
+#include <stdint.h>
+
+typedef struct {
+  uint64_t seq;
+  double   value;
+} ecmcRunningStatsEntry;
+
+// Compensated (Neumaier) sums of values relative to a shift value
+typedef struct {
+  double shift;
+  double sum;
+  double sumComp;
+  double sumSq;
+  double sumSqComp;
+  int    count;
+} ecmcRunningStatsSums;
+
+// Ring of entries with monotonic values (front is min or max of window)
+typedef struct {
+  ecmcRunningStatsEntry *entries;
+  int                    head;
+  int                    count;
+} ecmcRunningStatsDeque;
+
+/**
+ * Statistics of a sliding window of values (at most windowSize values).
+ *
+ * Values enter the window with add() and the oldest value leaves with
+ * remove(). Mean and variance are calculated from compensated sums of the
+ * values (shifted by a value of the window to avoid cancellation) and
+ * min/max from monotonic deques, so all operations are O(1) (amortized for
+ * add()). The caller must pass the oldest value to remove().
+ *
+ * The rounding errors of remove() would accumulate over time. A shadow sum
+ * of only the newest values (no removals) is therefore kept in parallel and
+ * replaces the sums each time it holds a full window, so the error is
+ * bounded without recalculation from the buffer.
+ */
+class ecmcRunningStats {
+ public:
+  explicit ecmcRunningStats(int windowSize);
+  ~ecmcRunningStats();
+  void   clear();
+  void   add(double value);
+  void   remove(double value);
+  int    getCount();
+  double getAvg();
+  double getStd();
+  double getMin();
+  double getMax();
+
+ private:
+  static void clearSums(ecmcRunningStatsSums *sums);
+  static void addSums(ecmcRunningStatsSums *sums,
+                      double                value,
+                      int                   sign);
+  void   push(ecmcRunningStatsDeque *deque,
+              double                 value,
+              bool                   keepMin);
+  void   popOldest(ecmcRunningStatsDeque *deque);
+  double front(ecmcRunningStatsDeque *deque);
+
+  int                   windowSize_;
+  int                   count_;
+  ecmcRunningStatsSums  sums_;
+  ecmcRunningStatsSums  shadowSums_;  // Newest values since last swap
+  // Sequence number of oldest value in window and of next value
+  uint64_t              firstSeq_;
+  uint64_t              nextSeq_;
+  ecmcRunningStatsDeque minDeque_;
+  ecmcRunningStatsDeque maxDeque_;
+};
+
+#endif  /* ECMC_RUNNING_STATS_H_ */
@@ -16,6 +16,7 @@
 #include <string>
 #include <new>
 #include <iostream>
+#include <epicsThread.h>
 #include "ecmcMotion.h"
 #include "../main/ecmcErrorsList.h"
 
@@ -33,6 +34,58 @@ asynStatus asynWriteCmd(void* data, size_t bytes, asynParamType asynParType,void
   return ((ecmcAxisBase*)userObj)->axisAsynWriteCmd(data, bytes, asynParType);
 }
 
+/**
+ * Motion queue of sequencer: add items (ECMC_ASYN_AX_QUEUE_ITEM_VALUES
+ * values per item), enable and clear.
+ * */
+asynStatus asynWriteQueueAdd(void* data, size_t bytes, asynParamType asynParType,void *userObj) {
+  if (!userObj) {
+    return asynError;
+  }
+  return ((ecmcAxisBase*)userObj)->axisAsynWriteQueueAdd(data, bytes, asynParType);
+}
+
+/**
+ * PVT table: add points (ECMC_AXIS_PVT_POINT_VALUES values per point) and
+ * start (1) / stop (0).
+ * */
+asynStatus asynWritePvtAdd(void* data, size_t bytes, asynParamType asynParType,void *userObj) {
+  if (!userObj) {
+    return asynError;
+  }
+  return ((ecmcAxisBase*)userObj)->axisAsynWritePvtAdd(data, bytes, asynParType);
+}
+
+asynStatus asynWritePvtStart(void* data, size_t bytes, asynParamType asynParType,void *userObj) {
+  if (!userObj || (asynParType != asynParamInt32) || (bytes != sizeof(int32_t))) {
+    return asynError;
+  }
+  if (*(int32_t*)data) {
+    ((ecmcAxisBase*)userObj)->getPvt()->start();
+  } else {
+    ((ecmcAxisBase*)userObj)->getPvt()->stop();
+  }
+  return asynSuccess;
+}
+
+asynStatus asynWriteQueueEnable(void* data, size_t bytes, asynParamType asynParType,void *userObj) {
+  if (!userObj || (asynParType != asynParamInt32) || (bytes != sizeof(int32_t))) {
+    return asynError;
+  }
+  ((ecmcAxisBase*)userObj)->getSeq()->setMotionQueueEnable(*(int32_t*)data != 0);
+  return asynSuccess;
+}
+
+asynStatus asynWriteQueueClear(void* data, size_t bytes, asynParamType asynParType,void *userObj) {
+  if (!userObj || (asynParType != asynParamInt32) || (bytes != sizeof(int32_t))) {
+    return asynError;
+  }
+  if (*(int32_t*)data) {
+    ((ecmcAxisBase*)userObj)->getSeq()->clearMotionQueue();
+  }
+  return asynSuccess;
+}
+
 ecmcAxisBase::ecmcAxisBase(ecmcAsynPortDriver *asynPortDriver,
                            int axisID, 
                            double sampleTime) {
@@ -48,6 +101,8 @@ ecmcAxisBase::ecmcAxisBase(ecmcAsynPortDriver *asynPortDriver,
     traj_ = new ecmcTrajectoryTrapetz(&data_,
                                     data_.sampleTime_);
     mon_ = new ecmcMonitor(&data_);
+    cam_ = new ecmcAxisCam(data_.sampleTime_);
+    pvt_ = new ecmcAxisPvt(this, data_.sampleTime_);
 
     extTrajVeloFilter_ = new ecmcFilter(data_.sampleTime_);    
     extEncVeloFilter_ = new ecmcFilter(data_.sampleTime_);    
@@ -68,6 +123,8 @@ ecmcAxisBase::ecmcAxisBase(ecmcAsynPortDriver *asynPortDriver,
   seq_.setMon(mon_);
   seq_.setEnc(enc_);
 
+  cmdProducerLock_ = epicsMutexMustCreate();
+
   initAsyn();
 }
 
@@ -78,10 +135,18 @@ ecmcAxisBase::~ecmcAxisBase() {
   traj_ = NULL;
   delete mon_;
   mon_ = NULL;
+  delete cam_;
+  cam_ = NULL;
+  delete pvt_;
+  pvt_ = NULL;
   delete extTrajVeloFilter_;
   extTrajVeloFilter_ = NULL;
   delete extEncVeloFilter_;
   extEncVeloFilter_ = NULL;
+  if (cmdProducerLock_) {
+    epicsMutexDestroy(cmdProducerLock_);
+  }
+  cmdProducerLock_ = NULL;
 //  free(plcExpr_);
 }
 
@@ -120,14 +185,32 @@ void ecmcAxisBase::initVars() {
   statusOutputEntry_          = 0;
   blockExtCom_                = 0;
   memset(diagBuffer_,0,AX_MAX_DIAG_STRING_CHAR_LENGTH);
+  memset(queueAddBuffer_,0,sizeof(queueAddBuffer_));
+  queueCount_                 = 0;
+  queueEnable_                = 0;
+  queueClear_                 = 0;
+  groupActive_                = false;
+  groupPosSet_                = 0;
+  groupVelSet_                = 0;
+  cam_                        = NULL;
+  pvt_                        = NULL;
+  memset(pvtAddBuffer_,0,sizeof(pvtAddBuffer_));
+  pvtFree_                    = 0;
+  pvtStart_                   = 0;
   extTrajVeloFilter_ = NULL;
   extEncVeloFilter_ = NULL;
   enableExtTrajVeloFilter_ = false;
   enableExtEncVeloFilter_ = false;
   disableAxisAtErrorReset_ = false;
+  cmdProducerLock_ = NULL;
+  cmdDoneCounter_  = 0;
+  memset(cmdResults_, 0, sizeof(cmdResults_));
+  memset(cmdStates_, 0, sizeof(cmdStates_));
 }
 
 void ecmcAxisBase::preExecute(bool masterOK) {
+  // Commands from non realtime
+  exeCmdQueue();
 
   data_.interlocks_.etherCatMasterInterlock = !masterOK;
   data_.refreshInterlocks();
@@ -206,6 +289,19 @@ void ecmcAxisBase::preExecute(bool masterOK) {
   }
   mon_->readEntries();
 
+  // Electronic gear/cam (replaces a PLC writing the external setpoint)
+  if (cam_->getConfigured()) {
+    cam_->execute();
+
+    if (cam_->getEnable() &&
+        (data_.command_.trajSource != ECMC_DATA_SOURCE_INTERNAL)) {
+      data_.status_.externalTrajectoryPosition = cam_->getSlavePos();
+    }
+  }
+
+  // PVT table (setpoints to axis like an axis group)
+  pvt_->execute();
+
   // Filter velocities from PLC source
   // Traj
   if(enableExtTrajVeloFilter_ && extTrajVeloFilter_) {
@@ -254,6 +350,14 @@ void ecmcAxisBase::postExecute(bool masterOK) {
   axAsynParams_[ECMC_ASYN_AX_POS_ERR_ID]->refreshParamRT(0);
   axAsynParams_[ECMC_ASYN_AX_STATUS_ID]->refreshParamRT(0);
   axAsynParams_[ECMC_ASYN_AX_STATUS_BIN_ID]->refreshParamRT(0);
+  queueCount_  = seq_.getMotionQueueCount();
+  queueEnable_ = seq_.getMotionQueueEnable();
+  axAsynParams_[ECMC_ASYN_AX_QUEUE_COUNT_ID]->refreshParamRT(0);
+  axAsynParams_[ECMC_ASYN_AX_QUEUE_ENABLE_ID]->refreshParamRT(0);
+  pvtFree_  = pvt_->getFree();
+  pvtStart_ = pvt_->getActive();
+  axAsynParams_[ECMC_ASYN_AX_PVT_FREE_ID]->refreshParamRT(0);
+  axAsynParams_[ECMC_ASYN_AX_PVT_START_ID]->refreshParamRT(0);
   
   if(axAsynParams_[ECMC_ASYN_AX_DIAG_ID]->willRefreshNext() && axAsynParams_[ECMC_ASYN_AX_DIAG_ID]->linkedToAsynClient() ) {    
     int  bytesUsed = 0;
@@ -477,6 +581,20 @@ int ecmcAxisBase::getErrorID() {
     }
   }
 
+  // Electronic gear/cam
+  if (cam_) {
+    if (cam_->getError()) {
+      return setErrorID(__FILE__, __FUNCTION__, __LINE__, cam_->getErrorID());
+    }
+  }
+
+  // PVT table
+  if (pvt_) {
+    if (pvt_->getError()) {
+      return setErrorID(__FILE__, __FUNCTION__, __LINE__, pvt_->getErrorID());
+    }
+  }
+
   return ecmcError::getErrorID();
 }
 
@@ -548,10 +666,25 @@ void ecmcAxisBase::errorReset() {
     seq->errorReset();
   }
 
+  // Electronic gear/cam
+  if (cam_) {
+    cam_->errorReset();
+  }
+
+  // PVT table
+  if (pvt_) {
+    pvt_->errorReset();
+  }
+
   ecmcError::errorReset();
 }
 
 int ecmcAxisBase::validateBase() {
+  int errorCode = cam_->validate();
+
+  if (errorCode) {
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
   return 0;
 }
 
@@ -591,6 +724,14 @@ ecmcAxisSequencer * ecmcAxisBase::getSeq() {
   return &seq_;
 }
 
+ecmcAxisCam * ecmcAxisBase::getCam() {
+  return cam_;
+}
+
+ecmcAxisPvt * ecmcAxisBase::getPvt() {
+  return pvt_;
+}
+
 int ecmcAxisBase::getAxisHomed(bool *homed) {
   *homed = enc_->getHomed();
   return 0;
@@ -716,6 +857,18 @@ int ecmcAxisBase::setExecute(bool execute) {
       return setErrorID(__FILE__, __FUNCTION__, __LINE__, ERROR_AXIS_BUSY);
     }
 
+    // Not an error of the axis (would stop the group or PVT table)
+    if (execute && !seq_.getExecute() && groupActive_) {
+      LOGERR(
+        "%s/%s:%d: ERROR (axis %d): Axis controlled by an axis group or PVT table (0x%x).\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        data_.axisId_,
+        ERROR_AXIS_GROUP_CONTROLLED);
+      return ERROR_AXIS_GROUP_CONTROLLED;
+    }
+
     int error = seq_.setExecute(execute);
 
     if (error) {
@@ -882,6 +1035,109 @@ int ecmcAxisBase::initAsyn() {
   paramTemp->refreshParam(1);
   axAsynParams_[ECMC_ASYN_AX_CONTROL_BIN_ID] = paramTemp;
 
+  // Motion queue: add items
+  errorCode = createAsynParam(ECMC_AX_STR "%d." ECMC_ASYN_AX_QUEUE_ADD_NAME,
+                              asynParamFloat64Array,
+                              ECMC_EC_F64,
+                              (uint8_t*)queueAddBuffer_,
+                              sizeof(queueAddBuffer_),
+                              &paramTemp);
+  if(errorCode) {
+    return errorCode;
+  }
+  paramTemp->setAllowWriteToEcmc(true);
+  paramTemp->setExeCmdFunctPtr(asynWriteQueueAdd,this);
+  paramTemp->refreshParam(1);
+  axAsynParams_[ECMC_ASYN_AX_QUEUE_ADD_ID] = paramTemp;
+
+  // Motion queue: items not yet started
+  errorCode = createAsynParam(ECMC_AX_STR "%d." ECMC_ASYN_AX_QUEUE_COUNT_NAME,
+                              asynParamInt32,
+                              ECMC_EC_S32,
+                              (uint8_t*)&queueCount_,
+                              sizeof(queueCount_),
+                              &paramTemp);
+  if(errorCode) {
+    return errorCode;
+  }
+  paramTemp->setAllowWriteToEcmc(false);
+  paramTemp->refreshParam(1);
+  axAsynParams_[ECMC_ASYN_AX_QUEUE_COUNT_ID] = paramTemp;
+
+  // Motion queue: enable
+  errorCode = createAsynParam(ECMC_AX_STR "%d." ECMC_ASYN_AX_QUEUE_ENABLE_NAME,
+                              asynParamInt32,
+                              ECMC_EC_S32,
+                              (uint8_t*)&queueEnable_,
+                              sizeof(queueEnable_),
+                              &paramTemp);
+  if(errorCode) {
+    return errorCode;
+  }
+  paramTemp->setAllowWriteToEcmc(true);
+  paramTemp->setExeCmdFunctPtr(asynWriteQueueEnable,this);
+  paramTemp->refreshParam(1);
+  axAsynParams_[ECMC_ASYN_AX_QUEUE_ENABLE_ID] = paramTemp;
+
+  // Motion queue: clear (and stop)
+  errorCode = createAsynParam(ECMC_AX_STR "%d." ECMC_ASYN_AX_QUEUE_CLEAR_NAME,
+                              asynParamInt32,
+                              ECMC_EC_S32,
+                              (uint8_t*)&queueClear_,
+                              sizeof(queueClear_),
+                              &paramTemp);
+  if(errorCode) {
+    return errorCode;
+  }
+  paramTemp->setAllowWriteToEcmc(true);
+  paramTemp->setExeCmdFunctPtr(asynWriteQueueClear,this);
+  paramTemp->refreshParam(1);
+  axAsynParams_[ECMC_ASYN_AX_QUEUE_CLEAR_ID] = paramTemp;
+
+  // PVT table: add points
+  errorCode = createAsynParam(ECMC_AX_STR "%d." ECMC_ASYN_AX_PVT_ADD_NAME,
+                              asynParamFloat64Array,
+                              ECMC_EC_F64,
+                              (uint8_t*)pvtAddBuffer_,
+                              sizeof(pvtAddBuffer_),
+                              &paramTemp);
+  if(errorCode) {
+    return errorCode;
+  }
+  paramTemp->setAllowWriteToEcmc(true);
+  paramTemp->setExeCmdFunctPtr(asynWritePvtAdd,this);
+  paramTemp->refreshParam(1);
+  axAsynParams_[ECMC_ASYN_AX_PVT_ADD_ID] = paramTemp;
+
+  // PVT table: free points in buffer (refill)
+  errorCode = createAsynParam(ECMC_AX_STR "%d." ECMC_ASYN_AX_PVT_FREE_NAME,
+                              asynParamInt32,
+                              ECMC_EC_S32,
+                              (uint8_t*)&pvtFree_,
+                              sizeof(pvtFree_),
+                              &paramTemp);
+  if(errorCode) {
+    return errorCode;
+  }
+  paramTemp->setAllowWriteToEcmc(false);
+  paramTemp->refreshParam(1);
+  axAsynParams_[ECMC_ASYN_AX_PVT_FREE_ID] = paramTemp;
+
+  // PVT table: start/stop (readback active)
+  errorCode = createAsynParam(ECMC_AX_STR "%d." ECMC_ASYN_AX_PVT_START_NAME,
+                              asynParamInt32,
+                              ECMC_EC_S32,
+                              (uint8_t*)&pvtStart_,
+                              sizeof(pvtStart_),
+                              &paramTemp);
+  if(errorCode) {
+    return errorCode;
+  }
+  paramTemp->setAllowWriteToEcmc(true);
+  paramTemp->setExeCmdFunctPtr(asynWritePvtStart,this);
+  paramTemp->refreshParam(1);
+  axAsynParams_[ECMC_ASYN_AX_PVT_START_ID] = paramTemp;
+
   asynPortDriver_->callParamCallbacks(ECMC_ASYN_DEFAULT_LIST, ECMC_ASYN_DEFAULT_ADDR);
   return 0;
 }
@@ -1165,6 +1421,8 @@ void ecmcAxisBase::refreshDebugInfoStruct() {
     velocityDiffTrajInterlock
     || data_.interlocks_.
     velocityDiffDriveInterlock;
+
+  statusSnapshot_.publish(&statusData_);
 }
 
 int ecmcAxisBase::setEnable(bool enable) {
@@ -1466,7 +1724,8 @@ int ecmcAxisBase::moveVelocity(
   }
 
   // check if already moveVelo then just update vel and acc
-  if(getExecute() && getCommand() == ECMC_CMD_MOVEVEL && getBusy()) {
+  if(getExecute() && getCommand() == ECMC_CMD_MOVEVEL && getBusy() &&
+     !groupActive_) {
     getSeq()->setTargetVel(velocitySet);
     getTraj()->setAcc(accelerationSet);
     getTraj()->setDec(decelerationSet);
@@ -1606,7 +1865,6 @@ int ecmcAxisBase::stopMotion(int killAmplifier) {
 */
 asynStatus ecmcAxisBase::axisAsynWriteCmd(void* data, size_t bytes, asynParamType asynParType) 
 {
-  asynStatus returnVal = asynSuccess;
   if(sizeof(controlWord_) != bytes) {
     LOGERR(
         "%s/%s:%d: ERROR (axis %d): Control word size missmatch.\n",
@@ -1618,7 +1876,89 @@ asynStatus ecmcAxisBase::axisAsynWriteCmd(void* data, size_t bytes, asynParamTyp
     return asynError;
   }
 
-  memcpy(&controlWord_,data,sizeof(controlWord_));
+  // Applied by the thread executing the axis.
+  // Do not wait for result since called with asyn port locked.
+  ecmcAxisCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = ECMC_AXIS_CMD_CONTROL_WORD;
+  memcpy(&cmd.controlWord, data, sizeof(cmd.controlWord));
+
+  return queueCmd(&cmd, false) == 0 ? asynSuccess : asynError;
+}
+
+/**
+ * Add items to the motion queue of the sequencer. Each item is
+ * ECMC_ASYN_AX_QUEUE_ITEM_VALUES values: position, velocity, acceleration,
+ * deceleration and blend. Items are added until the first failure.
+*/
+asynStatus ecmcAxisBase::axisAsynWriteQueueAdd(void* data, size_t bytes, asynParamType asynParType)
+{
+  size_t itemBytes = sizeof(double) * ECMC_ASYN_AX_QUEUE_ITEM_VALUES;
+
+  if(asynParType != asynParamFloat64Array || bytes % itemBytes != 0) {
+    LOGERR(
+        "%s/%s:%d: ERROR (axis %d): Motion queue items must be %d values each.\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        data_.axisId_,
+        ECMC_ASYN_AX_QUEUE_ITEM_VALUES);
+
+    return asynError;
+  }
+
+  double *values = (double*)data;
+
+  for (size_t i = 0; i < bytes / itemBytes; i++) {
+    ecmcMotionQueueItem item;
+    item.position     = values[0];
+    item.velocity     = values[1];
+    item.acceleration = values[2];
+    item.deceleration = values[3];
+    item.blend        = values[4] != 0;
+
+    if (seq_.addMotionQueueItem(&item)) {
+      return asynError;
+    }
+    memcpy(queueAddBuffer_, values, itemBytes);
+    values += ECMC_ASYN_AX_QUEUE_ITEM_VALUES;
+  }
+
+  return asynSuccess;
+}
+
+/**
+ * Add points to the PVT table. Each point is ECMC_AXIS_PVT_POINT_VALUES
+ * values: position, velocity and time (duration of segment).
+*/
+asynStatus ecmcAxisBase::axisAsynWritePvtAdd(void* data, size_t bytes, asynParamType asynParType)
+{
+  size_t pointBytes = sizeof(double) * ECMC_AXIS_PVT_POINT_VALUES;
+
+  if(asynParType != asynParamFloat64Array || bytes == 0 ||
+     bytes % pointBytes != 0) {
+    LOGERR(
+        "%s/%s:%d: ERROR (axis %d): PVT points must be %d values each.\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        data_.axisId_,
+        ECMC_AXIS_PVT_POINT_VALUES);
+
+    return asynError;
+  }
+
+  if (pvt_->addPoints((double*)data, bytes / pointBytes)) {
+    return asynError;
+  }
+  memcpy(pvtAddBuffer_, (uint8_t*)data + bytes - pointBytes, pointBytes);
+  return asynSuccess;
+}
+
+int ecmcAxisBase::writeControlWord(ecmcAsynAxisControlType *controlWord) {
+  int returnVal = 0;
+
+  memcpy(&controlWord_, controlWord, sizeof(controlWord_));
 
   int errorCode=0;
 //  printf("###############################\n");
@@ -1632,44 +1972,44 @@ asynStatus ecmcAxisBase::axisAsynWriteCmd(void* data, size_t bytes, asynParamTyp
  
   errorCode = setEnable(controlWord_.enableCmd);
   if(errorCode) {
-    returnVal = asynError;
+    returnVal = errorCode;
   }
 
   errorCode = setExecute(controlWord_.executeCmd);
   if(errorCode) {
-    returnVal = asynError;
+    returnVal = errorCode;
   }
 
   setReset(controlWord_.resetCmd);
   
   errorCode = setEncDataSourceType((controlWord_.encSourceCmd ? ECMC_DATA_SOURCE_EXTERNAL:ECMC_DATA_SOURCE_INTERNAL));
   if(errorCode) {
-    returnVal = asynError;
+    returnVal = errorCode;
   }
 
   errorCode = setTrajDataSourceType((controlWord_.trajSourceCmd ? ECMC_DATA_SOURCE_EXTERNAL:ECMC_DATA_SOURCE_INTERNAL));
   if(errorCode) {
-    returnVal = asynError;
+    returnVal = errorCode;
   }
 
   errorCode = setAllowCmdFromPLC(controlWord_.plcCmdsAllowCmd);
   if(errorCode) {
-    returnVal = asynError;
+    returnVal = errorCode;
   }
 
   errorCode = setAxisPLCEnable(data_.axisId_, controlWord_.plcEnableCmd);
   if(errorCode) {
-    returnVal = asynError;
+    returnVal = errorCode;
   }
 
   errorCode =  getMon()->setEnableSoftLimitBwd(controlWord_.enableSoftLimitBwd);
   if(errorCode) {
-    returnVal = asynError;
+    returnVal = errorCode;
   }
 
   errorCode =  getMon()->setEnableSoftLimitFwd(controlWord_.enableSoftLimitFwd);
   if(errorCode) {
-    returnVal = asynError;
+    returnVal = errorCode;
   }
 
   refreshStatusWd();
@@ -1728,3 +2068,246 @@ int ecmcAxisBase::getAllowHome(){
   }
   return -ERROR_AXIS_SEQ_OBJECT_NULL;
 }
+
+/**
+ * Queue a command to be executed by the thread executing the axis (ecmc_rt
+ * or a rt task group). The realtime thread never waits for a non realtime
+ * thread, only non realtime threads wait here (if waitForResult).
+ * If realtime is not started the command is executed directly.
+ * Returns the error code of the executed command (if waitForResult).
+ * A command that has not started to execute within ECMC_AXIS_CMD_TIMEOUT_S
+ * is cancelled (never executed) and ERROR_AXIS_CMD_QUEUE_TIMEOUT returned.
+ */
+int ecmcAxisBase::queueCmd(ecmcAxisCmd *cmd, bool waitForResult) {
+  if (cmd == NULL) {
+    return ERROR_AXIS_DATA_POINTER_NULL;
+  }
+
+  // Serialize non realtime producers (asyn, motor record)
+  epicsMutexLock(cmdProducerLock_);
+
+  if (!data_.status_.inRealtime) {
+    int errorCode = exeCmd(cmd);
+    epicsMutexUnlock(cmdProducerLock_);
+    return errorCode;
+  }
+
+  size_t seq  = cmdQueue_.getPushCount();
+  int    slot = seq & (ECMC_AXIS_CMD_QUEUE_SIZE - 1);
+
+  // Full (slot not yet popped)
+  if (seq - cmdQueue_.getPopCount() >= ECMC_AXIS_CMD_QUEUE_SIZE) {
+    epicsMutexUnlock(cmdProducerLock_);
+    LOGERR(
+      "%s/%s:%d: ERROR (axis %d): Command queue full (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      data_.axisId_,
+      ERROR_AXIS_CMD_QUEUE_FULL);
+    return ERROR_AXIS_CMD_QUEUE_FULL;
+  }
+
+  epicsAtomicSetIntT(&cmdStates_[slot], ECMC_AXIS_CMD_STATE_QUEUED);
+  // Single producer, so there is room
+  cmdQueue_.push(cmd);
+
+  if (!waitForResult) {
+    epicsMutexUnlock(cmdProducerLock_);
+    return 0;
+  }
+
+  double waitTime = 0;
+
+  while (epicsAtomicGetSizeT(&cmdDoneCounter_) <= seq) {
+    if (waitTime >= ECMC_AXIS_CMD_TIMEOUT_S || !data_.status_.inRealtime) {
+      // Cancel, unless already started (then done within this cycle)
+      if (epicsAtomicCmpAndSwapIntT(&cmdStates_[slot],
+                                    ECMC_AXIS_CMD_STATE_QUEUED,
+                                    ECMC_AXIS_CMD_STATE_CANCELLED) ==
+          ECMC_AXIS_CMD_STATE_QUEUED) {
+        epicsMutexUnlock(cmdProducerLock_);
+        LOGERR(
+          "%s/%s:%d: ERROR (axis %d): Timeout waiting for command %d, command cancelled (0x%x).\n",
+          __FILE__,
+          __FUNCTION__,
+          __LINE__,
+          data_.axisId_,
+          cmd->type,
+          ERROR_AXIS_CMD_QUEUE_TIMEOUT);
+        return ERROR_AXIS_CMD_QUEUE_TIMEOUT;
+      }
+    }
+    epicsThreadSleep(data_.sampleTime_);
+    waitTime += data_.sampleTime_;
+  }
+  epicsAtomicReadMemoryBarrier();
+
+  // Slot can not be reused before next push (producer lock)
+  int errorCode = cmdResults_[slot];
+  epicsMutexUnlock(cmdProducerLock_);
+  return errorCode;
+}
+
+// Realtime: execute all queued commands (cancelled commands are dropped)
+void ecmcAxisBase::exeCmdQueue() {
+  ecmcAxisCmd cmd;
+
+  while (cmdQueue_.pop(&cmd)) {
+    size_t seq  = cmdDoneCounter_;
+    int    slot = seq & (ECMC_AXIS_CMD_QUEUE_SIZE - 1);
+
+    if (epicsAtomicCmpAndSwapIntT(&cmdStates_[slot],
+                                  ECMC_AXIS_CMD_STATE_QUEUED,
+                                  ECMC_AXIS_CMD_STATE_EXECUTING) ==
+        ECMC_AXIS_CMD_STATE_QUEUED) {
+      cmdResults_[slot] = exeCmd(&cmd);
+    } else {
+      cmdResults_[slot] = ERROR_AXIS_CMD_QUEUE_TIMEOUT;
+    }
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&cmdDoneCounter_, seq + 1);
+  }
+}
+
+int ecmcAxisBase::exeCmd(ecmcAxisCmd *cmd) {
+  switch (cmd->type) {
+  case ECMC_AXIS_CMD_MOVE_ABS:
+    return moveAbsolutePosition(cmd->values[0],
+                                cmd->values[1],
+                                cmd->values[2],
+                                cmd->values[3]);
+
+  case ECMC_AXIS_CMD_MOVE_REL:
+    return moveRelativePosition(cmd->values[0],
+                                cmd->values[1],
+                                cmd->values[2],
+                                cmd->values[3]);
+
+  case ECMC_AXIS_CMD_MOVE_VEL:
+    return moveVelocity(cmd->values[1],
+                        cmd->values[2],
+                        cmd->values[3]);
+
+  case ECMC_AXIS_CMD_MOVE_HOME:
+    return moveHome(cmd->intValue,
+                    cmd->values[0],
+                    cmd->values[1],
+                    cmd->values[2],
+                    cmd->values[3],
+                    cmd->values[4]);
+
+  case ECMC_AXIS_CMD_SET_POS:
+    return setPosition(cmd->values[0]);
+
+  case ECMC_AXIS_CMD_SET_EXECUTE:
+    return setExecute(cmd->intValue);
+
+  case ECMC_AXIS_CMD_SET_ENABLE:
+    return setEnable(cmd->intValue);
+
+  case ECMC_AXIS_CMD_ERROR_RESET:
+    errorReset();
+    return 0;
+
+  case ECMC_AXIS_CMD_SET_SOFT_LIMIT_FWD:
+    return getMon()->setSoftLimitFwd(cmd->values[0]);
+
+  case ECMC_AXIS_CMD_SET_SOFT_LIMIT_BWD:
+    return getMon()->setSoftLimitBwd(cmd->values[0]);
+
+  case ECMC_AXIS_CMD_ENABLE_SOFT_LIMIT_FWD:
+    return getMon()->setEnableSoftLimitFwd(cmd->intValue);
+
+  case ECMC_AXIS_CMD_ENABLE_SOFT_LIMIT_BWD:
+    return getMon()->setEnableSoftLimitBwd(cmd->intValue);
+
+  case ECMC_AXIS_CMD_SET_MAX_VEL:
+    return getMon()->setMaxVel(cmd->values[1]);
+
+  case ECMC_AXIS_CMD_SET_ACC:
+    getTraj()->setAcc(cmd->values[2]);
+    return 0;
+
+  case ECMC_AXIS_CMD_CONTROL_WORD:
+    return writeControlWord(&cmd->controlWord);
+  }
+
+  return ERROR_AXIS_CMD_TYPE_INVALID;
+}
+
+int ecmcAxisBase::getStatusSnapshot(ecmcAxisStatusType *data) {
+  if (data == NULL) {
+    return ERROR_AXIS_DATA_POINTER_NULL;
+  }
+
+  if (!data_.status_.inRealtime) {
+    return getDebugInfoData(data);
+  }
+
+  if (statusSnapshot_.read(data, ECMC_RT_SNAPSHOT_MAX_RETRIES)) {
+    return ERROR_AXIS_STATUS_SNAPSHOT_FAIL;
+  }
+  return 0;
+}
+
+// Realtime: ready to be moved by an axis group (no motion queue)
+bool ecmcAxisBase::getGroupReady() {
+  return getEnabled() && !data_.status_.busy &&
+         !seq_.getMotionQueueEnable() &&
+         !data_.interlocks_.axisErrorStateInterlock &&
+         data_.command_.trajSource == ECMC_DATA_SOURCE_INTERNAL &&
+         data_.command_.operationModeCmd == ECMC_MODE_OP_AUTO;
+}
+
+void ecmcAxisBase::setGroupActive(bool active) {
+  if (active && !groupActive_) {
+    groupPosSet_ = data_.status_.currentPositionSetpoint;
+    groupVelSet_ = 0;
+    // Only valid for the internal trajectory
+    data_.interlocks_.noExecuteInterlock = false;
+    data_.refreshInterlocks();
+  }
+
+  if (!active && groupActive_) {
+    // Continue from last group setpoint
+    traj_->setCurrentPosSet(groupPosSet_);
+    groupVelSet_ = 0;
+  }
+  groupActive_ = active;
+}
+
+bool ecmcAxisBase::getGroupActive() {
+  return groupActive_;
+}
+
+void ecmcAxisBase::setGroupSetpoint(double pos, double vel) {
+  groupPosSet_ = pos;
+  groupVelSet_ = vel;
+}
+
+double ecmcAxisBase::getGroupPosSet() {
+  return groupPosSet_;
+}
+
+// Realtime: axis can not follow group setpoints (disabled or in error)
+bool ecmcAxisBase::getGroupFault() {
+  return !getEnabled() || data_.interlocks_.axisErrorStateInterlock;
+}
+
+/*
+ * Realtime: Stop mode for group motion with velocity vel
+ * (ECMC_STOP_MODE_RUN if the axis can continue).
+ */
+stopMode ecmcAxisBase::getGroupInterlock(double vel) {
+  if (getGroupFault()) {
+    return ECMC_STOP_MODE_EMERGENCY;
+  }
+
+  if ((vel > 0 && data_.interlocks_.trajSummaryInterlockFWD) ||
+      (vel < 0 && data_.interlocks_.trajSummaryInterlockBWD)) {
+    return data_.interlocks_.currStopMode == ECMC_STOP_MODE_RUN ?
+           ECMC_STOP_MODE_NORMAL : data_.interlocks_.currStopMode;
+  }
+  return ECMC_STOP_MODE_RUN;
+}
@@ -16,6 +16,8 @@
 #define __STDC_FORMAT_MACROS  // To "reinclude" inttypes
 #include "../main/ecmcDefinitions.h"
 #include "../main/ecmcError.h"
+#include "../main/ecmcRtHandoff.h"
+#include <epicsMutex.h>
 #include "../com/ecmcAsynPortDriver.h"
 #include "ecmcDriveBase.h"
 #include "ecmcDriveStepper.h"
@@ -25,6 +27,8 @@
 #include "ecmcPIDController.h"
 #include "ecmcAxisSequencer.h"
 #include "ecmcTrajectoryTrapetz.h"
+#include "ecmcAxisCam.h"
+#include "ecmcAxisPvt.h"
 #include "ecmcAxisData.h"
 #include "ecmcFilter.h"
 
@@ -67,6 +71,11 @@
 #define ERROR_AXIS_MODULO_TYPE_OUT_OF_RANGE 0x14323
 #define ERROR_AXIS_FILTER_OBJECT_NULL 0x14324
 #define ERROR_AXIS_PLC_OBJECT_NULL 0x14325
+#define ERROR_AXIS_CMD_QUEUE_FULL 0x14326
+#define ERROR_AXIS_CMD_QUEUE_TIMEOUT 0x14327
+#define ERROR_AXIS_CMD_TYPE_INVALID 0x14328
+#define ERROR_AXIS_STATUS_SNAPSHOT_FAIL 0x14329
+#define ERROR_AXIS_GROUP_CONTROLLED 0x1432A
 
 enum axisState {
   ECMC_AXIS_STATE_STARTUP  = 0,
@@ -146,6 +155,45 @@ typedef struct {
   int                        spareBitsCmd       : 23;
  } ecmcAsynAxisControlType;
 
+enum ecmcAxisCmdType {
+  ECMC_AXIS_CMD_MOVE_ABS              = 0,
+  ECMC_AXIS_CMD_MOVE_REL              = 1,
+  ECMC_AXIS_CMD_MOVE_VEL              = 2,
+  ECMC_AXIS_CMD_MOVE_HOME             = 3,
+  ECMC_AXIS_CMD_SET_POS               = 4,
+  ECMC_AXIS_CMD_SET_EXECUTE           = 5,
+  ECMC_AXIS_CMD_SET_ENABLE            = 6,
+  ECMC_AXIS_CMD_ERROR_RESET           = 7,
+  ECMC_AXIS_CMD_SET_SOFT_LIMIT_FWD    = 8,
+  ECMC_AXIS_CMD_SET_SOFT_LIMIT_BWD    = 9,
+  ECMC_AXIS_CMD_ENABLE_SOFT_LIMIT_FWD = 10,
+  ECMC_AXIS_CMD_ENABLE_SOFT_LIMIT_BWD = 11,
+  ECMC_AXIS_CMD_SET_MAX_VEL           = 12,
+  ECMC_AXIS_CMD_SET_ACC               = 13,
+  ECMC_AXIS_CMD_CONTROL_WORD          = 14,
+};
+
+// State of a queued command (a timed out command is cancelled)
+enum ecmcAxisCmdState {
+  ECMC_AXIS_CMD_STATE_QUEUED    = 0,
+  ECMC_AXIS_CMD_STATE_EXECUTING = 1,
+  ECMC_AXIS_CMD_STATE_CANCELLED = 2,
+};
+
+/**
+ * Command from non realtime (asyn, motor record) to an axis.
+ * Executed by the thread executing the axis (see ecmcAxisBase::queueCmd()).
+ * values[] (in order): position, velocity, acceleration, deceleration.
+ * For homing: home position, velocity towards cam, velocity off cam,
+ * acceleration, deceleration.
+ */
+typedef struct {
+  ecmcAxisCmdType            type;
+  int                        intValue;
+  double                     values[5];
+  ecmcAsynAxisControlType    controlWord;
+} ecmcAxisCmd;
+
 class ecmcAxisBase : public ecmcError {
  public:
   ecmcAxisBase(ecmcAsynPortDriver *asynPortDriver,
@@ -183,6 +231,8 @@ class ecmcAxisBase : public ecmcError {
   ecmcMonitor              * getMon();
   ecmcEncoder              * getEnc();
   ecmcAxisSequencer        * getSeq();
+  ecmcAxisCam              * getCam();
+  ecmcAxisPvt              * getPvt();
   int                        getPosAct(double *pos);
   int                        getPosSet(double *pos);
   int                        getVelAct(double *vel);
@@ -253,16 +303,34 @@ class ecmcAxisBase : public ecmcError {
   int                   setPosition(double homePositionSet);  // Autosave
   int                   stopMotion(int killAmplifier);
   asynStatus            axisAsynWriteCmd(void* data, size_t bytes, asynParamType asynParType);
+  asynStatus            axisAsynWriteQueueAdd(void* data, size_t bytes, asynParamType asynParType);
+  asynStatus            axisAsynWritePvtAdd(void* data, size_t bytes, asynParamType asynParType);
   int                   setAllowMotionFunctions(bool enablePos, bool enableConstVel, bool enableHome);
   int                   getAllowPos();
   int                   getAllowConstVelo();
   int                   getAllowHome();
   double                getExtSetPos();
   double                getExtActPos();
+  // Non realtime: execute command in the realtime thread (thread safe)
+  int                   queueCmd(ecmcAxisCmd *cmd, bool waitForResult);
+  // Non realtime: consistent copy of status published by realtime
+  int                   getStatusSnapshot(ecmcAxisStatusType *data);
+  // Realtime: setpoints from an axis group or a PVT table (see ecmcAxisGroup,
+  // ecmcAxisPvt). Single axis motion is rejected while active.
+  bool                  getGroupReady();
+  void                  setGroupActive(bool active);
+  bool                  getGroupActive();
+  void                  setGroupSetpoint(double pos, double vel);
+  double                getGroupPosSet();
+  stopMode              getGroupInterlock(double vel);
+  bool                  getGroupFault();
 
  protected:
   void         initVars();
   void         refreshDebugInfoStruct();
+  int          exeCmd(ecmcAxisCmd *cmd);
+  void         exeCmdQueue();
+  int          writeControlWord(ecmcAsynAxisControlType *controlWord);
   double       getPosErrorMod();
   int          createAsynParam(const char        *nameFormat,
                                asynParamType      asynType,
@@ -300,6 +368,34 @@ class ecmcAxisBase : public ecmcError {
   bool enableExtEncVeloFilter_;
   bool disableAxisAtErrorReset_;
   bool beforeFirstEnable_;
+
+  // Motion queue of sequencer (asyn)
+  double  queueAddBuffer_[ECMC_ASYN_AX_QUEUE_ITEM_VALUES];
+  int32_t queueCount_;
+  int32_t queueEnable_;
+  int32_t queueClear_;
+
+  // Axis group (setpoints bypass the trajectory while active)
+  bool   groupActive_;
+  double groupPosSet_;
+  double groupVelSet_;
+
+  // Electronic gear/cam (external trajectory source, see ecmcAxisCam)
+  ecmcAxisCam *cam_;
+
+  // PVT table (asyn)
+  ecmcAxisPvt *pvt_;
+  double  pvtAddBuffer_[ECMC_AXIS_PVT_POINT_VALUES];
+  int32_t pvtFree_;
+  int32_t pvtStart_;
+
+  // Handoff to/from non realtime
+  ecmcRtSnapshot<ecmcAxisStatusType> statusSnapshot_;
+  ecmcRtCmdQueue<ecmcAxisCmd, ECMC_AXIS_CMD_QUEUE_SIZE> cmdQueue_;
+  epicsMutexId cmdProducerLock_;
+  int    cmdResults_[ECMC_AXIS_CMD_QUEUE_SIZE];
+  int    cmdStates_[ECMC_AXIS_CMD_QUEUE_SIZE];
+  size_t cmdDoneCounter_;
 };
 
 #endif  /* ECMCAXISBASE_H_ */
@@ -0,0 +1,289 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisCam.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcAxisCam.h"
+#include <math.h>
+#include <epicsAtomic.h>
+#include "ecmcAxisBase.h"
+
+ecmcAxisCam::ecmcAxisCam(double sampleTime) {
+  initVars();
+  sampleTime_ = sampleTime;
+}
+
+ecmcAxisCam::~ecmcAxisCam() {}
+
+void ecmcAxisCam::initVars() {
+  errorReset();
+  sampleTime_       = 0;
+  masterSource_     = ECMC_AXIS_CAM_MASTER_NONE;
+  masterAxis_       = NULL;
+  masterScale_      = 1;
+  masterModulo_     = 0;
+  ratio_            = 1;
+  offset_           = 0;
+  enable_           = 0;
+  masterInit_       = false;
+  masterRawOld_     = 0;
+  masterEntryOld_   = 0;
+  masterEntryBits_  = 0;
+  masterPos_        = 0;
+  slavePos_         = 0;
+}
+
+int ecmcAxisCam::setMasterAxis(ecmcAxisBase           *master,
+                               ecmcAxisCamMasterSource source) {
+  if ((source != ECMC_AXIS_CAM_MASTER_AXIS_SET) &&
+      (source != ECMC_AXIS_CAM_MASTER_AXIS_ACT)) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_CAM_MASTER_SOURCE_INVALID);
+  }
+
+  if (master == NULL) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_CAM_MASTER_NULL);
+  }
+
+  masterAxis_   = master;
+  masterSource_ = source;
+  masterInit_   = false;
+  return 0;
+}
+
+int ecmcAxisCam::setMasterEntry(ecmcEcEntry *entry,
+                                int          bitIndex) {
+  int errorCode = setEntryAtIndex(entry,
+                                  ECMC_AXIS_CAM_ENTRY_INDEX_MASTER_POSITION,
+                                  bitIndex);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  masterAxis_   = NULL;
+  masterSource_ = ECMC_AXIS_CAM_MASTER_EC_ENTRY;
+  masterInit_   = false;
+  return 0;
+}
+
+int ecmcAxisCam::setMasterScale(double scale) {
+  masterScale_ = scale;
+  return 0;
+}
+
+int ecmcAxisCam::setMasterModulo(double modulo) {
+  if (modulo < 0) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_CAM_MODULO_INVALID);
+  }
+  masterModulo_ = modulo;
+  return 0;
+}
+
+int ecmcAxisCam::setRatio(double ratio) {
+  ratio_ = ratio;
+  return 0;
+}
+
+int ecmcAxisCam::setOffset(double offset) {
+  offset_ = offset;
+  return 0;
+}
+
+int ecmcAxisCam::loadTable(const char           *fileName,
+                           ecmcAxisCamInterpType interp) {
+  int lineNumber = 0;
+  int errorCode  = table_.load(fileName, interp, &lineNumber);
+
+  if (errorCode) {
+    LOGERR("%s/%s:%d: ERROR: Cam table file %s invalid at line %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           fileName,
+           lineNumber,
+           errorCode);
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
+  return 0;
+}
+
+int ecmcAxisCam::validate() {
+  if (masterSource_ == ECMC_AXIS_CAM_MASTER_NONE) {
+    return 0;
+  }
+
+  if (masterSource_ == ECMC_AXIS_CAM_MASTER_EC_ENTRY) {
+    int errorCode = validateEntry(ECMC_AXIS_CAM_ENTRY_INDEX_MASTER_POSITION);
+
+    if (errorCode) {
+      return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+    }
+
+    errorCode = getEntryBitCount(ECMC_AXIS_CAM_ENTRY_INDEX_MASTER_POSITION,
+                                 &masterEntryBits_);
+
+    if (errorCode) {
+      return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+    }
+  } else if (masterAxis_ == NULL) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_CAM_MASTER_NULL);
+  }
+
+  // Modulo table must span exactly one master cycle (periodic spline)
+  int tableSize = table_.getSize();
+
+  table_.setPeriodic(masterModulo_ > 0);
+
+  if ((masterModulo_ > 0) && (tableSize > 0)) {
+    double tol = masterModulo_ * 1e-9;
+
+    if ((fabs(table_.getX(0)) > tol) ||
+        (fabs(table_.getX(tableSize - 1) - masterModulo_) > tol)) {
+      LOGERR(
+        "%s/%s:%d: ERROR: Cam table must span [0..%lf] for a modulo master (0x%x).\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        masterModulo_,
+        ERROR_AXIS_CAM_MODULO_INVALID);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_AXIS_CAM_MODULO_INVALID);
+    }
+  }
+
+  return 0;
+}
+
+bool ecmcAxisCam::getConfigured() {
+  return masterSource_ != ECMC_AXIS_CAM_MASTER_NONE;
+}
+
+ecmcAxisBase * ecmcAxisCam::getMasterAxis() {
+  return masterSource_ == ECMC_AXIS_CAM_MASTER_EC_ENTRY ? NULL : masterAxis_;
+}
+
+void ecmcAxisCam::setEnable(bool enable) {
+  epicsAtomicSetIntT(&enable_, enable);
+}
+
+bool ecmcAxisCam::getEnable() {
+  return epicsAtomicGetIntT(&enable_) != 0;
+}
+
+int ecmcAxisCam::readMasterPos(double *pos) {
+  switch (masterSource_) {
+  case ECMC_AXIS_CAM_MASTER_AXIS_SET:
+    *pos = masterAxis_->getDebugInfoDataPointer()->onChangeData.positionSetpoint;
+    return 0;
+
+  case ECMC_AXIS_CAM_MASTER_AXIS_ACT:
+    *pos = masterAxis_->getDebugInfoDataPointer()->onChangeData.positionActual;
+    return 0;
+
+  case ECMC_AXIS_CAM_MASTER_EC_ENTRY:
+  {
+    uint64_t raw = 0;
+    int errorCode = readEcEntryValue(ECMC_AXIS_CAM_ENTRY_INDEX_MASTER_POSITION,
+                                     &raw);
+
+    if (errorCode) {
+      return errorCode;
+    }
+
+    // Difference to last value, sign extended to the bit count of the entry
+    uint64_t diff = masterInit_ ? raw - masterEntryOld_ : raw;
+
+    if ((masterEntryBits_ > 0) && (masterEntryBits_ < 64)) {
+      uint64_t range = (uint64_t)1 << masterEntryBits_;
+      diff &= range - 1;
+
+      if (diff >= range / 2) {
+        diff -= range;
+      }
+    }
+    masterEntryOld_ = raw;
+    *pos            = (masterInit_ ? masterPos_ : 0) +
+                      masterScale_ * (double)(int64_t)diff;
+    return 0;
+  }
+
+  default:
+    return ERROR_AXIS_CAM_MASTER_SOURCE_INVALID;
+  }
+}
+
+void ecmcAxisCam::execute() {
+  double raw = 0;
+
+  if (readMasterPos(&raw)) {
+    return;
+  }
+
+  if ((masterSource_ != ECMC_AXIS_CAM_MASTER_EC_ENTRY) && masterInit_) {
+    // Unwrap modulo master axis
+    double range = masterAxis_->getModRange();
+    double diff  = raw - masterRawOld_;
+
+    if (range > 0) {
+      if (diff > range / 2) {
+        diff -= range;
+      } else if (diff < -range / 2) {
+        diff += range;
+      }
+    }
+    masterRawOld_ = raw;
+    raw           = masterPos_ + diff;
+  } else {
+    masterRawOld_ = raw;
+  }
+
+  masterPos_  = raw;
+  masterInit_ = true;
+
+  double x           = masterPos_;
+  double cycleOffset = 0;
+  int    tableSize   = table_.getSize();
+
+  if (masterModulo_ > 0) {
+    double cycles = floor(x / masterModulo_);
+    x -= cycles * masterModulo_;
+
+    if (tableSize > 0) {
+      cycleOffset = cycles * (table_.getY(tableSize - 1) - table_.getY(0));
+    } else {
+      cycleOffset = cycles * masterModulo_;
+    }
+  }
+
+  double y = tableSize > 0 ? table_.evaluate(x) : x;
+
+  slavePos_ = ratio_ * (y + cycleOffset) + offset_;
+}
+
+double ecmcAxisCam::getMasterPos() {
+  return masterPos_;
+}
+
+double ecmcAxisCam::getSlavePos() {
+  return slavePos_;
+}
@@ -0,0 +1,116 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisCam.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCAXISCAM_H_
+#define ECMCAXISCAM_H_
+
+#include "../main/ecmcDefinitions.h"
+#include "../main/ecmcError.h"
+#include "../ethercat/ecmcEcEntryLink.h"
+#include "ecmcAxisCamTable.h"
+
+#define ERROR_AXIS_CAM_MASTER_NULL 0x14800
+#define ERROR_AXIS_CAM_MODULO_INVALID 0x14806
+#define ERROR_AXIS_CAM_MASTER_SOURCE_INVALID 0x14807
+#define ERROR_AXIS_CAM_MASTER_SELF 0x14808
+#define ERROR_AXIS_CAM_MASTER_ORDER 0x14809
+#define ERROR_AXIS_CAM_MASTER_RT_TASK_GROUP 0x1480A
+
+#define ECMC_AXIS_CAM_ENTRY_INDEX_MASTER_POSITION 0
+
+enum ecmcAxisCamMasterSource {
+  ECMC_AXIS_CAM_MASTER_NONE     = 0,
+  ECMC_AXIS_CAM_MASTER_AXIS_SET = 1,  // Master axis position setpoint
+  ECMC_AXIS_CAM_MASTER_AXIS_ACT = 2,  // Master axis actual position
+  ECMC_AXIS_CAM_MASTER_EC_ENTRY = 3,  // EtherCAT entry (raw counter)
+};
+
+class ecmcAxisBase;
+
+/**
+ * \class ecmcAxisCam
+ *
+ * \brief Electronic gear and cam of an axis (slave) to a master
+ *
+ * The master is the position (setpoint or actual) of another axis or a raw
+ * EtherCAT entry (counter, scaled). Wrap arounds of modulo master axes and
+ * of the entry are unwrapped to a continuous master position.
+ *
+ * slavePos = ratio * cam(masterPos) + offset
+ *
+ * Without a table cam(x) = x (electronic gear). A table ("master slave" per
+ * line) is interpolated linear or with a natural cubic spline, outside of
+ * the table the end values are held. If a master modulo is set, the master
+ * position is folded to [0..modulo[ and the table must span exactly
+ * [0..modulo]. Each master cycle then adds the slave stroke of the table
+ * (last - first value), so both closed (stroke 0) and continuous cams are
+ * supported. A cubic table then uses a periodic spline, so velocity and
+ * acceleration of the slave are continuous over the wrap.
+ *
+ * Executed by the slave axis (no PLC needed). The master axis must be
+ * executed before the slave in the same thread (checked when entering
+ * runtime): in ecmc_rt with a lower index, in an rt task group added
+ * before the slave. Otherwise the slave follows the master position of
+ * the previous cycle or reads it while it is written.
+ */
+class ecmcAxisCam : public ecmcEcEntryLink {
+ public:
+  explicit ecmcAxisCam(double sampleTime);
+  ~ecmcAxisCam();
+
+  // Configuration
+  int    setMasterAxis(ecmcAxisBase           *master,
+                       ecmcAxisCamMasterSource source);
+  int    setMasterEntry(ecmcEcEntry *entry,
+                        int          bitIndex);
+  int    setMasterScale(double scale);
+  int    setMasterModulo(double modulo);
+  int    setRatio(double ratio);
+  int    setOffset(double offset);
+  int    loadTable(const char           *fileName,
+                   ecmcAxisCamInterpType interp);
+  int    validate();
+  bool   getConfigured();
+  ecmcAxisBase* getMasterAxis();  // NULL if master is not an axis
+
+  // Thread safe
+  void   setEnable(bool enable);
+  bool   getEnable();
+
+  // Realtime
+  void   execute();
+  double getMasterPos();
+  double getSlavePos();
+
+ private:
+  void   initVars();
+  int    readMasterPos(double *pos);
+
+  double sampleTime_;
+  ecmcAxisCamMasterSource masterSource_;
+  ecmcAxisBase *masterAxis_;
+  double masterScale_;
+  double masterModulo_;
+  double ratio_;
+  double offset_;
+  int    enable_;
+
+  // Master position unwrap
+  bool     masterInit_;
+  double   masterRawOld_;
+  uint64_t masterEntryOld_;
+  int      masterEntryBits_;
+  double   masterPos_;
+  double   slavePos_;
+  ecmcAxisCamTable table_;
+};
+
+#endif  /* ECMCAXISCAM_H_ */
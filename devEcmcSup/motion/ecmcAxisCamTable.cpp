@@ -0,0 +1,368 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisCamTable.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcAxisCamTable.h"
+#include <stdio.h>
+#include <string.h>
+
+ecmcAxisCamTable::ecmcAxisCamTable() {
+  interp_   = ECMC_AXIS_CAM_INTERP_LINEAR;
+  periodic_ = false;
+  x_      = NULL;
+  y_      = NULL;
+  y2_     = NULL;
+  size_   = 0;
+  index_  = 0;
+}
+
+ecmcAxisCamTable::~ecmcAxisCamTable() {
+  clear();
+}
+
+void ecmcAxisCamTable::clear() {
+  delete[] x_;
+  x_ = NULL;
+  delete[] y_;
+  y_ = NULL;
+  delete[] y2_;
+  y2_    = NULL;
+  size_  = 0;
+  index_ = 0;
+}
+
+int ecmcAxisCamTable::setPoints(const double         *x,
+                                const double         *y,
+                                int                   count,
+                                ecmcAxisCamInterpType interp) {
+  if ((interp != ECMC_AXIS_CAM_INTERP_LINEAR) &&
+      (interp != ECMC_AXIS_CAM_INTERP_CUBIC)) {
+    return ERROR_AXIS_CAM_INTERP_TYPE_INVALID;
+  }
+
+  if ((count < 2) || (count > ECMC_AXIS_CAM_TABLE_MAX_POINTS)) {
+    return ERROR_AXIS_CAM_TABLE_SIZE_INVALID;
+  }
+
+  for (int i = 1; i < count; i++) {
+    if (!(x[i] > x[i - 1])) {
+      return ERROR_AXIS_CAM_TABLE_NOT_INCREASING;
+    }
+  }
+
+  clear();
+  x_  = new double[count];
+  y_  = new double[count];
+  y2_ = new double[count];
+  memcpy(x_, x, sizeof(double) * count);
+  memcpy(y_, y, sizeof(double) * count);
+  memset(y2_, 0, sizeof(double) * count);
+  size_   = count;
+  interp_ = interp;
+
+  if (interp_ == ECMC_AXIS_CAM_INTERP_CUBIC) {
+    initSpline();
+  }
+  return 0;
+}
+
+void ecmcAxisCamTable::setPeriodic(bool periodic) {
+  periodic_ = periodic;
+
+  if ((size_ > 0) && (interp_ == ECMC_AXIS_CAM_INTERP_CUBIC)) {
+    initSpline();
+  }
+}
+
+/*
+ * Table file: one point per line ("master slave", separated by white space
+ * or comma). Empty lines and lines starting with '#' are ignored.
+ */
+int ecmcAxisCamTable::load(const char           *fileName,
+                           ecmcAxisCamInterpType interp,
+                           int                  *lineNumber) {
+  *lineNumber = 0;
+  clear();
+
+  FILE *file = fopen(fileName, "r");
+
+  if (file == NULL) {
+    return ERROR_AXIS_CAM_TABLE_FILE_OPEN_FAIL;
+  }
+
+  double *x = new double[ECMC_AXIS_CAM_TABLE_MAX_POINTS];
+  double *y = new double[ECMC_AXIS_CAM_TABLE_MAX_POINTS];
+  char    line[ECMC_AXIS_CAM_TABLE_LINE_LENGTH];
+  int     count     = 0;
+  int     errorCode = 0;
+
+  while (fgets(line, sizeof(line), file)) {
+    (*lineNumber)++;
+
+    for (char *c = line; *c; c++) {
+      if (*c == ',') {
+        *c = ' ';
+      }
+    }
+
+    char *first = line + strspn(line, " \t\r\n");
+
+    if ((*first == '\0') || (*first == '#')) {
+      continue;
+    }
+
+    if (count >= ECMC_AXIS_CAM_TABLE_MAX_POINTS) {
+      errorCode = ERROR_AXIS_CAM_TABLE_SIZE_INVALID;
+      break;
+    }
+
+    if (sscanf(first, "%lf %lf", &x[count], &y[count]) != 2) {
+      errorCode = ERROR_AXIS_CAM_TABLE_PARSE_FAIL;
+      break;
+    }
+
+    if ((count > 0) && (x[count] <= x[count - 1])) {
+      errorCode = ERROR_AXIS_CAM_TABLE_NOT_INCREASING;
+      break;
+    }
+    count++;
+  }
+  fclose(file);
+
+  if (!errorCode) {
+    errorCode = setPoints(x, y, count, interp);
+  }
+
+  delete[] x;
+  delete[] y;
+  return errorCode;
+}
+
+/*
+ * Solve tridiagonal system (sub diagonal a, diagonal b, super diagonal c)
+ * with the Thomas algorithm. tmp must hold n values.
+ */
+static void solveTridiagonal(const double *a,
+                             const double *b,
+                             const double *c,
+                             const double *r,
+                             double       *x,
+                             double       *tmp,
+                             int           n) {
+  double bet = b[0];
+
+  x[0] = r[0] / bet;
+
+  for (int i = 1; i < n; i++) {
+    tmp[i] = c[i - 1] / bet;
+    bet    = b[i] - a[i] * tmp[i];
+    x[i]   = (r[i] - a[i] * x[i - 1]) / bet;
+  }
+
+  for (int i = n - 2; i >= 0; i--) {
+    x[i] -= tmp[i + 1] * x[i + 1];
+  }
+}
+
+/*
+ * Second derivatives of a periodic cubic spline (M0 = Mn, equal slope at
+ * both ends). Cyclic tridiagonal system for M0..Mn-1, solved with the
+ * Sherman-Morrison formula. Only slope differences of the segments are
+ * used, so a stroke of the table (y0 != yn) just adds a linear part.
+ */
+void ecmcAxisCamTable::initPeriodicSpline() {
+  int n = size_ - 1;  // Segments
+
+  if (n < 3) {
+    // One segment: straight line. Two segments: M1 = -M0
+    double s0 = (y_[1] - y_[0]) / (x_[1] - x_[0]);
+    double s1 = n == 2 ? (y_[2] - y_[1]) / (x_[2] - x_[1]) : s0;
+
+    y2_[0] = 6 * (s0 - s1) / (x_[n] - x_[0]);
+    y2_[1] = -y2_[0];
+    y2_[n] = y2_[0];
+    return;
+  }
+
+  double *a   = new double[n];
+  double *b   = new double[n];
+  double *c   = new double[n];
+  double *r   = new double[n];
+  double *u   = new double[n];
+  double *z   = new double[n];
+  double *tmp = new double[n];
+
+  for (int i = 0; i < n; i++) {
+    int    prev  = (i + n - 1) % n;
+    double hPrev = x_[prev + 1] - x_[prev];
+    double h     = x_[i + 1] - x_[i];
+    double sPrev = (y_[prev + 1] - y_[prev]) / hPrev;
+    double s     = (y_[i + 1] - y_[i]) / h;
+
+    a[i] = hPrev;
+    b[i] = 2 * (hPrev + h);
+    c[i] = h;
+    r[i] = 6 * (s - sPrev);
+    u[i] = 0;
+  }
+
+  // Corner elements: alpha at (n-1, 0), beta at (0, n-1)
+  double alpha = c[n - 1];
+  double beta  = a[0];
+  double gamma = -b[0];
+
+  b[0]     -= gamma;
+  b[n - 1] -= alpha * beta / gamma;
+  solveTridiagonal(a, b, c, r, y2_, tmp, n);
+
+  u[0]     = gamma;
+  u[n - 1] = alpha;
+  solveTridiagonal(a, b, c, u, z, tmp, n);
+
+  double fact = (y2_[0] + beta * y2_[n - 1] / gamma) /
+                (1 + z[0] + beta * z[n - 1] / gamma);
+
+  for (int i = 0; i < n; i++) {
+    y2_[i] -= fact * z[i];
+  }
+  y2_[n] = y2_[0];
+
+  delete[] a;
+  delete[] b;
+  delete[] c;
+  delete[] r;
+  delete[] u;
+  delete[] z;
+  delete[] tmp;
+}
+
+/*
+ * Second derivatives of a natural cubic spline (zero curvature at the
+ * ends), solved with the tridiagonal (Thomas) algorithm.
+ */
+void ecmcAxisCamTable::initSpline() {
+  if (periodic_) {
+    initPeriodicSpline();
+    return;
+  }
+
+  double *u = new double[size_];
+
+  y2_[0] = 0;
+  u[0]   = 0;
+
+  for (int i = 1; i < size_ - 1; i++) {
+    double sig = (x_[i] - x_[i - 1]) / (x_[i + 1] - x_[i - 1]);
+    double p   = sig * y2_[i - 1] + 2;
+    y2_[i] = (sig - 1) / p;
+    u[i]   = (y_[i + 1] - y_[i]) / (x_[i + 1] - x_[i]) -
+             (y_[i] - y_[i - 1]) / (x_[i] - x_[i - 1]);
+    u[i] = (6 * u[i] / (x_[i + 1] - x_[i - 1]) - sig * u[i - 1]) / p;
+  }
+
+  y2_[size_ - 1] = 0;
+
+  for (int i = size_ - 2; i >= 0; i--) {
+    y2_[i] = y2_[i] * y2_[i + 1] + u[i];
+  }
+
+  delete[] u;
+}
+
+int ecmcAxisCamTable::getSize() {
+  return size_;
+}
+
+double ecmcAxisCamTable::getX(int index) {
+  return x_[index];
+}
+
+double ecmcAxisCamTable::getY(int index) {
+  return y_[index];
+}
+
+/*
+ * Segment [x_i..x_i+1[ of x (x within the table). Normally same or next
+ * segment as last lookup, else binary search.
+ */
+int ecmcAxisCamTable::findSegment(double x) {
+  int i = index_;
+
+  if ((i >= size_ - 1) || (x < x_[i])) {
+    i = 0;
+  }
+
+  if (x >= x_[i + 1]) {
+    if ((i + 2 < size_) && (x < x_[i + 2])) {
+      i++;
+    } else {
+      int low  = 0;
+      int high = size_ - 1;
+
+      while (high - low > 1) {
+        int mid = (low + high) / 2;
+
+        if (x_[mid] <= x) {
+          low = mid;
+        } else {
+          high = mid;
+        }
+      }
+      i = low;
+    }
+  }
+  index_ = i;
+  return i;
+}
+
+double ecmcAxisCamTable::evaluate(double x) {
+  double y, dy, ddy;
+
+  evaluate(x, &y, &dy, &ddy);
+  return y;
+}
+
+void ecmcAxisCamTable::evaluate(double  x,
+                                double *y,
+                                double *dy,
+                                double *ddy) {
+  *dy  = 0;
+  *ddy = 0;
+
+  if (periodic_) {
+    // Derivatives of the first and last segment at the ends
+    if (x < x_[0]) {
+      x = x_[0];
+    } else if (x > x_[size_ - 1]) {
+      x = x_[size_ - 1];
+    }
+  } else if (x <= x_[0]) {
+    *y = y_[0];
+    return;
+  } else if (x >= x_[size_ - 1]) {
+    *y = y_[size_ - 1];
+    return;
+  }
+
+  int    i = findSegment(x);
+  double h = x_[i + 1] - x_[i];
+  double a = (x_[i + 1] - x) / h;
+  double b = 1 - a;
+
+  *y  = a * y_[i] + b * y_[i + 1];
+  *dy = (y_[i + 1] - y_[i]) / h;
+
+  if (interp_ == ECMC_AXIS_CAM_INTERP_CUBIC) {
+    *y += ((a * a * a - a) * y2_[i] + (b * b * b - b) * y2_[i + 1]) *
+          h * h / 6;
+    *dy += ((1 - 3 * a * a) * y2_[i] + (3 * b * b - 1) * y2_[i + 1]) * h / 6;
+    *ddy = a * y2_[i] + b * y2_[i + 1];
+  }
+}
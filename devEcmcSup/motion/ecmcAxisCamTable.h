@@ -0,0 +1,93 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisCamTable.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCAXISCAMTABLE_H_
+#define ECMCAXISCAMTABLE_H_
+
+#define ERROR_AXIS_CAM_TABLE_FILE_OPEN_FAIL 0x14801
+#define ERROR_AXIS_CAM_TABLE_PARSE_FAIL 0x14802
+#define ERROR_AXIS_CAM_TABLE_SIZE_INVALID 0x14803
+#define ERROR_AXIS_CAM_TABLE_NOT_INCREASING 0x14804
+#define ERROR_AXIS_CAM_INTERP_TYPE_INVALID 0x14805
+
+#define ECMC_AXIS_CAM_TABLE_MAX_POINTS 100000
+#define ECMC_AXIS_CAM_TABLE_LINE_LENGTH 256
+
+enum ecmcAxisCamInterpType {
+  ECMC_AXIS_CAM_INTERP_LINEAR = 0,
+  ECMC_AXIS_CAM_INTERP_CUBIC  = 1,  // Cubic spline (natural or periodic)
+};
+
+/**
+ * \class ecmcAxisCamTable
+ *
+ * \brief Cam table (master x, slave y) interpolated linear or with a
+ * natural or periodic cubic spline
+ *
+ * Master positions must be strictly increasing. Outside of the table the
+ * end values are held (zero derivatives).
+ *
+ * A periodic spline (for a modulo master) has equal slope and curvature at
+ * both ends, so velocity and acceleration are continuous over the wrap.
+ * The slave stroke of the table (last - first value) is allowed, only the
+ * curvature is periodic. For x at the end of the table the derivatives of
+ * the last segment are returned (not zero).
+ *
+ * Plain numerics without EPICS dependencies (see tools/check).
+ */
+class ecmcAxisCamTable {
+ public:
+  ecmcAxisCamTable();
+  ~ecmcAxisCamTable();
+
+  int    setPoints(const double         *x,
+                   const double         *y,
+                   int                   count,
+                   ecmcAxisCamInterpType interp);
+
+  /** \brief Load table from file, lineNumber is set to the failing line.
+   * The table is left empty on error.
+   */
+  int    load(const char           *fileName,
+              ecmcAxisCamInterpType interp,
+              int                  *lineNumber);
+  void   clear();
+
+  /** \brief Periodic spline (cubic only), recalculated if already loaded.
+   * Configuration only.
+   */
+  void   setPeriodic(bool periodic);
+  int    getSize();
+  double getX(int index);
+  double getY(int index);
+  double evaluate(double x);
+
+  /// Value and first and second derivative (dy/dx, d2y/dx2).
+  void   evaluate(double  x,
+                  double *y,
+                  double *dy,
+                  double *ddy);
+
+ private:
+  void   initSpline();
+  void   initPeriodicSpline();
+  int    findSegment(double x);
+
+  ecmcAxisCamInterpType interp_;
+  bool    periodic_;
+  double *x_;
+  double *y_;
+  double *y2_;     // Second derivatives (cubic spline)
+  int     size_;
+  int     index_;  // Segment of last lookup
+};
+
+#endif  /* ECMCAXISCAMTABLE_H_ */
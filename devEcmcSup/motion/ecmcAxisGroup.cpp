@@ -0,0 +1,758 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisGroup.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcAxisGroup.h"
+#include <math.h>
+#include <string.h>
+#include <epicsAtomic.h>
+#include "../main/ecmcErrorsList.h"
+
+ecmcAxisGroup::ecmcAxisGroup(ecmcAsynPortDriver *asynPortDriver,
+                             int                 index,
+                             double              sampleTime) {
+  initVars();
+  asynPortDriver_  = asynPortDriver;
+  index_           = index;
+  sampleTime_      = sampleTime;
+  cmdProducerLock_ = epicsMutexMustCreate();
+  initAsyn();
+}
+
+ecmcAxisGroup::~ecmcAxisGroup() {
+  if (cmdProducerLock_) {
+    epicsMutexDestroy(cmdProducerLock_);
+  }
+  cmdProducerLock_ = NULL;
+}
+
+void ecmcAxisGroup::initVars() {
+  errorReset();
+  asynPortDriver_ = NULL;
+  index_          = 0;
+  sampleTime_     = 1.0 / MCU_FREQUENCY;
+  inRealtime_     = false;
+
+  for (int i = 0; i < ECMC_AXIS_GROUP_MAX_AXES; i++) {
+    axes_[i]     = NULL;
+    startPos_[i] = 0;
+    endPos_[i]   = 0;
+    axisVel_[i]  = 0;
+  }
+  axisCount_      = 0;
+  vel_            = 0;
+  acc_            = 0;
+  dec_            = 0;
+  emergDec_       = 0;
+  jerk_           = 0;
+  pathType_       = ECMC_AXIS_GROUP_PATH_LINEAR;
+  pathLength_     = 0;
+  pathPos_        = 0;
+  pathPosAct_     = 0;
+  profileTime_    = 0;
+  moveVel_        = 0;
+  moveAcc_        = 0;
+  moveDec_        = 0;
+  moveJerk_       = 0;
+  stopping_       = false;
+  stopEmergency_  = false;
+  override_       = 1;
+  overrideTarget_ = 1;
+  busy_           = 0;
+  errorCode_      = 0;
+  overrideCmd_    = 1;
+  asynOverride_   = NULL;
+  asynBusy_       = NULL;
+  asynError_      = NULL;
+  cmdProducerLock_ = NULL;
+}
+
+ecmcAsynDataItem* ecmcAxisGroup::addParam(const char   *name,
+                                          asynParamType type,
+                                          uint8_t      *data,
+                                          size_t        bytes) {
+  char buffer[EC_MAX_OBJECT_PATH_CHAR_LENGTH];
+  unsigned int charCount = snprintf(buffer,
+                                    sizeof(buffer),
+                                    ECMC_AXIS_GROUP_STR "%d.%s",
+                                    index_,
+                                    name);
+
+  if (charCount >= sizeof(buffer) - 1) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Failed to generate param name. Buffer to small (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      ERROR_AXIS_GROUP_ASYN_PAR_BUFFER_OVERFLOW);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_AXIS_GROUP_ASYN_PAR_BUFFER_OVERFLOW);
+    return NULL;
+  }
+
+  ecmcAsynDataItem *paramTemp = asynPortDriver_->addNewAvailParam(
+    buffer,
+    type,
+    data,
+    bytes,
+    type == asynParamFloat64 ? ECMC_EC_F64 : ECMC_EC_S32,
+    0);
+
+  if (!paramTemp) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Add create default parameter for %s failed.\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      buffer);
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_MAIN_ASYN_CREATE_PARAM_FAIL);
+    return NULL;
+  }
+  paramTemp->setAllowWriteToEcmc(false);
+  paramTemp->refreshParam(1);
+  return paramTemp;
+}
+
+int ecmcAxisGroup::initAsyn() {
+  if (!asynPortDriver_) {
+    return 0;
+  }
+
+  asynBusy_ = addParam("busy",
+                       asynParamInt32,
+                       (uint8_t *)&busy_,
+                       sizeof(busy_));
+
+  asynError_ = addParam("error",
+                        asynParamInt32,
+                        (uint8_t *)&errorCode_,
+                        sizeof(errorCode_));
+
+  asynOverride_ = addParam("override",
+                           asynParamFloat64,
+                           (uint8_t *)&overrideCmd_,
+                           sizeof(overrideCmd_));
+
+  if (asynOverride_) {
+    asynOverride_->setAllowWriteToEcmc(true);
+    asynOverride_->setExeCmdFunctPtr(asynWriteOverride, this);
+  }
+  return getErrorID();
+}
+
+asynStatus ecmcAxisGroup::asynWriteOverride(void         *data,
+                                            size_t        bytes,
+                                            asynParamType asynParType,
+                                            void         *userObj) {
+  if (!userObj || (asynParType != asynParamFloat64) ||
+      (bytes != sizeof(double))) {
+    return asynError;
+  }
+
+  if (((ecmcAxisGroup *)userObj)->setOverride(*(double *)data)) {
+    return asynError;
+  }
+  return asynSuccess;
+}
+
+int ecmcAxisGroup::addAxis(ecmcAxisBase *axis) {
+  if (!axis) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_GROUP_AXIS_NULL);
+  }
+
+  if (axisCount_ >= ECMC_AXIS_GROUP_MAX_AXES) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_GROUP_AXIS_LIST_FULL);
+  }
+
+  for (int i = 0; i < axisCount_; i++) {
+    if (axes_[i] == axis) {
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_AXIS_GROUP_AXIS_ALREADY_MEMBER);
+    }
+  }
+
+  // Path is calculated in absolute coordinates
+  if (axis->getModRange() > 0) {
+    LOGERR(
+      "%s/%s:%d: ERROR (group %d): Modulo axis %d not supported (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      index_,
+      axis->getAxisID(),
+      ERROR_AXIS_GROUP_MOD_AXIS_NOT_SUPPORTED);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_GROUP_MOD_AXIS_NOT_SUPPORTED);
+  }
+
+  axes_[axisCount_] = axis;
+  axisCount_++;
+  return 0;
+}
+
+int ecmcAxisGroup::getAxisCount() {
+  return axisCount_;
+}
+
+int ecmcAxisGroup::setVel(double vel) {
+  if (vel <= 0) {
+    return ERROR_AXIS_GROUP_VEL_ACC_INVALID;
+  }
+  epicsMutexLock(cmdProducerLock_);
+  vel_ = vel;
+  epicsMutexUnlock(cmdProducerLock_);
+  return 0;
+}
+
+int ecmcAxisGroup::setAcc(double acc) {
+  if (acc <= 0) {
+    return ERROR_AXIS_GROUP_VEL_ACC_INVALID;
+  }
+  epicsMutexLock(cmdProducerLock_);
+  acc_ = acc;
+  epicsMutexUnlock(cmdProducerLock_);
+  return 0;
+}
+
+int ecmcAxisGroup::setDec(double dec) {
+  if (dec <= 0) {
+    return ERROR_AXIS_GROUP_VEL_ACC_INVALID;
+  }
+  epicsMutexLock(cmdProducerLock_);
+  dec_ = dec;
+  epicsMutexUnlock(cmdProducerLock_);
+  return 0;
+}
+
+int ecmcAxisGroup::setEmergDec(double dec) {
+  if (dec < 0) {
+    return ERROR_AXIS_GROUP_VEL_ACC_INVALID;
+  }
+  epicsMutexLock(cmdProducerLock_);
+  emergDec_ = dec;
+  epicsMutexUnlock(cmdProducerLock_);
+  return 0;
+}
+
+// Jerk 0: trapezoidal path profile
+int ecmcAxisGroup::setJerk(double jerk) {
+  if (jerk < 0) {
+    return ERROR_AXIS_GROUP_VEL_ACC_INVALID;
+  }
+  epicsMutexLock(cmdProducerLock_);
+  jerk_ = jerk;
+  epicsMutexUnlock(cmdProducerLock_);
+  return 0;
+}
+
+int ecmcAxisGroup::validate() {
+  if (axisCount_ == 0) {
+    LOGERR("%s/%s:%d: ERROR (group %d): No axes in group (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index_,
+           ERROR_AXIS_GROUP_AXIS_NULL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_GROUP_AXIS_NULL);
+  }
+  return 0;
+}
+
+void ecmcAxisGroup::setRealTimeStarted(bool realtime) {
+  epicsMutexLock(cmdProducerLock_);
+  inRealtime_ = realtime;
+  epicsMutexUnlock(cmdProducerLock_);
+}
+
+int ecmcAxisGroup::moveLinear(double *positions, int count) {
+  if (!positions || (count != axisCount_)) {
+    return ERROR_AXIS_GROUP_AXIS_COUNT_MISMATCH;
+  }
+
+  ecmcAxisGroupCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = ECMC_AXIS_GROUP_CMD_MOVE_LINEAR;
+
+  for (int i = 0; i < count; i++) {
+    cmd.positions[i] = positions[i];
+  }
+  return queueCmd(&cmd);
+}
+
+int ecmcAxisGroup::moveCircular(int     direction,
+                                double  centerX,
+                                double  centerY,
+                                double *positions,
+                                int     count) {
+  if (!positions || (count != axisCount_)) {
+    return ERROR_AXIS_GROUP_AXIS_COUNT_MISMATCH;
+  }
+
+  if ((axisCount_ < 2) || ((direction != 1) && (direction != -1))) {
+    return ERROR_AXIS_GROUP_CIRCLE_INVALID;
+  }
+
+  ecmcAxisGroupCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type      = ECMC_AXIS_GROUP_CMD_MOVE_CIRCULAR;
+  cmd.direction = direction;
+  cmd.center[0] = centerX;
+  cmd.center[1] = centerY;
+
+  for (int i = 0; i < count; i++) {
+    cmd.positions[i] = positions[i];
+  }
+  return queueCmd(&cmd);
+}
+
+int ecmcAxisGroup::stop() {
+  ecmcAxisGroupCmd cmd;
+
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = ECMC_AXIS_GROUP_CMD_STOP;
+  return queueCmd(&cmd);
+}
+
+int ecmcAxisGroup::setOverride(double override) {
+  if ((override < 0) || (override > 1)) {
+    return ERROR_AXIS_GROUP_OVERRIDE_OUT_OF_RANGE;
+  }
+
+  ecmcAxisGroupCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type     = ECMC_AXIS_GROUP_CMD_SET_OVERRIDE;
+  cmd.override = override;
+  return queueCmd(&cmd);
+}
+
+bool ecmcAxisGroup::getBusy() {
+  return epicsAtomicGetIntT(&busy_) != 0;
+}
+
+// Non realtime: execute command in ecmc_rt (result of moves in error)
+int ecmcAxisGroup::queueCmd(ecmcAxisGroupCmd *cmd) {
+  // Serialize non realtime producers
+  epicsMutexLock(cmdProducerLock_);
+
+  // Dynamics of the move
+  cmd->velocity     = vel_;
+  cmd->acceleration = acc_;
+  cmd->deceleration = dec_;
+  cmd->jerk         = jerk_;
+
+  if (!inRealtime_) {
+    int errorCode = exeCmd(cmd);
+    epicsMutexUnlock(cmdProducerLock_);
+    return errorCode;
+  }
+
+  if (!cmdQueue_.push(cmd)) {
+    epicsMutexUnlock(cmdProducerLock_);
+    LOGERR(
+      "%s/%s:%d: ERROR (group %d): Command queue full (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      index_,
+      ERROR_AXIS_GROUP_CMD_QUEUE_FULL);
+    return ERROR_AXIS_GROUP_CMD_QUEUE_FULL;
+  }
+  epicsMutexUnlock(cmdProducerLock_);
+  return 0;
+}
+
+// Realtime: execute all queued commands
+void ecmcAxisGroup::exeCmdQueue() {
+  ecmcAxisGroupCmd cmd;
+
+  while (cmdQueue_.pop(&cmd)) {
+    exeCmd(&cmd);
+  }
+}
+
+int ecmcAxisGroup::exeCmd(ecmcAxisGroupCmd *cmd) {
+  switch (cmd->type) {
+  case ECMC_AXIS_GROUP_CMD_MOVE_LINEAR:
+  case ECMC_AXIS_GROUP_CMD_MOVE_CIRCULAR:
+    return startMove(cmd);
+
+  case ECMC_AXIS_GROUP_CMD_STOP:
+    if (busy_ && !stopping_) {
+      startStop(false);
+    }
+    return 0;
+
+  case ECMC_AXIS_GROUP_CMD_SET_OVERRIDE:
+    overrideTarget_ = cmd->override;
+    return 0;
+  }
+  return 0;
+}
+
+int ecmcAxisGroup::startMove(ecmcAxisGroupCmd *cmd) {
+  if (busy_) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_GROUP_BUSY);
+  }
+
+  double emergDec = emergDec_ > 0 ? emergDec_ : cmd->deceleration;
+
+  if ((cmd->velocity <= 0) || (cmd->acceleration <= 0) ||
+      (cmd->deceleration <= 0)) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_AXIS_GROUP_VEL_ACC_INVALID);
+  }
+
+  for (int i = 0; i < axisCount_; i++) {
+    if (!axes_[i]->getGroupReady()) {
+      LOGERR(
+        "%s/%s:%d: ERROR (group %d): Axis %d not ready (enabled, idle, internal trajectory) (0x%x).\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        index_,
+        axes_[i]->getAxisID(),
+        ERROR_AXIS_GROUP_AXIS_NOT_READY);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_AXIS_GROUP_AXIS_NOT_READY);
+    }
+  }
+
+  // Start at current setpoints
+  for (int i = 0; i < axisCount_; i++) {
+    axes_[i]->setGroupActive(true);
+    startPos_[i] = axes_[i]->getGroupPosSet();
+    endPos_[i]   = cmd->positions[i];
+    axisVel_[i]  = 0;
+  }
+
+  int errorCode = 0;
+
+  if (cmd->type == ECMC_AXIS_GROUP_CMD_MOVE_CIRCULAR) {
+    pathType_ = ECMC_AXIS_GROUP_PATH_CIRCULAR;
+    errorCode = initCircle(cmd);
+  } else {
+    pathType_ = ECMC_AXIS_GROUP_PATH_LINEAR;
+    double sum = 0;
+
+    for (int i = 0; i < axisCount_; i++) {
+      sum += (endPos_[i] - startPos_[i]) * (endPos_[i] - startPos_[i]);
+    }
+    pathLength_ = sqrt(sum);
+  }
+
+  moveVel_  = cmd->velocity;
+  moveAcc_  = cmd->acceleration;
+  moveDec_  = cmd->deceleration;
+  // Jerk 0: reach acceleration within one sample (trapezoidal)
+  moveJerk_ = cmd->jerk > 0 ? cmd->jerk :
+              fmax(fmax(moveAcc_, moveDec_), emergDec) / sampleTime_;
+
+  if (!errorCode) {
+    errorCode = checkSoftLimits();
+  }
+
+  if (!errorCode && (pathLength_ > 0)) {
+    errorCode = profile_.planPos(pathLength_,
+                                 0,
+                                 0,
+                                 moveVel_,
+                                 moveAcc_,
+                                 moveDec_,
+                                 moveJerk_);
+  }
+
+  if (errorCode || (pathLength_ <= 0)) {
+    for (int i = 0; i < axisCount_; i++) {
+      axes_[i]->setGroupActive(false);
+    }
+
+    if (errorCode) {
+      return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+    }
+    return 0;  // Already at end position
+  }
+
+  pathPos_       = 0;
+  pathPosAct_    = 0;
+  profileTime_   = 0;
+  stopping_      = false;
+  stopEmergency_ = false;
+  errorReset();
+  epicsAtomicSetIntT(&busy_, 1);
+  return 0;
+}
+
+/*
+ * Arc in the plane of the first two axes (see ecmcAxisGroupArc).
+ */
+int ecmcAxisGroup::initCircle(ecmcAxisGroupCmd *cmd) {
+  if (arc_.init(cmd->center, startPos_, endPos_, cmd->direction)) {
+    LOGERR(
+      "%s/%s:%d: ERROR (group %d): Start and end not on circle (r=%lf, r=%lf) (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      index_,
+      arc_.getRadiusStart(),
+      arc_.getRadiusEnd(),
+      ERROR_AXIS_GROUP_CIRCLE_INVALID);
+    return ERROR_AXIS_GROUP_CIRCLE_INVALID;
+  }
+
+  double arc = arc_.getLength();
+  double sum = arc * arc;
+
+  for (int i = 2; i < axisCount_; i++) {
+    sum += (endPos_[i] - startPos_[i]) * (endPos_[i] - startPos_[i]);
+  }
+  pathLength_ = sqrt(sum);
+  return 0;
+}
+
+/*
+ * End positions and, for circular moves, the bounds of the arc within the
+ * enabled soft limits.
+ */
+int ecmcAxisGroup::checkSoftLimits() {
+  for (int i = 0; i < axisCount_; i++) {
+    if (!getWithinSoftLimits(i, endPos_[i])) {
+      LOGERR(
+        "%s/%s:%d: ERROR (group %d): End position %lf of axis %d outside soft limits (0x%x).\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        index_,
+        endPos_[i],
+        axes_[i]->getAxisID(),
+        ERROR_AXIS_GROUP_SOFT_LIMIT);
+      return ERROR_AXIS_GROUP_SOFT_LIMIT;
+    }
+  }
+
+  if (pathType_ != ECMC_AXIS_GROUP_PATH_CIRCULAR) {
+    return 0;
+  }
+
+  double min[2], max[2];
+
+  arc_.getBounds(min, max);
+
+  for (int i = 0; i < 2; i++) {
+    if (!getWithinSoftLimits(i, min[i]) || !getWithinSoftLimits(i, max[i])) {
+      LOGERR(
+        "%s/%s:%d: ERROR (group %d): Arc of axis %d (%lf..%lf) outside soft limits (0x%x).\n",
+        __FILE__,
+        __FUNCTION__,
+        __LINE__,
+        index_,
+        axes_[i]->getAxisID(),
+        min[i],
+        max[i],
+        ERROR_AXIS_GROUP_SOFT_LIMIT);
+      return ERROR_AXIS_GROUP_SOFT_LIMIT;
+    }
+  }
+  return 0;
+}
+
+bool ecmcAxisGroup::getWithinSoftLimits(int axis, double pos) {
+  ecmcMonitor *mon = axes_[axis]->getMon();
+
+  if (mon->getEnableSoftLimitBwd() && (pos < mon->getSoftLimitBwd())) {
+    return false;
+  }
+
+  if (mon->getEnableSoftLimitFwd() && (pos > mon->getSoftLimitFwd())) {
+    return false;
+  }
+  return true;
+}
+
+/*
+ * Stop along the path. The current (override scaled) path velocity is the
+ * start of the stop profile, override is not applied while stopping.
+ */
+void ecmcAxisGroup::startStop(bool emergency) {
+  double pos = 0, vel = 0, acc = 0;
+  double scale = stopping_ ? 1 : override_;
+
+  profile_.evaluate(profileTime_, &pos, &vel, &acc);
+  vel *= scale;
+  acc *= scale * scale;
+
+  double dec = moveDec_;
+
+  if (emergency) {
+    dec = emergDec_ > 0 ? emergDec_ : moveDec_;
+  }
+
+  pathPos_     = pathPosAct_;
+  profileTime_ = 0;
+  stopping_    = true;
+  stopEmergency_ = emergency;
+
+  if (profile_.planStop(vel, acc, dec, moveJerk_)) {
+    // Not possible to plan: stop immediately
+    profile_.planStop(0, 0, dec, moveJerk_);
+  }
+}
+
+void ecmcAxisGroup::checkInterlocks() {
+  bool interlock = false;
+  bool emergency = false;
+
+  for (int i = 0; i < axisCount_; i++) {
+    stopMode mode = axes_[i]->getGroupInterlock(axisVel_[i]);
+
+    if (mode != ECMC_STOP_MODE_RUN) {
+      interlock = true;
+
+      if (mode == ECMC_STOP_MODE_EMERGENCY) {
+        emergency = true;
+      }
+    }
+  }
+
+  if (!interlock || (stopping_ && (stopEmergency_ || !emergency))) {
+    return;
+  }
+
+  setErrorID(__FILE__, __FUNCTION__, __LINE__, ERROR_AXIS_GROUP_INTERLOCK);
+  startStop(emergency);
+}
+
+// Ramp override (limits the added path acceleration to the acceleration)
+void ecmcAxisGroup::refreshOverride() {
+  double step = fmin(moveAcc_, moveDec_) / moveVel_ * sampleTime_;
+  double diff = overrideTarget_ - override_;
+
+  if (diff > step) {
+    diff = step;
+  } else if (diff < -step) {
+    diff = -step;
+  }
+  override_ += diff;
+}
+
+void ecmcAxisGroup::writeSetpoints(double pathPos, double pathVel) {
+  double fraction = pathPos / pathLength_;
+  double fractionVel = pathVel / pathLength_;
+  double arcPos[2], arcVel[2];
+
+  if (pathType_ == ECMC_AXIS_GROUP_PATH_CIRCULAR) {
+    arc_.evaluate(fraction, fractionVel, arcPos, arcVel);
+  }
+
+  for (int i = 0; i < axisCount_; i++) {
+    double pos = startPos_[i] + (endPos_[i] - startPos_[i]) * fraction;
+    double vel = (endPos_[i] - startPos_[i]) * fractionVel;
+
+    if ((pathType_ == ECMC_AXIS_GROUP_PATH_CIRCULAR) && (i < 2)) {
+      pos = arcPos[i];
+      vel = arcVel[i];
+    }
+
+    if (fraction >= 1) {
+      pos = endPos_[i];
+    }
+    axisVel_[i] = vel;
+    axes_[i]->setGroupSetpoint(pos, vel);
+  }
+}
+
+void ecmcAxisGroup::endMove() {
+  for (int i = 0; i < axisCount_; i++) {
+    axisVel_[i] = 0;
+    axes_[i]->setGroupActive(false);
+  }
+  stopping_      = false;
+  stopEmergency_ = false;
+  epicsAtomicSetIntT(&busy_, 0);
+}
+
+/*
+* Realtime (ecmc_rt, before the axes are executed)
+*/
+void ecmcAxisGroup::execute() {
+  exeCmdQueue();
+
+  if (busy_) {
+    checkInterlocks();
+    refreshOverride();
+
+    double scale = stopping_ ? 1 : override_;
+    double pos = 0, vel = 0, acc = 0;
+
+    profileTime_ += scale * sampleTime_;
+    profile_.evaluate(profileTime_, &pos, &vel, &acc);
+
+    bool done = profileTime_ >= profile_.getDuration();
+
+    pathPosAct_ = pathPos_ + pos;
+
+    if (done && !stopping_) {
+      pathPosAct_ = pathLength_;
+    }
+
+    if (pathPosAct_ > pathLength_) {
+      pathPosAct_ = pathLength_;
+    } else if (pathPosAct_ < 0) {
+      pathPosAct_ = 0;
+    }
+
+    writeSetpoints(pathPosAct_, done ? 0 : vel * scale);
+
+    if (done) {
+      endMove();
+    }
+  } else {
+    override_ = overrideTarget_;
+  }
+
+  errorCode_   = getErrorID();
+  overrideCmd_ = override_;
+
+  if (asynBusy_) {
+    asynBusy_->refreshParamRT(0);
+  }
+
+  if (asynError_) {
+    asynError_->refreshParamRT(0);
+  }
+
+  if (asynOverride_) {
+    asynOverride_->refreshParamRT(0);
+  }
+}
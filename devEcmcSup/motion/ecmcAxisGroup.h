@@ -0,0 +1,201 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisGroup.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCAXISGROUP_H_
+#define ECMCAXISGROUP_H_
+
+#include <epicsMutex.h>
+#include "../main/ecmcDefinitions.h"
+#include "../main/ecmcError.h"
+#include "../main/ecmcRtHandoff.h"
+#include "../com/ecmcAsynPortDriver.h"
+#include "../com/ecmcAsynDataItem.h"
+#include "ecmcAxisBase.h"
+#include "ecmcTrajectorySCurve.h"
+#include "ecmcAxisGroupArc.h"
+
+#define ERROR_AXIS_GROUP_AXIS_NULL 0x14700
+#define ERROR_AXIS_GROUP_AXIS_LIST_FULL 0x14701
+#define ERROR_AXIS_GROUP_AXIS_ALREADY_MEMBER 0x14702
+#define ERROR_AXIS_GROUP_AXIS_COUNT_MISMATCH 0x14703
+#define ERROR_AXIS_GROUP_BUSY 0x14704
+#define ERROR_AXIS_GROUP_AXIS_NOT_READY 0x14705
+#define ERROR_AXIS_GROUP_VEL_ACC_INVALID 0x14707
+#define ERROR_AXIS_GROUP_INTERLOCK 0x14708
+#define ERROR_AXIS_GROUP_CMD_QUEUE_FULL 0x14709
+#define ERROR_AXIS_GROUP_MOD_AXIS_NOT_SUPPORTED 0x1470A
+#define ERROR_AXIS_GROUP_ASYN_PAR_BUFFER_OVERFLOW 0x1470B
+#define ERROR_AXIS_GROUP_OVERRIDE_OUT_OF_RANGE 0x1470C
+#define ERROR_AXIS_GROUP_SOFT_LIMIT 0x1470D
+
+enum ecmcAxisGroupPathType {
+  ECMC_AXIS_GROUP_PATH_LINEAR   = 0,
+  ECMC_AXIS_GROUP_PATH_CIRCULAR = 1,
+};
+
+enum ecmcAxisGroupCmdType {
+  ECMC_AXIS_GROUP_CMD_MOVE_LINEAR   = 0,
+  ECMC_AXIS_GROUP_CMD_MOVE_CIRCULAR = 1,
+  ECMC_AXIS_GROUP_CMD_STOP          = 2,
+  ECMC_AXIS_GROUP_CMD_SET_OVERRIDE  = 3,
+};
+
+/**
+ * Command from non realtime to an axis group (executed in ecmc_rt).
+ * Dynamics are copied when the command is queued.
+ */
+typedef struct {
+  ecmcAxisGroupCmdType type;
+  int                  direction;   // Circular: 1 = ccw, -1 = cw
+  double               center[2];   // Circular: center (first two axes)
+  double               positions[ECMC_AXIS_GROUP_MAX_AXES];
+  double               velocity;
+  double               acceleration;
+  double               deceleration;
+  double               jerk;
+  double               override;
+} ecmcAxisGroupCmd;
+
+/**
+ * \class ecmcAxisGroup
+ *
+ * \brief Coordinated linear and circular interpolation of several axes
+ *
+ * One jerk limited profile (ecmcTrajectorySCurve) is planned for the path
+ * length. Each cycle the path position is mapped to the position setpoint
+ * of all member axes (written directly to the axes, the trajectory of each
+ * axis is bypassed while the group is active).
+ *
+ * Linear moves: all axes move on a straight line to the end positions.
+ * Circular moves: the first two axes move on an arc around a center
+ * (end equal to start results in a full circle). Any other axes move
+ * linear with the path fraction (helix).
+ *
+ * Moves are rejected if the end point or the arc (start included) of any
+ * member axis is outside its enabled soft limits.
+ *
+ * The path feed rate can be scaled with an override (0..1) at any time
+ * (ramped so that the path acceleration limit is respected).
+ * If any member axis gets an interlock in its direction of motion, loses
+ * enable or gets an error, all axes are stopped together along the path.
+ *
+ * Executed in ecmc_rt before the axes (setpoints valid in the same cycle).
+ */
+class ecmcAxisGroup : public ecmcError {
+ public:
+  ecmcAxisGroup(ecmcAsynPortDriver *asynPortDriver,
+                int                 index,
+                double              sampleTime);
+  ~ecmcAxisGroup();
+
+  // Configuration
+  int  addAxis(ecmcAxisBase *axis);
+  int  getAxisCount();
+  int  setVel(double vel);
+  int  setAcc(double acc);
+  int  setDec(double dec);
+  int  setEmergDec(double dec);
+  int  setJerk(double jerk);
+  int  validate();
+  void setRealTimeStarted(bool realtime);
+
+  // Non realtime: commands executed in ecmc_rt (thread safe)
+  int  moveLinear(double *positions,
+                  int     count);
+  int  moveCircular(int     direction,
+                    double  centerX,
+                    double  centerY,
+                    double *positions,
+                    int     count);
+  int  stop();
+  int  setOverride(double override);
+  bool getBusy();
+
+  // Realtime
+  void execute();
+  static asynStatus asynWriteOverride(void         *data,
+                                      size_t        bytes,
+                                      asynParamType asynParType,
+                                      void         *userObj);
+
+ private:
+  void initVars();
+  int  initAsyn();
+  ecmcAsynDataItem* addParam(const char   *name,
+                             asynParamType type,
+                             uint8_t      *data,
+                             size_t        bytes);
+  int  queueCmd(ecmcAxisGroupCmd *cmd);
+  int  exeCmd(ecmcAxisGroupCmd *cmd);
+  void exeCmdQueue();
+  int  startMove(ecmcAxisGroupCmd *cmd);
+  int  initCircle(ecmcAxisGroupCmd *cmd);
+  int  checkSoftLimits();
+  bool getWithinSoftLimits(int    axis,
+                           double pos);
+  void startStop(bool emergency);
+  void checkInterlocks();
+  void refreshOverride();
+  void writeSetpoints(double pathPos,
+                      double pathVel);
+  void endMove();
+
+  ecmcAsynPortDriver *asynPortDriver_;
+  int    index_;
+  double sampleTime_;
+  bool   inRealtime_;
+
+  ecmcAxisBase *axes_[ECMC_AXIS_GROUP_MAX_AXES];
+  int    axisCount_;
+
+  // Dynamics for next move
+  double vel_;
+  double acc_;
+  double dec_;
+  double emergDec_;
+  double jerk_;
+
+  // Active move
+  ecmcTrajectorySCurve profile_;
+  ecmcAxisGroupPathType pathType_;
+  double startPos_[ECMC_AXIS_GROUP_MAX_AXES];
+  double endPos_[ECMC_AXIS_GROUP_MAX_AXES];
+  double axisVel_[ECMC_AXIS_GROUP_MAX_AXES];
+  ecmcAxisGroupArc arc_;
+  double pathLength_;
+  double pathPos_;    // Path position at start of profile (after stop)
+  double pathPosAct_;
+  double profileTime_;
+  double moveVel_;
+  double moveAcc_;
+  double moveDec_;
+  double moveJerk_;
+  bool   stopping_;
+  bool   stopEmergency_;
+
+  // Feed rate override (profile time scale)
+  double override_;
+  double overrideTarget_;
+
+  // Asyn (status written in ecmc_rt)
+  int32_t busy_;
+  int32_t errorCode_;
+  double  overrideCmd_;
+  ecmcAsynDataItem *asynOverride_;
+  ecmcAsynDataItem *asynBusy_;
+  ecmcAsynDataItem *asynError_;
+
+  // Handoff from non realtime
+  ecmcRtCmdQueue<ecmcAxisGroupCmd, ECMC_AXIS_GROUP_CMD_QUEUE_SIZE> cmdQueue_;
+  epicsMutexId cmdProducerLock_;
+};
+
+#endif  /* ECMCAXISGROUP_H_ */
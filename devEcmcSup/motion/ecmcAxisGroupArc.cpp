@@ -0,0 +1,189 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisGroupArc.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcAxisGroupArc.h"
+#include <math.h>
+
+// Iterations for extremes with radius change (resolution sweep/2^50)
+#define ECMC_AXIS_GROUP_ARC_EXTREME_ITERATIONS 50
+
+ecmcAxisGroupArc::ecmcAxisGroupArc() {
+  center_[0]   = 0;
+  center_[1]   = 0;
+  start_[0]    = 0;
+  start_[1]    = 0;
+  end_[0]      = 0;
+  end_[1]      = 0;
+  radiusStart_ = 0;
+  radiusEnd_   = 0;
+  startAngle_  = 0;
+  sweep_       = 0;
+}
+
+ecmcAxisGroupArc::~ecmcAxisGroupArc() {}
+
+int ecmcAxisGroupArc::init(const double *center,
+                           const double *start,
+                           const double *end,
+                           int           direction) {
+  center_[0] = center[0];
+  center_[1] = center[1];
+  start_[0]  = start[0];
+  start_[1]  = start[1];
+  end_[0]    = end[0];
+  end_[1]    = end[1];
+
+  double x0 = start[0] - center_[0];
+  double y0 = start[1] - center_[1];
+  double x1 = end[0] - center_[0];
+  double y1 = end[1] - center_[1];
+
+  radiusStart_ = sqrt(x0 * x0 + y0 * y0);
+  radiusEnd_   = sqrt(x1 * x1 + y1 * y1);
+  sweep_       = 0;
+
+  if ((radiusStart_ <= 0) ||
+      (fabs(radiusEnd_ - radiusStart_) >
+       ECMC_AXIS_GROUP_RADIUS_TOL * radiusStart_) ||
+      ((direction != 1) && (direction != -1))) {
+    return ERROR_AXIS_GROUP_CIRCLE_INVALID;
+  }
+
+  startAngle_ = atan2(y0, x0);
+  double sweep = direction * (atan2(y1, x1) - startAngle_);
+
+  // Full circle if end equals start (to the exact end angle)
+  if (sqrt((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0)) <=
+      ECMC_AXIS_GROUP_RADIUS_TOL * radiusStart_) {
+    sweep = 2 * M_PI + remainder(sweep, 2 * M_PI);
+  } else {
+    while (sweep <= 0) {
+      sweep += 2 * M_PI;
+    }
+
+    while (sweep > 2 * M_PI) {
+      sweep -= 2 * M_PI;
+    }
+  }
+  sweep_ = direction * sweep;
+  return 0;
+}
+
+/*
+ * Length in the plane (mean radius and radius change), the speed along the
+ * arc is at most the max/mean radius ratio above the path speed.
+ */
+double ecmcAxisGroupArc::getLength() {
+  double arc = 0.5 * (radiusStart_ + radiusEnd_) * sweep_;
+
+  return sqrt(arc * arc +
+              (radiusEnd_ - radiusStart_) * (radiusEnd_ - radiusStart_));
+}
+
+double ecmcAxisGroupArc::getRadiusStart() {
+  return radiusStart_;
+}
+
+double ecmcAxisGroupArc::getRadiusEnd() {
+  return radiusEnd_;
+}
+
+void ecmcAxisGroupArc::evaluate(double  fraction,
+                                double  fractionVel,
+                                double *pos,
+                                double *vel) {
+  double angle     = startAngle_ + sweep_ * fraction;
+  double radius    = radiusStart_ + (radiusEnd_ - radiusStart_) * fraction;
+  double radiusVel = (radiusEnd_ - radiusStart_) * fractionVel;
+  double angleVel  = sweep_ * fractionVel;
+
+  pos[0] = center_[0] + radius * cos(angle);
+  pos[1] = center_[1] + radius * sin(angle);
+  vel[0] = radiusVel * cos(angle) - radius * sin(angle) * angleVel;
+  vel[1] = radiusVel * sin(angle) + radius * cos(angle) * angleVel;
+}
+
+/*
+ * Start, end and the extremes where the arc crosses an axis direction
+ * within the sweep (between these points the arc is monotonic in x and y).
+ * With a radius change (slope k = dr/dangle) an extreme is within
+ * atan(k/r) of a crossing.
+ */
+void ecmcAxisGroupArc::getBounds(double *min, double *max) {
+  double sweep = fabs(sweep_);
+
+  for (int i = 0; i < 2; i++) {
+    min[i] = fmin(start_[i], end_[i]);
+    max[i] = fmax(start_[i], end_[i]);
+  }
+
+  if (sweep <= 0) {
+    return;
+  }
+
+  double slope  = (radiusEnd_ - radiusStart_) / sweep;
+  double margin = atan(fabs(slope) / fmin(radiusStart_, radiusEnd_));
+
+  for (int k = 0; k < 4; k++) {
+    double angle = k * M_PI / 2;
+    int    axis  = k % 2;
+
+    // Angle from start in direction of motion [0..2pi[
+    double delta = fmod(sweep_ > 0 ? angle - startAngle_ :
+                        startAngle_ - angle, 2 * M_PI);
+
+    if (delta < 0) {
+      delta += 2 * M_PI;
+    }
+
+    // Crossing in the previous, this and next turn (full circles)
+    for (int turn = -1; turn <= 1; turn++) {
+      double crossing = delta + turn * 2 * M_PI;
+
+      if ((crossing + margin < 0) || (crossing - margin > sweep)) {
+        continue;
+      }
+
+      double pos = center_[axis] + getExtreme(crossing, margin) *
+                   (axis == 0 ? cos(angle) : sin(angle));
+
+      min[axis] = fmin(min[axis], pos);
+      max[axis] = fmax(max[axis], pos);
+    }
+  }
+}
+
+/*
+ * Max distance from the center in the direction of a crossing at the angle
+ * delta from start: r(u) * cos(u - delta) for the angle u from start within
+ * the sweep. The derivative has one zero within the margin (bisection).
+ */
+double ecmcAxisGroupArc::getExtreme(double delta, double margin) {
+  double sweep = fabs(sweep_);
+  double slope = (radiusEnd_ - radiusStart_) / sweep;
+  double low   = fmax(0, delta - margin);
+  double high  = fmin(sweep, delta + margin);
+
+  for (int i = 0; i < ECMC_AXIS_GROUP_ARC_EXTREME_ITERATIONS; i++) {
+    double mid = (low + high) / 2;
+
+    if (slope * cos(mid - delta) -
+        (radiusStart_ + slope * mid) * sin(mid - delta) > 0) {
+      low = mid;
+    } else {
+      high = mid;
+    }
+  }
+
+  double u = (low + high) / 2;
+
+  return (radiusStart_ + slope * u) * cos(u - delta);
+}
@@ -0,0 +1,71 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisGroupArc.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCAXISGROUPARC_H_
+#define ECMCAXISGROUPARC_H_
+
+#define ERROR_AXIS_GROUP_CIRCLE_INVALID 0x14706
+
+// Relative tolerance of start and end radius of a circular move
+#define ECMC_AXIS_GROUP_RADIUS_TOL 1e-3
+
+/**
+ * \class ecmcAxisGroupArc
+ *
+ * \brief Geometry of the arc of a circular axis group move
+ *
+ * Arc in a plane (x, y) around a center from a start to an end point,
+ * direction 1 = ccw and -1 = cw. End equal to start (within tolerance)
+ * results in a full circle that ends exactly at the end point. The radius
+ * is interpolated linearly from start to end radius (small differences
+ * allowed). Positions are evaluated for a path fraction 0..1.
+ *
+ * Plain geometry without EPICS dependencies (see tools/check).
+ */
+class ecmcAxisGroupArc {
+ public:
+  ecmcAxisGroupArc();
+  ~ecmcAxisGroupArc();
+
+  int    init(const double *center,
+              const double *start,
+              const double *end,
+              int           direction);
+  double getLength();
+  double getRadiusStart();
+  double getRadiusEnd();
+
+  /** \brief Position and velocity (x, y) at a path fraction.
+   * The velocity is for a path fraction velocity fractionVel.
+   */
+  void   evaluate(double  fraction,
+                  double  fractionVel,
+                  double *pos,
+                  double *vel);
+
+  /// Bounds (x, y) of the arc (start and end included).
+  void   getBounds(double *min,
+                   double *max);
+
+ private:
+  double getExtreme(double delta,
+                    double margin);
+
+  double center_[2];
+  double start_[2];
+  double end_[2];
+  double radiusStart_;
+  double radiusEnd_;
+  double startAngle_;
+  double sweep_;      // Signed angle of arc [rad]
+};
+
+#endif  /* ECMCAXISGROUPARC_H_ */
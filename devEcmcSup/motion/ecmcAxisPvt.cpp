@@ -0,0 +1,304 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisPvt.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcAxisPvt.h"
+#include <cmath>
+#include <epicsAtomic.h>
+#include "ecmcAxisBase.h"
+
+ecmcAxisPvt::ecmcAxisPvt(ecmcAxisBase *axis,
+                         double        sampleTime) {
+  initVars();
+  axis_         = axis;
+  sampleTime_   = sampleTime;
+  producerLock_ = epicsMutexMustCreate();
+}
+
+ecmcAxisPvt::~ecmcAxisPvt() {
+  if (producerLock_) {
+    epicsMutexDestroy(producerLock_);
+  }
+  producerLock_ = NULL;
+}
+
+void ecmcAxisPvt::initVars() {
+  errorReset();
+  axis_          = NULL;
+  sampleTime_    = 0;
+  time_          = 0;
+  pos_           = 0;
+  vel_           = 0;
+  stopDec_       = 0;
+  stopping_      = false;
+  active_        = 0;
+  startRequest_  = 0;
+  stopRequest_   = 0;
+  clearRequest_  = 0;
+  producerLock_  = NULL;
+}
+
+int ecmcAxisPvt::setBufferSize(int points) {
+  if ((points <= 0) || (points > ECMC_AXIS_PVT_BUFFER_MAX_POINTS)) {
+    LOGERR("%s/%s:%d: ERROR: PVT buffer size %d out of range 1..%d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           points,
+           ECMC_AXIS_PVT_BUFFER_MAX_POINTS,
+           ERROR_AXIS_PVT_BUFFER_SIZE_INVALID);
+    return ERROR_AXIS_PVT_BUFFER_SIZE_INVALID;
+  }
+
+  epicsMutexLock(producerLock_);
+  buffer_.init(points);
+  epicsMutexUnlock(producerLock_);
+  return 0;
+}
+
+int ecmcAxisPvt::getBufferSize() {
+  return (int)buffer_.getSize();
+}
+
+/*
+ * Add points (ECMC_AXIS_PVT_POINT_VALUES values each: position, velocity,
+ * time). Points are added until the first failure.
+ */
+int ecmcAxisPvt::addPoints(double *values, int pointCount) {
+  if (buffer_.getSize() == 0) {
+    LOGERR("%s/%s:%d: ERROR: PVT buffer not allocated (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_AXIS_PVT_BUFFER_SIZE_INVALID);
+    return ERROR_AXIS_PVT_BUFFER_SIZE_INVALID;
+  }
+
+  int errorCode = 0;
+
+  epicsMutexLock(producerLock_);
+
+  for (int i = 0; i < pointCount; i++) {
+    ecmcAxisPvtPoint point;
+    point.position = values[0];
+    point.velocity = values[1];
+    point.time     = values[2];
+
+    if (!(point.time > 0) || !std::isfinite(point.position) ||
+        !std::isfinite(point.velocity)) {
+      errorCode = ERROR_AXIS_PVT_POINT_INVALID;
+      break;
+    }
+
+    if (!buffer_.push(&point)) {
+      errorCode = ERROR_AXIS_PVT_BUFFER_FULL;
+      break;
+    }
+    values += ECMC_AXIS_PVT_POINT_VALUES;
+  }
+  epicsMutexUnlock(producerLock_);
+
+  if (errorCode) {
+    LOGERR("%s/%s:%d: ERROR: Failed to add PVT point (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           errorCode);
+  }
+  return errorCode;
+}
+
+void ecmcAxisPvt::start() {
+  epicsAtomicSetIntT(&startRequest_, 1);
+}
+
+void ecmcAxisPvt::stop() {
+  epicsAtomicSetIntT(&stopRequest_, 1);
+}
+
+// Remove all points not yet started (and stop)
+void ecmcAxisPvt::clear() {
+  epicsAtomicSetIntT(&clearRequest_, 1);
+}
+
+int ecmcAxisPvt::getFree() {
+  return (int)buffer_.getFree();
+}
+
+// Points not yet started
+int ecmcAxisPvt::getCount() {
+  return (int)buffer_.getCount();
+}
+
+bool ecmcAxisPvt::getActive() {
+  return epicsAtomicGetIntT(&active_) != 0;
+}
+
+void ecmcAxisPvt::execute() {
+  if (buffer_.getSize() == 0) {
+    return;
+  }
+
+  if (epicsAtomicCmpAndSwapIntT(&clearRequest_, 1, 0)) {
+    ecmcAxisPvtPoint point;
+
+    while (buffer_.pop(&point)) {}
+
+    if (active_ && !stopping_) {
+      startStop();
+    }
+  }
+
+  if (epicsAtomicCmpAndSwapIntT(&stopRequest_, 1, 0)) {
+    if (active_ && !stopping_) {
+      startStop();
+    }
+  }
+
+  if (epicsAtomicCmpAndSwapIntT(&startRequest_, 1, 0)) {
+    if (!active_) {
+      startTable();
+    }
+  }
+
+  if (!active_) {
+    return;
+  }
+
+  if (stopping_) {
+    executeStop();
+  } else {
+    executeTable();
+  }
+
+  if (!active_) {
+    return;
+  }
+
+  // Axis can not follow a stop ramp (disabled or in error)
+  if (axis_->getGroupFault()) {
+    setErrorID(__FILE__, __FUNCTION__, __LINE__, ERROR_AXIS_PVT_INTERLOCK);
+    endTable();
+    return;
+  }
+
+  // Ramped down with emergency deceleration (any stop mode)
+  stopMode mode = axis_->getGroupInterlock(vel_);
+
+  if ((mode != ECMC_STOP_MODE_RUN) && !stopping_) {
+    setErrorID(__FILE__, __FUNCTION__, __LINE__, ERROR_AXIS_PVT_INTERLOCK);
+    startStop();
+
+    if (!active_) {
+      return;
+    }
+  }
+
+  axis_->setGroupSetpoint(pos_, vel_);
+}
+
+void ecmcAxisPvt::startTable() {
+  ecmcAxisPvtPoint point;
+
+  if (buffer_.getCount() == 0) {
+    setErrorID(__FILE__, __FUNCTION__, __LINE__, ERROR_AXIS_PVT_BUFFER_EMPTY);
+    return;
+  }
+
+  if (axis_->getModRange() > 0) {
+    setErrorID(__FILE__,
+               __FUNCTION__,
+               __LINE__,
+               ERROR_AXIS_PVT_MOD_AXIS_NOT_SUPPORTED);
+    return;
+  }
+
+  if (!axis_->getGroupReady()) {
+    setErrorID(__FILE__, __FUNCTION__, __LINE__, ERROR_AXIS_PVT_AXIS_NOT_READY);
+    return;
+  }
+
+  buffer_.pop(&point);
+  errorReset();
+  axis_->setGroupActive(true);
+  pos_      = axis_->getGroupPosSet();
+  vel_      = 0;
+  time_     = 0;
+  stopping_ = false;
+  segment_.init(pos_, vel_, point.position, point.velocity, point.time);
+  epicsAtomicSetIntT(&active_, 1);
+}
+
+void ecmcAxisPvt::executeTable() {
+  time_ += sampleTime_;
+
+  while (time_ >= segment_.getTime()) {
+    ecmcAxisPvtPoint point;
+
+    time_ -= segment_.getTime();
+
+    if (!buffer_.pop(&point)) {
+      pos_ = segment_.getEndPos();
+      vel_ = segment_.getEndVel();
+
+      if (vel_ == 0) {
+        endTable();
+        return;
+      }
+      setErrorID(__FILE__,
+                 __FUNCTION__,
+                 __LINE__,
+                 ERROR_AXIS_PVT_BUFFER_UNDERRUN);
+      startStop();
+      return;
+    }
+    segment_.init(segment_.getEndPos(), segment_.getEndVel(), point.position,
+                  point.velocity, point.time);
+  }
+
+  double acc = 0;
+
+  segment_.evaluate(time_, &pos_, &vel_, &acc);
+}
+
+void ecmcAxisPvt::startStop() {
+  stopping_ = true;
+  stopDec_  = std::abs(axis_->getTraj()->getEmergDec());
+
+  if (stopDec_ <= 0) {
+    vel_ = 0;
+    endTable();
+  }
+}
+
+void ecmcAxisPvt::executeStop() {
+  double velStep = stopDec_ * sampleTime_;
+
+  if (std::abs(vel_) <= velStep) {
+    pos_ += vel_ * sampleTime_ / 2;
+    vel_  = 0;
+    endTable();
+    return;
+  }
+
+  double velNew = vel_ > 0 ? vel_ - velStep : vel_ + velStep;
+
+  pos_ += (vel_ + velNew) / 2 * sampleTime_;
+  vel_  = velNew;
+}
+
+// Hand over to the trajectory of the axis at the last setpoint
+void ecmcAxisPvt::endTable() {
+  axis_->setGroupSetpoint(pos_, 0);
+  axis_->setGroupActive(false);
+  vel_      = 0;
+  stopping_ = false;
+  epicsAtomicSetIntT(&active_, 0);
+}
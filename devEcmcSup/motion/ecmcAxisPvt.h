@@ -0,0 +1,122 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisPvt.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCAXISPVT_H_
+#define ECMCAXISPVT_H_
+
+#include <epicsMutex.h>
+#include "../main/ecmcDefinitions.h"
+#include "../main/ecmcError.h"
+#include "../main/ecmcRtHandoff.h"
+#include "ecmcAxisPvtSegment.h"
+
+#define ERROR_AXIS_PVT_BUFFER_SIZE_INVALID 0x14900
+#define ERROR_AXIS_PVT_BUFFER_FULL 0x14901
+#define ERROR_AXIS_PVT_BUFFER_EMPTY 0x14902
+#define ERROR_AXIS_PVT_BUFFER_UNDERRUN 0x14903
+#define ERROR_AXIS_PVT_POINT_INVALID 0x14904
+#define ERROR_AXIS_PVT_AXIS_NOT_READY 0x14905
+#define ERROR_AXIS_PVT_INTERLOCK 0x14906
+#define ERROR_AXIS_PVT_MOD_AXIS_NOT_SUPPORTED 0x14907
+
+// Values per point (position, velocity, time)
+#define ECMC_AXIS_PVT_POINT_VALUES 3
+#define ECMC_AXIS_PVT_BUFFER_MAX_POINTS 1048576
+
+/**
+ * Point of a PVT table. The time is the duration of the segment that ends
+ * in the point.
+ */
+typedef struct {
+  double position;
+  double velocity;
+  double time;
+} ecmcAxisPvtPoint;
+
+class ecmcAxisBase;
+
+/**
+ * \class ecmcAxisPvt
+ *
+ * \brief Execution of position/velocity/time tables (PVT) on an axis
+ *
+ * Points are added from non realtime (asyn array, data storage or command)
+ * to a lock free ring buffer and consumed by ecmc_rt. Points can be added
+ * while the table is executed (streaming), the free space is available
+ * with getFree().
+ *
+ * Each segment is interpolated with a cubic Hermite polynomial between the
+ * position and velocity of its start and end point (ecmcAxisPvtSegment).
+ * The first segment
+ * starts at the current position setpoint at standstill. The table ends
+ * when the buffer is empty at a point with zero velocity. If the buffer
+ * runs empty at any other point (underrun), on stop or on an interlock in
+ * the direction of motion the axis is ramped down with its emergency
+ * deceleration. If the axis gets disabled or goes to error the table ends
+ * at once.
+ *
+ * The setpoints are written to the axis in the same way as for an axis
+ * group (trajectory of the axis bypassed while active).
+ */
+class ecmcAxisPvt : public ecmcError {
+ public:
+  ecmcAxisPvt(ecmcAxisBase *axis,
+              double        sampleTime);
+  ~ecmcAxisPvt();
+
+  // Configuration
+  int    setBufferSize(int points);
+  int    getBufferSize();
+
+  // Non realtime (thread safe)
+  int    addPoints(double *values,
+                   int     pointCount);
+  void   start();
+  void   stop();
+  void   clear();
+  int    getFree();
+  int    getCount();
+  bool   getActive();
+
+  // Realtime
+  void   execute();
+
+ private:
+  void   initVars();
+  void   startTable();
+  void   executeTable();
+  void   startStop();
+  void   executeStop();
+  void   endTable();
+
+  ecmcAxisBase *axis_;
+  double sampleTime_;
+
+  // Active segment
+  ecmcAxisPvtSegment segment_;
+  double time_;
+  double pos_;
+  double vel_;
+  double stopDec_;
+  bool   stopping_;
+  int    active_;
+
+  // Requests from non realtime
+  int    startRequest_;
+  int    stopRequest_;
+  int    clearRequest_;
+
+  // Handoff from non realtime
+  ecmcRtRingBuffer<ecmcAxisPvtPoint> buffer_;
+  epicsMutexId producerLock_;
+};
+
+#endif  /* ECMCAXISPVT_H_ */
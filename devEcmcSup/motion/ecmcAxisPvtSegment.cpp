@@ -0,0 +1,66 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisPvtSegment.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcAxisPvtSegment.h"
+
+ecmcAxisPvtSegment::ecmcAxisPvtSegment() {
+  startPos_ = 0;
+  startVel_ = 0;
+  endPos_   = 0;
+  endVel_   = 0;
+  time_     = 0;
+}
+
+ecmcAxisPvtSegment::~ecmcAxisPvtSegment() {}
+
+void ecmcAxisPvtSegment::init(double startPos,
+                              double startVel,
+                              double endPos,
+                              double endVel,
+                              double time) {
+  startPos_ = startPos;
+  startVel_ = startVel;
+  endPos_   = endPos;
+  endVel_   = endVel;
+  time_     = time;
+}
+
+void ecmcAxisPvtSegment::evaluate(double  t,
+                                  double *pos,
+                                  double *vel,
+                                  double *acc) {
+  double s  = t / time_;
+  double s2 = s * s;
+  double s3 = s2 * s;
+
+  *pos = (2 * s3 - 3 * s2 + 1) * startPos_ +
+         (s3 - 2 * s2 + s) * time_ * startVel_ +
+         (-2 * s3 + 3 * s2) * endPos_ +
+         (s3 - s2) * time_ * endVel_;
+  *vel = (6 * s2 - 6 * s) * (startPos_ - endPos_) / time_ +
+         (3 * s2 - 4 * s + 1) * startVel_ +
+         (3 * s2 - 2 * s) * endVel_;
+  *acc = ((12 * s - 6) * (startPos_ - endPos_) / time_ +
+          (6 * s - 4) * startVel_ +
+          (6 * s - 2) * endVel_) / time_;
+}
+
+double ecmcAxisPvtSegment::getTime() {
+  return time_;
+}
+
+double ecmcAxisPvtSegment::getEndPos() {
+  return endPos_;
+}
+
+double ecmcAxisPvtSegment::getEndVel() {
+  return endVel_;
+}
@@ -0,0 +1,54 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcAxisPvtSegment.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCAXISPVTSEGMENT_H_
+#define ECMCAXISPVTSEGMENT_H_
+
+/**
+ * \class ecmcAxisPvtSegment
+ *
+ * \brief Segment of a PVT table
+ *
+ * Cubic Hermite polynomial between the position and velocity of the start
+ * and end point of the segment. The acceleration is linear over the
+ * segment (constant jerk), so it is limited by its values at start and end.
+ *
+ * Plain numerics without EPICS dependencies (see tools/check).
+ */
+class ecmcAxisPvtSegment {
+ public:
+  ecmcAxisPvtSegment();
+  ~ecmcAxisPvtSegment();
+
+  void   init(double startPos,
+              double startVel,
+              double endPos,
+              double endVel,
+              double time);
+
+  /// Position, velocity and acceleration at time t (0..time) of segment.
+  void   evaluate(double  t,
+                  double *pos,
+                  double *vel,
+                  double *acc);
+  double getTime();
+  double getEndPos();
+  double getEndVel();
+
+ private:
+  double startPos_;
+  double startVel_;
+  double endPos_;
+  double endVel_;
+  double time_;
+};
+
+#endif  /* ECMCAXISPVTSEGMENT_H_ */
@@ -76,6 +76,13 @@ void ecmcAxisReal::execute(bool masterOK) {
     if (data_.command_.trajSource == ECMC_DATA_SOURCE_INTERNAL) {
       data_.status_.currentPositionSetpoint = traj_->getNextPosSet();
       data_.status_.currentVelocitySetpoint = traj_->getVel();
+
+      // Setpoints from axis group (trajectory follows)
+      if (groupActive_) {
+        traj_->setCurrentPosSet(groupPosSet_);
+        data_.status_.currentPositionSetpoint = groupPosSet_;
+        data_.status_.currentVelocitySetpoint = groupVelSet_;
+      }
     } else {    // External source (PLC)
       data_.status_.currentPositionSetpoint =
         data_.status_.externalTrajectoryPosition;
@@ -99,6 +106,10 @@ void ecmcAxisReal::execute(bool masterOK) {
     traj_->setStartPos(data_.status_.currentPositionSetpoint);
 
     seq_.execute();
+
+    if (groupActive_) {
+      data_.status_.busy = true;
+    }
     mon_->execute();
 
     // Switch to internal trajectory temporary if interlock
@@ -11,13 +11,19 @@
 \*************************************************************************/
 
 #include "ecmcAxisSequencer.h"
+#include <string.h>
 
 ecmcAxisSequencer::ecmcAxisSequencer() {
   initVars();
+  motionQueueLock_ = epicsMutexMustCreate();
 }
 
-ecmcAxisSequencer::~ecmcAxisSequencer()
-{}
+ecmcAxisSequencer::~ecmcAxisSequencer() {
+  if (motionQueueLock_) {
+    epicsMutexDestroy(motionQueueLock_);
+  }
+  motionQueueLock_ = NULL;
+}
 
 void ecmcAxisSequencer::initVars() {
   homeSensorOld_         = false;
@@ -57,6 +63,15 @@ void ecmcAxisSequencer::initVars() {
   homeEnablePostMove_    = false;
   homePostMoveTargetPos_ = 0;
   seqPosHomeState_       = 0;
+  motionQueueLock_       = NULL;
+  memset(&queueItem_, 0, sizeof(queueItem_));
+  queueEnableCmd_        = 0;
+  queueClearRequest_     = 0;
+  queueBusy_             = false;
+  queueLookahead_        = false;
+  queueWaitNext_         = false;
+  queueTarget_           = 0;
+  queueDir_              = 1;
 }
 
 // Cyclic execution
@@ -82,6 +97,12 @@ void ecmcAxisSequencer::execute() {
     data_->status_.busy = true;
   }
 
+  executeMotionQueue();
+
+  if (queueBusy_) {
+    data_->status_.busy = true;
+  }
+
   hwLimitSwitchBwdOld_ = hwLimitSwitchBwd_;
   hwLimitSwitchFwdOld_ = hwLimitSwitchFwd_;
   hwLimitSwitchBwd_    = data_->status_.limitBwd;
@@ -2811,3 +2832,205 @@ void ecmcAxisSequencer::setHomePostMoveTargetPosition(double targetPos) {
 void ecmcAxisSequencer::setHomePostMoveEnable(double enable) {
   homeEnablePostMove_ = enable;
 }
+
+/*
+* Non realtime. Returns error code (axis not set in error state).
+*/
+int ecmcAxisSequencer::addMotionQueueItem(ecmcMotionQueueItem *item) {
+  if ((item == NULL) || (std::abs(item->velocity) == 0) ||
+      (item->acceleration <= 0) || (item->deceleration <= 0)) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Invalid motion queue item. Velocity, acceleration and deceleration must be set (0x%x).\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__,
+      ERROR_SEQ_MOTION_QUEUE_ITEM_INVALID);
+    return ERROR_SEQ_MOTION_QUEUE_ITEM_INVALID;
+  }
+
+  // Velocity sign is defined by the positions
+  ecmcMotionQueueItem queueItem = *item;
+  queueItem.velocity = std::abs(item->velocity);
+
+  epicsMutexLock(motionQueueLock_);
+  bool pushed = motionQueue_.push(&queueItem);
+  epicsMutexUnlock(motionQueueLock_);
+
+  if (!pushed) {
+    LOGERR("%s/%s:%d: ERROR: Motion queue full (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_SEQ_MOTION_QUEUE_FULL);
+    return ERROR_SEQ_MOTION_QUEUE_FULL;
+  }
+  return 0;
+}
+
+void ecmcAxisSequencer::setMotionQueueEnable(bool enable) {
+  epicsAtomicSetIntT(&queueEnableCmd_, enable);
+}
+
+bool ecmcAxisSequencer::getMotionQueueEnable() {
+  return epicsAtomicGetIntT(&queueEnableCmd_) != 0;
+}
+
+void ecmcAxisSequencer::clearMotionQueue() {
+  epicsAtomicSetIntT(&queueClearRequest_, 1);
+}
+
+// Items not yet started
+int ecmcAxisSequencer::getMotionQueueCount() {
+  return (int)(motionQueue_.getPushCount() - motionQueue_.getPopCount());
+}
+
+bool ecmcAxisSequencer::getMotionQueueBusy() {
+  return queueBusy_;
+}
+
+/*
+* Realtime (thread executing the axis, after the trajectory)
+*/
+void ecmcAxisSequencer::executeMotionQueue() {
+  if (epicsAtomicGetIntT(&queueClearRequest_)) {
+    epicsAtomicSetIntT(&queueClearRequest_, 0);
+    bool stop = queueBusy_;
+    abortMotionQueue();
+
+    if (stop) {
+      setExecute(false);
+    }
+    return;
+  }
+
+  if (!queueBusy_) {
+    if (!epicsAtomicGetIntT(&queueEnableCmd_) || data_->status_.busy ||
+        !data_->status_.enabled ||
+        data_->interlocks_.axisErrorStateInterlock ||
+        (data_->command_.trajSource != ECMC_DATA_SOURCE_INTERNAL)) {
+      return;
+    }
+
+    if (motionQueue_.pop(&queueItem_)) {
+      startMotionQueueItem();
+    }
+    return;
+  }
+
+  // Stopped or other motion command
+  if (!data_->command_.execute ||
+      (data_->command_.command != ECMC_CMD_MOVEABS) ||
+      (data_->command_.positionTarget != queueTarget_) ||
+      (data_->command_.trajSource != ECMC_DATA_SOURCE_INTERNAL)) {
+    abortMotionQueue();
+    return;
+  }
+
+  // Interlocked in direction of motion
+  if (((queueDir_ > 0) && data_->interlocks_.trajSummaryInterlockFWD) ||
+      ((queueDir_ < 0) && data_->interlocks_.trajSummaryInterlockBWD)) {
+    abortMotionQueue();
+    return;
+  }
+
+  double posSet = traj_->getCurrentPosSet();
+
+  if (queueLookahead_) {
+    // Passed position of item: continue with next (already the target)
+    if ((queueDir_ * (posSet - queueItem_.position) < 0) &&
+        traj_->getBusy()) {
+      return;
+    }
+
+    if (!motionQueue_.pop(&queueItem_)) {
+      abortMotionQueue();
+      return;
+    }
+    traj_->setAcc(queueItem_.acceleration);
+    traj_->setDec(queueItem_.deceleration);
+    traj_->setBlendRamp(true);
+    setTargetVel(queueItem_.velocity);
+    setMotionQueueTarget();
+    traj_->setTargetPos(queueTarget_);
+    return;
+  }
+
+  if (traj_->getBusy()) {
+    // Next item queued after start of this item
+    if (queueWaitNext_ && (getMotionQueueCount() > 0)) {
+      setMotionQueueTarget();
+
+      if (queueLookahead_) {
+        traj_->setTargetPos(queueTarget_);
+      }
+    }
+    return;
+  }
+
+  // Item done: start next in this cycle (motion in next cycle)
+  queueBusy_ = false;
+
+  if (epicsAtomicGetIntT(&queueEnableCmd_) && motionQueue_.pop(&queueItem_)) {
+    startMotionQueueItem();
+  }
+}
+
+int ecmcAxisSequencer::startMotionQueueItem() {
+  queueDir_ = queueItem_.position >= data_->status_.currentPositionSetpoint ?
+              1 : -1;
+  data_->command_.command = ECMC_CMD_MOVEABS;
+  data_->command_.cmdData = 0;
+  traj_->setAcc(queueItem_.acceleration);
+  traj_->setDec(queueItem_.deceleration);
+  setTargetVel(queueItem_.velocity);
+  setMotionQueueTarget();
+  queueBusy_ = true;
+
+  setExecute(false);
+  int errorCode = setExecute(true);
+
+  if (errorCode) {
+    abortMotionQueue();
+    return errorCode;
+  }
+
+  data_->status_.busy = true;
+  return 0;
+}
+
+/*
+* Target of trajectory is the position of the next item if blending in
+* same direction is possible.
+*/
+void ecmcAxisSequencer::setMotionQueueTarget() {
+  ecmcMotionQueueItem next;
+  double target   = queueItem_.position;
+
+  queueLookahead_ = false;
+  queueWaitNext_  = false;
+
+  if (queueItem_.blend && (data_->command_.moduloRange == 0) &&
+      epicsAtomicGetIntT(&queueEnableCmd_)) {
+    if (!motionQueue_.peek(&next)) {
+      // Retry when next item is queued
+      queueWaitNext_ = true;
+    } else if (queueDir_ * (next.position - queueItem_.position) > 0) {
+      target          = next.position;
+      queueLookahead_ = true;
+    }
+  }
+
+  setTargetPos(target);
+  queueTarget_ = data_->command_.positionTarget;
+}
+
+// Discard remaining items
+void ecmcAxisSequencer::abortMotionQueue() {
+  ecmcMotionQueueItem item;
+
+  while (motionQueue_.pop(&item)) {}
+
+  queueBusy_      = false;
+  queueLookahead_ = false;
+  queueWaitNext_  = false;
+}
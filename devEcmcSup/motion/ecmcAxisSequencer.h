@@ -13,7 +13,9 @@
 #ifndef ecmcAxisSequencer_H_
 #define ecmcAxisSequencer_H_
 
+#include <epicsMutex.h>
 #include "../main/ecmcError.h"
+#include "../main/ecmcRtHandoff.h"
 #include "ecmcEncoder.h"
 #include "ecmcMonitor.h"
 #include "ecmcPIDController.h"
@@ -46,6 +48,8 @@
 #define ERROR_SEQ_TARGET_POS_OUT_OF_RANGE 0x14D15
 #define ERROR_SEQ_MOTION_CMD_NOT_ENABLED 0x14D16
 #define ERROR_SEQ_HOME_POST_MOVE_FAILED 0x14D17
+#define ERROR_SEQ_MOTION_QUEUE_FULL 0x14D18
+#define ERROR_SEQ_MOTION_QUEUE_ITEM_INVALID 0x14D19
 
 // Homing
 enum ecmcHomingType {
@@ -68,6 +72,19 @@ enum ecmcHomingType {
   ECMC_SEQ_HOME_SET_POS_2                = 25,   // Same as ECMC_SEQ_HOME_SET_POS but not blocked by motor. Code handled in ecmcMotorRecordAxis
 };
 
+/**
+ * Item of the motion queue (absolute positioning).
+ * blend: Do not stop at position if the next item continues in the
+ *        same direction (velocity of next item applies from position).
+ */
+typedef struct {
+  double position;
+  double velocity;
+  double acceleration;
+  double deceleration;
+  int    blend;
+} ecmcMotionQueueItem;
+
 class ecmcAxisSequencer : public ecmcError {
  public:
   ecmcAxisSequencer();
@@ -125,6 +142,35 @@ class ecmcAxisSequencer : public ecmcError {
   int    getAllowConstVelo();
   int    getAllowHome();
 
+  /**
+   * Motion queue: Buffered absolute moves executed back to back by the
+   * realtime thread (no round trip to asyn/PLC between moves).
+   *
+   * When enabled and the axis is idle the first item is started as a
+   * normal absolute positioning (command MOVEABS). The next item is
+   * started in the same cycle as the previous one is finished. Items
+   * with blend set are not stopped at their position if the next item
+   * is already queued and continues in the same direction: the
+   * trajectory is retargeted to the next position and the velocity,
+   * acceleration and deceleration of the next item apply when passing.
+   * No blending for modulo axes.
+   *
+   * A stop (execute low), interlock or any other motion command aborts
+   * the queue and discards all remaining items. Disable pauses the queue
+   * after the ongoing item(s). Clear discards all items and stops an
+   * ongoing queue motion.
+   *
+   * Threads: addMotionQueueItem() from non realtime threads (serialized
+   * by a lock of the queue). Enable and clear are requests applied by
+   * the thread executing the axis.
+   */
+  int    addMotionQueueItem(ecmcMotionQueueItem *item);
+  void   setMotionQueueEnable(bool enable);
+  bool   getMotionQueueEnable();
+  void   clearMotionQueue();
+  int    getMotionQueueCount();
+  bool   getMotionQueueBusy();
+
  private:
   void   initVars();
   double checkSoftLimits(double posSetpoint);
@@ -151,6 +197,10 @@ class ecmcAxisSequencer : public ecmcError {
   void   initHomingSeq();
   void   finalizeHomingSeq(double newPosition);
   int    postHomeMove();
+  void   executeMotionQueue();
+  int    startMotionQueueItem();
+  void   setMotionQueueTarget();
+  void   abortMotionQueue();
 
   int seqState_;
   int seqStateOld_;
@@ -193,6 +243,17 @@ class ecmcAxisSequencer : public ecmcError {
   bool enablePos_;
   bool enableConstVel_;
   bool enableHome_;
+  // Motion queue
+  ecmcRtCmdQueue<ecmcMotionQueueItem, ECMC_SEQ_MOTION_QUEUE_SIZE> motionQueue_;
+  epicsMutexId motionQueueLock_;
+  ecmcMotionQueueItem queueItem_;
+  int queueEnableCmd_;
+  int queueClearRequest_;
+  bool queueBusy_;
+  bool queueLookahead_;
+  bool queueWaitNext_;
+  double queueTarget_;
+  int queueDir_;
 };
 
 #endif  /* ecmcAxisSequencer_H_ */
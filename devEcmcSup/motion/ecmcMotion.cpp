@@ -177,6 +177,276 @@ int stopMotion(int axisIndex, int killAmplifier) {
   return axes[axisIndex]->stopMotion(killAmplifier);
 }
 
+int addMotionQueueItem(int    axisIndex,
+                       double positionSet,
+                       double velocitySet,
+                       double accelerationSet,
+                       double decelerationSet,
+                       int    blend) {
+  LOGINFO4(
+    "%s/%s:%d axisIndex=%d, positionSet=%lf, velocitySet=%lf, accelerationSet=%lf, decelerationSet=%lf, blend=%d\n",
+    __FILE__,
+    __FUNCTION__,
+    __LINE__,
+    axisIndex,
+    positionSet,
+    velocitySet,
+    accelerationSet,
+    decelerationSet,
+    blend);
+
+  CHECK_AXIS_RETURN_IF_ERROR_AND_BLOCK_COM(axisIndex);
+  CHECK_AXIS_SEQ_RETURN_IF_ERROR(axisIndex);
+
+  ecmcMotionQueueItem item;
+  item.position     = positionSet;
+  item.velocity     = velocitySet;
+  item.acceleration = accelerationSet;
+  item.deceleration = decelerationSet;
+  item.blend        = blend != 0;
+
+  return axes[axisIndex]->getSeq()->addMotionQueueItem(&item);
+}
+
+int setMotionQueueEnable(int axisIndex, int enable) {
+  LOGINFO4("%s/%s:%d axisIndex=%d, enable=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           enable);
+
+  CHECK_AXIS_RETURN_IF_ERROR_AND_BLOCK_COM(axisIndex);
+  CHECK_AXIS_SEQ_RETURN_IF_ERROR(axisIndex);
+
+  axes[axisIndex]->getSeq()->setMotionQueueEnable(enable != 0);
+  return 0;
+}
+
+int clearMotionQueue(int axisIndex) {
+  LOGINFO4("%s/%s:%d axisIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+  CHECK_AXIS_SEQ_RETURN_IF_ERROR(axisIndex);
+
+  axes[axisIndex]->getSeq()->clearMotionQueue();
+  return 0;
+}
+
+int getMotionQueueCount(int axisIndex, int *count) {
+  LOGINFO4("%s/%s:%d axisIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+  CHECK_AXIS_SEQ_RETURN_IF_ERROR(axisIndex);
+
+  *count = axes[axisIndex]->getSeq()->getMotionQueueCount();
+  return 0;
+}
+
+int moveAxisGroupLinear(int groupIndex, double *positions, int count) {
+  LOGINFO4("%s/%s:%d groupIndex=%d count=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           count);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  return axisGroups[groupIndex]->moveLinear(positions, count);
+}
+
+int moveAxisGroupCircular(int     groupIndex,
+                          int     direction,
+                          double  centerX,
+                          double  centerY,
+                          double *positions,
+                          int     count) {
+  LOGINFO4("%s/%s:%d groupIndex=%d direction=%d center=%lf,%lf count=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           direction,
+           centerX,
+           centerY,
+           count);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  return axisGroups[groupIndex]->moveCircular(direction,
+                                              centerX,
+                                              centerY,
+                                              positions,
+                                              count);
+}
+
+int stopAxisGroup(int groupIndex) {
+  LOGINFO4("%s/%s:%d groupIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  return axisGroups[groupIndex]->stop();
+}
+
+int setAxisGroupOverride(int groupIndex, double override) {
+  LOGINFO4("%s/%s:%d groupIndex=%d override=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           override);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  return axisGroups[groupIndex]->setOverride(override);
+}
+
+int getAxisGroupBusy(int groupIndex, int *busy) {
+  LOGINFO4("%s/%s:%d groupIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  *busy = axisGroups[groupIndex]->getBusy();
+  return 0;
+}
+
+int setAxisCamEnable(int axisIndex, int enable) {
+  LOGINFO4("%s/%s:%d axisIndex=%d enable=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           enable);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  axes[axisIndex]->getCam()->setEnable(enable);
+  return 0;
+}
+
+int addAxisPvtPoint(int    axisIndex,
+                    double position,
+                    double velocity,
+                    double time) {
+  LOGINFO4("%s/%s:%d axisIndex=%d position=%lf velocity=%lf time=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           position,
+           velocity,
+           time);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  double values[ECMC_AXIS_PVT_POINT_VALUES] = { position, velocity, time };
+
+  return axes[axisIndex]->getPvt()->addPoints(values, 1);
+}
+
+int addAxisPvtFromDataStorage(int axisIndex, int storageIndex) {
+  LOGINFO4("%s/%s:%d axisIndex=%d storageIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           storageIndex);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  if ((storageIndex < 0) || (storageIndex >= ECMC_MAX_DATA_STORAGE_OBJECTS)) {
+    return ERROR_MAIN_DATA_STORAGE_INDEX_OUT_OF_RANGE;
+  }
+
+  if (dataStorages[storageIndex] == NULL) {
+    return ERROR_MAIN_DATA_STORAGE_NULL;
+  }
+
+  double *data = NULL;
+  int     size = 0;
+  int     errorCode = dataStorages[storageIndex]->getData(&data, &size);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  if (!dataStorages[storageIndex]->isStorageFull()) {
+    size = dataStorages[storageIndex]->getCurrentIndex();
+  }
+
+  return axes[axisIndex]->getPvt()->addPoints(data,
+                                              size / ECMC_AXIS_PVT_POINT_VALUES);
+}
+
+int startAxisPvt(int axisIndex) {
+  LOGINFO4("%s/%s:%d axisIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  axes[axisIndex]->getPvt()->start();
+  return 0;
+}
+
+int stopAxisPvt(int axisIndex) {
+  LOGINFO4("%s/%s:%d axisIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  axes[axisIndex]->getPvt()->stop();
+  return 0;
+}
+
+int clearAxisPvt(int axisIndex) {
+  LOGINFO4("%s/%s:%d axisIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  axes[axisIndex]->getPvt()->clear();
+  return 0;
+}
+
+int getAxisPvtFree(int axisIndex, int *free) {
+  LOGINFO4("%s/%s:%d axisIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  *free = axes[axisIndex]->getPvt()->getFree();
+  return 0;
+}
+
 int getAxisError(int axisIndex) {
   LOGINFO4("%s/%s:%d axisIndex=%d\n",
            __FILE__,
@@ -803,11 +1073,24 @@ int setAxisJerk(int axisIndex, double value) {
   CHECK_AXIS_RETURN_IF_ERROR_AND_BLOCK_COM(axisIndex)
   CHECK_AXIS_TRAJ_RETURN_IF_ERROR(axisIndex)
 
-  // TODO not implemented in trajectory generator
   axes[axisIndex]->getTraj()->setJerk(value);
   return 0;
 }
 
+int setAxisTrajProfile(int axisIndex, int value) {
+  LOGINFO4("%s/%s:%d axisIndex=%d value=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           value);
+
+  CHECK_AXIS_RETURN_IF_ERROR_AND_BLOCK_COM(axisIndex)
+  CHECK_AXIS_TRAJ_RETURN_IF_ERROR(axisIndex)
+
+  return axes[axisIndex]->getTraj()->setProfileType(value);
+}
+
 int setAxisTargetPos(int axisIndex, double value) {
   LOGINFO4("%s/%s:%d axisIndex=%d value=%f\n",
            __FILE__,
@@ -2483,6 +2766,287 @@ int createAxis(int index, int type, int drvType) {
   return axes[index]->getErrorID();
 }
 
+int createAxisGroup(int groupIndex) {
+  LOGINFO4("%s/%s:%d groupIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex);
+
+  if ((groupIndex < 0) || (groupIndex >= ECMC_MAX_AXIS_GROUPS)) {
+    return ERROR_MAIN_AXIS_GROUP_INDEX_OUT_OF_RANGE;
+  }
+
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  if (axisGroups[groupIndex]) {
+    LOGERR("%s/%s:%d: ERROR: Axis group %d already created (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           ERROR_MAIN_AXIS_GROUP_OBJ_ALREADY_ASSIGNED);
+    return ERROR_MAIN_AXIS_GROUP_OBJ_ALREADY_ASSIGNED;
+  }
+
+  // Sample rate fixed
+  sampleRateChangeAllowed = 0;
+  axisGroups[groupIndex] = new ecmcAxisGroup(asynPort,
+                                             groupIndex,
+                                             1 / mcuFrequency);
+  if (!axisGroups[groupIndex]) {
+    return ERROR_MAIN_AXIS_GROUP_NULL;
+  }
+
+  int errorCode = axisGroups[groupIndex]->getErrorID();
+  if (errorCode) {
+    delete axisGroups[groupIndex];
+    axisGroups[groupIndex] = NULL;
+    return errorCode;
+  }
+
+  return 0;
+}
+
+int addAxisToGroup(int groupIndex, int axisIndex) {
+  LOGINFO4("%s/%s:%d groupIndex=%d axisIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           axisIndex);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  return axisGroups[groupIndex]->addAxis(axes[axisIndex]);
+}
+
+int setAxisGroupVel(int groupIndex, double value) {
+  LOGINFO4("%s/%s:%d groupIndex=%d value=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           value);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  return axisGroups[groupIndex]->setVel(value);
+}
+
+int setAxisGroupAcc(int groupIndex, double value) {
+  LOGINFO4("%s/%s:%d groupIndex=%d value=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           value);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  return axisGroups[groupIndex]->setAcc(value);
+}
+
+int setAxisGroupDec(int groupIndex, double value) {
+  LOGINFO4("%s/%s:%d groupIndex=%d value=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           value);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  return axisGroups[groupIndex]->setDec(value);
+}
+
+int setAxisGroupEmergDec(int groupIndex, double value) {
+  LOGINFO4("%s/%s:%d groupIndex=%d value=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           value);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  return axisGroups[groupIndex]->setEmergDec(value);
+}
+
+int setAxisGroupJerk(int groupIndex, double value) {
+  LOGINFO4("%s/%s:%d groupIndex=%d value=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           groupIndex,
+           value);
+
+  CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex);
+
+  return axisGroups[groupIndex]->setJerk(value);
+}
+
+int setAxisCamMasterAxis(int axisIndex, int masterAxisIndex, int source) {
+  LOGINFO4("%s/%s:%d axisIndex=%d masterAxisIndex=%d source=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           masterAxisIndex,
+           source);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+  CHECK_AXIS_RETURN_IF_ERROR(masterAxisIndex);
+
+  // Execution order and thread of master validated when entering runtime
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  if (masterAxisIndex == axisIndex) {
+    return ERROR_AXIS_CAM_MASTER_SELF;
+  }
+
+  return axes[axisIndex]->getCam()->setMasterAxis(axes[masterAxisIndex],
+                                                  (ecmcAxisCamMasterSource)source);
+}
+
+int linkEcEntryToAxisCamMaster(int   slaveIndex,
+                               char *entryIDString,
+                               int   axisIndex) {
+  LOGINFO4("%s/%s:%d slave_index=%d entry=%s axisIndex=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           slaveIndex,
+           entryIDString,
+           axisIndex);
+
+  if (!ec) return ERROR_MAIN_EC_NOT_INITIALIZED;
+
+  ecmcEcSlave *slave = NULL;
+
+  if (slaveIndex >= 0) {
+    slave = ec->findSlave(slaveIndex);
+  } else {    // simulation slave
+    slave = ec->getSlave(slaveIndex);
+  }
+
+  if (slave == NULL) return ERROR_MAIN_EC_SLAVE_NULL;
+
+  std::string sEntryID = entryIDString;
+
+  ecmcEcEntry *entry = slave->findEntry(sEntryID);
+
+  if (entry == NULL) return ERROR_MAIN_EC_ENTRY_NULL;
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  // Master is validated when entering runtime
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  return axes[axisIndex]->getCam()->setMasterEntry(entry, -1);
+}
+
+int setAxisCamMasterScale(int axisIndex, double value) {
+  LOGINFO4("%s/%s:%d axisIndex=%d value=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           value);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  return axes[axisIndex]->getCam()->setMasterScale(value);
+}
+
+int setAxisCamMasterModulo(int axisIndex, double value) {
+  LOGINFO4("%s/%s:%d axisIndex=%d value=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           value);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  return axes[axisIndex]->getCam()->setMasterModulo(value);
+}
+
+int setAxisCamRatio(int axisIndex, double value) {
+  LOGINFO4("%s/%s:%d axisIndex=%d value=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           value);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  return axes[axisIndex]->getCam()->setRatio(value);
+}
+
+int setAxisCamOffset(int axisIndex, double value) {
+  LOGINFO4("%s/%s:%d axisIndex=%d value=%lf\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           value);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  return axes[axisIndex]->getCam()->setOffset(value);
+}
+
+int loadAxisCamTable(int axisIndex, const char *fileName, int interpolation) {
+  LOGINFO4("%s/%s:%d axisIndex=%d fileName=%s interpolation=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           fileName,
+           interpolation);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  // Table is read by ecmc_rt
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  return axes[axisIndex]->getCam()->loadTable(fileName,
+                                              (ecmcAxisCamInterpType)interpolation);
+}
+
+int setAxisPvtBufferSize(int axisIndex, int points) {
+  LOGINFO4("%s/%s:%d axisIndex=%d points=%d\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           axisIndex,
+           points);
+
+  CHECK_AXIS_RETURN_IF_ERROR(axisIndex);
+
+  // Buffer is used by ecmc_rt
+  if (appModeStat != ECMC_MODE_CONFIG) {
+    return ERROR_MAIN_APP_MODE_ALREADY_RUNTIME;
+  }
+
+  return axes[axisIndex]->getPvt()->setBufferSize(points);
+}
+
 int linkEcEntryToAxisEnc(int   slaveIndex,
                          char *entryIDString,
                          int   axisIndex,
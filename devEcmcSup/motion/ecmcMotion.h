@@ -94,6 +94,18 @@ extern "C" {
   }                                                                           \
 }                                                                             \
 
+#define CHECK_AXIS_GROUP_RETURN_IF_ERROR(groupIndex)                          \
+{                                                                             \
+  if (groupIndex >= ECMC_MAX_AXIS_GROUPS || groupIndex < 0) {                 \
+    LOGERR("ERROR: Axis group index out of range.\n");                        \
+    return ERROR_MAIN_AXIS_GROUP_INDEX_OUT_OF_RANGE;                          \
+  }                                                                           \
+  if (axisGroups[groupIndex] == NULL) {                                       \
+    LOGERR("ERROR: Axis group object NULL.\n");                               \
+    return ERROR_MAIN_AXIS_GROUP_NULL;                                        \
+  }                                                                           \
+}                                                                             \
+
 /** \brief Move axis to an absolute position.\n
  *
  * \param[in] axisIndex Axis index.\n
@@ -166,6 +178,270 @@ int moveVelocity(int    axisIndex,
 int stopMotion(int axisIndex,
                int killAmplifier);
 
+/** \brief Add absolute positioning to motion queue of axis.\n
+ *
+ * Queued positionings are executed back to back by the realtime thread
+ * when the queue is enabled (see setMotionQueueEnable()).\n
+ * If blend is set the axis does not stop at the position if the next
+ * queued positioning continues in the same direction. The velocity,
+ * acceleration and deceleration of the next positioning are then applied
+ * when passing the position (not for modulo axes).\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ * \param[in] positionSet Position setpoint.\n
+ * \param[in] velocitySet Velocity setpoint.\n
+ * \param[in] accelerationSet Acceleration setpoint.\n
+ * \param[in] decelerationSet Deceleration setpoint.\n
+ * \param[in] blend Blend into next positioning.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Queue positioning of axis 5 to 1234 at velocity 10,
+ * acceleration 100, deceleration 200, blended into next positioning.\n
+ * "AddMotionQueueItem(5,1234,10,100,200,1)" //Command string to ecmcCmdParser.c\n
+ */
+int addMotionQueueItem(int    axisIndex,
+                       double positionSet,
+                       double velocitySet,
+                       double accelerationSet,
+                       double decelerationSet,
+                       int    blend);
+
+/** \brief Enable motion queue of axis.\n
+ *
+ * When enabled, queued positionings are started as soon as the axis is
+ * idle. Disable pauses the queue after the ongoing positioning.\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ * \param[in] enable Enable.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Enable motion queue of axis 5.\n
+ * "SetMotionQueueEnable(5,1)" //Command string to ecmcCmdParser.c\n
+ */
+int setMotionQueueEnable(int axisIndex,
+                         int enable);
+
+/** \brief Clear motion queue of axis.\n
+ *
+ * Discards all queued positionings and stops an ongoing queue motion.\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Clear motion queue of axis 5.\n
+ * "ClearMotionQueue(5)" //Command string to ecmcCmdParser.c\n
+ */
+int clearMotionQueue(int axisIndex);
+
+/** \brief Get number of positionings in motion queue (not yet started).\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ * \param[out] count Number of queued positionings.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Get number of queued positionings of axis 5.\n
+ * "GetMotionQueueCount(5)" //Command string to ecmcCmdParser.c\n
+ */
+int getMotionQueueCount(int  axisIndex,
+                        int *count);
+
+/** \brief Coordinated linear move of all axes in an axis group.\n
+ *
+ * All axes of the group move on a straight line to the end positions and
+ * arrive at the same time. Velocity, acceleration, deceleration and jerk
+ * of the path are set with setAxisGroupVel() and related functions.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[in] positions End positions (in order of addAxisToGroup()).\n
+ * \param[in] count Number of positions (same as axes in group).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Move the axes of group 0 (two axes) to 10,20.\n
+ * "MoveAxisGroupLinear(0,10,20)" //Command string to ecmcCmdParser.c\n
+ */
+int moveAxisGroupLinear(int     groupIndex,
+                        double *positions,
+                        int     count);
+
+/** \brief Coordinated circular move of all axes in an axis group.\n
+ *
+ * The first two axes of the group move on an arc around the center to
+ * the end positions. End positions equal to the start positions result in
+ * a full circle. Any other axes in the group move linear along the
+ * path (helix).\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[in] direction 1 = counter clockwise, -1 = clockwise.\n
+ * \param[in] centerX Center of arc (first axis).\n
+ * \param[in] centerY Center of arc (second axis).\n
+ * \param[in] positions End positions (in order of addAxisToGroup()).\n
+ * \param[in] count Number of positions (same as axes in group).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Half circle counter clockwise from 10,0 to -10,0
+ * around 0,0 for group 0.\n
+ * "MoveAxisGroupCircular(0,1,0,0,-10,0)" //Command string to ecmcCmdParser.c\n
+ */
+int moveAxisGroupCircular(int     groupIndex,
+                          int     direction,
+                          double  centerX,
+                          double  centerY,
+                          double *positions,
+                          int     count);
+
+/** \brief Stop all axes of an axis group along the path.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Stop axis group 0.\n
+ * "StopAxisGroup(0)" //Command string to ecmcCmdParser.c\n
+ */
+int stopAxisGroup(int groupIndex);
+
+/** \brief Set feed rate override of an axis group.\n
+ *
+ * Scales the path velocity of ongoing and coming moves. The change is
+ * ramped with the path acceleration. Override 0 holds the path.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[in] override Override (0..1).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set override of axis group 0 to 50%.\n
+ * "SetAxisGroupOverride(0,0.5)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisGroupOverride(int    groupIndex,
+                         double override);
+
+/** \brief Get busy state of an axis group.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[out] busy Busy.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Get busy state of axis group 0.\n
+ * "GetAxisGroupBusy(0)" //Command string to ecmcCmdParser.c\n
+ */
+int getAxisGroupBusy(int  groupIndex,
+                     int *busy);
+
+/** \brief Enable electronic gear/cam of an axis.\n
+ *
+ * When enabled and the trajectory source of the axis is external, the
+ * position setpoint of the axis is calculated from the master position
+ * each cycle (see ecmcAxisCam). Configure the master with
+ * Cfg.SetAxisCamMasterAxis() or Cfg.LinkEcEntryToAxisCamMaster().\n
+ *
+ * \param[in] axisIndex Axis index (slave).\n
+ * \param[in] enable Enable.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Enable cam of axis 3.\n
+ * "SetAxisCamEnable(3,1)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisCamEnable(int axisIndex,
+                     int enable);
+
+/** \brief Add a point to the PVT table of an axis.\n
+ *
+ * The table is executed with cubic Hermite interpolation between the
+ * points (see ecmcAxisPvt). Points can be added while the table is
+ * executed. The PVT buffer must be allocated with
+ * Cfg.SetAxisPvtBufferSize().\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ * \param[in] position Position of point.\n
+ * \param[in] velocity Velocity at point.\n
+ * \param[in] time Duration of segment ending in the point [s].\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Add point 10.0 at velocity 5.0 after 0.5 s to axis 3.\n
+ * "AddAxisPvtPoint(3,10.0,5.0,0.5)" //Command string to ecmcCmdParser.c\n
+ */
+int addAxisPvtPoint(int    axisIndex,
+                    double position,
+                    double velocity,
+                    double time);
+
+/** \brief Add points from a data storage to the PVT table of an axis.\n
+ *
+ * The filled part of the data storage is read as points of three values
+ * each (position, velocity, time).\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ * \param[in] storageIndex Data storage index.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Add points from data storage 2 to the PVT table of axis 3.\n
+ * "AddAxisPvtFromDataStorage(3,2)" //Command string to ecmcCmdParser.c\n
+ */
+int addAxisPvtFromDataStorage(int axisIndex,
+                              int storageIndex);
+
+/** \brief Start execution of the PVT table of an axis.\n
+ *
+ * The axis must be enabled and not busy.\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Start PVT table of axis 3.\n
+ * "StartAxisPvt(3)" //Command string to ecmcCmdParser.c\n
+ */
+int startAxisPvt(int axisIndex);
+
+/** \brief Stop execution of the PVT table of an axis.\n
+ *
+ * The axis is ramped down with the emergency deceleration. Points not yet
+ * executed are kept.\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Stop PVT table of axis 3.\n
+ * "StopAxisPvt(3)" //Command string to ecmcCmdParser.c\n
+ */
+int stopAxisPvt(int axisIndex);
+
+/** \brief Clear the PVT table of an axis (and stop).\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Clear PVT table of axis 3.\n
+ * "ClearAxisPvt(3)" //Command string to ecmcCmdParser.c\n
+ */
+int clearAxisPvt(int axisIndex);
+
+/** \brief Get free points in the PVT buffer of an axis.\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ * \param[out] free Free points.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Get free points in PVT buffer of axis 3.\n
+ * "GetAxisPvtFree(3)" //Command string to ecmcCmdParser.c\n
+ */
+int getAxisPvtFree(int  axisIndex,
+                   int *free);
+
 /** \brief Execute homing sequence.\n
  *
  * \param[in] axisIndex Axis index.\n
@@ -1342,20 +1618,39 @@ int setAxisDeceleration(int    axisIndex,
 int setAxisEmergDeceleration(int    axisIndex,
                              double value);
 
-/** \brief Set axis maximum jerk setpoint. NOT USED!\n
+/** \brief Set axis maximum jerk setpoint.\n
  *
- * \note Currently not used!!!!!.\n
+ * Only used for profile type 1 (s-curve), see setAxisTrajProfile().\n
  *
  * \param[in] axisIndex  Axis index.\n
  * \param[in] value Jerk setpoint.\n
  *
  * \return 0 if success or otherwise an error code.\n
  *
- * \note Example: No command string implemented in the ecmcCmdParser.c parser.\n
+ * \note Example: Set jerk setpoint for axis 3 to 5000.\n
+ * "Cfg.SetAxisJerk(3,5000)"  //Command string to ecmcCmdParser.c.\n
  */
 int setAxisJerk(int    axisIndex,
                 double value);
 
+/** \brief Set axis trajectory profile type.\n
+ *
+ * Profile types:\n
+ *   0 = Trapezoidal (default).\n
+ *   1 = S-curve (jerk limited, jerk set by setAxisJerk()). Emergency stops
+ *       are not jerk limited.\n
+ *
+ * \param[in] axisIndex  Axis index.\n
+ * \param[in] value Profile type.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Use s-curve profile for axis 3.\n
+ * "Cfg.SetAxisTrajProfile(3,1)"  //Command string to ecmcCmdParser.c.\n
+ */
+int setAxisTrajProfile(int axisIndex,
+                       int value);
+
 /** \brief Set axis target position setpoint.\n
  *
  * The target position is the desired end setpoint of a motion.
@@ -3136,6 +3431,244 @@ int getAxisModType(int  axisIndex,
 int setAxisDisableAtErrorReset(int axisIndex,
                                int disable);
 
+/** \brief Create an axis group for coordinated motion.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Create axis group 0.\n
+ * "Cfg.CreateAxisGroup(0)" //Command string to ecmcCmdParser.c\n
+ */
+int createAxisGroup(int groupIndex);
+
+/** \brief Add an axis to an axis group.\n
+ *
+ * The order of the axes defines the order of the positions in the move
+ * commands. Circular moves are made in the plane of the first two axes.
+ * Modulo axes are not supported.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[in] axisIndex Axis index.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Add axis 3 to axis group 0.\n
+ * "Cfg.AddAxisToGroup(0,3)" //Command string to ecmcCmdParser.c\n
+ */
+int addAxisToGroup(int groupIndex,
+                   int axisIndex);
+
+/** \brief Set path velocity of an axis group.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[in] value Path velocity.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set path velocity of axis group 0 to 10.\n
+ * "Cfg.SetAxisGroupVel(0,10)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisGroupVel(int    groupIndex,
+                    double value);
+
+/** \brief Set path acceleration of an axis group.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[in] value Path acceleration.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set path acceleration of axis group 0 to 100.\n
+ * "Cfg.SetAxisGroupAcc(0,100)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisGroupAcc(int    groupIndex,
+                    double value);
+
+/** \brief Set path deceleration of an axis group.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[in] value Path deceleration.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set path deceleration of axis group 0 to 100.\n
+ * "Cfg.SetAxisGroupDec(0,100)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisGroupDec(int    groupIndex,
+                    double value);
+
+/** \brief Set path deceleration of an axis group for emergency stops.\n
+ *
+ * Used when a member axis is in error, loses enable or has an
+ * interlock with emergency stop mode (0 = same as deceleration).\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[in] value Path emergency deceleration.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set path emergency deceleration of axis group 0 to 500.\n
+ * "Cfg.SetAxisGroupEmergDec(0,500)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisGroupEmergDec(int    groupIndex,
+                         double value);
+
+/** \brief Set path jerk of an axis group.\n
+ *
+ * \param[in] groupIndex Axis group index.\n
+ * \param[in] value Path jerk (0 = trapezoidal profile).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set path jerk of axis group 0 to 1000.\n
+ * "Cfg.SetAxisGroupJerk(0,1000)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisGroupJerk(int    groupIndex,
+                     double value);
+
+/** \brief Set an axis as master of the electronic gear/cam of an axis.\n
+ *
+ * The master axis must be executed before the slave in the same thread,
+ * checked when entering runtime: both in ecmc_rt and master with a lower
+ * index, or both in the same rt task group and master added first. The
+ * slave axis can not be its own master.\n
+ *
+ * \param[in] axisIndex Axis index (slave).\n
+ * \param[in] masterAxisIndex Axis index of master.\n
+ * \param[in] source Master position.\n
+ *   source = 1: Position setpoint.\n
+ *   source = 2: Actual position.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Slave axis 3 to the position setpoint of axis 1.\n
+ * "Cfg.SetAxisCamMasterAxis(3,1,1)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisCamMasterAxis(int axisIndex,
+                         int masterAxisIndex,
+                         int source);
+
+/** \brief Links an EtherCAT entry as master of the electronic gear/cam of
+ *  an axis.\n
+ *
+ * The raw value of the entry (counter) is unwrapped at overflow and scaled
+ * with Cfg.SetAxisCamMasterScale().\n
+ *
+ *  \param[in] slaveBusPosition Position of the EtherCAT slave on the bus.\n
+ *  \param[in] entryIdString String for addressing purpose (see command
+ *                      "Cfg.EcAddEntryComplete() for more information").\n
+ *  \param[in] axisIndex Axis index (slave).\n
+ *
+ *  \return 0 if success or otherwise an error code.\n
+ *
+ *  \note Example: Link an EtherCAT entry configured as "POSITION" in slave 7
+ *  as cam master of axis 3.\n
+ *  "Cfg.LinkEcEntryToAxisCamMaster(7,POSITION,3)" //Command string
+ *  to ecmcCmdParser.c\n
+ */
+int linkEcEntryToAxisCamMaster(int   slaveBusPosition,
+                               char *entryIdString,
+                               int   axisIndex);
+
+/** \brief Set scale of an EtherCAT entry cam master (raw to master unit).\n
+ *
+ * \param[in] axisIndex Axis index (slave).\n
+ * \param[in] value Scale.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set cam master scale of axis 3 to 360/4096.\n
+ * "Cfg.SetAxisCamMasterScale(3,0.087890625)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisCamMasterScale(int    axisIndex,
+                          double value);
+
+/** \brief Set master modulo (cycle length) of the electronic gear/cam of an
+ *  axis.\n
+ *
+ * The master position is folded into [0..modulo[ before the cam table is
+ * applied. A cam table must then span exactly [0..modulo]. 0 = no modulo.\n
+ * A cubic cam table then uses a periodic spline (continuous velocity and
+ * acceleration over the wrap).\n
+ *
+ * \param[in] axisIndex Axis index (slave).\n
+ * \param[in] value Modulo.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set cam master modulo of axis 3 to 360.\n
+ * "Cfg.SetAxisCamMasterModulo(3,360)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisCamMasterModulo(int    axisIndex,
+                           double value);
+
+/** \brief Set ratio of the electronic gear/cam of an axis.\n
+ *
+ * slavePos = ratio * cam(masterPos) + offset.\n
+ *
+ * \param[in] axisIndex Axis index (slave).\n
+ * \param[in] value Ratio.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set gear ratio of axis 3 to 0.5.\n
+ * "Cfg.SetAxisCamRatio(3,0.5)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisCamRatio(int    axisIndex,
+                    double value);
+
+/** \brief Set offset of the electronic gear/cam of an axis.\n
+ *
+ * \param[in] axisIndex Axis index (slave).\n
+ * \param[in] value Offset.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Set cam offset of axis 3 to 10.\n
+ * "Cfg.SetAxisCamOffset(3,10)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisCamOffset(int    axisIndex,
+                     double value);
+
+/** \brief Load cam table of an axis from file.\n
+ *
+ * One point per line: "master slave" (white space or comma separated),
+ * lines starting with '#' are ignored. Master positions must be strictly
+ * increasing. Only allowed in configuration mode.\n
+ *
+ * \param[in] axisIndex Axis index (slave).\n
+ * \param[in] fileName File name.\n
+ * \param[in] interpolation Interpolation.\n
+ *   interpolation = 0: Linear.\n
+ *   interpolation = 1: Cubic spline (natural, periodic if master modulo).\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Load cubic cam table cam.txt to axis 3.\n
+ * "Cfg.LoadAxisCamTable(3,cam.txt,1)" //Command string to ecmcCmdParser.c\n
+ */
+int loadAxisCamTable(int         axisIndex,
+                     const char *fileName,
+                     int         interpolation);
+
+/** \brief Allocate the PVT buffer of an axis.\n
+ *
+ * The size is rounded up to a power of 2. A table can be larger than the
+ * buffer if the buffer is refilled while the table is executed.
+ * Only allowed in configuration mode.\n
+ *
+ * \param[in] axisIndex Axis index.\n
+ * \param[in] points Buffer size in points.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Allocate a PVT buffer of 131072 points for axis 3.\n
+ * "Cfg.SetAxisPvtBufferSize(3,131072)" //Command string to ecmcCmdParser.c\n
+ */
+int setAxisPvtBufferSize(int axisIndex,
+                         int points);
+
 # ifdef __cplusplus
 }
 # endif  // ifdef __cplusplus
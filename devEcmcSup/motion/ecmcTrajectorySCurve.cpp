@@ -0,0 +1,356 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcTrajectorySCurve.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include "ecmcTrajectorySCurve.h"
+
+// Iterations for peak velocity of short moves (resolution velMax/2^50)
+#define ECMC_TRAJ_SCURVE_PEAK_VEL_ITERATIONS 50
+
+ecmcTrajectorySCurve::ecmcTrajectorySCurve() {
+  initVars();
+}
+
+ecmcTrajectorySCurve::~ecmcTrajectorySCurve() {}
+
+void ecmcTrajectorySCurve::initVars() {
+  errorReset();
+
+  for (int i = 0; i < ECMC_TRAJ_SCURVE_MAX_SEGMENTS; i++) {
+    startTime_[i] = 0;
+    startPos_[i]  = 0;
+    startVel_[i]  = 0;
+    startAcc_[i]  = 0;
+    jerk_[i]      = 0;
+  }
+  segmentCount_ = 0;
+  segmentIndex_ = 0;
+  endTime_      = 0;
+  endPos_       = 0;
+  endVel_       = 0;
+  endAcc_       = 0;
+  accMax_       = 0;
+  decMax_       = 0;
+  jerkMax_      = 0;
+}
+
+int ecmcTrajectorySCurve::init(double vel,
+                               double acc,
+                               double accMax,
+                               double decMax,
+                               double jerkMax) {
+  segmentCount_ = 0;
+  segmentIndex_ = 0;
+  endTime_      = 0;
+  endPos_       = 0;
+  endVel_       = vel;
+  endAcc_       = acc;
+  accMax_       = std::abs(accMax);
+  decMax_       = std::abs(decMax);
+  jerkMax_      = std::abs(jerkMax);
+
+  if (jerkMax_ <= 0) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_TRAJ_SCURVE_JERK_INVALID);
+  }
+
+  if ((accMax_ <= 0) || (decMax_ <= 0)) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_TRAJ_SCURVE_ACC_INVALID);
+  }
+  errorReset();
+  return 0;
+}
+
+int ecmcTrajectorySCurve::addSegment(double duration, double jerk) {
+  if (duration <= 0) {
+    return 0;
+  }
+
+  if (segmentCount_ >= ECMC_TRAJ_SCURVE_MAX_SEGMENTS) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_TRAJ_SCURVE_SEGMENT_OVERFLOW);
+  }
+
+  double t = duration;
+
+  startTime_[segmentCount_] = endTime_;
+  startPos_[segmentCount_]  = endPos_;
+  startVel_[segmentCount_]  = endVel_;
+  startAcc_[segmentCount_]  = endAcc_;
+  jerk_[segmentCount_]      = jerk;
+  segmentCount_++;
+
+  endPos_ += endVel_ * t + endAcc_ * t * t / 2 + jerk * t * t * t / 6;
+  endVel_ += endAcc_ * t + jerk * t * t / 2;
+  endAcc_ += jerk * t;
+  endTime_ += t;
+  return 0;
+}
+
+/*
+ * Ramp start acceleration to zero (all other segments start and end at
+ * zero acceleration).
+ */
+void ecmcTrajectorySCurve::addJerkToZeroAcc() {
+  if (endAcc_ == 0) {
+    return;
+  }
+
+  addSegment(std::abs(endAcc_) / jerkMax_, endAcc_ > 0 ? -jerkMax_ : jerkMax_);
+  endAcc_ = 0;
+}
+
+/*
+ * Time for a velocity change from and to zero acceleration. Max
+ * acceleration is only reached if velDiff >= accMax^2/jerk.
+ */
+double ecmcTrajectorySCurve::velChangeTime(double velDiff, double accMax) {
+  if (velDiff <= 0) {
+    return 0;
+  }
+
+  if (velDiff * jerkMax_ >= accMax * accMax) {
+    return velDiff / accMax + accMax / jerkMax_;
+  }
+  return 2 * sqrt(velDiff / jerkMax_);
+}
+
+/*
+ * Distance of a velocity change (symmetric acceleration profile, so the
+ * average velocity is the mean of start and end velocity).
+ */
+double ecmcTrajectorySCurve::velChangeDist(double velFrom,
+                                           double velTo,
+                                           double accMax) {
+  return (velFrom + velTo) / 2 * velChangeTime(std::abs(velTo - velFrom),
+                                               accMax);
+}
+
+int ecmcTrajectorySCurve::addVelChange(double velFrom,
+                                       double velTo,
+                                       double accMax) {
+  double velDiff = std::abs(velTo - velFrom);
+
+  if (velDiff <= 0) {
+    return 0;
+  }
+
+  double jerk       = velTo > velFrom ? jerkMax_ : -jerkMax_;
+  double jerkTime   = 0;
+  double constTime  = 0;
+
+  if (velDiff * jerkMax_ >= accMax * accMax) {
+    jerkTime  = accMax / jerkMax_;
+    constTime = velDiff / accMax - jerkTime;
+  } else {
+    jerkTime = sqrt(velDiff / jerkMax_);
+  }
+
+  int errorCode = addSegment(jerkTime, jerk);
+
+  if (!errorCode) {
+    errorCode = addSegment(constTime, 0);
+  }
+
+  if (!errorCode) {
+    errorCode = addSegment(jerkTime, -jerk);
+  }
+
+  // Remove numerical residuals
+  endVel_ = velTo;
+  endAcc_ = 0;
+  return errorCode;
+}
+
+/*
+ * Distance (positive direction) to reach velPeak from vel and then stop.
+ */
+double ecmcTrajectorySCurve::posMoveDist(double vel, double velPeak) {
+  return velChangeDist(vel, velPeak, velPeak > vel ? accMax_ : decMax_) +
+         velChangeDist(velPeak, 0, decMax_);
+}
+
+int ecmcTrajectorySCurve::planPos(double distance,
+                                  double vel,
+                                  double acc,
+                                  double velMax,
+                                  double accMax,
+                                  double decMax,
+                                  double jerkMax) {
+  int errorCode = init(vel, acc, accMax, decMax, jerkMax);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  velMax = std::abs(velMax);
+
+  if (velMax <= 0) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_TRAJ_SCURVE_VEL_INVALID);
+  }
+
+  addJerkToZeroAcc();
+
+  double remaining = distance - endPos_;
+  double dir       = remaining >= 0 ? 1 : -1;
+
+  // Moving away from target: Stop first
+  if (dir * endVel_ < 0) {
+    addVelChange(endVel_, 0, decMax_);
+    remaining = distance - endPos_;
+    dir       = remaining >= 0 ? 1 : -1;
+  }
+
+  // Not possible to stop before target: Stop and move back
+  if (velChangeDist(dir * endVel_, 0, decMax_) > std::abs(remaining)) {
+    addVelChange(endVel_, 0, decMax_);
+    remaining = distance - endPos_;
+    dir       = remaining >= 0 ? 1 : -1;
+  }
+
+  double startVel = dir * endVel_;
+  double absDist  = std::abs(remaining);
+  double velPeak  = velMax;
+
+  if (posMoveDist(startVel, velMax) > absDist) {
+    // Max velocity not reached (or start velocity above max). The distance
+    // for startVel is always within reach (checked above).
+    double velOK  = startVel;
+    double velBad = velMax;
+
+    for (int i = 0; i < ECMC_TRAJ_SCURVE_PEAK_VEL_ITERATIONS; i++) {
+      double velMid = (velOK + velBad) / 2;
+
+      if (posMoveDist(startVel, velMid) <= absDist) {
+        velOK = velMid;
+      } else {
+        velBad = velMid;
+      }
+    }
+    velPeak = velOK;
+  }
+
+  errorCode = addVelChange(dir * startVel,
+                           dir * velPeak,
+                           velPeak > startVel ? accMax_ : decMax_);
+
+  if (!errorCode && (velPeak > 0)) {
+    errorCode = addSegment((absDist - posMoveDist(startVel, velPeak)) / velPeak,
+                           0);
+  }
+
+  if (!errorCode) {
+    errorCode = addVelChange(dir * velPeak, 0, decMax_);
+  }
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  endPos_ = distance;
+  return 0;
+}
+
+int ecmcTrajectorySCurve::planVel(double vel,
+                                  double acc,
+                                  double velTarget,
+                                  double accMax,
+                                  double decMax,
+                                  double jerkMax) {
+  int errorCode = init(vel, acc, accMax, decMax, jerkMax);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  addJerkToZeroAcc();
+
+  // Change of direction: Stop first
+  if (endVel_ * velTarget < 0) {
+    errorCode = addVelChange(endVel_, 0, decMax_);
+
+    if (errorCode) {
+      return errorCode;
+    }
+  }
+
+  return addVelChange(endVel_,
+                      velTarget,
+                      std::abs(velTarget) > std::abs(endVel_) ?
+                      accMax_ : decMax_);
+}
+
+int ecmcTrajectorySCurve::planStop(double vel,
+                                   double acc,
+                                   double decMax,
+                                   double jerkMax) {
+  int errorCode = init(vel, acc, decMax, decMax, jerkMax);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  addJerkToZeroAcc();
+
+  return addVelChange(endVel_, 0, decMax_);
+}
+
+void ecmcTrajectorySCurve::evaluate(double  time,
+                                    double *pos,
+                                    double *vel,
+                                    double *acc) {
+  if ((time >= endTime_) || (segmentCount_ == 0)) {
+    double t = time - endTime_;
+
+    if (t < 0) {
+      t = 0;
+    }
+    *pos = endPos_ + endVel_ * t;
+    *vel = endVel_;
+    *acc = 0;
+    return;
+  }
+
+  if ((segmentIndex_ >= segmentCount_) ||
+      (time < startTime_[segmentIndex_])) {
+    segmentIndex_ = 0;
+  }
+
+  while (segmentIndex_ < segmentCount_ - 1 &&
+         time >= startTime_[segmentIndex_ + 1]) {
+    segmentIndex_++;
+  }
+
+  int    i = segmentIndex_;
+  double t = time - startTime_[i];
+
+  *pos = startPos_[i] + startVel_[i] * t + startAcc_[i] * t * t / 2 +
+         jerk_[i] * t * t * t / 6;
+  *vel = startVel_[i] + startAcc_[i] * t + jerk_[i] * t * t / 2;
+  *acc = startAcc_[i] + jerk_[i] * t;
+}
+
+double ecmcTrajectorySCurve::getDuration() {
+  return endTime_;
+}
+
+double ecmcTrajectorySCurve::getEndPos() {
+  return endPos_;
+}
@@ -0,0 +1,131 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcTrajectorySCurve.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMCTRAJECTORYSCURVE_H_
+#define ECMCTRAJECTORYSCURVE_H_
+
+#include <cmath>
+#include "../main/ecmcDefinitions.h"
+#include "../main/ecmcError.h"
+
+#define ERROR_TRAJ_SCURVE_JERK_INVALID 0x14E20
+#define ERROR_TRAJ_SCURVE_ACC_INVALID 0x14E21
+#define ERROR_TRAJ_SCURVE_VEL_INVALID 0x14E22
+#define ERROR_TRAJ_SCURVE_SEGMENT_OVERFLOW 0x14E23
+
+#define ECMC_TRAJ_SCURVE_MAX_SEGMENTS 16
+
+/**
+ * \class ecmcTrajectorySCurve
+ *
+ * \brief Jerk limited (s-shaped) motion profile
+ *
+ * The profile is planned once per move (or stop/velocity change) and then
+ * evaluated analytically for each sample (no per-cycle integration).
+ * A profile is a list of constant jerk segments. A positioning from rest
+ * consists of the classic seven segments:
+ * 1. Jerk up to max acceleration
+ * 2. Constant acceleration
+ * 3. Jerk down to zero acceleration (max velocity reached)
+ * 4. Constant velocity
+ * 5-7. Same as 1-3 for the deceleration
+ *
+ * Segments with zero length are skipped (max acceleration or max velocity
+ * not reached for short moves). Moves can be planned from any state:
+ * a non zero start acceleration is first ramped to zero, a start velocity
+ * away from the target (or too high to stop before the target) results in
+ * a stop followed by a move back.
+ *
+ * All positions are relative to the start of the profile.
+ */
+class ecmcTrajectorySCurve : public ecmcError {
+ public:
+  ecmcTrajectorySCurve();
+  ~ecmcTrajectorySCurve();
+
+  /// Move a distance (signed) and stop.
+  int    planPos(double distance,
+                 double vel,
+                 double acc,
+                 double velMax,
+                 double accMax,
+                 double decMax,
+                 double jerkMax);
+
+  /// Change to a new velocity (constant after end of profile).
+  int    planVel(double vel,
+                 double acc,
+                 double velTarget,
+                 double accMax,
+                 double decMax,
+                 double jerkMax);
+
+  /// Stop as fast as allowed by deceleration and jerk.
+  int    planStop(double vel,
+                  double acc,
+                  double decMax,
+                  double jerkMax);
+
+  /** \brief Position, velocity and acceleration at time t.
+   * After the end of the profile the end velocity is kept.
+   */
+  void   evaluate(double  time,
+                  double *pos,
+                  double *vel,
+                  double *acc);
+
+  /// Returns duration of profile [s].
+  double getDuration();
+
+  /// Returns position at end of profile.
+  double getEndPos();
+
+ private:
+  void   initVars();
+  int    init(double vel,
+              double acc,
+              double accMax,
+              double decMax,
+              double jerkMax);
+  int    addSegment(double duration,
+                    double jerk);
+  void   addJerkToZeroAcc();
+  int    addVelChange(double velFrom,
+                      double velTo,
+                      double accMax);
+  double velChangeTime(double velDiff,
+                       double accMax);
+  double velChangeDist(double velFrom,
+                       double velTo,
+                       double accMax);
+  double posMoveDist(double vel,
+                     double velPeak);
+
+  // Segments (start state of each segment)
+  double startTime_[ECMC_TRAJ_SCURVE_MAX_SEGMENTS];
+  double startPos_[ECMC_TRAJ_SCURVE_MAX_SEGMENTS];
+  double startVel_[ECMC_TRAJ_SCURVE_MAX_SEGMENTS];
+  double startAcc_[ECMC_TRAJ_SCURVE_MAX_SEGMENTS];
+  double jerk_[ECMC_TRAJ_SCURVE_MAX_SEGMENTS];
+  int    segmentCount_;
+  // Last segment evaluated (time normally increasing)
+  int    segmentIndex_;
+  // End of planned segments
+  double endTime_;
+  double endPos_;
+  double endVel_;
+  double endAcc_;
+  double accMax_;
+  double decMax_;
+  double jerkMax_;
+};
+
+#endif  // ifndef ECMCTRAJECTORYSCURVE_H_
@@ -77,6 +77,14 @@ void ecmcTrajectoryTrapetz::initVars() {
   setDirection_            = ECMC_DIR_FORWARD;
   actDirection_            = ECMC_DIR_FORWARD;
   latchedStopMode_         = ECMC_STOP_MODE_RUN;
+  profileType_             = ECMC_TRAJ_PROFILE_TRAPETZ;
+  blendRamp_               = false;
+  sCurvePlanned_           = false;
+  sCurveStopping_          = false;
+  sCurveEmergency_         = false;
+  sCurveTime_              = 0;
+  sCurveStartPos_          = 0;
+  accelerationSetpoint_    = 0;
 }
 
 void ecmcTrajectoryTrapetz::initTraj() {
@@ -97,6 +105,8 @@ void ecmcTrajectoryTrapetz::setCurrentPosSet(double posSet) {
   posSetMinus1_            = currentPositionSetpoint_;
   prevStepSize_            = 0;
   velocity_                = 0;
+  accelerationSetpoint_    = 0;
+  sCurvePlanned_           = false;
   setDirection_            = ECMC_DIR_STANDSTILL;
   actDirection_            = ECMC_DIR_STANDSTILL;
 }
@@ -122,6 +132,8 @@ double ecmcTrajectoryTrapetz::getNextPosSet() {
     velocity_     = 0;
     setDirection_ = ECMC_DIR_STANDSTILL;
     actDirection_ = ECMC_DIR_STANDSTILL;
+    accelerationSetpoint_ = 0;
+    sCurvePlanned_        = false;
     return currentPositionSetpoint_;
   }
   index_++;
@@ -131,6 +143,23 @@ double ecmcTrajectoryTrapetz::getNextPosSet() {
     data_->refreshInterlocks();
   }
 
+  if (useSCurve()) {
+    nextSetpoint = internalTrajSCurve(&nextVelocity, &stopped);
+
+    if (stopped) {
+      setDirection_ = ECMC_DIR_STANDSTILL;
+      actDirection_ = ECMC_DIR_STANDSTILL;
+      busy_         = false;
+      nextVelocity  = 0;
+    }
+    actDirection_ = checkDirection(currentPositionSetpoint_,
+                                   nextSetpoint);
+    currentPositionSetpoint_ = updateSetpoint(nextSetpoint, nextVelocity);
+    // Direction can change within a profile (used by emergency stop)
+    prevStepSize_ = velocity_ * sampleTime_;
+    return currentPositionSetpoint_;
+  }
+
   nextSetpoint = internalTraj(&nextVelocity);
   motionDirection nextDir = checkDirection(currentPositionSetpoint_,
                                            nextSetpoint);
@@ -257,6 +286,9 @@ double ecmcTrajectoryTrapetz::movePos(double currSetpoint,
   if (!stopping) {
     if (std::abs(currVelo) < std::abs(targetVelo)) {
       positionStep = std::abs(prevStepSize_) + stepACC_;
+    } else if (blendRamp_ && (std::abs(prevStepSize_) - stepDEC_ > stepNOM_)) {
+      // Ramp down to lowered target velocity of blended queue segment
+      positionStep = std::abs(prevStepSize_) - stepDEC_;
     } else {
       positionStep = stepNOM_;
     }
@@ -346,6 +378,11 @@ double ecmcTrajectoryTrapetz::distToStop(double vel) {
 void ecmcTrajectoryTrapetz::setTargetPos(double pos) {
   targetPosition_ = pos;
   index_          = 0;
+  sCurvePlanned_  = false;
+}
+
+void ecmcTrajectoryTrapetz::setBlendRamp(bool ramp) {
+  blendRamp_ = ramp;
 }
 
 bool ecmcTrajectoryTrapetz::getBusy() {
@@ -362,6 +399,7 @@ double ecmcTrajectoryTrapetz::getVel() {
 
 void ecmcTrajectoryTrapetz::setTargetVel(double velTarget) {
   velocityTarget_ = velTarget;
+  sCurvePlanned_  = false;
   initTraj();
 }
 
@@ -370,7 +408,8 @@ double ecmcTrajectoryTrapetz::getTargetVel() {
 }
 
 void ecmcTrajectoryTrapetz::setAcc(double acc) {
-  acceleration_ = acc;
+  acceleration_  = acc;
+  sCurvePlanned_ = false;
   initTraj();
 }
 
@@ -380,7 +419,8 @@ void ecmcTrajectoryTrapetz::setEmergDec(double dec) {
 }
 
 void ecmcTrajectoryTrapetz::setDec(double dec) {
-  deceleration_ = dec;
+  deceleration_  = dec;
+  sCurvePlanned_ = false;
 
   if (decelerationEmergency_ == 0) {
     decelerationEmergency_ = deceleration_ * 3;
@@ -388,12 +428,35 @@ void ecmcTrajectoryTrapetz::setDec(double dec) {
   initTraj();
 }
 
-// Not used
 void ecmcTrajectoryTrapetz::setJerk(double jerk) {
-  jerk_ = jerk;
+  jerk_          = jerk;
+  sCurvePlanned_ = false;
   initTraj();
 }
 
+int ecmcTrajectoryTrapetz::setProfileType(int type) {
+  if ((type != ECMC_TRAJ_PROFILE_TRAPETZ) &&
+      (type != ECMC_TRAJ_PROFILE_SCURVE)) {
+    LOGERR("%s/%s:%d: ERROR: Profile type out of range (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_TRAJ_PROFILE_TYPE_OUT_OF_RANGE);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_TRAJ_PROFILE_TYPE_OUT_OF_RANGE);
+  }
+
+  profileType_   = type;
+  sCurvePlanned_ = false;
+  return 0;
+}
+
+int ecmcTrajectoryTrapetz::getProfileType() {
+  return profileType_;
+}
+
 double ecmcTrajectoryTrapetz::getAcc() {
   return acceleration_;
 }
@@ -402,8 +465,12 @@ double ecmcTrajectoryTrapetz::getDec() {
   return deceleration_;
 }
 
+double ecmcTrajectoryTrapetz::getEmergDec() {
+  return decelerationEmergency_;
+}
+
 double ecmcTrajectoryTrapetz::getJerk() {
-  return jerk_;  // Not used
+  return jerk_;
 }
 
 double ecmcTrajectoryTrapetz::getTargetPos() {
@@ -425,6 +492,8 @@ void ecmcTrajectoryTrapetz::setEnable(bool enable) {
     prevStepSize_            = 0;
     velocity_                = 0;
     distToStop_              = 0;
+    accelerationSetpoint_    = 0;
+    sCurvePlanned_           = false;
   }
 }
 
@@ -451,6 +520,7 @@ int ecmcTrajectoryTrapetz::setExecute(bool execute) {
 
   if (!executeOld_ && execute_) {
     currentPositionSetpoint_ = startPosition_;
+    blendRamp_               = false;
 
     switch (motionMode_) {
     case ECMC_MOVE_MODE_VEL:
@@ -529,9 +599,14 @@ int ecmcTrajectoryTrapetz::setExecute(bool execute) {
     }
 
     if (!busy_) {
-      posSetMinus1_ = currentPositionSetpoint_;
-      velocity_     = 0;
+      posSetMinus1_         = currentPositionSetpoint_;
+      velocity_             = 0;
+      accelerationSetpoint_ = 0;
     }
+    // New profile from current state
+    sCurvePlanned_   = false;
+    sCurveStopping_  = false;
+    sCurveEmergency_ = false;
     initTraj();
     currentPositionSetpoint_ = startPosition_;
     busy_                    = true;  // Trigger new trajectory
@@ -564,6 +639,18 @@ int ecmcTrajectoryTrapetz::validate() {
                       __LINE__,
                       ERROR_TRAJ_INVALID_SAMPLE_TIME);
   }
+
+  if ((profileType_ == ECMC_TRAJ_PROFILE_SCURVE) && (jerk_ <= 0)) {
+    LOGERR("%s/%s:%d: ERROR: Jerk must be set for s-curve profile (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_TRAJ_SCURVE_JERK_INVALID);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_TRAJ_SCURVE_JERK_INVALID);
+  }
   return 0;
 }
 
@@ -600,6 +687,8 @@ int ecmcTrajectoryTrapetz::initStopRamp(double currentPos,
   currentPositionSetpoint_ = currentPos;
   velocity_                = currentVel;
   prevStepSize_            = velocity_ * sampleTime_;
+  accelerationSetpoint_    = currentAcc;
+  sCurvePlanned_           = false;
   return 0;
 }
 
@@ -653,3 +742,157 @@ double ecmcTrajectoryTrapetz::checkModuloPos(double pos,
   
   return posSetTemp;
 }
+
+bool ecmcTrajectoryTrapetz::useSCurve() {
+  return profileType_ == ECMC_TRAJ_PROFILE_SCURVE && jerk_ > 0;
+}
+
+/* Plan jerk limited profile from current setpoint state */
+int ecmcTrajectoryTrapetz::planSCurve() {
+  int errorCode = 0;
+
+  sCurveTime_     = 0;
+  sCurveStartPos_ = currentPositionSetpoint_;
+
+  if (sCurveStopping_) {
+    errorCode = sCurve_.planStop(velocity_,
+                                 accelerationSetpoint_,
+                                 deceleration_,
+                                 jerk_);
+  } else if (motionMode_ == ECMC_MOVE_MODE_VEL) {
+    errorCode = sCurve_.planVel(velocity_,
+                                accelerationSetpoint_,
+                                velocityTarget_,
+                                acceleration_,
+                                deceleration_,
+                                jerk_);
+  } else {
+    double distance = 0;
+
+    if (targetPosition_ != currentPositionSetpoint_) {
+      distance = dist(currentPositionSetpoint_, targetPosition_, setDirection_);
+    }
+    errorCode = sCurve_.planPos(distance,
+                                velocity_,
+                                accelerationSetpoint_,
+                                velocityTarget_,
+                                acceleration_,
+                                deceleration_,
+                                jerk_);
+  }
+
+  if (errorCode) {
+    LOGERR("%s/%s:%d: ERROR: Failed to plan s-curve profile (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           errorCode);
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
+
+  sCurvePlanned_ = true;
+  return 0;
+}
+
+double ecmcTrajectoryTrapetz::internalTrajSCurve(double *velocity,
+                                                 bool   *stopped) {
+  double pos = 0;
+  double vel = 0;
+  double acc = 0;
+
+  *stopped  = false;
+  *velocity = velocity_;
+
+  if (!sCurvePlanned_ && !sCurveEmergency_) {
+    if (planSCurve()) {
+      busy_                 = false;
+      *velocity             = 0;
+      accelerationSetpoint_ = 0;
+      return currentPositionSetpoint_;
+    }
+  }
+
+  // Same interlock checks as trapezoidal (direction of next setpoint)
+  motionDirection nextDir = velocity_ > 0 ? ECMC_DIR_FORWARD :
+                            velocity_ < 0 ? ECMC_DIR_BACKWARD :
+                            ECMC_DIR_STANDSTILL;
+
+  if (!sCurveEmergency_) {
+    sCurve_.evaluate(sCurveTime_ + sampleTime_, &pos, &vel, &acc);
+    nextDir = vel > 0 ? ECMC_DIR_FORWARD :
+              vel < 0 ? ECMC_DIR_BACKWARD : nextDir;
+  }
+
+  bool stopCmd = data_->command_.trajSource != ECMC_DATA_SOURCE_INTERNAL ||
+                 ((nextDir == ECMC_DIR_BACKWARD) &&
+                  data_->interlocks_.trajSummaryInterlockBWD) ||
+                 ((nextDir == ECMC_DIR_FORWARD) &&
+                  data_->interlocks_.trajSummaryInterlockFWD);
+
+  // Emergency: Shortest stop (trapezoidal ramp with emergency deceleration)
+  if (stopCmd &&
+      (data_->interlocks_.currStopMode == ECMC_STOP_MODE_EMERGENCY)) {
+    sCurveEmergency_      = true;
+    sCurvePlanned_        = false;
+    accelerationSetpoint_ = 0;
+    return moveStop(ECMC_STOP_MODE_EMERGENCY,
+                    currentPositionSetpoint_,
+                    velocity_,
+                    velocityTarget_,
+                    stopped,
+                    velocity);
+  }
+
+  // Start of stop or resume of motion: New profile from current state
+  if (sCurveEmergency_ || (stopCmd != sCurveStopping_)) {
+    sCurveEmergency_ = false;
+    sCurveStopping_  = stopCmd;
+
+    if (planSCurve()) {
+      busy_                 = false;
+      *velocity             = 0;
+      accelerationSetpoint_ = 0;
+      return currentPositionSetpoint_;
+    }
+    sCurve_.evaluate(sCurveTime_ + sampleTime_, &pos, &vel, &acc);
+  }
+
+  sCurveTime_          += sampleTime_;
+  accelerationSetpoint_ = acc;
+  double nextSetpoint   = sCurveStartPos_ + pos;
+
+  // Profile done (velocity mode continues with constant velocity)
+  if (sCurveTime_ >= sCurve_.getDuration()) {
+    if (sCurveStopping_) {
+      *stopped              = true;
+      vel                   = 0;
+      accelerationSetpoint_ = 0;
+      nextSetpoint          = wrapModuloPos(nextSetpoint);
+      // To allow for at target monitoring to go high (and then also bBusy)
+      targetPosition_       = nextSetpoint;
+    } else if (motionMode_ == ECMC_MOVE_MODE_POS) {
+      nextSetpoint          = targetPosition_;
+      vel                   = 0;
+      accelerationSetpoint_ = 0;
+      busy_                 = false;
+    }
+  }
+
+  *velocity = vel;
+  return wrapModuloPos(nextSetpoint);
+}
+
+double ecmcTrajectoryTrapetz::wrapModuloPos(double pos) {
+  double range = data_->command_.moduloRange;
+
+  if (range <= 0) {
+    return pos;
+  }
+
+  double posWrapped = fmod(pos, range);
+
+  if (posWrapped < 0) {
+    posWrapped += range;
+  }
+  return posWrapped;
+}
@@ -19,6 +19,7 @@
 #include "../main/ecmcError.h"
 #include "ecmcEncoder.h"
 #include "ecmcAxisData.h"
+#include "ecmcTrajectorySCurve.h"
 
 /// Error codes for class ecmcTrajectoryTrapetz
 #define ERROR_TRAJ_EXT_ENC_NULL 0x14E00
@@ -45,6 +46,7 @@
 #define ERROR_TRAJ_MAX_SPEED_INTERLOCK 0x14E15
 #define ERROR_TRAJ_MOD_FACTOR_OUT_OF_RANGE 0x14E16
 #define ERROR_TRAJ_MOD_TYPE_OUT_OF_RANGE 0x14E17
+#define ERROR_TRAJ_PROFILE_TYPE_OUT_OF_RANGE 0x14E18
 
 /**
  * \class ecmcTrajectoryTrapetz
@@ -64,6 +66,12 @@
  * 3. Absolute positioning
  * 4. Interlocks (hard limits, soft limits, external interlocks)
  *
+ * Optionally a jerk limited profile can be used instead (profile type
+ * ECMC_TRAJ_PROFILE_SCURVE, see ecmcTrajectorySCurve). The profile is then
+ * planned once for each move, stop or change of target and evaluated
+ * analytically each sample. Emergency stops always use the trapezoidal
+ * ramp (shortest stop).
+ *
  * \date $Date: 2005/04/14 14:16:20 $
  *
  * Contact: anders.sandstrom@esss.se
@@ -132,17 +140,30 @@ class ecmcTrajectoryTrapetz : public ecmcError {
    */
   void            setEmergDec(double dec);
 
-  /** Currently not implemented (will be used when 
-   * s-shaped trajectory is implemented).
-   */
+  /// Returns emergency deceleration.
+  double          getEmergDec();
+
+  /// Sets jerk (used by profile type ECMC_TRAJ_PROFILE_SCURVE).
   void            setJerk(double jerk);
 
-  /// Not used.
+  /// Returns jerk.
   double          getJerk();
 
+  /// Sets profile type (trajProfileType).
+  int             setProfileType(int type);
+
+  /// Returns profile type.
+  int             getProfileType();
+
   /// Sets target position (end position of trajectory).
   void            setTargetPos(double pos);
 
+  /** \brief Ramp down with the deceleration if the target velocity is
+   * lowered during a positioning (blended motion queue segments).
+   * Otherwise the velocity steps down. Reset when a motion is started.
+   */
+  void            setBlendRamp(bool ramp);
+
   /// returns target position (end position of trajectory).
   double          getTargetPos();
 
@@ -194,6 +215,11 @@ class ecmcTrajectoryTrapetz : public ecmcError {
                        motionDirection direction);
   double          checkModuloPos(double pos,
                        motionDirection direction);
+  bool            useSCurve();
+  int             planSCurve();
+  double          internalTrajSCurve(double *velocity,
+                                     bool   *stopped);
+  double          wrapModuloPos(double pos);
   double acceleration_;
   double deceleration_;
   double decelerationEmergency_;
@@ -224,5 +250,16 @@ class ecmcTrajectoryTrapetz : public ecmcError {
   interlockTypes interlockStatus_;
   ecmcAxisData *data_;
   stopMode latchedStopMode_;  
+  int profileType_;
+  // Ramp down to lowered target velocity (blended queue segment)
+  bool blendRamp_;
+  // Jerk limited profile
+  ecmcTrajectorySCurve sCurve_;
+  bool sCurvePlanned_;
+  bool sCurveStopping_;
+  bool sCurveEmergency_;
+  double sCurveTime_;
+  double sCurveStartPos_;
+  double accelerationSetpoint_;
 };
 #endif  // ifndef SRC_ECMCTRAJECTORYTRAPETZ_H_
@@ -286,12 +286,11 @@ asynStatus ecmcMotorRecordAxis::readBackSoftLimits(void)
   int    enabledFwd = 0,  enabledBwd = 0;
   double fValueFwd = 0.0, fValueBwd  = 0.0;
   
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
+  // Config values (written through command queue), no lock needed
   fValueBwd  = drvlocal.ecmcAxis->getMon()->getSoftLimitBwd();
   fValueFwd  = drvlocal.ecmcAxis->getMon()->getSoftLimitFwd();
   enabledBwd = drvlocal.ecmcAxis->getMon()->getEnableSoftLimitBwd();
   enabledFwd = drvlocal.ecmcAxis->getMon()->getEnableSoftLimitFwd();
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
 
   pC_->setIntegerParam(axisNo_, pC_->ecmcMotorRecordCfgDLLM_En_, enabledBwd);
   pC_->setDoubleParam(axisNo_, pC_->ecmcMotorRecordCfgDLLM_, fValueBwd);
@@ -310,9 +309,7 @@ asynStatus ecmcMotorRecordAxis::readScaling(int axisID)
 {
   int errorCode =0;
   double num = 0, denom = 0;
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
   errorCode=drvlocal.ecmcAxis->getEncScaleNum(&num);
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
   if(errorCode) {
     LOGERR(
       "%s/%s:%d: ERROR: function getEncScaleNum() returned error (0x%x).\n",
@@ -322,9 +319,7 @@ asynStatus ecmcMotorRecordAxis::readScaling(int axisID)
       errorCode);
     return asynError;
   }
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
   errorCode=drvlocal.ecmcAxis->getEncScaleDenom(&denom);
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
   if(errorCode) {
     LOGERR(
       "%s/%s:%d: ERROR: function getEncScaleDenom() returned error (0x%x).\n",
@@ -366,7 +361,6 @@ asynStatus ecmcMotorRecordAxis::readMonitoring(int axisID)
   int    poslag_enable, attarget_enable;
 
   // Position lag monitoring (following error)
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
   poslag_tol = drvlocal.ecmcAxis->getMon()->getPosLagTol();
   poslag_time = drvlocal.ecmcAxis->getMon()->getPosLagTime() * 1 / mcuFrequency;
   poslag_enable = drvlocal.ecmcAxis->getMon()->getEnableLagMon();
@@ -375,7 +369,6 @@ asynStatus ecmcMotorRecordAxis::readMonitoring(int axisID)
   attarget_tol = drvlocal.ecmcAxis->getMon()->getAtTargetTol();
   attarget_time = drvlocal.ecmcAxis->getMon()->getAtTargetTime() * 1 / mcuFrequency;
   attarget_enable = drvlocal.ecmcAxis->getMon()->getEnableAtTargetMon();
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
 
   // At target monitoring must be enabled
   drvlocal.illegalInTargetWindow = (!attarget_enable || !attarget_tol);
@@ -403,10 +396,8 @@ asynStatus ecmcMotorRecordAxis::readBackVelocities(int axisID)
 {
   double vel_max, acceleration;
   
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
   vel_max = drvlocal.ecmcAxis->getMon()->getMaxVel();
   acceleration = drvlocal.ecmcAxis->getTraj()->getAcc();
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
 
   if (drvlocal.manualVelocFast > 0.0) {
     updateCfgValue(pC_->ecmcMotorRecordCfgVELO_, drvlocal.manualVelocFast, "velo");
@@ -517,33 +508,26 @@ asynStatus ecmcMotorRecordAxis::move(double position, int relative, double minVe
   
   int errorCode = 0;
 
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-
-    if(drvlocal.ecmcAxis->getBlockExtCom()) {
-      if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
-      LOGERR(
-        "%s/%s:%d: ERROR: Communication to ECMC blocked, motion commands not allowed..\n",
-        __FILE__,
-        __FUNCTION__,
-        __LINE__);
-      return asynError;
-    }
+  if(drvlocal.ecmcAxis->getBlockExtCom()) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Communication to ECMC blocked, motion commands not allowed..\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__);
+    return asynError;
+  }
 
     //if(drvlocal.ecmcAxis->getAllowPos()) {
 
-    if(relative) {
-      errorCode = drvlocal.ecmcAxis->moveRelativePosition(position,
-                                                          maxVelocity,
-                                                          acceleration,
-                                                          acceleration);
-    }
-    else
-    {
-      errorCode = drvlocal.ecmcAxis->moveAbsolutePosition(position,
-                                                          maxVelocity,
-                                                          acceleration,
-                                                          acceleration);        
-    }    
+    // Executed by ecmc realtime
+    ecmcAxisCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type      = relative ? ECMC_AXIS_CMD_MOVE_REL : ECMC_AXIS_CMD_MOVE_ABS;
+    cmd.values[0] = position;
+    cmd.values[1] = maxVelocity;
+    cmd.values[2] = acceleration;
+    cmd.values[3] = acceleration;
+    errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
     //} else {
     //  LOGERR(
     //    "%s/%s:%d: ERROR: Constant velo disabled and therefore not allowed.\n",
@@ -552,8 +536,6 @@ asynStatus ecmcMotorRecordAxis::move(double position, int relative, double minVe
     //    __LINE__);
     //}
 
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
-
 #ifndef motorWaitPollsBeforeReadyString
   drvlocal.waitNumPollsBeforeReady += WAITNUMPOLLSBEFOREREADY;
 #endif
@@ -632,20 +614,27 @@ asynStatus ecmcMotorRecordAxis::home(double minVelocity, double maxVelocity, dou
   }
 
   int errorCode = 0;
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-
-    if(drvlocal.ecmcAxis->getBlockExtCom()) {
-      if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
-      LOGERR(
-        "%s/%s:%d: ERROR: Communication to ECMC blocked, motion commands not allowed..\n",
-        __FILE__,
-        __FUNCTION__,
-        __LINE__);
-      return asynError;
-    }
+  if(drvlocal.ecmcAxis->getBlockExtCom()) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Communication to ECMC blocked, motion commands not allowed..\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__);
+    return asynError;
+  }
 
     //if(drvlocal.ecmcAxis->getAllowHome()) {
-    errorCode =  drvlocal.ecmcAxis->moveHome(cmdData,homPos,velToCam,velOffCam,accHom,accHom);
+    // Executed by ecmc realtime
+    ecmcAxisCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type      = ECMC_AXIS_CMD_MOVE_HOME;
+    cmd.intValue  = cmdData;
+    cmd.values[0] = homPos;
+    cmd.values[1] = velToCam;
+    cmd.values[2] = velOffCam;
+    cmd.values[3] = accHom;
+    cmd.values[4] = accHom;
+    errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
     //} else
     //{
     //  LOGERR(
@@ -655,8 +644,6 @@ asynStatus ecmcMotorRecordAxis::home(double minVelocity, double maxVelocity, dou
     //    __LINE__);    
     //}
 
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
-
 #ifndef motorWaitPollsBeforeReadyString
   drvlocal.waitNumPollsBeforeReady += WAITNUMPOLLSBEFOREREADY;
 #endif
@@ -708,22 +695,24 @@ asynStatus ecmcMotorRecordAxis::moveVelocity(double minVelocity, double maxVeloc
   }
 
   int errorCode = 0;
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-
-    if(drvlocal.ecmcAxis->getBlockExtCom()) {
-      if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
-      LOGERR(
-        "%s/%s:%d: ERROR: Communication to ECMC blocked, motion commands not allowed..\n",
-        __FILE__,
-        __FUNCTION__,
-        __LINE__);
-      return asynError;
-    }
+  if(drvlocal.ecmcAxis->getBlockExtCom()) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Communication to ECMC blocked, motion commands not allowed..\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__);
+    return asynError;
+  }
 
     //if(drvlocal.ecmcAxis->getAllowConstVelo()) {
-    errorCode = drvlocal.ecmcAxis->moveVelocity(velo,
-                                                acc,
-                                                acc);
+    // Executed by ecmc realtime
+    ecmcAxisCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type      = ECMC_AXIS_CMD_MOVE_VEL;
+    cmd.values[1] = velo;
+    cmd.values[2] = acc;
+    cmd.values[3] = acc;
+    errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
     //} else
     //{
     //  LOGERR(
@@ -733,8 +722,6 @@ asynStatus ecmcMotorRecordAxis::moveVelocity(double minVelocity, double maxVeloc
     //    __LINE__);
     //}
 
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
-
 #ifndef motorWaitPollsBeforeReadyString
   drvlocal.waitNumPollsBeforeReady += WAITNUMPOLLSBEFOREREADY;
 #endif
@@ -752,9 +739,11 @@ asynStatus ecmcMotorRecordAxis::setPosition(double value)
 
   drvlocal.eeAxisWarning = eeAxisWarningNoWarning;
   
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-  int errorCode =  drvlocal.ecmcAxis->setPosition(value);
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+  ecmcAxisCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type      = ECMC_AXIS_CMD_SET_POS;
+  cmd.values[0] = value;
+  int errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
   
   return errorCode == 0 ? asynSuccess:asynError;
 }
@@ -768,9 +757,10 @@ asynStatus ecmcMotorRecordAxis::resetAxis(void)
   drvlocal.eeAxisWarning = eeAxisWarningNoWarning;
   drvlocal.cmdErrorMessage[0] = 0;
 
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-  drvlocal.ecmcAxis->errorReset();
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+  ecmcAxisCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type = ECMC_AXIS_CMD_ERROR_RESET;
+  drvlocal.ecmcAxis->queueCmd(&cmd, true);
   
   // Refresh
   bool moving;
@@ -783,20 +773,20 @@ asynStatus ecmcMotorRecordAxis::setEnable(int on) {
             "%ssetEnable(%d) enable=%d\n",
             modNamEMC, axisNo_,on);
 
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-
-      if(drvlocal.ecmcAxis->getBlockExtCom()) {
-        if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
-        LOGERR(
-          "%s/%s:%d: ERROR: Communication to ECMC blocked, motion commands not allowed..\n",
-          __FILE__,
-          __FUNCTION__,
-          __LINE__);      
-      return asynError;
-    }
+  if(drvlocal.ecmcAxis->getBlockExtCom()) {
+    LOGERR(
+      "%s/%s:%d: ERROR: Communication to ECMC blocked, motion commands not allowed..\n",
+      __FILE__,
+      __FUNCTION__,
+      __LINE__);      
+    return asynError;
+  }
 
-  int errorCode = drvlocal.ecmcAxis->setEnable(on);
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+  ecmcAxisCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type     = ECMC_AXIS_CMD_SET_ENABLE;
+  cmd.intValue = on;
+  int errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
   if(errorCode){
     LOGERR(
       "%s/%s:%d: ERROR: Function setEnable(%d) returned errorCode (0x%x).\n",
@@ -824,11 +814,11 @@ bool ecmcMotorRecordAxis::pollPowerIsOn(void)
             "%spollPowerIsOn(%d)\n",
             modNamEMC, axisNo_);
 
-  int enabled = 0;
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-  enabled = drvlocal.ecmcAxis->getEnabled();
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
-  return enabled > 0;
+  ecmcAxisStatusType status;
+  if(drvlocal.ecmcAxis->getStatusSnapshot(&status)) {
+    return false;
+  }
+  return status.onChangeData.statusWd.enabled > 0;
 }
 
 /** 
@@ -910,9 +900,11 @@ asynStatus ecmcMotorRecordAxis::stopAxisInternal(const char *function_name, doub
             "%sstopAxisInternal(%d) function_name= %s, acceleration=%lf\n",
             modNamEMC, axisNo_,function_name,acceleration);
 
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-  int errorCode = drvlocal.ecmcAxis->setExecute(0);
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+  ecmcAxisCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type     = ECMC_AXIS_CMD_SET_EXECUTE;
+  cmd.intValue = 0;
+  int errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
   if(errorCode){
     LOGERR(
       "%s/%s:%d: ERROR: Function setExecute(0) returned errorCode (0x%x).\n",
@@ -1042,26 +1034,23 @@ void ecmcMotorRecordAxis::callParamCallbacksUpdateError()
 asynStatus ecmcMotorRecordAxis::readEcmcAxisStatusData() {
   
   /* Driver not yet initialized, do nothing */
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
   if (!drvlocal.ecmcAxis->getRealTimeStarted()){
-    if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
     return asynSuccess;
   }
-  // Get values from ecmc
-  ecmcAxisStatusType *tempAxisStat = drvlocal.ecmcAxis->getDebugInfoDataPointer();
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
 
-  if(!tempAxisStat) {
+  // Get consistent copy of status published by ecmc realtime
+  int errorCode = drvlocal.ecmcAxis->getStatusSnapshot(&drvlocal.statusBinData);
+
+  if(errorCode) {
     LOGERR(
-      "%s/%s:%d: ERROR: function getAxisDebugInfoDataPointer() returned NULL.\n",
+      "%s/%s:%d: ERROR: function getStatusSnapshot() returned error (0x%x).\n",
       __FILE__,
       __FUNCTION__,
-      __LINE__);
+      __LINE__,
+      errorCode);
 
     return asynError;
   }
-  // copy data locally
-  memcpy(&drvlocal.statusBinData,tempAxisStat,sizeof(ecmcAxisStatusType));
 
   return asynSuccess;
 }
@@ -1085,7 +1074,7 @@ asynStatus ecmcMotorRecordAxis::poll(bool *moving)
   }
 
   if(drvlocal.ecmcAxis) {
-    drvlocal.moveNotReadyNext= drvlocal.ecmcAxis->getBusy() || !drvlocal.statusBinData.onChangeData.statusWd.attarget;
+    drvlocal.moveNotReadyNext= drvlocal.statusBinData.onChangeData.statusWd.busy || !drvlocal.statusBinData.onChangeData.statusWd.attarget;
   }
   else {
     drvlocal.moveNotReadyNext= false;
@@ -1308,9 +1297,11 @@ asynStatus ecmcMotorRecordAxis::setIntegerParam(int function, int value)
               "%ssetIntegerParam(%d ecmcMotorRecordCfgDHLM_En)=%d\n",
               modNamEMC, axisNo_, value);
 
-    if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-    errorCode = drvlocal.ecmcAxis->getMon()->setEnableSoftLimitFwd(value);
-    if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+    ecmcAxisCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = ECMC_AXIS_CMD_ENABLE_SOFT_LIMIT_FWD;
+    cmd.intValue = value;
+    errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
     
     readBackSoftLimits();
     return errorCode == 0 ? asynSuccess : asynError;
@@ -1323,9 +1314,11 @@ asynStatus ecmcMotorRecordAxis::setIntegerParam(int function, int value)
               "%ssetIntegerParam(%d ecmcMotorRecordCfgDLLM_En)=%d\n",
               modNamEMC, axisNo_, value);
 
-    if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-    errorCode = drvlocal.ecmcAxis->getMon()->setEnableSoftLimitBwd(value);
-    if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+    ecmcAxisCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = ECMC_AXIS_CMD_ENABLE_SOFT_LIMIT_BWD;
+    cmd.intValue = value;
+    errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
 
     readBackSoftLimits();
     return errorCode==0 ? asynSuccess : asynError;
@@ -1424,9 +1417,11 @@ asynStatus ecmcMotorRecordAxis::setDoubleParam(int function, double value)
     asynPrint(pPrintOutAsynUser, ASYN_TRACE_INFO,
               "%ssetDoubleParam(%d ecmcMotorRecordCfgDHLM_)=%f\n", modNamEMC, axisNo_, value);
 
-    if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-    errorCode = drvlocal.ecmcAxis->getMon()->setSoftLimitFwd(value);
-    if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+    ecmcAxisCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = ECMC_AXIS_CMD_SET_SOFT_LIMIT_FWD;
+    cmd.values[0] = value;
+    errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
 
     readBackSoftLimits();
     return errorCode==0 ? asynSuccess : asynError;
@@ -1436,9 +1431,11 @@ asynStatus ecmcMotorRecordAxis::setDoubleParam(int function, double value)
     asynPrint(pPrintOutAsynUser, ASYN_TRACE_INFO,
               "%ssetDoubleParam(%d ecmcMotorRecordCfgDLLM_)=%f\n", modNamEMC, axisNo_, value);
 
-    if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-    errorCode = drvlocal.ecmcAxis->getMon()->setSoftLimitBwd(value);
-    if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+    ecmcAxisCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = ECMC_AXIS_CMD_SET_SOFT_LIMIT_BWD;
+    cmd.values[0] = value;
+    errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
 
     readBackSoftLimits();
     return errorCode==0 ? asynSuccess : asynError;
@@ -1456,9 +1453,11 @@ asynStatus ecmcMotorRecordAxis::setDoubleParam(int function, double value)
     asynPrint(pPrintOutAsynUser, ASYN_TRACE_INFO,
               "%ssetDoubleParam(%d ecmcMotorRecordCfgVMAX_)=%f\n", modNamEMC, axisNo_, value);
 
-    if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-    errorCode = drvlocal.ecmcAxis->getMon()->setMaxVel(value);
-    if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+    ecmcAxisCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = ECMC_AXIS_CMD_SET_MAX_VEL;
+    cmd.values[1] = value;
+    errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
 
     return errorCode==0 ? asynSuccess : asynError;
 
@@ -1474,11 +1473,13 @@ asynStatus ecmcMotorRecordAxis::setDoubleParam(int function, double value)
     asynPrint(pPrintOutAsynUser, ASYN_TRACE_INFO,
               "%ssetDoubleParam(%d ecmcMotorRecordCfgACCS_)=%f\n", modNamEMC, axisNo_, value);
 
-    if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-    drvlocal.ecmcAxis->getTraj()->setAcc(value);
-    if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+    ecmcAxisCmd cmd;
+    memset(&cmd, 0, sizeof(cmd));
+    cmd.type = ECMC_AXIS_CMD_SET_ACC;
+    cmd.values[2] = value;
+    errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
 
-    return asynSuccess;
+    return errorCode==0 ? asynSuccess : asynError;
 
   }
   // Call the base class method
@@ -1501,9 +1502,11 @@ void ecmcMotorRecordAxis::updateMsgTxtFromDriver(const char *value)
   * \param[in] highLimit The new high limit position that should be set in the hardware. Units=steps.*/
 asynStatus ecmcMotorRecordAxis::setHighLimit(double highLimit)
 {
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-  int errorCode = drvlocal.ecmcAxis->getMon()->setSoftLimitFwd(highLimit);
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+  ecmcAxisCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type      = ECMC_AXIS_CMD_SET_SOFT_LIMIT_FWD;
+  cmd.values[0] = highLimit;
+  int errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
   if(errorCode) {
     asynPrint(pPrintOutAsynUser, ASYN_TRACE_INFO,
              "%ssetHighLimit(%d)=%lf\n", modNamEMC, axisNo_, highLimit);
@@ -1517,9 +1520,11 @@ asynStatus ecmcMotorRecordAxis::setHighLimit(double highLimit)
   * \param[in] lowLimit The new low limit position that should be set in the hardware. Units=steps.*/
 asynStatus ecmcMotorRecordAxis::setLowLimit(double lowLimit)
 {
-  if(ecmcRTMutex) epicsMutexLock(ecmcRTMutex);
-  int errorCode = drvlocal.ecmcAxis->getMon()->setSoftLimitBwd(lowLimit);
-  if(ecmcRTMutex) epicsMutexUnlock(ecmcRTMutex);
+  ecmcAxisCmd cmd;
+  memset(&cmd, 0, sizeof(cmd));
+  cmd.type      = ECMC_AXIS_CMD_SET_SOFT_LIMIT_BWD;
+  cmd.values[0] = lowLimit;
+  int errorCode = drvlocal.ecmcAxis->queueCmd(&cmd, true);
   if(errorCode) {
     asynPrint(pPrintOutAsynUser, ASYN_TRACE_INFO,
              "%ssetLowLimit(%d)=%lf\n", modNamEMC, axisNo_, lowLimit);
@@ -140,6 +140,19 @@ int loadPLCFile(int index, char *fileName) {
   return plcs->loadPLCFile(index, fileName);
 }
 
+int openPLCFile(int index, int channel, int mode, char *fileName) {
+  LOGINFO4("%s/%s:%d index=%d channel=%d mode=%d fileName=%s\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           index,
+           channel,
+           mode,
+           fileName);
+  CHECK_PLCS_RETURN_IF_ERROR();
+  return plcs->openFile(index, channel, mode, fileName);
+}
+
 int clearPLCExpr(int index) {
   LOGINFO4("%s/%s:%d index=%d\n", __FILE__, __FUNCTION__, __LINE__, index);
   CHECK_PLCS_RETURN_IF_ERROR();
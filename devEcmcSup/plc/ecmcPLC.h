@@ -222,6 +222,14 @@ int setPLCExpr(int   index,
  *   5.  ds<id>.error                 Data storage class error         (ro)\n
  *   6.  ds<id>.clear                 Data buffer clear (set to zero)  (ro)\n
  *   7.  ds<id>.full                  True if data storage is full     (ro)\n
+ *   8.  ds<id>.vec                   Whole buffer as vector           (rw)\n
+ *                                    No copy, use with exprtk vector\n
+ *                                    operations (sum(ds0.vec),\n
+ *                                    ds1.vec := ds0.vec * 2..).\n
+ *                                    Storage order (oldest value at\n
+ *                                    ds<id>.index for full ring\n
+ *                                    buffers). Size is locked. Not\n
+ *                                    for FIFO buffers.\n
  *
  *  Function Lib: EtherCAT
  *   1. retvalue = ec_set_bit(
@@ -391,6 +399,54 @@ int setPLCExpr(int   index,
  *                           );
  *      Returns maximum of the values in the data storage.\n
  *
+ *  Function Lib: Buffered file io (files opened with "openPLCFile()")
+ *   1. retvalue = fio_wrt(
+ *                           <channel>,       : File channel\n
+ *                           <value>,         : Value\n
+ *                           );
+ *      Queue value for writing (comma separated within a line).\n
+ *      returns 0 if success or error code (buffer full).\n
+ *
+ *   2. retvalue = fio_nl(
+ *                           <channel>,       : File channel\n
+ *                           );
+ *      Queue end of line.\n
+ *      returns 0 if success or error code (buffer full).\n
+ *
+ *   3. retvalue = fio_rd(
+ *                           <channel>,       : File channel\n
+ *                           );
+ *      Returns next prefetched value (0 and error if none).\n
+ *
+ *   4. retvalue = fio_rd_avail(
+ *                           <channel>,       : File channel\n
+ *                           );
+ *      Returns number of prefetched values.\n
+ *
+ *   5. retvalue = fio_at_end(
+ *                           <channel>,       : File channel\n
+ *                           );
+ *      Returns 1 if end of file and all values read.\n
+ *
+ *   6. retvalue = fio_get_err();
+ *      Returns error code for last lib call.\n
+ *
+ *   7. retvalue = fio_get_ch_err(
+ *                           <channel>,       : File channel\n
+ *                           );
+ *      Returns latched error of channel (overflow, write failure).\n
+ *
+ *   8. retvalue = fio_err_rst(
+ *                           <channel>,       : File channel\n
+ *                           );
+ *      Reset latched error of channel.\n
+ *
+ *  The fio_*() functions only access memory buffers. Files are written and
+ *  read by a separate low priority thread. Buffer overflows are also
+ *  reported in plc<index>.error. The exprtk file io functions (println,
+ *  open, write, read, getline..) access files directly from the realtime
+ *  thread and should be avoided.\n
+ *
  * \note Pipe sign "|" should be used instead of ";" This because asynOctet 
  * interface uses ";" as command delimiter\n.
  * 
@@ -423,6 +479,30 @@ int appendPLCExpr(int   index,
 int loadPLCFile(int   index,
                 char *fileName);
 
+/** \brief Open buffered file channel for PLC.\n
+ *
+ * Opens a file for the fio_*() PLC functions (see "appendPLCExpr()").
+ * Data is written and read by a low priority thread, never in the realtime
+ * thread. Files are closed when the PLC is deleted.\n
+ *
+ * \param[in] index     PLC index.\n
+ * \param[in] channel   File channel (0..3).\n
+ * \param[in] mode      Mode.\n
+ *   mode = 0: Write (truncate).\n
+ *   mode = 1: Append.\n
+ *   mode = 2: Read (values separated by whitespace, "," or ";").\n
+ * \param[in] fileName  File name.\n
+ *
+ * \return 0 if success or otherwise an error code.\n
+ *
+ * \note Example: Open file for writing as channel 0 of PLC 5\n
+ * "Cfg.OpenPLCFile(5,0,0,/tmp/plc5.csv)" //Command string to ecmcCmdParser.c.\n
+ */
+int openPLCFile(int   index,
+                int   channel,
+                int   mode,
+                char *fileName);
+
 /** \brief Write to PLC variable.\n
  * \note: Only static variables are supported.\n
  *
@@ -0,0 +1,499 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcPLCFileIO.cpp
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // pthread_setname_np
+#endif
+#include "ecmcPLCFileIO.h"
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <epicsAtomic.h>
+#include "../main/ecmcErrorsList.h"
+
+#define ECMC_PLC_FILE_IO_SEPARATORS " \t\r\n,;"
+
+ecmcPLCFileIO::ecmcPLCFileIO(int plcIndex) {
+  initVars();
+  plcIndex_ = plcIndex;
+}
+
+ecmcPLCFileIO::~ecmcPLCFileIO() {
+  // Write remaining data
+  stop();
+
+  if (semInit_) {
+    sem_destroy(&sem_);
+  }
+
+  for (int i = 0; i < ECMC_PLC_FILE_IO_MAX_CHANNELS; i++) {
+    if (channels_[i].file) {
+      fclose(channels_[i].file);
+    }
+    delete[] channels_[i].writeBuffer;
+    delete[] channels_[i].readBuffer;
+    delete[] channels_[i].line;
+  }
+}
+
+void ecmcPLCFileIO::initVars() {
+  errorReset();
+  plcIndex_      = 0;
+  semInit_       = false;
+  threadRunning_ = false;
+  stop_          = false;
+  wakePending_   = 0;
+  pendingError_  = 0;
+  memset(channels_, 0, sizeof(channels_));
+}
+
+int ecmcPLCFileIO::openChannel(int channel, int mode, const char *fileName) {
+  if ((channel < 0) || (channel >= ECMC_PLC_FILE_IO_MAX_CHANNELS)) {
+    LOGERR("%s/%s:%d: ERROR PLC%d: File channel %d out of range (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           plcIndex_,
+           channel,
+           ERROR_PLC_FILE_IO_CHANNEL_OUT_OF_RANGE);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLC_FILE_IO_CHANNEL_OUT_OF_RANGE);
+  }
+
+  ecmcPLCFileChannel *ch = &channels_[channel];
+
+  if (ch->file) {
+    LOGERR("%s/%s:%d: ERROR PLC%d: File channel %d already open (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           plcIndex_,
+           channel,
+           ERROR_PLC_FILE_IO_CHANNEL_ALREADY_OPEN);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLC_FILE_IO_CHANNEL_ALREADY_OPEN);
+  }
+
+  const char *fileMode = NULL;
+
+  switch (mode) {
+  case ECMC_PLC_FILE_MODE_WRITE:
+    fileMode = "w";
+    break;
+
+  case ECMC_PLC_FILE_MODE_APPEND:
+    fileMode = "a";
+    break;
+
+  case ECMC_PLC_FILE_MODE_READ:
+    fileMode = "r";
+    break;
+
+  default:
+    LOGERR("%s/%s:%d: ERROR PLC%d: Invalid file mode %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           plcIndex_,
+           mode,
+           ERROR_PLC_FILE_IO_MODE_INVALID);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLC_FILE_IO_MODE_INVALID);
+  }
+
+  if (!semInit_) {
+    if (sem_init(&sem_, 0, 0)) {
+      LOGERR("%s/%s:%d: ERROR PLC%d: Semaphore init failed (0x%x).\n",
+             __FILE__,
+             __FUNCTION__,
+             __LINE__,
+             plcIndex_,
+             ERROR_PLC_FILE_IO_SEM_INIT_FAIL);
+      return setErrorID(__FILE__,
+                        __FUNCTION__,
+                        __LINE__,
+                        ERROR_PLC_FILE_IO_SEM_INIT_FAIL);
+    }
+    semInit_ = true;
+  }
+
+  FILE *file = fopen(fileName, fileMode);
+
+  if (!file) {
+    LOGERR("%s/%s:%d: ERROR PLC%d: Open file %s failed with %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           plcIndex_,
+           fileName,
+           errno,
+           ERROR_PLC_FILE_IO_FILE_OPEN_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLC_FILE_IO_FILE_OPEN_FAIL);
+  }
+
+  ch->mode = mode;
+
+  if (mode == ECMC_PLC_FILE_MODE_READ) {
+    ch->readBuffer = new double[ECMC_PLC_FILE_IO_READ_BUFFER_SIZE];
+    ch->line       = new char[ECMC_PLC_FILE_IO_LINE_LENGTH];
+    ch->linePos    = NULL;
+  } else {
+    ch->writeBuffer = new char[ECMC_PLC_FILE_IO_WRITE_BUFFER_SIZE];
+    ch->lineStart   = true;
+  }
+
+  // Io thread only looks at channels with file set
+  epicsAtomicWriteMemoryBarrier();
+  ch->file = file;
+
+  if (!threadRunning_) {
+    int errorCode = start();
+
+    if (errorCode) {
+      return errorCode;
+    }
+  }
+
+  // Prefetch
+  wakeUp();
+  return 0;
+}
+
+int ecmcPLCFileIO::start() {
+  // Normal priority (inherited from caller), not realtime
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, PTHREAD_STACK_MIN + ECMC_STACK_SIZE);
+
+  stop_ = false;
+  int result = pthread_create(&thread_, &attr, threadFunc, this);
+  pthread_attr_destroy(&attr);
+
+  if (result) {
+    LOGERR("%s/%s:%d: ERROR PLC%d: Thread create failed with %d (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           plcIndex_,
+           result,
+           ERROR_PLC_FILE_IO_THREAD_CREATE_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLC_FILE_IO_THREAD_CREATE_FAIL);
+  }
+
+  char name[16];
+  snprintf(name, sizeof(name), ECMC_PLC_FILE_IO_THREAD_NAME "%d", plcIndex_);
+  pthread_setname_np(thread_, name);
+  threadRunning_ = true;
+  return 0;
+}
+
+void ecmcPLCFileIO::stop() {
+  if (!threadRunning_) {
+    return;
+  }
+  stop_ = true;
+  sem_post(&sem_);
+  pthread_join(thread_, NULL);
+  threadRunning_ = false;
+}
+
+void* ecmcPLCFileIO::threadFunc(void *arg) {
+  ecmcPLCFileIO *fileIO = (ecmcPLCFileIO *)arg;
+
+  while (true) {
+    while (sem_wait(&fileIO->sem_) != 0 && errno == EINTR) {}
+
+    // Clear before reading buffer indices, see wakeUp()
+    epicsAtomicSetIntT(&fileIO->wakePending_, 0);
+    epicsAtomicReadMemoryBarrier();
+
+    // Drain before exit
+    fileIO->service();
+
+    if (fileIO->stop_) {
+      break;
+    }
+  }
+  return NULL;
+}
+
+/*
+* ecmc_rt: At most one post per wake up of the io thread.
+*/
+void ecmcPLCFileIO::wakeUp() {
+  epicsAtomicWriteMemoryBarrier();
+
+  if (epicsAtomicCmpAndSwapIntT(&wakePending_, 0, 1) == 0) {
+    sem_post(&sem_);
+  }
+}
+
+void ecmcPLCFileIO::service() {
+  for (int i = 0; i < ECMC_PLC_FILE_IO_MAX_CHANNELS; i++) {
+    ecmcPLCFileChannel *ch = &channels_[i];
+
+    if (!ch->file) {
+      continue;
+    }
+
+    if (ch->mode == ECMC_PLC_FILE_MODE_READ) {
+      serviceRead(ch);
+    } else {
+      serviceWrite(ch);
+    }
+  }
+}
+
+/*
+* Io thread: Write all queued bytes.
+*/
+void ecmcPLCFileIO::serviceWrite(ecmcPLCFileChannel *ch) {
+  size_t head = epicsAtomicGetSizeT(&ch->writeHead);
+
+  if (ch->writeTail == head) {
+    return;
+  }
+  epicsAtomicReadMemoryBarrier();
+
+  while (ch->writeTail != head) {
+    size_t index = ch->writeTail & (ECMC_PLC_FILE_IO_WRITE_BUFFER_SIZE - 1);
+    size_t bytes = head - ch->writeTail;
+
+    if (bytes > ECMC_PLC_FILE_IO_WRITE_BUFFER_SIZE - index) {
+      bytes = ECMC_PLC_FILE_IO_WRITE_BUFFER_SIZE - index;
+    }
+
+    if (fwrite(&ch->writeBuffer[index], 1, bytes, ch->file) != bytes) {
+      setChannelError(ch, ERROR_PLC_FILE_IO_WRITE_FAIL);
+    }
+
+    // Release bytes to ecmc_rt
+    epicsAtomicSetSizeT(&ch->writeTail, ch->writeTail + bytes);
+  }
+
+  if (fflush(ch->file)) {
+    setChannelError(ch, ERROR_PLC_FILE_IO_WRITE_FAIL);
+  }
+}
+
+/*
+* Io thread: Parse values until read buffer is full or end of file.
+*/
+void ecmcPLCFileIO::serviceRead(ecmcPLCFileChannel *ch) {
+  while (!ch->eof) {
+    if (ch->readHead - epicsAtomicGetSizeT(&ch->readTail) >=
+        ECMC_PLC_FILE_IO_READ_BUFFER_SIZE) {
+      return;  // Full
+    }
+
+    if (!ch->linePos) {
+      if (!fgets(ch->line, ECMC_PLC_FILE_IO_LINE_LENGTH, ch->file)) {
+        epicsAtomicWriteMemoryBarrier();
+        ch->eof = true;
+        return;
+      }
+      ch->linePos = ch->line;
+    }
+
+    ch->linePos += strspn(ch->linePos, ECMC_PLC_FILE_IO_SEPARATORS);
+
+    if (*ch->linePos == '\0') {
+      ch->linePos = NULL;
+      continue;
+    }
+
+    char  *end   = NULL;
+    double value = strtod(ch->linePos, &end);
+
+    if (end == ch->linePos) {
+      // Not a number, skip token
+      ch->linePos += strcspn(ch->linePos, ECMC_PLC_FILE_IO_SEPARATORS);
+      continue;
+    }
+    ch->linePos = end;
+
+    ch->readBuffer[ch->readHead % ECMC_PLC_FILE_IO_READ_BUFFER_SIZE] = value;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetSizeT(&ch->readHead, ch->readHead + 1);
+  }
+}
+
+void ecmcPLCFileIO::setChannelError(ecmcPLCFileChannel *ch, int error) {
+  ch->error     = error;
+  pendingError_ = error;
+}
+
+int ecmcPLCFileIO::popPendingError() {
+  int error = pendingError_;
+
+  if (error) {
+    pendingError_ = 0;
+  }
+  return error;
+}
+
+int ecmcPLCFileIO::checkChannel(int channel, int mode) {
+  if ((channel < 0) || (channel >= ECMC_PLC_FILE_IO_MAX_CHANNELS)) {
+    return ERROR_PLC_FILE_IO_CHANNEL_OUT_OF_RANGE;
+  }
+
+  ecmcPLCFileChannel *ch = &channels_[channel];
+
+  if (!ch->file) {
+    return ERROR_PLC_FILE_IO_CHANNEL_NOT_OPEN;
+  }
+
+  if ((mode == ECMC_PLC_FILE_MODE_READ) !=
+      (ch->mode == ECMC_PLC_FILE_MODE_READ)) {
+    return ERROR_PLC_FILE_IO_WRONG_MODE;
+  }
+  return 0;
+}
+
+/*
+* ecmc_rt: Queue bytes, all or nothing.
+*/
+int ecmcPLCFileIO::write(ecmcPLCFileChannel *ch,
+                         const char         *text,
+                         size_t              bytes) {
+  size_t used = ch->writeHead - epicsAtomicGetSizeT(&ch->writeTail);
+
+  if (bytes > ECMC_PLC_FILE_IO_WRITE_BUFFER_SIZE - used) {
+    setChannelError(ch, ERROR_PLC_FILE_IO_BUFFER_OVERFLOW);
+    return ERROR_PLC_FILE_IO_BUFFER_OVERFLOW;
+  }
+
+  size_t index = ch->writeHead & (ECMC_PLC_FILE_IO_WRITE_BUFFER_SIZE - 1);
+  size_t first = ECMC_PLC_FILE_IO_WRITE_BUFFER_SIZE - index;
+
+  if (first > bytes) {
+    first = bytes;
+  }
+  memcpy(&ch->writeBuffer[index], text, first);
+  memcpy(ch->writeBuffer, text + first, bytes - first);
+
+  epicsAtomicWriteMemoryBarrier();
+  epicsAtomicSetSizeT(&ch->writeHead, ch->writeHead + bytes);
+  wakeUp();
+  return 0;
+}
+
+int ecmcPLCFileIO::writeValue(int channel, double value) {
+  int errorCode = checkChannel(channel, ECMC_PLC_FILE_MODE_WRITE);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  ecmcPLCFileChannel *ch = &channels_[channel];
+  char buffer[32];
+  int  bytes = snprintf(buffer,
+                        sizeof(buffer),
+                        ch->lineStart ? "%.15g" : ",%.15g",
+                        value);
+
+  errorCode = write(ch, buffer, bytes);
+
+  if (errorCode) {
+    return errorCode;
+  }
+  ch->lineStart = false;
+  return 0;
+}
+
+int ecmcPLCFileIO::writeNewLine(int channel) {
+  int errorCode = checkChannel(channel, ECMC_PLC_FILE_MODE_WRITE);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  ecmcPLCFileChannel *ch = &channels_[channel];
+  errorCode = write(ch, "\n", 1);
+
+  if (errorCode) {
+    return errorCode;
+  }
+  ch->lineStart = true;
+  return 0;
+}
+
+int ecmcPLCFileIO::readValue(int channel, double *value) {
+  int errorCode = checkChannel(channel, ECMC_PLC_FILE_MODE_READ);
+
+  if (errorCode) {
+    return errorCode;
+  }
+
+  ecmcPLCFileChannel *ch = &channels_[channel];
+
+  if (ch->readTail == epicsAtomicGetSizeT(&ch->readHead)) {
+    // Not prefetched yet or end of file
+    return ERROR_PLC_FILE_IO_NO_DATA;
+  }
+  epicsAtomicReadMemoryBarrier();
+
+  *value = ch->readBuffer[ch->readTail % ECMC_PLC_FILE_IO_READ_BUFFER_SIZE];
+  epicsAtomicSetSizeT(&ch->readTail, ch->readTail + 1);
+  wakeUp();
+  return 0;
+}
+
+int ecmcPLCFileIO::getAvailable(int channel) {
+  if (checkChannel(channel, ECMC_PLC_FILE_MODE_READ)) {
+    return 0;
+  }
+
+  ecmcPLCFileChannel *ch = &channels_[channel];
+  return (int)(epicsAtomicGetSizeT(&ch->readHead) - ch->readTail);
+}
+
+int ecmcPLCFileIO::getAtEnd(int channel) {
+  if (checkChannel(channel, ECMC_PLC_FILE_MODE_READ)) {
+    return 1;
+  }
+
+  ecmcPLCFileChannel *ch = &channels_[channel];
+
+  if (!ch->eof) {
+    return 0;
+  }
+  epicsAtomicReadMemoryBarrier();
+  return ch->readTail == epicsAtomicGetSizeT(&ch->readHead);
+}
+
+int ecmcPLCFileIO::getChannelError(int channel) {
+  if ((channel < 0) || (channel >= ECMC_PLC_FILE_IO_MAX_CHANNELS)) {
+    return ERROR_PLC_FILE_IO_CHANNEL_OUT_OF_RANGE;
+  }
+  return channels_[channel].error;
+}
+
+int ecmcPLCFileIO::resetChannelError(int channel) {
+  if ((channel < 0) || (channel >= ECMC_PLC_FILE_IO_MAX_CHANNELS)) {
+    return ERROR_PLC_FILE_IO_CHANNEL_OUT_OF_RANGE;
+  }
+  channels_[channel].error = 0;
+  return 0;
+}
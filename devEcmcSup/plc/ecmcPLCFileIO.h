@@ -0,0 +1,122 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcPLCFileIO.h
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#ifndef ECMC_PLC_FILE_IO_H_
+#define ECMC_PLC_FILE_IO_H_
+
+#include <pthread.h>
+#include <semaphore.h>
+#include "stdio.h"
+
+#include "../main/ecmcDefinitions.h"
+#include "../main/ecmcError.h"
+
+#define ERROR_PLC_FILE_IO_CHANNEL_OUT_OF_RANGE 0x20510
+#define ERROR_PLC_FILE_IO_CHANNEL_NOT_OPEN 0x20511
+#define ERROR_PLC_FILE_IO_CHANNEL_ALREADY_OPEN 0x20512
+#define ERROR_PLC_FILE_IO_MODE_INVALID 0x20513
+#define ERROR_PLC_FILE_IO_WRONG_MODE 0x20514
+#define ERROR_PLC_FILE_IO_FILE_OPEN_FAIL 0x20515
+#define ERROR_PLC_FILE_IO_WRITE_FAIL 0x20516
+#define ERROR_PLC_FILE_IO_BUFFER_OVERFLOW 0x20517
+#define ERROR_PLC_FILE_IO_NO_DATA 0x20518
+#define ERROR_PLC_FILE_IO_SEM_INIT_FAIL 0x20519
+#define ERROR_PLC_FILE_IO_THREAD_CREATE_FAIL 0x2051A
+
+enum ecmcPLCFileMode {
+  ECMC_PLC_FILE_MODE_WRITE  = 0,
+  ECMC_PLC_FILE_MODE_APPEND = 1,
+  ECMC_PLC_FILE_MODE_READ   = 2,
+};
+
+typedef struct {
+  FILE   *file;
+  int     mode;
+  // Write: bytes (ecmc_rt produces, io thread consumes)
+  char   *writeBuffer;
+  size_t  writeHead;
+  size_t  writeTail;
+  // Next value starts a new line (ecmc_rt)
+  bool    lineStart;
+  // Read: values (io thread produces, ecmc_rt consumes)
+  double *readBuffer;
+  size_t  readHead;
+  size_t  readTail;
+  // Line being parsed (io thread)
+  char   *line;
+  char   *linePos;
+  volatile bool    eof;
+  volatile int32_t error;
+} ecmcPLCFileChannel;
+
+/**
+ * Buffered file channels for one PLC.
+ *
+ * The PLC code (ecmc_rt) only touches memory buffers. A low priority thread
+ * writes queued text to file and prefetches values from files opened for
+ * reading. Both directions are lock free single producer / single consumer
+ * rings. If a write does not fit or no value is prefetched, the call fails
+ * with an error (overflows are also reported as PLC error) instead of
+ * blocking the cycle.
+ *
+ * Files are opened at configuration (file names are not available in the
+ * PLC function lib) and closed when the PLC is deleted. Read files are
+ * parsed as numbers separated by whitespace, "," or ";".
+ */
+class ecmcPLCFileIO : public ecmcError {
+ public:
+  explicit ecmcPLCFileIO(int plcIndex);
+  ~ecmcPLCFileIO();
+  int  openChannel(int         channel,
+                   int         mode,
+                   const char *fileName);
+  // Realtime (ecmc_rt)
+  int  writeValue(int    channel,
+                  double value);
+  int  writeNewLine(int channel);
+  int  readValue(int     channel,
+                 double *value);
+  int  getAvailable(int channel);
+  int  getAtEnd(int channel);
+  int  getChannelError(int channel);
+  int  resetChannelError(int channel);
+  // Returns and clears error raised since last call (0 if none)
+  int  popPendingError();
+
+ private:
+  void         initVars();
+  int          start();
+  void         stop();
+  int          checkChannel(int channel,
+                            int mode);
+  int          write(ecmcPLCFileChannel *ch,
+                     const char         *text,
+                     size_t              bytes);
+  void         setChannelError(ecmcPLCFileChannel *ch,
+                               int                 error);
+  void         wakeUp();
+  void         service();
+  void         serviceWrite(ecmcPLCFileChannel *ch);
+  void         serviceRead(ecmcPLCFileChannel *ch);
+  static void* threadFunc(void *arg);
+  int                plcIndex_;
+  ecmcPLCFileChannel channels_[ECMC_PLC_FILE_IO_MAX_CHANNELS];
+  pthread_t          thread_;
+  sem_t              sem_;
+  bool               semInit_;
+  volatile bool      threadRunning_;
+  volatile bool      stop_;
+  // Set by ecmc_rt when posting, cleared by io thread (one post per wake up)
+  int                wakePending_;
+  volatile int32_t   pendingError_;
+};
+
+#endif  /* ECMC_PLC_FILE_IO_H_ */
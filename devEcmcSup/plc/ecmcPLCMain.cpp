@@ -31,6 +31,7 @@ ecmcPLCMain::~ecmcPLCMain() {
 
 void ecmcPLCMain::initVars() {
   globalVariableCount_ = 0;  
+  execProfiler_        = NULL;
   for (int i = 0; i < ECMC_MAX_PLCS + ECMC_MAX_AXES; i++) {
     plcs_[i]         = NULL;
     plcEnable_[i]    = NULL;
@@ -38,6 +39,10 @@ void ecmcPLCMain::initVars() {
     plcFirstScan_[i] = NULL;
   }
 
+  for (int i = 0; i < ECMC_MAX_PLCS; i++) {
+    plcExeExternal_[i] = 0;
+  }
+
   for (int i = 0; i < ECMC_MAX_AXES; i++) {
     axes_[i] = NULL;
   }
@@ -184,12 +189,19 @@ int ecmcPLCMain::execute(bool ecOK) {
     ecStatus_->setData((double)ecOK);
   }
 
+  bool profile = execProfiler_ && execProfiler_->getEnable();
+
   // ONLY EXECUTE NORMAL PLCS (AXIS PLCs are executed from main thread)
   for (int plcIndex = 0; plcIndex < ECMC_MAX_PLCS; plcIndex++) {
-    if (plcs_[plcIndex] != NULL) {
+    if (plcs_[plcIndex] != NULL && !plcExeExternal_[plcIndex]) {
       if (plcEnable_[plcIndex]) {
         if (plcEnable_[plcIndex]->getData()) {
+          uint64_t startNs = profile ? ecmcExecProfiler::now() : 0;
           plcs_[plcIndex]->execute(ecOK);
+          if (profile) {
+            execProfiler_->add(ECMC_PROF_SLOT_PLC_FIRST + plcIndex, startNs);
+          }
+          updateFileIOError(plcIndex);
           if (ecOK) {
             if (plcFirstScan_[plcIndex]) {
               plcFirstScan_[plcIndex]->setData(plcs_[plcIndex]->getFirstScanDone()==0); // First scan
@@ -215,7 +227,13 @@ int ecmcPLCMain::execute(int plcIndex, bool ecOK) {
   if (plcs_[plcIndex] != NULL) {
     if (plcEnable_[plcIndex]) {
       if (plcEnable_[plcIndex]->getData()) {
+        bool     profile = execProfiler_ && execProfiler_->getEnable();
+        uint64_t startNs = profile ? ecmcExecProfiler::now() : 0;
         plcs_[plcIndex]->execute(ecOK);
+        if (profile) {
+          execProfiler_->add(ECMC_PROF_SLOT_PLC_FIRST + plcIndex, startNs);
+        }
+        updateFileIOError(plcIndex);
          if (ecOK) {
           if (plcFirstScan_[plcIndex]) {
             plcFirstScan_[plcIndex]->setData(plcs_[plcIndex]->getFirstScanDone()==0); // First scan
@@ -227,6 +245,30 @@ int ecmcPLCMain::execute(int plcIndex, bool ecOK) {
   return 0;
 }
 
+/*
+ * PLCs executed from another thread (rt task group) with
+ * execute(plcIndex, ecOK) are skipped in execute(ecOK)
+ */
+int ecmcPLCMain::setExecuteExternal(int plcIndex, int external) {
+  if (plcIndex >= ECMC_MAX_PLCS || plcIndex < 0) {
+    LOGERR("ERROR: PLC index out of range.\n");
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLCS_INDEX_OUT_OF_RANGE);
+  }
+
+  plcExeExternal_[plcIndex] = external;
+  return 0;
+}
+
+/*
+ * Execution time of each PLC added to profiler (if enabled)
+ */
+void ecmcPLCMain::setExecProfiler(ecmcExecProfiler *profiler) {
+  execProfiler_ = profiler;
+}
+
 std::string *ecmcPLCMain::getExpr(int plcIndex, int *error) {
   
   if (plcIndex >= ECMC_MAX_PLCS + ECMC_MAX_AXES || plcIndex < 0) {
@@ -372,6 +414,23 @@ int ecmcPLCMain::loadPLCFile(int plcIndex, char *fileName) {
   return 0;
 }
 
+int ecmcPLCMain::openFile(int         plcIndex,
+                          int         channel,
+                          int         mode,
+                          const char *fileName) {
+  CHECK_PLC_RETURN_IF_ERROR(plcIndex)
+  return plcs_[plcIndex]->openFile(channel, mode, fileName);
+}
+
+void ecmcPLCMain::updateFileIOError(int plcIndex) {
+  // Report file io overflow as PLC error (plc<index>.error)
+  int errorCode = plcs_[plcIndex]->popFileIOError();
+
+  if (errorCode && plcError_[plcIndex]) {
+    plcError_[plcIndex]->setData(errorCode);
+  }
+}
+
 int ecmcPLCMain::clearExpr(int plcIndex) {
   CHECK_PLC_RETURN_IF_ERROR(plcIndex)
   return plcs_[plcIndex]->clearRawExpr();
@@ -892,9 +951,15 @@ int ecmcPLCMain::parseDataStorage(int plcIndex, const char *exprStr) {
       int nvals = sscanf(strDS, ECMC_PLC_VAR_FORMAT, varName);
 
       if (nvals == 1) {
-        int errorCode = createAndRegisterNewDataIF(plcIndex,
-                                                   varName,
-                                                   ECMC_RECORDER_SOURCE_DATA_STORAGE);
+        int errorCode = 0;
+
+        if (isDataStorageVector(varName)) {
+          errorCode = addDataStorageVector(plcIndex, varName);
+        } else {
+          errorCode = createAndRegisterNewDataIF(plcIndex,
+                                                 varName,
+                                                 ECMC_RECORDER_SOURCE_DATA_STORAGE);
+        }
 
         if (errorCode) {
           free(strLocal);
@@ -908,6 +973,30 @@ int ecmcPLCMain::parseDataStorage(int plcIndex, const char *exprStr) {
   return 0;
 }
 
+/*
+ * "ds<index>.vec": Whole data storage buffer as exprtk vector
+ */
+bool ecmcPLCMain::isDataStorageVector(const char *varName) {
+  const char *field = strchr(varName, '.');
+
+  if (!field) {
+    return false;
+  }
+  return strcmp(field + 1, ECMC_DATA_STORAGE_DATA_VECTOR_STR) == 0;
+}
+
+int ecmcPLCMain::addDataStorageVector(int plcIndex, char *varName) {
+  int dsId = getDsIndex(varName);
+
+  if ((dsId >= ECMC_MAX_DATA_STORAGE_OBJECTS) || (dsId < 0) || !ds_[dsId]) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLCS_DATA_STORAGE_INDEX_OUT_OF_RANGE);
+  }
+  return plcs_[plcIndex]->addDataStorageVector(varName, ds_[dsId]);
+}
+
 int ecmcPLCMain::parsePLC(int plcIndex, const char *exprStr) {
   // find plc variable
   char *strLocal = strdup(exprStr);
@@ -23,6 +23,7 @@
 #include "../misc/ecmcDataStorage.h"
 #include "../ethercat/ecmcEc.h"
 #include "../plugin/ecmcPluginLib.h"
+#include "../main/ecmcExecProfiler.h"
 #include "ecmcPLCTask.h"
 #include "ecmcPLCDataIF.h"
 
@@ -66,6 +67,9 @@ class ecmcPLCMain : public ecmcError {
                         int            index);
   int  execute(bool ecOK);
   int  execute(int   plcIndex, bool ecOK);
+  int  setExecuteExternal(int plcIndex,
+                          int external);
+  void setExecProfiler(ecmcExecProfiler *profiler);
   int  setExpr(int   plcIndex,
                char *expr);
   int  parseExpr(int         plcIndex,
@@ -78,6 +82,10 @@ class ecmcPLCMain : public ecmcError {
                     const char *expr);
   int  loadPLCFile(int   plcIndex,
                    char *fileName);
+  int  openFile(int         plcIndex,
+                int         channel,
+                int         mode,
+                const char *fileName);
   int  clearExpr(int plcIndex);
   int  compileExpr(int plcIndex);
   int  setEnable(int plcIndex,
@@ -103,6 +111,10 @@ class ecmcPLCMain : public ecmcError {
 
  private:
   void initVars();
+  void updateFileIOError(int plcIndex);
+  bool isDataStorageVector(const char *varName);
+  int  addDataStorageVector(int   plcIndex,
+                            char *varName);
   int  createNewGlobalDataIF(char              *varName,
                              ecmcDataSourceType dataSource,
                              ecmcPLCDataIF    **outDataIF);
@@ -147,10 +159,13 @@ class ecmcPLCMain : public ecmcError {
   ecmcPLCDataIF      *plcEnable_[ECMC_MAX_PLCS + ECMC_MAX_AXES];
   ecmcPLCDataIF      *plcError_[ECMC_MAX_PLCS + ECMC_MAX_AXES];
   ecmcPLCDataIF      *plcFirstScan_[ECMC_MAX_PLCS + ECMC_MAX_AXES];
+  // Executed by other thread (rt task group), skip in execute(bool ecOK)
+  int                 plcExeExternal_[ECMC_MAX_PLCS];
   ecmcPLCDataIF      *globalDataArray_[ECMC_MAX_PLC_VARIABLES];
   ecmcPLCDataIF      *ecStatus_;
   double              mcuFreq_;
   ecmcPluginLib      *plugins_[ECMC_MAX_PLUGINS];
+  ecmcExecProfiler   *execProfiler_;
 };
 
 #endif  /* ECMC_PLC_MAIN_H_ */
@@ -16,6 +16,22 @@
 #include "ecmcPLCTask_libEc.inc"
 #include "ecmcPLCTask_libMc.inc"
 #include "ecmcPLCTask_libFileIO.inc"
+#include "ecmcPLCTask_libFio.inc"
+
+// exprtk functions that can write to a vector argument (vecops, fileio)
+static const char *vectorWriteFuncs[] = { "assign", "axpby", "axpbsy",
+                                          "axpbsyz", "axpbyz", "axpbz",
+                                          "axpy", "axpyz", "copy", "diff",
+                                          "iota", "nth_element", "read",
+                                          "reverse", "rotate_left",
+                                          "rotate_right", "shift_left",
+                                          "shift_right", "sort", "swap",
+                                          "threshold_above",
+                                          "threshold_below" };
+
+// Assignment operators of exprtk (and swap)
+static const char *vectorWriteOps[] = { ":=", "+=", "-=", "*=", "/=", "%=",
+                                        "<=>" };
 
 #define ecmcPLCTaskAddFunction(cmd, func) {          \
     errorCode = exprtk_->addFunction(cmd, func); \
@@ -44,6 +60,7 @@ ecmcPLCTask::~ecmcPLCTask() {
     delete localArray_[i];
     localArray_[i] = NULL;
   }
+  delete fileIO_;
 }
 
 void ecmcPLCTask::initVars() {
@@ -71,6 +88,13 @@ void ecmcPLCTask::initVars() {
   libEcLoaded_         = 0;
   libDsLoaded_         = 0;
   libFileIOLoaded_     = 0;
+  libFioLoaded_        = 0;
+  fileIO_              = NULL;
+  dsVectorCount_       = 0;
+  for (int i = 0; i < ECMC_MAX_DATA_STORAGE_OBJECTS; i++) {
+    dsVectors_[i]       = NULL;
+    dsVectorWritten_[i] = true;
+  }
   asynPortDriver_      = 0;
   newExpr_             = 0;
   mcuFreq_             = MCU_FREQUENCY;
@@ -157,6 +181,10 @@ int ecmcPLCTask::compile() {
   compiled_ = true;
   newExpr_  = false;
   exprStrRaw_ = "";
+
+  for (int i = 0; i < dsVectorCount_; i++) {
+    dsVectorWritten_[i] = findVectorWrite(dsVectorNames_[i].c_str());
+  }
   return 0;
 }
 
@@ -196,9 +224,19 @@ int ecmcPLCTask::execute(bool ecOK) {
     }
   }
 
+  // Buffered file io for fio_*() calls (PLCs can execute in several threads)
+  fio_current = fileIO_;
+
   // Run equation
   exprtk_->refresh();
 
+  // Vectors the expression can write
+  for (int i = 0; i < dsVectorCount_; i++) {
+    if (dsVectorWritten_[i]) {
+      dsVectors_[i]->vectorViewWritten();
+    }
+  }
+
   for (int i = 0; i < localVariableCount_; i++) {
     if (localArray_[i]) {
       localArray_[i]->write();
@@ -476,6 +514,52 @@ int ecmcPLCTask::setDataStoragePointer(ecmcDataStorage *ds, int index) {
   return 0;
 }
 
+int ecmcPLCTask::addDataStorageVector(const char      *vectorName,
+                                      ecmcDataStorage *ds) {
+  // Already added?
+  for (int i = 0; i < dsVectorCount_; i++) {
+    if (dsVectors_[i] == ds) {
+      return 0;
+    }
+  }
+
+  if (dsVectorCount_ >= ECMC_MAX_DATA_STORAGE_OBJECTS) {
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLC_DATA_STORAGE_INDEX_OUT_OF_RANGE);
+  }
+
+  double *data = NULL;
+  int     size = 0;
+  int errorCode = ds->getVectorView(&data, &size);
+
+  if (errorCode) {
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
+
+  errorCode = exprtk_->addVector(vectorName, data, (size_t)size);
+
+  if (errorCode) {
+    LOGERR("%s/%s:%d: Add vector %s failed (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           vectorName,
+           ERROR_PLC_ADD_VARIABLE_FAIL);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLC_ADD_VARIABLE_FAIL);
+  }
+  dsVectors_[dsVectorCount_]       = ds;
+  dsVectorNames_[dsVectorCount_]   = vectorName;
+  // Until analyzed at compile
+  dsVectorWritten_[dsVectorCount_] = true;
+  dsVectorCount_++;
+  return 0;
+}
+
 int ecmcPLCTask::setEcPointer(ecmcEc *ec) {
   ecmcPLCTask::statEc_ = ec;
   return 0;
@@ -517,6 +601,16 @@ int ecmcPLCTask::parseFunctions(const char *exprStr) {
     }
   }
 
+  // look for buffered file io function
+  if (!libFioLoaded_) {
+    if (findFioFunction(exprStr)) {
+      errorCode = loadFioLib();
+      if (errorCode) {
+        return errorCode;
+      }
+    }
+  }
+
   // look for File IO function
   if (!libFileIOLoaded_) {
     if (findFileIOFunction(exprStr)) {
@@ -570,6 +664,116 @@ bool ecmcPLCTask::findDsFunction(const char *exprStr) {
   return false;
 }
 
+/*
+* True if the expression can write to the vector: the vector is the target of
+* an assignment (also indexed) or a swap, or an argument of a function that
+* writes to its vector arguments. Conservative, a false match only costs a
+* recalculation of the statistics.
+*/
+bool ecmcPLCTask::findVectorWrite(const char *vectorName) {
+  const char *expr = exprStr_.c_str();
+  size_t      len  = strlen(vectorName);
+  const char *pos  = expr;
+
+  while ((pos = strstr(pos, vectorName)) != NULL) {
+    const char *start = pos;
+    const char *end   = pos + len;
+    pos++;
+
+    // Whole name only
+    if (((start > expr) &&
+         (isalnum((unsigned char)start[-1]) || start[-1] == '_' ||
+          start[-1] == '.')) ||
+        isalnum((unsigned char)*end) || *end == '_' || *end == '.') {
+      continue;
+    }
+
+    // Assignment or swap after name (and index)
+    const char *next = end;
+
+    while (isspace((unsigned char)*next)) {
+      next++;
+    }
+
+    if (*next == '[') {
+      int depth = 0;
+
+      do {
+        if (*next == '[') {
+          depth++;
+        } else if (*next == ']') {
+          depth--;
+        } else if (*next == '\0') {
+          return true;
+        }
+        next++;
+      } while (depth > 0);
+
+      while (isspace((unsigned char)*next)) {
+        next++;
+      }
+    }
+
+    for (size_t i = 0; i < sizeof(vectorWriteOps) / sizeof(char *); i++) {
+      if (strncmp(next, vectorWriteOps[i], strlen(vectorWriteOps[i])) == 0) {
+        return true;
+      }
+    }
+
+    // Swap before name
+    const char *prev = start;
+
+    while ((prev > expr) && isspace((unsigned char)prev[-1])) {
+      prev--;
+    }
+
+    if ((prev - expr >= 3) && (strncmp(prev - 3, "<=>", 3) == 0)) {
+      return true;
+    }
+
+    // Innermost function call with the name as argument
+    int depth = 0;
+
+    for (prev = start; prev > expr; prev--) {
+      if (prev[-1] == ')') {
+        depth++;
+      } else if (prev[-1] == '(') {
+        if (depth == 0) {
+          break;
+        }
+        depth--;
+      } else if ((prev[-1] == ';') && (depth == 0)) {
+        prev = expr;
+        break;
+      }
+    }
+
+    if (prev == expr) {
+      continue;
+    }
+    prev--;  // At "("
+
+    while ((prev > expr) && isspace((unsigned char)prev[-1])) {
+      prev--;
+    }
+    const char *funcEnd = prev;
+
+    while ((prev > expr) &&
+           (isalnum((unsigned char)prev[-1]) || prev[-1] == '_')) {
+      prev--;
+    }
+    size_t funcLen = funcEnd - prev;
+
+    for (size_t i = 0; i < sizeof(vectorWriteFuncs) / sizeof(char *); i++) {
+      if ((strlen(vectorWriteFuncs[i]) == funcLen) &&
+          (strncmp(prev, vectorWriteFuncs[i], funcLen) == 0)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 bool ecmcPLCTask::findFileIOFunction(const char *exprStr) {
   for (int i = 0; i < fileIO_cmd_count; i++) {
     if (strstr(exprStr, fileIOLibCmdList[i])) {
@@ -579,6 +783,15 @@ bool ecmcPLCTask::findFileIOFunction(const char *exprStr) {
   return false;
 }
 
+bool ecmcPLCTask::findFioFunction(const char *exprStr) {
+  for (int i = 0; i < fio_cmd_count; i++) {
+    if (strstr(exprStr, fioLibCmdList[i])) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool ecmcPLCTask::findPluginFunction(ecmcPluginLib* plugin, const char *exprStr){
 
  if(!plugin){
@@ -740,6 +953,10 @@ int ecmcPLCTask::loadEcLib() {
   ecmcPLCTaskAddFunction("ec_mm_append_to_ds", ec_mm_append_to_ds);
   ecmcPLCTaskAddFunction("ec_mm_append_to_ds_scale_offset", ec_mm_append_to_ds_scale_offset);
   ecmcPLCTaskAddFunction("ec_mm_push_asyn", ec_mm_push_asyn);
+  ecmcPLCTaskAddFunction("ec_sdo_req_rd", ec_sdo_req_rd);
+  ecmcPLCTaskAddFunction("ec_sdo_req_wrt", ec_sdo_req_wrt);
+  ecmcPLCTaskAddFunction("ec_sdo_req_stat", ec_sdo_req_stat);
+  ecmcPLCTaskAddFunction("ec_sdo_req_val", ec_sdo_req_val);
   
   if (ec_cmd_count != cmdCounter) {
     LOGERR("%s/%s:%d: PLC Lib EC command count missmatch (0x%x).\n",
@@ -832,10 +1049,67 @@ int ecmcPLCTask::loadFileIOLib() {
   if (errorCode) {
     return errorCode;
   }
+
+  // The exprtk file io package calls stdio directly in exprtk_->refresh()
+  LOGERR("%s/%s:%d: WARNING PLC%d: exprtk file io (println, open, write, read, "
+         "getline..) blocks the realtime thread. Use buffered fio_*() "
+         "functions instead.\n",
+         __FILE__,
+         __FUNCTION__,
+         __LINE__,
+         plcIndex_);
   libFileIOLoaded_ = 1;
   return errorCode;
 }
 
+int ecmcPLCTask::loadFioLib() {
+  int errorCode  = 0;
+  int cmdCounter = 0;
+
+  ecmcPLCTaskAddFunction("fio_wrt",        fio_wrt);
+  ecmcPLCTaskAddFunction("fio_nl",         fio_nl);
+  ecmcPLCTaskAddFunction("fio_rd",         fio_rd);
+  ecmcPLCTaskAddFunction("fio_rd_avail",   fio_rd_avail);
+  ecmcPLCTaskAddFunction("fio_at_end",     fio_at_end);
+  ecmcPLCTaskAddFunction("fio_get_err",    fio_get_err);
+  ecmcPLCTaskAddFunction("fio_get_ch_err", fio_get_ch_err);
+  ecmcPLCTaskAddFunction("fio_err_rst",    fio_err_rst);
+
+  if (fio_cmd_count != cmdCounter) {
+    LOGERR("%s/%s:%d: PLC Lib FIO command count missmatch (0x%x).\n",
+           __FILE__,
+           __FUNCTION__,
+           __LINE__,
+           ERROR_PLC_LIB_CMD_COUNT_MISS_MATCH);
+    return setErrorID(__FILE__,
+                      __FUNCTION__,
+                      __LINE__,
+                      ERROR_PLC_LIB_CMD_COUNT_MISS_MATCH);
+  }
+  libFioLoaded_ = 1;
+  return 0;
+}
+
+int ecmcPLCTask::openFile(int channel, int mode, const char *fileName) {
+  if (!fileIO_) {
+    fileIO_ = new ecmcPLCFileIO(plcIndex_);
+  }
+
+  int errorCode = fileIO_->openChannel(channel, mode, fileName);
+
+  if (errorCode) {
+    return setErrorID(__FILE__, __FUNCTION__, __LINE__, errorCode);
+  }
+  return 0;
+}
+
+int ecmcPLCTask::popFileIOError() {
+  if (!fileIO_) {
+    return 0;
+  }
+  return fileIO_->popPendingError();
+}
+
 int ecmcPLCTask::readStaticPLCVar(const char *varName, double *data) {
   ecmcPLCDataIF *dataIF = NULL;
   int errorCode         = findLocalVar(varName, &dataIF);
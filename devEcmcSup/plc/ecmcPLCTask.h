@@ -23,6 +23,7 @@
 #include "../ethercat/ecmcEcEntry.h"  // Bit macros
 #include "../plugin/ecmcPluginLib.h"
 #include "ecmcPLCDataIF.h"
+#include "ecmcPLCFileIO.h"
 
 #define ECMC_MAX_PLC_VARIABLES 1024
 #define ECMC_MAX_PLC_VARIABLES_NAME_LENGTH 1024
@@ -68,6 +69,9 @@ class ecmcPLCTask : public ecmcError {
                                    int           index);
   int          setDataStoragePointer(ecmcDataStorage *ds,
                                      int              index);
+  // Data storage buffer as exprtk vector (no copy)
+  int          addDataStorageVector(const char      *vectorName,
+                                    ecmcDataStorage *ds);
   int          setPluginPointer(ecmcPluginLib *plugin, 
                                 int            index);
   int          setEcPointer(ecmcEc *ec);
@@ -81,6 +85,12 @@ class ecmcPLCTask : public ecmcError {
                             ecmcPLCDataIF  **outDataIF);
   double       getSampleTime();
   int          getNewExpr();
+  // Buffered file channel for fio_*() functions (configuration)
+  int          openFile(int         channel,
+                        int         mode,
+                        const char *fileName);
+  // File io error (buffer overflow, write fail) since last call
+  int          popFileIOError();
   static ecmcAxisBase    *statAxes_[ECMC_MAX_AXES];
   static ecmcDataStorage *statDs_[ECMC_MAX_DATA_STORAGE_OBJECTS];
   static ecmcEc          *statEc_;
@@ -97,12 +107,15 @@ class ecmcPLCTask : public ecmcError {
   bool findEcFunction(const char *exprStr);
   bool findDsFunction(const char *exprStr);
   bool findFileIOFunction(const char *exprStr);
+  bool findFioFunction(const char *exprStr);
   bool findPluginFunction(ecmcPluginLib* plugin, const char *exprStr);
   bool findPluginConstant(ecmcPluginLib* plugin, const char *exprStr);
+  bool findVectorWrite(const char *vectorName);
   int  loadMcLib();
   int  loadEcLib();
   int  loadDsLib();
   int  loadFileIOLib();
+  int  loadFioLib();
   int  loadPluginLib(ecmcPluginLib* plugin);
   std::string exprStr_;
   std::string exprStrRaw_; //Before compile and preprocess
@@ -122,6 +135,13 @@ class ecmcPLCTask : public ecmcError {
   int libEcLoaded_;
   int libDsLoaded_;
   int libFileIOLoaded_;
+  int libFioLoaded_;
+  ecmcPLCFileIO *fileIO_;
+  ecmcDataStorage *dsVectors_[ECMC_MAX_DATA_STORAGE_OBJECTS];
+  std::string dsVectorNames_[ECMC_MAX_DATA_STORAGE_OBJECTS];
+  // Vector written by expression (statistics invalidated after scan)
+  bool dsVectorWritten_[ECMC_MAX_DATA_STORAGE_OBJECTS];
+  int dsVectorCount_;
   int libPluginsLoaded_[ECMC_MAX_PLUGINS];
   
   ecmcAsynPortDriver *asynPortDriver_;
@@ -0,0 +1,644 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcBenchCmdDispatch.cpp
+*
+*  Replay of a startup script through the two paths of handleCfgCommand()
+*  (ecmcCmdParser.c):
+*  - chain:    sscanf()/strcmp() of every command until one matches (all
+*              commands in the chain, as before the dispatch table)
+*  - dispatch: ecmcCmdDispatch table, then the remaining chain
+*
+*  The command formats are read from ecmcCmdParser.c (handleCfgCommand()
+*  and the ECMC_CFG_CMD_xx table entries), so the benchmark follows the
+*  parser. Commands are only parsed, not executed. In the chain path the
+*  table commands are placed first, which favours the chain.
+*
+*  Script lines are "Cfg.<cmd>" commands, optionally quoted in an iocsh
+*  line (ecmcConfigOrDie "Cfg.<cmd>"), other lines are ignored. Without a
+*  script a typical configuration of slaves and axes is generated.
+*
+*  Usage: ecmcBenchCmdDispatch [ecmcCmdParser.c] [script] [replays]
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <inttypes.h>
+#include <time.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include "ecmcCmdDispatch.h"
+
+#ifndef ECMC_BENCH_CMD_PARSER
+# define ECMC_BENCH_CMD_PARSER "../../devEcmcSup/com/ecmcCmdParser.c"
+#endif
+
+#define BENCH_ARGS 16
+#define BENCH_ARG_BYTES 4096
+#define BENCH_SLAVES 100
+#define BENCH_AXES 32
+
+// Command of the sscanf()/strcmp() chain
+typedef struct {
+  std::string       name;     // Command name (format up to "(")
+  std::string       format;
+  bool              isStrcmp;
+  std::vector<int>  counts;   // Matched if nvals == any count
+  std::vector<bool> atLeast;  // nvals >= count instead of ==
+} ecmcBenchChainCmd;
+
+// Table commands (ECMC_CFG_CMD_xx), matched against the argument string
+typedef struct {
+  const char *type;
+  const char *format;
+  int         count;
+} ecmcBenchTableType;
+
+static const ecmcBenchTableType tableTypes[] = {
+  { "1I",   "(%d)",          1 },
+  { "2I",   "(%d,%d)",       2 },
+  { "3I",   "(%d,%d,%d)",    3 },
+  { "4I",   "(%d,%d,%d,%d)", 4 },
+  { "1D",   "(%lf)",         1 },
+  { "1I1D", "(%d,%lf)",      2 },
+};
+
+static char benchArgs[BENCH_ARGS][BENCH_ARG_BYTES] __attribute__((aligned(8)));
+static volatile int benchSink;
+
+static uint64_t nowNs() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int scanArgs(const char *line, const char *format) {
+  return sscanf(line, format,
+                benchArgs[0], benchArgs[1], benchArgs[2], benchArgs[3],
+                benchArgs[4], benchArgs[5], benchArgs[6], benchArgs[7],
+                benchArgs[8], benchArgs[9], benchArgs[10], benchArgs[11],
+                benchArgs[12], benchArgs[13], benchArgs[14], benchArgs[15]);
+}
+
+#define BENCH_TABLE_HANDLER(TYPE, FORMAT, COUNT)               \
+  static int benchCmd##TYPE(const char *args, int *errorCode) { \
+    if (scanArgs(args, FORMAT) != COUNT) {                      \
+      return -1;                                                \
+    }                                                           \
+    *errorCode = 0;                                             \
+    return 0;                                                   \
+  }
+
+BENCH_TABLE_HANDLER(1I,   "(%d)",          1)
+BENCH_TABLE_HANDLER(2I,   "(%d,%d)",       2)
+BENCH_TABLE_HANDLER(3I,   "(%d,%d,%d)",    3)
+BENCH_TABLE_HANDLER(4I,   "(%d,%d,%d,%d)", 4)
+BENCH_TABLE_HANDLER(1D,   "(%lf)",         1)
+BENCH_TABLE_HANDLER(1I1D, "(%d,%lf)",      2)
+
+static ecmcCmdHandler tableHandlers[] = {
+  benchCmd1I, benchCmd2I, benchCmd3I, benchCmd4I, benchCmd1D, benchCmd1I1D
+};
+
+static bool readFile(const char *fileName, std::string *text) {
+  FILE *file = fopen(fileName, "r");
+
+  if (!file) {
+    return false;
+  }
+  char buffer[4096];
+  size_t n;
+
+  while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    text->append(buffer, n);
+  }
+  fclose(file);
+  return true;
+}
+
+// Replace comments with spaces (string and char literals kept)
+static std::string stripComments(const std::string &src) {
+  std::string out = src;
+  size_t i = 0;
+
+  while (i < out.size()) {
+    if ((out[i] == '"') || (out[i] == '\'')) {
+      char quote = out[i++];
+
+      while ((i < out.size()) && (out[i] != quote)) {
+        i += out[i] == '\\' ? 2 : 1;
+      }
+      i++;
+    } else if (out.compare(i, 2, "//") == 0) {
+      while ((i < out.size()) && (out[i] != '\n')) {
+        out[i++] = ' ';
+      }
+    } else if (out.compare(i, 2, "/*") == 0) {
+      size_t end = out.find("*/", i + 2);
+      end = end == std::string::npos ? out.size() : end + 2;
+
+      for (; i < end; i++) {
+        if (out[i] != '\n') {
+          out[i] = ' ';
+        }
+      }
+    } else {
+      i++;
+    }
+  }
+  return out;
+}
+
+// String macros of the parser and of inttypes.h used in formats
+static void initMacros(const std::string                  &src,
+                       std::map<std::string, std::string> *macros) {
+  (*macros)["PRIu64"] = PRIu64;
+  (*macros)["PRIx64"] = PRIx64;
+  (*macros)["SCNu64"] = SCNu64;
+  (*macros)["SCNx64"] = SCNx64;
+
+  size_t pos = 0;
+
+  while ((pos = src.find("#define ", pos)) != std::string::npos) {
+    char name[256];
+    char value[1024];
+
+    pos += 8;
+
+    if (sscanf(src.c_str() + pos, "%255s \"%1023[^\"\n]\"", name,
+               value) == 2) {
+      (*macros)[name] = value;
+    }
+  }
+}
+
+/*
+ * Parse concatenated string literals and string macros at pos (up to the
+ * next "," or ")"). Returns false if no literal was found.
+ */
+static bool parseLiteral(const std::string                        &src,
+                         size_t                                    pos,
+                         const std::map<std::string, std::string> &macros,
+                         std::string                              *literal) {
+  bool found = false;
+
+  literal->clear();
+
+  while (pos < src.size()) {
+    char c = src[pos];
+
+    if (isspace((unsigned char)c)) {
+      pos++;
+    } else if (c == '"') {
+      pos++;
+
+      while ((pos < src.size()) && (src[pos] != '"')) {
+        if (src[pos] == '\\') {
+          pos++;
+          char e = src[pos];
+          literal->push_back(e == 'n' ? '\n' : e == 't' ? '\t' : e);
+        } else {
+          literal->push_back(src[pos]);
+        }
+        pos++;
+      }
+      pos++;
+      found = true;
+    } else if (isalpha((unsigned char)c) || (c == '_')) {
+      size_t end = pos;
+
+      while ((end < src.size()) &&
+             (isalnum((unsigned char)src[end]) || (src[end] == '_'))) {
+        end++;
+      }
+      std::map<std::string, std::string>::const_iterator it =
+        macros.find(src.substr(pos, end - pos));
+
+      if (it == macros.end()) {
+        return false;
+      }
+      literal->append(it->second);
+      pos   = end;
+      found = true;
+    } else {
+      break;
+    }
+  }
+  return found;
+}
+
+// Commands of the chain in handleCfgCommand() in order
+static int readChain(const std::string                        &src,
+                     const std::map<std::string, std::string> &macros,
+                     std::vector<ecmcBenchChainCmd>           *chain) {
+  size_t start = src.find("static int handleCfgCommand(");
+
+  if (start == std::string::npos) {
+    return -1;
+  }
+  size_t end = src.find("\n}", start);
+  size_t pos = start;
+
+  while (true) {
+    size_t scan = src.find("sscanf(myarg_1,", pos);
+    size_t cmp  = src.find("strcmp(myarg_1,", pos);
+
+    pos = scan < cmp ? scan : cmp;
+
+    if ((pos == std::string::npos) || (pos > end)) {
+      break;
+    }
+    ecmcBenchChainCmd cmd;
+
+    cmd.isStrcmp = pos == cmp;
+    pos         += strlen("sscanf(myarg_1,");
+
+    if (!parseLiteral(src, pos, macros, &cmd.format)) {
+      fprintf(stderr, "Failed to parse format at offset %zu\n", pos);
+      return -1;
+    }
+
+    // nvals tests up to the next command
+    if (!cmd.isStrcmp) {
+      size_t next = std::min(src.find("sscanf(myarg_1,", pos),
+                             src.find("strcmp(myarg_1,", pos));
+      size_t test = pos;
+
+      next = std::min(next, end);
+
+      while (((test = src.find("if (nvals ", test)) != std::string::npos) &&
+             (test < next)) {
+        char op[3] = { 0 };
+        int  count = 0;
+
+        if (sscanf(src.c_str() + test, "if (nvals %2[=>] %d)", op,
+                   &count) == 2) {
+          cmd.counts.push_back(count);
+          cmd.atLeast.push_back(op[0] == '>');
+        }
+        test++;
+      }
+
+      if (cmd.counts.empty()) {
+        fprintf(stderr, "No nvals test for %s\n", cmd.format.c_str());
+        return -1;
+      }
+    }
+    cmd.name = cmd.format.substr(0, cmd.format.find_first_of("(="));
+    chain->push_back(cmd);
+  }
+  return 0;
+}
+
+// ECMC_CFG_CMD_xx(NAME, FCN) entries (type index in tableTypes)
+static int readTable(const std::string        &src,
+                     std::vector<std::string> *names,
+                     std::vector<int>         *types) {
+  size_t pos = 0;
+
+  while ((pos = src.find("\nECMC_CFG_CMD_", pos)) != std::string::npos) {
+    char type[8];
+    char name[256];
+
+    pos += strlen("\nECMC_CFG_CMD_");
+
+    if (sscanf(src.c_str() + pos, "%7[0-9ID](%255[A-Za-z0-9_],", type,
+               name) != 2) {
+      continue;
+    }
+    int t = -1;
+
+    for (size_t i = 0; i < sizeof(tableTypes) / sizeof(tableTypes[0]); i++) {
+      if (strcmp(type, tableTypes[i].type) == 0) {
+        t = (int)i;
+      }
+    }
+
+    if (t < 0) {
+      fprintf(stderr, "Unknown command type ECMC_CFG_CMD_%s\n", type);
+      return -1;
+    }
+    names->push_back(name);
+    types->push_back(t);
+  }
+  return names->empty() ? -1 : 0;
+}
+
+static bool chainMatch(const ecmcBenchChainCmd *cmd, const char *line) {
+  if (cmd->isStrcmp) {
+    return strcmp(line, cmd->format.c_str()) == 0;
+  }
+  int nvals = scanArgs(line, cmd->format.c_str());
+
+  for (size_t i = 0; i < cmd->counts.size(); i++) {
+    if (cmd->atLeast[i] ? nvals >= cmd->counts[i] : nvals == cmd->counts[i]) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Index of matching command in chain or -1
+static int runChain(const std::vector<ecmcBenchChainCmd> &chain,
+                    const char                           *line) {
+  for (size_t i = 0; i < chain.size(); i++) {
+    if (chainMatch(&chain[i], line)) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+// Same as handleCfgCommand(). Table index or chain index + table size
+static int runDispatch(const ecmcCmdDispatchTable           *table,
+                       const std::vector<ecmcBenchChainCmd> &chain,
+                       const char                           *line) {
+  const char *args = strchr(line, '(');
+
+  if (args) {
+    const ecmcCmdDispatchEntry *cmd = ecmcCmdDispatchFind(table,
+                                                          line,
+                                                          args - line);
+    int errorCode = 0;
+
+    if (cmd && (cmd->handler(args, &errorCode) == 0)) {
+      return (int)(cmd - table->entries);
+    }
+  }
+  int index = runChain(chain, line);
+
+  return index < 0 ? -1 : index + table->count;
+}
+
+// Cfg commands of a script (without "Cfg.")
+static void readScript(const std::string &text,
+                       std::vector<std::string> *lines) {
+  size_t pos = 0;
+
+  while (pos < text.size()) {
+    size_t end = text.find('\n', pos);
+
+    if (end == std::string::npos) {
+      end = text.size();
+    }
+    std::string line = text.substr(pos, end - pos);
+    size_t cfg = line.find("Cfg.");
+
+    if ((cfg != std::string::npos) && (line.find('#') != 0)) {
+      line = line.substr(cfg + 4);
+
+      if ((cfg > 0) && (line.rfind('"') != std::string::npos)) {
+        line = line.substr(0, line.rfind('"'));
+      }
+
+      while (!line.empty() && isspace((unsigned char)line[line.size() - 1])) {
+        line.erase(line.size() - 1);
+      }
+      lines->push_back(line);
+    }
+    pos = end + 1;
+  }
+}
+
+static void addLine(std::vector<std::string> *lines, const char *format, ...)
+__attribute__((format(printf, 2, 3)));
+
+static void addLine(std::vector<std::string> *lines, const char *format, ...) {
+  char    line[512];
+  va_list ap;
+
+  va_start(ap, format);
+  vsnprintf(line, sizeof(line), format, ap);
+  va_end(ap);
+  lines->push_back(line);
+}
+
+// Startup of slaves (PDOs, SDOs) and axes (links, parameters)
+static void generateScript(std::vector<std::string> *lines) {
+  addLine(lines, "EcSetMaster(0)");
+  addLine(lines, "EcResetMaster(0)");
+  addLine(lines, "SetSampleRate(1000)");
+
+  for (int s = 0; s < BENCH_SLAVES; s++) {
+    addLine(lines, "EcSlaveVerify(0,%d,0x00000002,0x%08x)", s, 0x1b813052);
+    addLine(lines, "EcAddSlave(0,%d,0x00000002,0x%08x)", s, 0x1b813052);
+
+    for (int i = 0; i < 4; i++) {
+      addLine(lines, "EcAddSdo(%d,0x8010,0x%02x,%d,2)", s, i + 1, 1000 * i);
+    }
+
+    for (int i = 0; i < 8; i++) {
+      addLine(lines,
+              "EcAddEntryComplete(%d,0x00000002,0x%08x,%d,%d,0x%04x,0x%04x,"
+              "0x%02x,%d,%d,ch%02d)",
+              s, 0x1b813052, i < 4 ? 2 : 1, i < 4 ? 2 : 3, 0x1600 + i,
+              0x7000 + i, 1, 16, 1, i);
+    }
+    addLine(lines, "EcSlaveConfigDC(%d,0x300,1000000,0,1000000,0)", s);
+  }
+
+  for (int a = 1; a <= BENCH_AXES; a++) {
+    int s = a * 2;
+
+    addLine(lines, "CreateAxis(%d,1,0)", a);
+    addLine(lines, "LinkEcEntryToObject(ec0.s%d.positionActual01,"
+            "ax%d.enc.actpos)", s, a);
+    addLine(lines, "LinkEcEntryToObject(ec0.s%d.velocitySetpoint01,"
+            "ax%d.drv.velocity)", s + 1, a);
+    addLine(lines, "LinkEcEntryToObject(ec0.s%d.driveControl01.0,"
+            "ax%d.drv.control)", s + 1, a);
+    addLine(lines, "LinkEcEntryToObject(ec0.s%d.driveStatus01.1,"
+            "ax%d.drv.status)", s + 1, a);
+    addLine(lines, "SetAxisEncScaleNum(%d,360)", a);
+    addLine(lines, "SetAxisEncScaleDenom(%d,12800)", a);
+    addLine(lines, "SetAxisEncBits(%d,16)", a);
+    addLine(lines, "SetAxisEncType(%d,0)", a);
+    addLine(lines, "SetAxisEncOffset(%d,0)", a);
+    addLine(lines, "SetAxisDrvScaleNum(%d,360)", a);
+    addLine(lines, "SetAxisDrvScaleDenom(%d,32768)", a);
+    addLine(lines, "SetAxisDrvType(%d,0)", a);
+    addLine(lines, "SetAxisCntrlKp(%d,5.0)", a);
+    addLine(lines, "SetAxisCntrlKi(%d,0.02)", a);
+    addLine(lines, "SetAxisCntrlKd(%d,0)", a);
+    addLine(lines, "SetAxisCntrlKff(%d,1)", a);
+    addLine(lines, "SetAxisCntrlOutHL(%d,32000)", a);
+    addLine(lines, "SetAxisCntrlOutLL(%d,-32000)", a);
+    addLine(lines, "SetAxisSoftLimitPosBwd(%d,-100)", a);
+    addLine(lines, "SetAxisEnableSoftLimitBwd(%d,1)", a);
+    addLine(lines, "SetAxisSoftLimitPosFwd(%d,100)", a);
+    addLine(lines, "SetAxisEnableSoftLimitFwd(%d,1)", a);
+    addLine(lines, "SetAxisMonAtTargetTol(%d,0.1)", a);
+    addLine(lines, "SetAxisMonAtTargetTime(%d,100)", a);
+    addLine(lines, "SetAxisMonPosLagTol(%d,1)", a);
+    addLine(lines, "SetAxisMonPosLagTime(%d,100)", a);
+    addLine(lines, "SetAxisMonEnableLagMon(%d,1)", a);
+    addLine(lines, "SetAxisMonMaxVel(%d,100)", a);
+    addLine(lines, "SetAxisMonEnableMaxVel(%d,1)", a);
+    addLine(lines, "SetAxisAcc(%d,100)", a);
+    addLine(lines, "SetAxisDec(%d,100)", a);
+    addLine(lines, "SetAxisEmergDeceleration(%d,500)", a);
+    addLine(lines, "SetAxisJogVel(%d,10)", a);
+    addLine(lines, "SetAxisHomeVelTwordsCam(%d,5)", a);
+    addLine(lines, "SetAxisHomeVelOffCam(%d,2)", a);
+    addLine(lines, "SetAxisTrajSourceType(%d,0)", a);
+    addLine(lines, "SetAxisEncSourceType(%d,0)", a);
+    addLine(lines, "EcSetEntryUpdateInRealtime(%d,positionActual01,1)", s);
+  }
+
+  addLine(lines, "CreatePLC(0,10)");
+  addLine(lines, "SetPLCExpr(0)=ax1.traj.targetpos:=10;");
+  addLine(lines, "SetPLCEnable(0,1)");
+  addLine(lines, "EcApplyConfig(1)");
+  addLine(lines, "ValidateConfig()");
+}
+
+int main(int argc, char **argv) {
+  const char *parserFile = argc > 1 ? argv[1] : ECMC_BENCH_CMD_PARSER;
+  const char *scriptFile = argc > 2 ? argv[2] : NULL;
+  int replays            = argc > 3 ? atoi(argv[3]) : 20;
+  std::string src;
+
+  if ((replays <= 0) || !readFile(parserFile, &src)) {
+    printf("Usage: %s [ecmcCmdParser.c] [script] [replays]\n", argv[0]);
+    return 1;
+  }
+  src = stripComments(src);
+
+  std::map<std::string, std::string> macros;
+  std::vector<ecmcBenchChainCmd> chain;
+  std::vector<std::string> tableNames;
+  std::vector<int> tableTypeIndex;
+
+  initMacros(src, &macros);
+
+  if (readChain(src, macros, &chain) || readTable(src, &tableNames,
+                                                  &tableTypeIndex)) {
+    printf("ERROR: Failed to read commands from %s.\n", parserFile);
+    return 1;
+  }
+
+  // Dispatch table
+  std::vector<ecmcCmdDispatchEntry> entries(tableNames.size());
+
+  for (size_t i = 0; i < tableNames.size(); i++) {
+    entries[i].name    = tableNames[i].c_str();
+    entries[i].handler = tableHandlers[tableTypeIndex[i]];
+  }
+  ecmcCmdDispatchTable table;
+
+  if (ecmcCmdDispatchInit(&table, &entries[0], (int)entries.size())) {
+    printf("ERROR: Failed to build dispatch table.\n");
+    return 1;
+  }
+
+  // Chain of all commands (table commands first)
+  std::vector<ecmcBenchChainCmd> fullChain;
+
+  for (size_t i = 0; i < tableNames.size(); i++) {
+    ecmcBenchChainCmd cmd;
+    const ecmcBenchTableType *type = &tableTypes[tableTypeIndex[i]];
+
+    cmd.name     = tableNames[i];
+    cmd.format   = tableNames[i] + type->format;
+    cmd.isStrcmp = false;
+    cmd.counts.push_back(type->count);
+    cmd.atLeast.push_back(false);
+    fullChain.push_back(cmd);
+  }
+  fullChain.insert(fullChain.end(), chain.begin(), chain.end());
+
+  // Script
+  std::vector<std::string> lines;
+
+  if (scriptFile) {
+    std::string text;
+
+    if (!readFile(scriptFile, &text)) {
+      printf("ERROR: Failed to open %s.\n", scriptFile);
+      return 1;
+    }
+    readScript(text, &lines);
+  } else {
+    generateScript(&lines);
+  }
+
+  if (lines.empty()) {
+    printf("ERROR: No Cfg commands in script.\n");
+    return 1;
+  }
+
+  // Both paths must select the same command
+  std::vector<std::string> chainCmd(lines.size());
+  int errors    = 0;
+  int unmatched = 0;
+  int inTable   = 0;
+
+  for (size_t i = 0; i < lines.size(); i++) {
+    int c = runChain(fullChain, lines[i].c_str());
+    int d = runDispatch(&table, chain, lines[i].c_str());
+
+    std::string chainName = c < 0 ? "" : fullChain[c].format;
+    std::string dispName  = d < 0 ? "" :
+                            d < table.count ?
+                            fullChain[d].format :
+                            chain[d - table.count].format;
+
+    if (chainName != dispName) {
+      printf("Mismatch: %s (chain %s, dispatch %s)\n", lines[i].c_str(),
+             chainName.c_str(), dispName.c_str());
+      errors++;
+    }
+    unmatched += c < 0;
+    inTable   += (d >= 0) && (d < table.count);
+  }
+
+  int dummy = 0;
+  uint64_t start = nowNs();
+
+  for (int r = 0; r < replays; r++) {
+    for (size_t i = 0; i < lines.size(); i++) {
+      dummy += runChain(fullChain, lines[i].c_str());
+    }
+  }
+  double chainNs = (double)(nowNs() - start) / replays / lines.size();
+
+  start = nowNs();
+
+  for (int r = 0; r < replays; r++) {
+    for (size_t i = 0; i < lines.size(); i++) {
+      dummy += runDispatch(&table, chain, lines[i].c_str());
+    }
+  }
+  double dispNs = (double)(nowNs() - start) / replays / lines.size();
+
+  benchSink = dummy;
+
+  printf("Cfg command parsing: %zu lines (%d in table, %d unknown), "
+         "%d table + %zu chain commands\n",
+         lines.size(), inTable, unmatched, table.count, chain.size());
+  printf("  %-9s %12s %14s\n", "", "per line [us]", "script [ms]");
+  printf("  %-9s %12.2f %14.2f\n", "chain", chainNs * 1e-3,
+         chainNs * lines.size() * 1e-6);
+  printf("  %-9s %12.2f %14.2f\n", "dispatch", dispNs * 1e-3,
+         dispNs * lines.size() * 1e-6);
+  printf("  %-9s %12.1f\n", "speedup", chainNs / dispNs);
+
+  ecmcCmdDispatchFree(&table);
+
+  if (errors) {
+    printf("ERROR: %d lines matched different commands.\n", errors);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,175 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcBenchParamIndex.cpp
+*
+*  Startup benchmark of the lookup of available asyn parameters by name
+*  (ecmcAsynPortDriver::findAvailParam(), called for each drvUserCreate()):
+*  - linear: strcmp() scan over the list of parameters (old lookup)
+*  - index:  ecmcNameIndex (filled in appendAvailParam())
+*
+*  All parameters are added and then each one is looked up once (all
+*  parameters linked to records).
+*
+*  Usage: ecmcBenchParamIndex [parameters]
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include <utility>
+#include "ecmcNameIndex.h"
+
+#define BENCH_PAD_BYTES 256
+
+// Parameter object (only the name is accessed)
+typedef struct {
+  char   *name;
+  uint8_t pad[BENCH_PAD_BYTES];
+} ecmcBenchParam;
+
+static uint64_t nowNs() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Names like the ones generated by ecmc (EtherCAT entries, axes, PLCs)
+static void benchParamName(int i, char *name, size_t size) {
+  static const char *entries[8] = {
+    "binaryInput", "binaryOutput", "analogInput", "analogOutput",
+    "positionActual", "velocitySetpoint", "controlWord", "statusWord"
+  };
+  static const char *axisParams[8] = {
+    "enc.actpos", "enc.actvel", "traj.setpos", "traj.setvel",
+    "cntrl.error", "status", "control", "errorid"
+  };
+
+  switch (i % 4) {
+  case 0:
+  case 1:
+    snprintf(name, size, "ec0.s%d.%s%02d", i / 64, entries[(i / 4) % 8],
+             i % 64);
+    break;
+
+  case 2:
+    snprintf(name, size, "ax%d.%s.%d", i / 32, axisParams[(i / 4) % 8],
+             i % 32);
+    break;
+
+  default:
+    snprintf(name, size, "plcs.plc%d.static.var%d", i / 256, i % 256);
+    break;
+  }
+}
+
+static int findLinear(std::vector<ecmcBenchParam *> *params,
+                      const char                    *name) {
+  for (size_t i = 0; i < params->size(); i++) {
+    if (strcmp((*params)[i]->name, name) == 0) {
+      return (int)i;
+    }
+  }
+  return -1;
+}
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? atoi(argv[1]) : 50000;
+
+  if (count <= 0) {
+    printf("Usage: %s [parameters]\n", argv[0]);
+    return 1;
+  }
+
+  char name[128];
+  std::vector<ecmcBenchParam *> params;
+
+  for (int i = 0; i < count; i++) {
+    benchParamName(i, name, sizeof(name));
+    ecmcBenchParam *param = new ecmcBenchParam;
+    param->name = strdup(name);
+    memset(param->pad, 0, sizeof(param->pad));
+    params.push_back(param);
+  }
+
+  // Records are not loaded in parameter order
+  std::vector<int> order(count);
+
+  srand(1);
+
+  for (int i = 0; i < count; i++) {
+    order[i] = i;
+  }
+
+  for (int i = count - 1; i > 0; i--) {
+    std::swap(order[i], order[rand() % (i + 1)]);
+  }
+
+  // Linear
+  std::vector<ecmcBenchParam *> list;
+  std::vector<int> linearResult(count);
+  uint64_t start = nowNs();
+
+  for (int i = 0; i < count; i++) {
+    list.push_back(params[i]);
+  }
+
+  for (int i = 0; i < count; i++) {
+    linearResult[i] = findLinear(&list, params[order[i]]->name);
+  }
+  double linearS = (nowNs() - start) * 1e-9;
+
+  // Index
+  ecmcNameIndex index;
+  std::vector<int> indexResult(count);
+
+  start = nowNs();
+  index.init(count);
+
+  for (int i = 0; i < count; i++) {
+    index.add(params[i]->name, i);
+  }
+
+  for (int i = 0; i < count; i++) {
+    indexResult[i] = index.find(params[order[i]]->name);
+  }
+  double indexS = (nowNs() - start) * 1e-9;
+
+  int errors = 0;
+
+  for (int i = 0; i < count; i++) {
+    if ((linearResult[i] != order[i]) || (indexResult[i] != order[i])) {
+      errors++;
+    }
+  }
+
+  if ((findLinear(&list, "not.a.param") != -1) ||
+      (index.find("not.a.param") != -1)) {
+    errors++;
+  }
+
+  printf("Param lookup: %d parameters, each looked up once\n", count);
+  printf("  %-8s %12s %16s\n", "", "total [s]", "per lookup [us]");
+  printf("  %-8s %12.4f %16.3f\n", "linear", linearS, linearS * 1e6 / count);
+  printf("  %-8s %12.4f %16.3f\n", "index", indexS, indexS * 1e6 / count);
+  printf("  %-8s %12.0f\n", "speedup", linearS / indexS);
+
+  for (int i = 0; i < count; i++) {
+    free(params[i]->name);
+    delete params[i];
+  }
+
+  if (errors) {
+    printf("ERROR: %d lookups returned the wrong parameter.\n", errors);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,379 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcBenchProcessImage.cpp
+*
+*  Benchmark of the EtherCAT process image mapping (ns/entry):
+*  - per entry: entries in slave lists, data type switch per entry (same
+*    as ecmcEcEntry::updateInputProcessImage()/writeOutProcessImage())
+*  - copy tables: type sorted tables of ecmcEcProcessImage
+*    (ecmcEcCopyTablesIn()/ecmcEcCopyTablesOut())
+*
+*  Usage: ecmcBenchProcessImage [entries] [cycles]
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <vector>
+#include <utility>
+#include "ecmcEcCopyTable.h"
+
+#define BENCH_ENTRIES_PER_SLAVE 8
+#define BENCH_PAD_BYTES 192
+
+// Entry with a data type switch per entry (as ecmcEcEntry)
+class ecmcBenchEntry {
+ public:
+  ecmcBenchEntry(ecmcEcDataType dt, uint8_t *adr, unsigned int bitOffset) {
+    dataType_  = dt;
+    adr_       = adr;
+    bitOffset_ = bitOffset;
+    buffer_    = 0;
+    float32Ptr_ = (float *)&buffer_;
+    float64Ptr_ = (double *)&buffer_;
+    memset(pad_, 0, sizeof(pad_));
+  }
+
+  __attribute__((noinline)) int updateInputProcessImage() {
+    buffer_ = 0;
+
+    switch (dataType_) {
+    case ECMC_EC_B1:
+      buffer_ = (uint64_t)EC_READ_BIT(adr_, bitOffset_);
+      break;
+
+    case ECMC_EC_U8:
+      buffer_ = (uint64_t)EC_READ_U8(adr_);
+      break;
+
+    case ECMC_EC_S8:
+      buffer_ = (uint64_t)EC_READ_S8(adr_);
+      break;
+
+    case ECMC_EC_U16:
+      buffer_ = (uint64_t)EC_READ_U16(adr_);
+      break;
+
+    case ECMC_EC_S16:
+      buffer_ = (uint64_t)EC_READ_S16(adr_);
+      break;
+
+    case ECMC_EC_U32:
+      buffer_ = (uint64_t)EC_READ_U32(adr_);
+      break;
+
+    case ECMC_EC_S32:
+      buffer_ = (uint64_t)EC_READ_S32(adr_);
+      break;
+
+    case ECMC_EC_U64:
+      buffer_ = (uint64_t)EC_READ_U64(adr_);
+      break;
+
+    case ECMC_EC_S64:
+      buffer_ = (uint64_t)EC_READ_S64(adr_);
+      break;
+
+    case ECMC_EC_F32:
+      *float32Ptr_ = EC_READ_REAL(adr_);
+      break;
+
+    case ECMC_EC_F64:
+      *float64Ptr_ = EC_READ_LREAL(adr_);
+      break;
+
+    default:
+      buffer_ = 0;
+      break;
+    }
+    return 0;
+  }
+
+  __attribute__((noinline)) int writeOutProcessImage() {
+    switch (dataType_) {
+    case ECMC_EC_B1:
+      EC_WRITE_BIT(adr_, bitOffset_, buffer_);
+      break;
+
+    case ECMC_EC_U8:
+      EC_WRITE_U8(adr_, buffer_);
+      break;
+
+    case ECMC_EC_S8:
+      EC_WRITE_S8(adr_, buffer_);
+      break;
+
+    case ECMC_EC_U16:
+      EC_WRITE_U16(adr_, buffer_);
+      break;
+
+    case ECMC_EC_S16:
+      EC_WRITE_S16(adr_, buffer_);
+      break;
+
+    case ECMC_EC_U32:
+      EC_WRITE_U32(adr_, buffer_);
+      break;
+
+    case ECMC_EC_S32:
+      EC_WRITE_S32(adr_, buffer_);
+      break;
+
+    case ECMC_EC_U64:
+      EC_WRITE_U64(adr_, buffer_);
+      break;
+
+    case ECMC_EC_S64:
+      EC_WRITE_S64(adr_, buffer_);
+      break;
+
+    case ECMC_EC_F32:
+      EC_WRITE_REAL(adr_, *float32Ptr_);
+      break;
+
+    case ECMC_EC_F64:
+      EC_WRITE_LREAL(adr_, *float64Ptr_);
+      break;
+
+    default:
+      break;
+    }
+    return 0;
+  }
+
+  ecmcEcDataType dataType_;
+  uint8_t       *adr_;
+  unsigned int   bitOffset_;
+  uint64_t       buffer_;
+  float         *float32Ptr_;
+  double        *float64Ptr_;
+  // Other members of the entry object (not accessed)
+  uint8_t        pad_[BENCH_PAD_BYTES];
+};
+
+// Slave with list of entries (as ecmcEcSlave)
+class ecmcBenchSlave {
+ public:
+  __attribute__((noinline)) void updateInputProcessImage() {
+    for (size_t i = 0; i < entries_.size(); i++) {
+      entries_[i]->updateInputProcessImage();
+    }
+  }
+
+  __attribute__((noinline)) void updateOutProcessImage() {
+    for (size_t i = 0; i < entries_.size(); i++) {
+      entries_[i]->writeOutProcessImage();
+    }
+  }
+
+  std::vector<ecmcBenchEntry *> entries_;
+};
+
+static uint64_t nowNs() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Typical mix of a bus (digital io, analog io, drives, encoders)
+static ecmcEcDataType benchDataType(int i) {
+  static const ecmcEcDataType mix[20] = {
+    ECMC_EC_B1,  ECMC_EC_B1,  ECMC_EC_B1,  ECMC_EC_B1,  ECMC_EC_B1,
+    ECMC_EC_B1,  ECMC_EC_U8,  ECMC_EC_U8,  ECMC_EC_U16, ECMC_EC_U16,
+    ECMC_EC_U16, ECMC_EC_S16, ECMC_EC_S16, ECMC_EC_U32, ECMC_EC_U32,
+    ECMC_EC_S32, ECMC_EC_S32, ECMC_EC_S64, ECMC_EC_F32, ECMC_EC_F64
+  };
+
+  return mix[i % 20];
+}
+
+static size_t benchDataSize(ecmcEcDataType dt) {
+  switch (dt) {
+  case ECMC_EC_U16:
+  case ECMC_EC_S16:
+    return 2;
+
+  case ECMC_EC_U32:
+  case ECMC_EC_S32:
+  case ECMC_EC_F32:
+    return 4;
+
+  case ECMC_EC_U64:
+  case ECMC_EC_S64:
+  case ECMC_EC_F64:
+    return 8;
+
+  default:
+    return 1;
+  }
+}
+
+int main(int argc, char **argv) {
+  int entryCount = argc > 1 ? atoi(argv[1]) : 4096;
+  int cycles     = argc > 2 ? atoi(argv[2]) : 20000;
+
+  if ((entryCount <= 0) || (cycles <= 0)) {
+    printf("Usage: %s [entries] [cycles]\n", argv[0]);
+    return 1;
+  }
+
+  // Domain memory (inputs and outputs)
+  std::vector<ecmcEcDataType> types(entryCount);
+  std::vector<size_t>         offsets(entryCount);
+  std::vector<unsigned int>   bitOffsets(entryCount);
+  size_t domainSize = 0;
+  int    bit        = 8;
+
+  for (int i = 0; i < entryCount; i++) {
+    types[i] = benchDataType(i);
+
+    if (types[i] == ECMC_EC_B1) {
+      if (bit == 8) {
+        bit = 0;
+        domainSize++;
+      }
+      offsets[i]    = domainSize - 1;
+      bitOffsets[i] = bit++;
+      continue;
+    }
+    bit           = 8;
+    offsets[i]    = domainSize;
+    bitOffsets[i] = 0;
+    domainSize   += benchDataSize(types[i]);
+  }
+
+  std::vector<uint8_t> inDomain(domainSize);
+  std::vector<uint8_t> outDomainEntry(domainSize);
+  std::vector<uint8_t> outDomainTable(domainSize);
+
+  srand(1);
+
+  for (size_t i = 0; i < domainSize; i++) {
+    inDomain[i] = (uint8_t)rand();
+  }
+
+  // Entry objects, allocated in random order (spread over the heap)
+  std::vector<int> order(entryCount);
+
+  for (int i = 0; i < entryCount; i++) {
+    order[i] = i;
+  }
+
+  for (int i = entryCount - 1; i > 0; i--) {
+    std::swap(order[i], order[rand() % (i + 1)]);
+  }
+
+  std::vector<ecmcBenchEntry *> inEntries(entryCount);
+  std::vector<ecmcBenchEntry *> outEntries(entryCount);
+
+  for (int j = 0; j < entryCount; j++) {
+    int i = order[j];
+    inEntries[i] = new ecmcBenchEntry(types[i], &inDomain[offsets[i]],
+                                      bitOffsets[i]);
+    outEntries[i] = new ecmcBenchEntry(types[i], &outDomainEntry[offsets[i]],
+                                       bitOffsets[i]);
+    outEntries[i]->buffer_ = ((uint64_t)rand() << 32) | rand();
+  }
+
+  std::vector<ecmcBenchSlave> inSlaves((entryCount +
+                                        BENCH_ENTRIES_PER_SLAVE - 1) /
+                                       BENCH_ENTRIES_PER_SLAVE);
+  std::vector<ecmcBenchSlave> outSlaves(inSlaves.size());
+
+  for (int i = 0; i < entryCount; i++) {
+    inSlaves[i / BENCH_ENTRIES_PER_SLAVE].entries_.push_back(inEntries[i]);
+    outSlaves[i / BENCH_ENTRIES_PER_SLAVE].entries_.push_back(outEntries[i]);
+  }
+
+  // Copy tables (same entries in separate buffers)
+  std::vector<uint64_t> inBuffers(entryCount);
+  std::vector<uint64_t> outBuffers(entryCount);
+  ecmcEcCopyTable inTables[ECMC_EC_COPY_TABLES];
+  ecmcEcCopyTable outTables[ECMC_EC_COPY_TABLES];
+
+  for (int i = 0; i < entryCount; i++) {
+    outBuffers[i] = outEntries[i]->buffer_;
+
+    if (types[i] == ECMC_EC_F32) {
+      outBuffers[i] &= 0xFFFFFFFF;
+    }
+    ecmcEcCopyTableAdd(&inTables[types[i]], &inDomain[offsets[i]],
+                       &inBuffers[i], bitOffsets[i]);
+    ecmcEcCopyTableAdd(&outTables[types[i]], &outDomainTable[offsets[i]],
+                       &outBuffers[i], bitOffsets[i]);
+  }
+
+  // Per entry
+  uint64_t start = nowNs();
+
+  for (int c = 0; c < cycles; c++) {
+    for (size_t s = 0; s < inSlaves.size(); s++) {
+      inSlaves[s].updateInputProcessImage();
+    }
+  }
+  double entryInNs = (double)(nowNs() - start) / cycles / entryCount;
+
+  start = nowNs();
+
+  for (int c = 0; c < cycles; c++) {
+    for (size_t s = 0; s < outSlaves.size(); s++) {
+      outSlaves[s].updateOutProcessImage();
+    }
+  }
+  double entryOutNs = (double)(nowNs() - start) / cycles / entryCount;
+
+  // Copy tables
+  start = nowNs();
+
+  for (int c = 0; c < cycles; c++) {
+    ecmcEcCopyTablesIn(inTables);
+  }
+  double tableInNs = (double)(nowNs() - start) / cycles / entryCount;
+
+  start = nowNs();
+
+  for (int c = 0; c < cycles; c++) {
+    ecmcEcCopyTablesOut(outTables);
+  }
+  double tableOutNs = (double)(nowNs() - start) / cycles / entryCount;
+
+  // Both methods must give the same result
+  int errors = 0;
+
+  for (int i = 0; i < entryCount; i++) {
+    if (inEntries[i]->buffer_ != inBuffers[i]) {
+      errors++;
+    }
+  }
+
+  if (memcmp(&outDomainEntry[0], &outDomainTable[0], domainSize) != 0) {
+    errors++;
+  }
+
+  printf("Process image: %d entries, %zu bytes, %d cycles\n",
+         entryCount, domainSize, cycles);
+  printf("  %-12s %12s %12s\n", "", "in [ns/ent]", "out [ns/ent]");
+  printf("  %-12s %12.2f %12.2f\n", "per entry", entryInNs, entryOutNs);
+  printf("  %-12s %12.2f %12.2f\n", "copy tables", tableInNs, tableOutNs);
+  printf("  %-12s %12.1f %12.1f\n", "speedup", entryInNs / tableInNs,
+         entryOutNs / tableOutNs);
+
+  for (int i = 0; i < entryCount; i++) {
+    delete inEntries[i];
+    delete outEntries[i];
+  }
+
+  if (errors) {
+    printf("ERROR: Results of per entry and copy table mapping differ.\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,229 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcBenchRunningStats.cpp
+*
+*  Benchmark of data storage statistics (avg, std, min, max) of a full ring
+*  buffer, one value appended and all statistics read per step:
+*  - rescan:  each statistic calculated from the whole buffer (one pass
+*             each, as the getters of ecmcDataStorage before
+*             ecmcRunningStats)
+*  - running: ecmcRunningStats updated per value (as ecmcDataStorage, no
+*             recalculation from the buffer)
+*
+*  The error of the running statistics against an exact calculation after
+*  several windows of values is printed.
+*
+*  Usage: ecmcBenchRunningStats [elements ...]
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <vector>
+#include "ecmcRunningStats.h"
+
+#define BENCH_RESCAN_VALUES 50000000.0
+#define BENCH_OFFSET 1e6
+#define BENCH_VALUES 65536  // Power of 2
+
+typedef struct {
+  double avg;
+  double std;
+  double min;
+  double max;
+} ecmcBenchStats;
+
+static volatile double benchSink;
+static double benchValues[BENCH_VALUES];
+
+static uint64_t nowNs() {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Signal with noise on a large offset (makes rounding errors visible)
+static void initValues() {
+  srand(1);
+
+  for (int i = 0; i < BENCH_VALUES; i++) {
+    benchValues[i] = BENCH_OFFSET + 100 * sin(i * 0.001) +
+                     (rand() % 1000) * 0.01;
+  }
+}
+
+static double benchValue(uint64_t i) {
+  return benchValues[i & (BENCH_VALUES - 1)];
+}
+
+static double rescanAvg(const double *buffer, int size) {
+  double sum = 0;
+
+  for (int i = 0; i < size; i++) {
+    sum += buffer[i];
+  }
+  return sum / size;
+}
+
+static double rescanStd(const double *buffer, int size) {
+  double avg = rescanAvg(buffer, size);
+  double sum = 0;
+
+  for (int i = 0; i < size; i++) {
+    sum += (buffer[i] - avg) * (buffer[i] - avg);
+  }
+  return sqrt(sum / size);
+}
+
+static double rescanMin(const double *buffer, int size) {
+  double min = buffer[0];
+
+  for (int i = 0; i < size; i++) {
+    if (buffer[i] < min) {
+      min = buffer[i];
+    }
+  }
+  return min;
+}
+
+static double rescanMax(const double *buffer, int size) {
+  double max = buffer[0];
+
+  for (int i = 0; i < size; i++) {
+    if (buffer[i] > max) {
+      max = buffer[i];
+    }
+  }
+  return max;
+}
+
+static void rescan(const double *buffer, int size, ecmcBenchStats *stats) {
+  stats->avg = rescanAvg(buffer, size);
+  stats->std = rescanStd(buffer, size);
+  stats->min = rescanMin(buffer, size);
+  stats->max = rescanMax(buffer, size);
+}
+
+static void fillStats(ecmcRunningStats *stats,
+                      const double     *buffer,
+                      int               size,
+                      int               oldest) {
+  stats->clear();
+
+  for (int i = 0; i < size; i++) {
+    stats->add(buffer[(oldest + i) % size]);
+  }
+}
+
+// Relative error of avg and std (largest)
+static double statsError(ecmcRunningStats *stats, ecmcBenchStats *exact) {
+  double avgError = fabs(stats->getAvg() - exact->avg) / exact->std;
+  double stdError = fabs(stats->getStd() - exact->std) / exact->std;
+
+  if ((stats->getMin() != exact->min) || (stats->getMax() != exact->max)) {
+    return INFINITY;
+  }
+  return avgError > stdError ? avgError : stdError;
+}
+
+static int benchSize(int size) {
+  std::vector<double> buffer(size);
+  uint64_t n = 0;
+
+  for (int i = 0; i < size; i++) {
+    buffer[i] = benchValue(n++);
+  }
+
+  // Rescan
+  int rescanSteps = (int)(BENCH_RESCAN_VALUES / size);
+  int index       = 0;
+  ecmcBenchStats exact;
+
+  if (rescanSteps < 5) {
+    rescanSteps = 5;
+  }
+  uint64_t start = nowNs();
+
+  for (int i = 0; i < rescanSteps; i++) {
+    buffer[index] = benchValue(n++);
+    index         = (index + 1) % size;
+    rescan(&buffer[0], size, &exact);
+    benchSink = exact.avg + exact.std + exact.min + exact.max;
+  }
+  double rescanNs = (double)(nowNs() - start) / rescanSteps;
+
+  // Running, steps over several windows
+  int runningSteps = 4 * size > 4000000 ? 4 * size : 4000000;
+  ecmcRunningStats stats(size);
+
+  fillStats(&stats, &buffer[0], size, index);
+  start = nowNs();
+
+  for (int i = 0; i < runningSteps; i++) {
+    double value = benchValue(n++);
+
+    stats.remove(buffer[index]);
+    stats.add(value);
+    buffer[index] = value;
+    index         = (index + 1) % size;
+    benchSink     = stats.getAvg() + stats.getStd() + stats.getMin() +
+                    stats.getMax();
+  }
+  double runningNs = (double)(nowNs() - start) / runningSteps;
+
+  rescan(&buffer[0], size, &exact);
+  double error = statsError(&stats, &exact);
+
+  printf("  %9d %14.1f %14.1f %10.0f %14.1e\n", size, rescanNs,
+         runningNs, rescanNs / runningNs, error);
+
+  // Running statistics must be exact to rounding (no drift)
+  return error < 1e-6 ? 0 : 1;
+}
+
+int main(int argc, char **argv) {
+  std::vector<int> sizes;
+
+  for (int i = 1; i < argc; i++) {
+    sizes.push_back(atoi(argv[i]));
+
+    if (sizes.back() <= 0) {
+      printf("Usage: %s [elements ...]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  if (sizes.empty()) {
+    sizes.push_back(1000);
+    sizes.push_back(10000);
+    sizes.push_back(100000);
+    sizes.push_back(1000000);
+  }
+
+  printf("Data storage statistics: ns per appended value (all statistics "
+         "read)\n");
+  printf("  %9s %14s %14s %10s %14s\n", "elements", "rescan [ns]",
+         "running [ns]", "speedup", "error");
+  int errors = 0;
+
+  initValues();
+
+  for (size_t i = 0; i < sizes.size(); i++) {
+    errors += benchSize(sizes[i]);
+  }
+
+  if (errors) {
+    printf("ERROR: Statistics of %d sizes differ from exact values.\n",
+           errors);
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,294 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcCheckAxisGroupArc.cpp
+*
+*  Check of the arc of circular axis group moves (ecmcAxisGroupArc) for
+*  random centers, radii, start and end angles in both directions (also
+*  full circles, end close to start and start/end radius differences
+*  within tolerance). Each arc is sampled and checked for:
+*  - rejection of start and end points not on a circle
+*  - start and end position, direction and swept angle
+*  - speed along the arc within the path speed (path length) and
+*    velocity consistent with the position
+*  - continuity of the position
+*  - bounds (soft limit check) equal to the sampled extremes
+*
+*  Usage: ecmcCheckAxisGroupArc [arcs] [seed]
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "ecmcAxisGroupArc.h"
+
+#define CHECK_SAMPLES 2048
+#define CHECK_REL_TOL 1e-9
+#define CHECK_MAX_PRINTED 10
+
+typedef struct {
+  double center[2];
+  double start[2];
+  double end[2];
+  int    direction;
+  bool   valid;       // Start and end on circle (within tolerance)
+} ecmcCheckArc;
+
+static double randUniform(double min, double max) {
+  return min + (max - min) * rand() / (double)RAND_MAX;
+}
+
+// Log uniform in [10^minExp..10^maxExp]
+static double randLog(double minExp, double maxExp) {
+  return pow(10, randUniform(minExp, maxExp));
+}
+
+static void randArc(ecmcCheckArc *arc) {
+  double radius     = randLog(-3, 3);
+  double startAngle = randUniform(-M_PI, M_PI);
+  double endAngle   = randUniform(-M_PI, M_PI);
+  double radiusEnd  = radius *
+                      (1 + randUniform(-0.9, 0.9) * ECMC_AXIS_GROUP_RADIUS_TOL);
+
+  switch (rand() % 10) {
+  case 0:  // Full circle
+    endAngle  = startAngle;
+    radiusEnd = radius;
+    break;
+
+  case 1:  // End close to start (short arc or almost full circle)
+    endAngle = startAngle + (rand() % 2 ? 1 : -1) * randLog(-2, -1);
+    break;
+
+  case 2:  // Not on circle
+    radiusEnd = radius * (1 + (rand() % 2 ? 2 : -2) *
+                          ECMC_AXIS_GROUP_RADIUS_TOL);
+    break;
+  }
+
+  arc->center[0] = randUniform(-100, 100);
+  arc->center[1] = randUniform(-100, 100);
+  arc->start[0]  = arc->center[0] + radius * cos(startAngle);
+  arc->start[1]  = arc->center[1] + radius * sin(startAngle);
+  arc->end[0]    = arc->center[0] + radiusEnd * cos(endAngle);
+  arc->end[1]    = arc->center[1] + radiusEnd * sin(endAngle);
+  arc->direction = rand() % 2 ? 1 : -1;
+  arc->valid     = fabs(radiusEnd - radius) <=
+                   ECMC_AXIS_GROUP_RADIUS_TOL * radius;
+}
+
+static void printArc(int index, ecmcCheckArc *arc, const char *error) {
+  printf("  arc %d: %s\n"
+         "    center=(%.17g, %.17g) direction=%d\n"
+         "    start=(%.17g, %.17g) end=(%.17g, %.17g)\n",
+         index, error, arc->center[0], arc->center[1], arc->direction,
+         arc->start[0], arc->start[1], arc->end[0], arc->end[1]);
+}
+
+static double distance(const double *a, const double *b) {
+  return sqrt((a[0] - b[0]) * (a[0] - b[0]) + (a[1] - b[1]) * (a[1] - b[1]));
+}
+
+/*
+ * Expected swept angle, calculated from the points independent of
+ * ecmcAxisGroupArc: the end angle in the direction of motion (0..2pi], or
+ * a full circle to the end angle if end is at start.
+ */
+static double expectedSweep(ecmcCheckArc *arc, double radius) {
+  double start = atan2(arc->start[1] - arc->center[1],
+                       arc->start[0] - arc->center[0]);
+  double end = atan2(arc->end[1] - arc->center[1],
+                     arc->end[0] - arc->center[0]);
+  double sweep = remainder(arc->direction * (end - start), 2 * M_PI);
+
+  if (distance(arc->start, arc->end) <= ECMC_AXIS_GROUP_RADIUS_TOL * radius) {
+    return 2 * M_PI + sweep;
+  }
+  return sweep <= 0 ? sweep + 2 * M_PI : sweep;
+}
+
+/*
+ * Returns NULL if the arc is OK, otherwise a description of the first
+ * failed check.
+ */
+static const char* checkArc(ecmcCheckArc *arc) {
+  ecmcAxisGroupArc groupArc;
+
+  int errorCode = groupArc.init(arc->center, arc->start, arc->end,
+                                arc->direction);
+
+  if (!arc->valid) {
+    return errorCode == ERROR_AXIS_GROUP_CIRCLE_INVALID ?
+           NULL : "start and end not on circle accepted";
+  }
+
+  if (errorCode) {
+    return "init() failed";
+  }
+
+  double radiusStart = groupArc.getRadiusStart();
+  double radiusEnd   = groupArc.getRadiusEnd();
+  double radiusMax   = fmax(radiusStart, radiusEnd);
+  double radiusMean  = (radiusStart + radiusEnd) / 2;
+  double length      = groupArc.getLength();
+  double sweep       = expectedSweep(arc, radiusStart);
+  double posTol      = CHECK_REL_TOL * (radiusMax + fabs(arc->center[0]) +
+                                        fabs(arc->center[1]));
+  double pos[2], vel[2];
+
+  if (fabs(length - radiusMean * sweep) >
+      fabs(radiusEnd - radiusStart) + CHECK_REL_TOL * length) {
+    return "wrong swept angle";
+  }
+
+  groupArc.evaluate(0, 0, pos, vel);
+
+  if (distance(pos, arc->start) > posTol) {
+    return "arc does not start at start position";
+  }
+
+  groupArc.evaluate(1, 0, pos, vel);
+
+  if (distance(pos, arc->end) > posTol) {
+    return "arc does not end at end position";
+  }
+
+  // Samples (fraction velocity 1: velocity is the derivative per fraction)
+  double df         = 1.0 / CHECK_SAMPLES;
+  double speedLimit = length * radiusMax / radiusMean;
+  double posOld[2]  = { arc->start[0], arc->start[1] };
+  double angle      = 0;
+  double min[2]     = { arc->start[0], arc->start[1] };
+  double max[2]     = { arc->start[0], arc->start[1] };
+
+  for (int i = 1; i <= CHECK_SAMPLES; i++) {
+    double posUp[2], posDown[2], unused[2];
+
+    groupArc.evaluate(i * df, 1, pos, vel);
+
+    double speed = sqrt(vel[0] * vel[0] + vel[1] * vel[1]);
+
+    if (speed > speedLimit * (1 + CHECK_REL_TOL)) {
+      return "speed along arc above path speed";
+    }
+
+    // Central difference (error below speed * sweep^2 * h^2 / 6)
+    double h = df / 2;
+
+    groupArc.evaluate(i * df + h, 0, posUp, unused);
+    groupArc.evaluate(i * df - h, 0, posDown, unused);
+
+    for (int j = 0; j < 2; j++) {
+      if (fabs((posUp[j] - posDown[j]) / (2 * h) - vel[j]) >
+          speedLimit * sweep * sweep * h * h / 3 + posTol / h) {
+        return "velocity not consistent with position";
+      }
+    }
+
+    if (distance(pos, posOld) > speedLimit * df * (1 + CHECK_REL_TOL) +
+        posTol) {
+      return "position not continuous";
+    }
+
+    // Angle increments in direction of motion
+    double a0 = atan2(posOld[1] - arc->center[1], posOld[0] - arc->center[0]);
+    double a1 = atan2(pos[1] - arc->center[1], pos[0] - arc->center[0]);
+    double da = remainder(a1 - a0, 2 * M_PI);
+
+    if (da * arc->direction <= 0) {
+      return "wrong direction";
+    }
+    angle += da;
+
+    for (int j = 0; j < 2; j++) {
+      min[j]    = fmin(min[j], pos[j]);
+      max[j]    = fmax(max[j], pos[j]);
+      posOld[j] = pos[j];
+    }
+  }
+
+  if (fabs(fabs(angle) - sweep) > CHECK_REL_TOL * 2 * M_PI +
+      posTol / radiusStart) {
+    return "wrong swept angle";
+  }
+
+  // Bounds include the sampled extremes, at most the sampling resolution
+  // outside (curvature of the position over the angle step)
+  double boundMin[2], boundMax[2];
+  double curvature = radiusMax + 2 * fabs(radiusEnd - radiusStart) / sweep;
+  double boundTol  = curvature * sweep * sweep * df * df / 2 + posTol;
+
+  groupArc.getBounds(boundMin, boundMax);
+
+  for (int j = 0; j < 2; j++) {
+    if ((boundMin[j] > min[j] + posTol) ||
+        (boundMin[j] < min[j] - boundTol) ||
+        (boundMax[j] < max[j] - posTol) ||
+        (boundMax[j] > max[j] + boundTol)) {
+      return "wrong bounds";
+    }
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  int arcs = argc > 1 ? atoi(argv[1]) : 20000;
+  int seed = argc > 2 ? atoi(argv[2]) : 1;
+
+  if (arcs <= 0) {
+    printf("Usage: %s [arcs] [seed]\n", argv[0]);
+    return 1;
+  }
+
+  srand(seed);
+
+  // Fixed cases first: quarter circles on the axis directions (bounds at
+  // start and end), half circle, full circles (also with end not exactly
+  // at start), short arc with radius change
+  ecmcCheckArc fixed[] = {
+    { { 0, 0 }, { 1, 0 },  { 0, 1 },     1,  true  },
+    { { 0, 0 }, { 1, 0 },  { 0, 1 },     -1, true  },
+    { { 5, 5 }, { 6, 5 },  { 4, 5 },     1,  true  },
+    { { 0, 0 }, { 0, -2 }, { 0, -2 },    -1, true  },
+    { { 0, 0 }, { 1, 0 },  { 1, 0.0005 }, 1, true  },
+    { { 0, 0 }, { 1, 0 },  { 1, 0.0005 }, -1, true },
+    { { 0, 0 }, { 1, 0 },  { 0.9995, 0.002 }, 1, true },
+    { { 0, 0 }, { 0, 0 },  { 1, 0 },     1,  false },
+  };
+  int fixedCount = sizeof(fixed) / sizeof(fixed[0]);
+  int failed     = 0;
+
+  printf("Axis group arc: %d arcs, %d samples each\n", fixedCount + arcs,
+         CHECK_SAMPLES);
+
+  for (int i = 0; i < fixedCount + arcs; i++) {
+    ecmcCheckArc arc;
+
+    if (i < fixedCount) {
+      arc = fixed[i];
+    } else {
+      randArc(&arc);
+    }
+
+    const char *error = checkArc(&arc);
+
+    if (error) {
+      if (failed < CHECK_MAX_PRINTED) {
+        printArc(i, &arc, error);
+      }
+      failed++;
+    }
+  }
+
+  if (failed) {
+    printf("ERROR: %d arcs failed.\n", failed);
+    return 1;
+  }
+  printf("  OK\n");
+  return 0;
+}
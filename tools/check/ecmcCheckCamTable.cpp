@@ -0,0 +1,478 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcCheckCamTable.cpp
+*
+*  Check of the cam table interpolation (ecmcAxisCamTable) for random
+*  tables (uneven master spacing, smooth, noisy and steep slave values),
+*  linear, natural and periodic cubic spline. Each table is sampled and
+*  checked for:
+*  - rejection of invalid tables
+*  - interpolation exactly through the table points
+*  - values and derivatives equal to a reference spline (dense solve of
+*    the spline equations, independent of the tridiagonal solvers), for
+*    ascending, descending and random master positions
+*  - continuity of value, first and (cubic) second derivative at the
+*    points and natural end conditions (zero second derivative)
+*  - periodic end conditions (equal first and second derivative at both
+*    ends, continuous over the wrap of a modulo master)
+*  - end values held outside of the table (not periodic)
+*
+*  Usage: ecmcCheckCamTable [tables] [seed]
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "ecmcAxisCamTable.h"
+
+#define CHECK_MAX_POINTS 200
+#define CHECK_SAMPLES 1000
+#define CHECK_REL_TOL 1e-9
+#define CHECK_MAX_PRINTED 10
+
+typedef struct {
+  double x[CHECK_MAX_POINTS];
+  double y[CHECK_MAX_POINTS];
+  int    count;
+  ecmcAxisCamInterpType interp;
+  bool   periodic;
+} ecmcCheckTable;
+
+static double randUniform(double min, double max) {
+  return min + (max - min) * rand() / (double)RAND_MAX;
+}
+
+// Log uniform in [10^minExp..10^maxExp]
+static double randLog(double minExp, double maxExp) {
+  return pow(10, randUniform(minExp, maxExp));
+}
+
+static void randTable(ecmcCheckTable *table) {
+  table->count  = 2 + rand() % (rand() % 4 ? 20 : CHECK_MAX_POINTS - 1);
+  table->interp = rand() % 4 ? ECMC_AXIS_CAM_INTERP_CUBIC :
+                  ECMC_AXIS_CAM_INTERP_LINEAR;
+  table->periodic = (table->interp == ECMC_AXIS_CAM_INTERP_CUBIC) &&
+                    (rand() % 2);
+
+  // Spacing even or uneven (up to 3 decades)
+  double spacing   = randLog(-3, 2);
+  double spread    = rand() % 3 ? randUniform(0, 3) : 0;
+  double amplitude = randLog(-3, 3);
+  double periods   = randUniform(0, 3);
+  int    shape     = rand() % 4;
+
+  table->x[0] = randUniform(-100, 100);
+
+  for (int i = 1; i < table->count; i++) {
+    table->x[i] = table->x[i - 1] + spacing * pow(10, randUniform(0, spread));
+  }
+
+  double range = table->x[table->count - 1] - table->x[0];
+
+  for (int i = 0; i < table->count; i++) {
+    double phase = (table->x[i] - table->x[0]) / range;
+
+    switch (shape) {
+    case 0:  // Smooth
+      table->y[i] = amplitude * sin(2 * M_PI * periods * phase);
+      break;
+
+    case 1:  // Noise
+      table->y[i] = amplitude * randUniform(-1, 1);
+      break;
+
+    case 2:  // Step
+      table->y[i] = phase < 0.5 ? 0 : amplitude;
+      break;
+
+    default:  // Continuous cam (stroke) with noise
+      table->y[i] = amplitude * (phase + 0.1 * randUniform(-1, 1));
+      break;
+    }
+  }
+}
+
+static void printTable(int index, ecmcCheckTable *table, const char *error) {
+  printf("  table %d: %s\n"
+         "    interp=%d periodic=%d count=%d x=[%.17g..%.17g] y0=%.17g\n",
+         index, error, (int)table->interp, (int)table->periodic,
+         table->count, table->x[0], table->x[table->count - 1],
+         table->y[0]);
+}
+
+/*
+ * Reference second derivatives: the spline equations (continuous first
+ * derivative at inner points, zero second derivative at the ends) as a
+ * dense system, solved by Gaussian elimination with partial pivoting.
+ * Periodic: continuous first derivative over the wrap (first row) and
+ * equal second derivative at the ends (last row).
+ */
+static void referenceSpline(ecmcCheckTable *table, double *m) {
+  static double a[CHECK_MAX_POINTS][CHECK_MAX_POINTS + 1];
+  int n = table->count;
+
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j <= n; j++) {
+      a[i][j] = 0;
+    }
+  }
+
+  a[0][0]         = 1;
+  a[n - 1][n - 1] = 1;
+
+  if (table->periodic && (n > 2)) {
+    double h0 = table->x[n - 1] - table->x[n - 2];
+    double h1 = table->x[1] - table->x[0];
+
+    a[0][n - 2]     = h0;
+    a[0][0]         = 2 * (h0 + h1);
+    a[0][1]        += h1;
+    a[0][n]         = 6 * ((table->y[1] - table->y[0]) / h1 -
+                           (table->y[n - 1] - table->y[n - 2]) / h0);
+    a[n - 1][0]     = -1;
+  }
+
+  for (int i = 1; i < n - 1; i++) {
+    double h0 = table->x[i] - table->x[i - 1];
+    double h1 = table->x[i + 1] - table->x[i];
+
+    a[i][i - 1] = h0;
+    a[i][i]     = 2 * (h0 + h1);
+    a[i][i + 1] = h1;
+    a[i][n]     = 6 * ((table->y[i + 1] - table->y[i]) / h1 -
+                       (table->y[i] - table->y[i - 1]) / h0);
+  }
+
+  for (int k = 0; k < n; k++) {
+    int pivot = k;
+
+    for (int i = k + 1; i < n; i++) {
+      if (fabs(a[i][k]) > fabs(a[pivot][k])) {
+        pivot = i;
+      }
+    }
+
+    for (int j = k; j <= n; j++) {
+      double t = a[k][j];
+      a[k][j]     = a[pivot][j];
+      a[pivot][j] = t;
+    }
+
+    for (int i = k + 1; i < n; i++) {
+      double f = a[i][k] / a[k][k];
+
+      for (int j = k; j <= n; j++) {
+        a[i][j] -= f * a[k][j];
+      }
+    }
+  }
+
+  for (int i = n - 1; i >= 0; i--) {
+    double sum = a[i][n];
+
+    for (int j = i + 1; j < n; j++) {
+      sum -= a[i][j] * m[j];
+    }
+    m[i] = sum / a[i][i];
+  }
+}
+
+// Reference value and derivatives (polynomial in x - x_i per segment)
+static void referenceEvaluate(ecmcCheckTable *table, const double *m,
+                              double x, double *y, double *dy, double *ddy) {
+  int n = table->count;
+
+  if (table->periodic) {
+    x = fmin(fmax(x, table->x[0]), table->x[n - 1]);
+  } else if ((x <= table->x[0]) || (x >= table->x[n - 1])) {
+    *y   = x <= table->x[0] ? table->y[0] : table->y[n - 1];
+    *dy  = 0;
+    *ddy = 0;
+    return;
+  }
+
+  int i = 0;
+
+  while ((i < n - 2) && (x >= table->x[i + 1])) {
+    i++;
+  }
+
+  double h     = table->x[i + 1] - table->x[i];
+  double t     = x - table->x[i];
+  double slope = (table->y[i + 1] - table->y[i]) / h;
+
+  if (table->interp == ECMC_AXIS_CAM_INTERP_LINEAR) {
+    *y   = table->y[i] + slope * t;
+    *dy  = slope;
+    *ddy = 0;
+    return;
+  }
+
+  double b = slope - h * (2 * m[i] + m[i + 1]) / 6;
+  double c = m[i] / 2;
+  double d = (m[i + 1] - m[i]) / (6 * h);
+
+  *y   = table->y[i] + t * (b + t * (c + t * d));
+  *dy  = b + t * (2 * c + 3 * t * d);
+  *ddy = 2 * c + 6 * t * d;
+}
+
+/*
+ * Returns NULL if the table is OK, otherwise a description of the first
+ * failed check.
+ */
+static const char* checkTable(ecmcCheckTable *table) {
+  ecmcAxisCamTable camTable;
+  int    n = table->count;
+  double m[CHECK_MAX_POINTS];
+
+  if (camTable.setPoints(table->x, table->y, n, table->interp)) {
+    return "setPoints() failed";
+  }
+  camTable.setPeriodic(table->periodic);
+
+  for (int i = 0; i < n; i++) {
+    m[i] = 0;
+  }
+
+  if (table->interp == ECMC_AXIS_CAM_INTERP_CUBIC) {
+    referenceSpline(table, m);
+  }
+
+  // Scales of value and derivatives for the tolerances
+  double hMin = INFINITY, hMax = 0, yMax = 0, mMax = 0;
+
+  for (int i = 0; i < n; i++) {
+    yMax = fmax(yMax, fabs(table->y[i]));
+    mMax = fmax(mMax, fabs(m[i]));
+
+    if (i > 0) {
+      hMin = fmin(hMin, table->x[i] - table->x[i - 1]);
+      hMax = fmax(hMax, table->x[i] - table->x[i - 1]);
+    }
+  }
+
+  double xTol   = CHECK_REL_TOL * (fabs(table->x[0]) + fabs(table->x[n - 1]));
+  double yTol   = CHECK_REL_TOL * (yMax + mMax * hMax * hMax);
+  double dyTol  = CHECK_REL_TOL * (yMax / hMin + mMax * hMax) *
+                  (1 + xTol / hMin);
+  double ddyTol = CHECK_REL_TOL * (yMax / (hMin * hMin) + mMax) *
+                  (1 + xTol / hMin);
+  double y, dy, ddy, yRef, dyRef, ddyRef;
+
+  // Table points (exact) and continuity at the points (left limit)
+  for (int i = 0; i < n; i++) {
+    if (camTable.evaluate(table->x[i]) != table->y[i]) {
+      return "interpolation not through table point";
+    }
+
+    if (i == 0) {
+      continue;
+    }
+
+    double yLeft, dyLeft, ddyLeft;
+
+    camTable.evaluate(table->x[i], &y, &dy, &ddy);
+    camTable.evaluate(nextafter(table->x[i], -INFINITY), &yLeft, &dyLeft,
+                      &ddyLeft);
+
+    if (fabs(yLeft - y) > yTol + fabs(dyLeft) * xTol) {
+      return "value not continuous at table point";
+    }
+
+    if ((i == n - 1) || (table->interp == ECMC_AXIS_CAM_INTERP_LINEAR)) {
+      continue;
+    }
+
+    if (fabs(dyLeft - dy) > dyTol) {
+      return "first derivative not continuous at table point";
+    }
+
+    if (fabs(ddyLeft - ddy) > ddyTol) {
+      return "second derivative not continuous at table point";
+    }
+  }
+
+  // Periodic end conditions (derivatives at the wrap)
+  if (table->periodic) {
+    double dyStart, ddyStart;
+
+    camTable.evaluate(table->x[0], &y, &dyStart, &ddyStart);
+    camTable.evaluate(table->x[n - 1], &y, &dy, &ddy);
+
+    if (fabs(dy - dyStart) > dyTol) {
+      return "first derivative not periodic";
+    }
+
+    if (fabs(ddy - ddyStart) > ddyTol) {
+      return "second derivative not periodic";
+    }
+  } else if (table->interp == ECMC_AXIS_CAM_INTERP_CUBIC) {
+    // Natural end conditions
+    camTable.evaluate(nextafter(table->x[0], INFINITY), &y, &dy, &ddy);
+
+    if (fabs(ddy) > ddyTol) {
+      return "second derivative not zero at start";
+    }
+
+    camTable.evaluate(nextafter(table->x[n - 1], -INFINITY), &y, &dy, &ddy);
+
+    if (fabs(ddy) > ddyTol) {
+      return "second derivative not zero at end";
+    }
+  }
+
+  // Samples ascending, descending and random (also outside of the table)
+  double range = table->x[n - 1] - table->x[0];
+
+  for (int i = 0; i < 3 * CHECK_SAMPLES; i++) {
+    double phase;
+
+    if (i < CHECK_SAMPLES) {
+      phase = (double)i / CHECK_SAMPLES;
+    } else if (i < 2 * CHECK_SAMPLES) {
+      phase = (double)(2 * CHECK_SAMPLES - i) / CHECK_SAMPLES;
+    } else {
+      phase = randUniform(0, 1);
+    }
+
+    double x = table->x[0] + range * (1.2 * phase - 0.1);
+
+    camTable.evaluate(x, &y, &dy, &ddy);
+    referenceEvaluate(table, m, x, &yRef, &dyRef, &ddyRef);
+
+    if (((x < table->x[0]) || (x > table->x[n - 1])) && !table->periodic) {
+      if ((y != yRef) || (dy != 0) || (ddy != 0)) {
+        return "end value not held outside of table";
+      }
+      continue;
+    }
+
+    if (fabs(y - yRef) > yTol) {
+      return "value differs from reference spline";
+    }
+
+    if (fabs(dy - dyRef) > dyTol) {
+      return "first derivative differs from reference spline";
+    }
+
+    if (fabs(ddy - ddyRef) > ddyTol) {
+      return "second derivative differs from reference spline";
+    }
+
+    if (camTable.evaluate(x) != y) {
+      return "value differs from value with derivatives";
+    }
+  }
+  return NULL;
+}
+
+// Invalid tables must be rejected and leave the table empty
+static const char* checkInvalid() {
+  ecmcAxisCamTable camTable;
+  double x[] = { 0, 1, 1, 2 };
+  double y[] = { 0, 1, 2, 3 };
+  double xNan[] = { 0, NAN };
+
+  if (camTable.setPoints(x, y, 1, ECMC_AXIS_CAM_INTERP_LINEAR) !=
+      ERROR_AXIS_CAM_TABLE_SIZE_INVALID) {
+    return "table with one point accepted";
+  }
+
+  if (camTable.setPoints(x, y, 4, ECMC_AXIS_CAM_INTERP_CUBIC) !=
+      ERROR_AXIS_CAM_TABLE_NOT_INCREASING) {
+    return "not increasing master positions accepted";
+  }
+
+  if (camTable.setPoints(xNan, y, 2, ECMC_AXIS_CAM_INTERP_CUBIC) !=
+      ERROR_AXIS_CAM_TABLE_NOT_INCREASING) {
+    return "invalid master position accepted";
+  }
+
+  if (camTable.setPoints(x, y, 2, (ecmcAxisCamInterpType)2) !=
+      ERROR_AXIS_CAM_INTERP_TYPE_INVALID) {
+    return "invalid interpolation accepted";
+  }
+
+  if (camTable.getSize() != 0) {
+    return "table not empty after invalid table";
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  int tables = argc > 1 ? atoi(argv[1]) : 20000;
+  int seed   = argc > 2 ? atoi(argv[2]) : 1;
+
+  if (tables <= 0) {
+    printf("Usage: %s [tables] [seed]\n", argv[0]);
+    return 1;
+  }
+
+  srand(seed);
+
+  // Fixed cases first: two points, straight line (zero second derivative),
+  // even sine and uneven spacing. Periodic: two and three points, sine and
+  // continuous cam (stroke)
+  static ecmcCheckTable fixed[] = {
+    { { 0, 1 },             { 0, 1 },          2, ECMC_AXIS_CAM_INTERP_CUBIC  },
+    { { 0, 1, 2, 3 },       { 0, 2, 4, 6 },    4, ECMC_AXIS_CAM_INTERP_CUBIC  },
+    { { 0, 90, 180, 270, 360 }, { 0, 1, 0, -1, 0 }, 5,
+      ECMC_AXIS_CAM_INTERP_CUBIC },
+    { { 0, 0.001, 10, 10.001 }, { 0, 1, -1, 5 }, 4,
+      ECMC_AXIS_CAM_INTERP_CUBIC },
+    { { 0, 0.001, 10, 10.001 }, { 0, 1, -1, 5 }, 4,
+      ECMC_AXIS_CAM_INTERP_LINEAR },
+    { { 0, 1 },             { 0, 1 },          2, ECMC_AXIS_CAM_INTERP_CUBIC,
+      true },
+    { { 0, 1, 3 },          { 0, 2, 1 },       3, ECMC_AXIS_CAM_INTERP_CUBIC,
+      true },
+    { { 0, 90, 180, 270, 360 }, { 0, 1, 0, -1, 0 }, 5,
+      ECMC_AXIS_CAM_INTERP_CUBIC, true },
+    { { 0, 90, 180, 270, 360 }, { 0, 100, 180, 290, 360 }, 5,
+      ECMC_AXIS_CAM_INTERP_CUBIC, true },
+  };
+  int fixedCount = sizeof(fixed) / sizeof(fixed[0]);
+  int failed     = 0;
+  const char *error = checkInvalid();
+
+  printf("Cam table: %d tables, %d samples each\n", fixedCount + tables,
+         3 * CHECK_SAMPLES);
+
+  if (error) {
+    printf("  invalid tables: %s\n", error);
+    failed++;
+  }
+
+  for (int i = 0; i < fixedCount + tables; i++) {
+    static ecmcCheckTable table;
+
+    if (i < fixedCount) {
+      table = fixed[i];
+    } else {
+      randTable(&table);
+    }
+
+    error = checkTable(&table);
+
+    if (error) {
+      if (failed < CHECK_MAX_PRINTED) {
+        printTable(i, &table, error);
+      }
+      failed++;
+    }
+  }
+
+  if (failed) {
+    printf("ERROR: %d tables failed.\n", failed);
+    return 1;
+  }
+  printf("  OK\n");
+  return 0;
+}
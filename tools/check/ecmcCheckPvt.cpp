@@ -0,0 +1,301 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcCheckPvt.cpp
+*
+*  Check of the PVT segment interpolation (ecmcAxisPvtSegment) for random
+*  tables (positions, velocities including stops and reversals, segment
+*  times from below one sample to seconds). Each table is chained like in
+*  ecmcAxisPvt (starting at rest) and checked for:
+*  - start and end position and velocity of each segment (exact)
+*  - acceleration equal to the analytic values at the segment ends and
+*    within them (linear over the segment)
+*  - velocity and acceleration consistent with the position (derivatives)
+*  - continuity of position and velocity over samples, also across
+*    segments (sample time carried over to the next segment)
+*
+*  Usage: ecmcCheckPvt [tables] [seed]
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "ecmcAxisPvtSegment.h"
+
+#define CHECK_MAX_POINTS 50
+#define CHECK_SAMPLES 200
+#define CHECK_REL_TOL 1e-9
+#define CHECK_MAX_PRINTED 10
+
+typedef struct {
+  double startPos;
+  double position[CHECK_MAX_POINTS];
+  double velocity[CHECK_MAX_POINTS];
+  double time[CHECK_MAX_POINTS];
+  int    count;
+  double sampleTime;
+} ecmcCheckPvtTable;
+
+static double randUniform(double min, double max) {
+  return min + (max - min) * rand() / (double)RAND_MAX;
+}
+
+// Log uniform in [10^minExp..10^maxExp]
+static double randLog(double minExp, double maxExp) {
+  return pow(10, randUniform(minExp, maxExp));
+}
+
+static void randTable(ecmcCheckPvtTable *table) {
+  double velMax = randLog(-2, 3);
+  double time   = randLog(-3, 1);
+
+  table->count      = 1 + rand() % CHECK_MAX_POINTS;
+  table->sampleTime = rand() % 2 ? 1e-3 : randLog(-4, -2);
+  table->startPos   = randUniform(-1000, 1000);
+
+  double pos       = table->startPos;
+  double velOld    = 0;
+  double totalTime = 0;
+
+  for (int i = 0; i < table->count; i++) {
+    // Even segment times or varying (also below the sample time)
+    table->time[i] = rand() % 2 ? time : randLog(-4, 1);
+
+    double vel = randUniform(-1, 1) * velMax;
+
+    // Stops and reversals (position against the velocity)
+    if ((rand() % 5 == 0) || (i == table->count - 1)) {
+      vel = 0;
+    }
+    pos += rand() % 5 ? (vel + velOld) / 2 * table->time[i] *
+           randUniform(0.5, 1.5) :
+           randUniform(-1, 1) * velMax * table->time[i];
+    table->position[i] = pos;
+    table->velocity[i] = vel;
+    velOld             = vel;
+    totalTime         += table->time[i];
+  }
+
+  // Limit samples of long tables
+  table->sampleTime = fmax(table->sampleTime,
+                           totalTime / (CHECK_MAX_POINTS * CHECK_SAMPLES));
+}
+
+static void printTable(int index, ecmcCheckPvtTable *table, int segment,
+                       const char *error) {
+  printf("  table %d segment %d: %s\n"
+         "    count=%d sampleTime=%.17g startPos=%.17g\n",
+         index, segment, error, table->count, table->sampleTime,
+         table->startPos);
+
+  for (int i = segment > 0 ? segment - 1 : 0; i <= segment; i++) {
+    printf("    point %d: position=%.17g velocity=%.17g time=%.17g\n", i,
+           table->position[i], table->velocity[i], table->time[i]);
+  }
+}
+
+/*
+ * Returns NULL if the segment is OK, otherwise a description of the first
+ * failed check.
+ */
+static const char* checkSegment(ecmcAxisPvtSegment *segment,
+                                double startPos, double startVel,
+                                double endPos, double endVel, double time) {
+  double pos, vel, acc;
+  double dist = endPos - startPos;
+
+  // Analytic acceleration at start and end (linear in between)
+  double accStart = (6 * dist / time - 4 * startVel - 2 * endVel) / time;
+  double accEnd   = (-6 * dist / time + 2 * startVel + 4 * endVel) / time;
+  double jerk     = (accEnd - accStart) / time;
+  double accMax   = fmax(fabs(accStart), fabs(accEnd));
+  double velScale = fabs(startVel) + fabs(endVel) + fabs(dist) / time;
+  double posTol   = CHECK_REL_TOL * (fabs(startPos) + fabs(endPos) +
+                                     velScale * time);
+  double velTol   = CHECK_REL_TOL * velScale + posTol / time;
+  double accTol   = CHECK_REL_TOL * accMax + velTol / time;
+
+  segment->evaluate(0, &pos, &vel, &acc);
+
+  if ((pos != startPos) || (vel != startVel)) {
+    return "segment does not start at start point";
+  }
+
+  if (fabs(acc - accStart) > accTol) {
+    return "wrong acceleration at start";
+  }
+
+  segment->evaluate(time, &pos, &vel, &acc);
+
+  if ((pos != endPos) || (vel != endVel)) {
+    return "segment does not end at end point";
+  }
+
+  if (fabs(acc - accEnd) > accTol) {
+    return "wrong acceleration at end";
+  }
+
+  for (int i = 1; i < CHECK_SAMPLES; i++) {
+    double t = time * i / CHECK_SAMPLES;
+    double h = time / CHECK_SAMPLES / 2;
+    double posUp, velUp, accUp, posDown, velDown, accDown;
+
+    segment->evaluate(t, &pos, &vel, &acc);
+    segment->evaluate(t + h, &posUp, &velUp, &accUp);
+    segment->evaluate(t - h, &posDown, &velDown, &accDown);
+
+    if ((acc > fmax(accStart, accEnd) + accTol) ||
+        (acc < fmin(accStart, accEnd) - accTol)) {
+      return "acceleration outside of end values";
+    }
+
+    // Central differences (exact for the quadratic velocity, error jerk *
+    // h^2 / 6 for the cubic position)
+    if (fabs((posUp - posDown) / (2 * h) - vel) >
+        fabs(jerk) * h * h / 6 + velTol + posTol / h) {
+      return "velocity not consistent with position";
+    }
+
+    if (fabs((velUp - velDown) / (2 * h) - acc) > accTol + velTol / h) {
+      return "acceleration not consistent with velocity";
+    }
+  }
+  return NULL;
+}
+
+/*
+ * Returns NULL if the table is OK, otherwise a description of the first
+ * failed check (segment set to the failing segment).
+ */
+static const char* checkTable(ecmcCheckPvtTable *table, int *segmentIndex) {
+  ecmcAxisPvtSegment segments[CHECK_MAX_POINTS];
+  double startPos = table->startPos;
+  double startVel = 0;
+  double accMax   = 0;
+  double posMax   = fabs(table->startPos);
+  double velMax   = 0;
+
+  for (int i = 0; i < table->count; i++) {
+    *segmentIndex = i;
+    segments[i].init(startPos, startVel, table->position[i],
+                     table->velocity[i], table->time[i]);
+
+    const char *error = checkSegment(&segments[i], startPos, startVel,
+                                     table->position[i], table->velocity[i],
+                                     table->time[i]);
+
+    if (error) {
+      return error;
+    }
+
+    double dist = table->position[i] - startPos;
+    double time = table->time[i];
+
+    accMax = fmax(accMax, fabs(6 * dist / time - 4 * startVel -
+                               2 * table->velocity[i]) / time);
+    accMax = fmax(accMax, fabs(-6 * dist / time + 2 * startVel +
+                               4 * table->velocity[i]) / time);
+    posMax   = fmax(posMax, fabs(table->position[i]));
+    velMax   = fmax(velMax, fabs(startVel) + fabs(table->velocity[i]) +
+                    fabs(dist) / time);
+    startPos = table->position[i];
+    startVel = table->velocity[i];
+  }
+
+  // Samples over the chained segments (as in ecmcAxisPvt::executeTable())
+  double dt     = table->sampleTime;
+  double posTol = CHECK_REL_TOL * (posMax + velMax * dt);
+  double velTol = CHECK_REL_TOL * (velMax + accMax * dt);
+  double time   = 0;
+  double posOld = table->startPos;
+  double velOld = 0;
+  int    i      = 0;
+
+  for (;;) {
+    double pos, vel, acc;
+
+    time += dt;
+
+    while ((i < table->count) && (time >= segments[i].getTime())) {
+      time -= segments[i].getTime();
+      i++;
+    }
+
+    if (i >= table->count) {
+      break;
+    }
+    *segmentIndex = i;
+    segments[i].evaluate(time, &pos, &vel, &acc);
+
+    if (fabs(vel - velOld) > accMax * dt + velTol) {
+      return "velocity not continuous (acceleration limit)";
+    }
+
+    if (fabs(pos - posOld - (vel + velOld) / 2 * dt) >
+        accMax * dt * dt / 4 + posTol) {
+      return "position not continuous";
+    }
+    posOld = pos;
+    velOld = vel;
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  int tables = argc > 1 ? atoi(argv[1]) : 20000;
+  int seed   = argc > 2 ? atoi(argv[2]) : 1;
+
+  if (tables <= 0) {
+    printf("Usage: %s [tables] [seed]\n", argv[0]);
+    return 1;
+  }
+
+  srand(seed);
+
+  // Fixed cases first: single segment from rest to rest, constant
+  // velocity, reversal, segments shorter than the sample time
+  static ecmcCheckPvtTable fixed[] = {
+    { 0,   { 10 },              { 0 },           { 1 },             1, 1e-3 },
+    { 0,   { 1, 2, 3, 3.5 },    { 1, 1, 1, 0 },  { 2, 1, 1, 1 },    4, 1e-3 },
+    { 5,   { 6, 4, 5 },         { 2, -2, 0 },    { 1, 1, 1 },       3, 1e-3 },
+    { 0,   { 1e-4, 2e-4, 3e-4 }, { 0.5, 0.5, 0 }, { 2e-4, 2e-4, 2e-4 }, 3,
+      1e-3 },
+  };
+  int fixedCount = sizeof(fixed) / sizeof(fixed[0]);
+  int failed     = 0;
+
+  printf("PVT segments: %d tables, %d samples per segment\n",
+         fixedCount + tables, CHECK_SAMPLES);
+
+  for (int i = 0; i < fixedCount + tables; i++) {
+    static ecmcCheckPvtTable table;
+    int segment = 0;
+
+    if (i < fixedCount) {
+      table = fixed[i];
+    } else {
+      randTable(&table);
+    }
+
+    const char *error = checkTable(&table, &segment);
+
+    if (error) {
+      if (failed < CHECK_MAX_PRINTED) {
+        printTable(i, &table, segment, error);
+      }
+      failed++;
+    }
+  }
+
+  if (failed) {
+    printf("ERROR: %d tables failed.\n", failed);
+    return 1;
+  }
+  printf("  OK\n");
+  return 0;
+}
@@ -0,0 +1,249 @@
+/*************************************************************************\
+* Copyright (c) 2019 European Spallation Source ERIC
+* ecmc is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+*
+*  ecmcCheckSCurve.cpp
+*
+*  Check of ecmcTrajectorySCurve::planPos() for random start states and
+*  dynamics (moves from rest, start velocity towards and away from the
+*  target, too fast to stop before the target (stop and return), start
+*  velocity above max and non zero start acceleration). Each profile is
+*  sampled and checked for:
+*  - start state, end position and velocity (also at the end of the last
+*    segment, before the end position is set)
+*  - velocity, acceleration and jerk limits
+*  - continuity of position, velocity and acceleration (change per sample
+*    consistent with the derivatives)
+*  - no overshoot for moves from rest
+*
+*  Usage: ecmcCheckSCurve [profiles] [seed]
+*
+*  Created on: Oct 18, 2026
+*
+\*************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "asynDriver.h"
+#include "ecmcTrajectorySCurve.h"
+
+#define CHECK_SAMPLES 2000
+#define CHECK_REL_TOL 1e-9
+#define CHECK_MAX_PRINTED 10
+
+// Error logging of ecmcError (normally created by ecmcAsynPortDriver)
+asynUser *pPrintOutAsynUser = NULL;
+
+typedef struct {
+  double distance;
+  double vel;
+  double acc;
+  double velMax;
+  double accMax;
+  double decMax;
+  double jerkMax;
+} ecmcCheckMove;
+
+static double randUniform(double min, double max) {
+  return min + (max - min) * rand() / (double)RAND_MAX;
+}
+
+// Log uniform in [10^minExp..10^maxExp]
+static double randLog(double minExp, double maxExp) {
+  return pow(10, randUniform(minExp, maxExp));
+}
+
+static void randMove(ecmcCheckMove *move) {
+  move->velMax  = randLog(-1, 2);
+  move->accMax  = randLog(-1, 3);
+  move->decMax  = randLog(-1, 3);
+  move->jerkMax = randLog(0, 5);
+
+  // Down to distances far below the ramp distances
+  move->distance = rand() % 20 ? randLog(-6, 3) : 0;
+
+  if (rand() % 2) {
+    move->distance = -move->distance;
+  }
+
+  move->vel = 0;
+  move->acc = 0;
+
+  // Start velocity in both directions, also above max
+  if (rand() % 5 > 1) {
+    move->vel = randUniform(-1.5, 1.5) * move->velMax;
+  }
+
+  if (rand() % 3 == 0) {
+    move->acc = randUniform(-1, 1) * move->accMax;
+  }
+}
+
+static void printMove(int index, ecmcCheckMove *move, const char *error) {
+  printf("  profile %d: %s\n"
+         "    distance=%.17g vel=%.17g acc=%.17g\n"
+         "    velMax=%.17g accMax=%.17g decMax=%.17g jerkMax=%.17g\n",
+         index, error, move->distance, move->vel, move->acc, move->velMax,
+         move->accMax, move->decMax, move->jerkMax);
+}
+
+/*
+ * Returns NULL if the profile is OK, otherwise a description of the first
+ * failed check.
+ */
+static const char* checkMove(ecmcCheckMove *move) {
+  ecmcTrajectorySCurve profile;
+
+  if (profile.planPos(move->distance, move->vel, move->acc, move->velMax,
+                      move->accMax, move->decMax, move->jerkMax)) {
+    return "planPos() failed";
+  }
+
+  // Velocity reached by ramping the start acceleration to zero
+  double velStart = fabs(move->vel + move->acc * fabs(move->acc) /
+                         (2 * move->jerkMax));
+  double velLimit = fmax(move->velMax, fmax(fabs(move->vel), velStart));
+  double accLimit = fmax(fmax(move->accMax, move->decMax), fabs(move->acc));
+  double duration = profile.getDuration();
+  double posScale = fmax(fabs(move->distance), velLimit * duration);
+  // Segment start times are sums of durations (rounding of time)
+  double timeTol  = CHECK_REL_TOL * 1e-3 * duration;
+  double posTol   = CHECK_REL_TOL * fmax(posScale, 1e-12);
+  double velTol   = CHECK_REL_TOL * velLimit + accLimit * timeTol;
+  double accTol   = CHECK_REL_TOL * accLimit + move->jerkMax * timeTol;
+  double pos = 0, vel = 0, acc = 0;
+
+  // End state
+  profile.evaluate(duration, &pos, &vel, &acc);
+
+  if ((pos != move->distance) || (vel != 0) || (acc != 0)) {
+    return "end state not at target";
+  }
+
+  if (duration <= 0) {
+    return move->distance == 0 && move->vel == 0 && move->acc == 0 ?
+           NULL : "empty profile";
+  }
+
+  // End of last segment (before the end position is set)
+  profile.evaluate(nextafter(duration, 0), &pos, &vel, &acc);
+
+  if ((fabs(pos - move->distance) > posTol) || (fabs(vel) > velTol) ||
+      (fabs(acc) > accTol)) {
+    return "last segment does not end at target";
+  }
+
+  // Start state
+  profile.evaluate(0, &pos, &vel, &acc);
+
+  if ((pos != 0) || (vel != move->vel) || (acc != move->acc)) {
+    return "profile does not start at start state";
+  }
+
+  // Samples
+  double dt       = duration / CHECK_SAMPLES;
+  double jerk     = move->jerkMax;
+  double posOld   = pos;
+  double velOld   = vel;
+  double accOld   = acc;
+  bool   fromRest = (move->vel == 0) && (move->acc == 0);
+
+  for (int i = 1; i <= CHECK_SAMPLES; i++) {
+    profile.evaluate(i * dt, &pos, &vel, &acc);
+
+    if (fabs(vel) > velLimit + velTol) {
+      return "velocity limit exceeded";
+    }
+
+    if (fabs(acc) > accLimit + accTol) {
+      return "acceleration limit exceeded";
+    }
+
+    if (fromRest &&
+        ((pos * move->distance < -posTol * fabs(move->distance)) ||
+         (fabs(pos) > fabs(move->distance) + posTol) ||
+         (vel * move->distance < -velTol * fabs(move->distance)))) {
+      return "overshoot of move from rest";
+    }
+
+    // Change over a sample consistent with the derivatives (exact within a
+    // segment, bounded by the jerk over a segment change)
+    if (fabs(acc - accOld) > jerk * dt + accTol) {
+      return "acceleration not continuous (jerk limit)";
+    }
+
+    if (fabs(vel - velOld - (acc + accOld) / 2 * dt) >
+        jerk * dt * dt / 4 + velTol) {
+      return "velocity not continuous";
+    }
+
+    if (fabs(pos - posOld - (vel + velOld) / 2 * dt) >
+        jerk * dt * dt * dt / 4 + accLimit * dt * dt * CHECK_REL_TOL +
+        posTol) {
+      return "position not continuous";
+    }
+    posOld = pos;
+    velOld = vel;
+    accOld = acc;
+  }
+  return NULL;
+}
+
+int main(int argc, char **argv) {
+  int profiles = argc > 1 ? atoi(argv[1]) : 100000;
+  int seed     = argc > 2 ? atoi(argv[2]) : 1;
+
+  if (profiles <= 0) {
+    printf("Usage: %s [profiles] [seed]\n", argv[0]);
+    return 1;
+  }
+
+  pPrintOutAsynUser = pasynManager->createAsynUser(0, 0);
+  srand(seed);
+
+  // Fixed cases first: short moves, stop and return, trapezoidal (jerk of
+  // one sample at 1 kHz as used by axis groups), start above max velocity
+  ecmcCheckMove fixed[] = {
+    { 1e-9,  0,   0,   1,   10,  10,  100   },
+    { 1,     0,   0,   1,   10,  10,  1e4   },
+    { 0.001, 1,   0,   1,   10,  10,  100   },
+    { 1,    -1,   0,   1,   10,  10,  100   },
+    { 1,     3,   0,   1,   10,  10,  100   },
+    { -1,    0.5, 5,   1,   10,  10,  100   },
+    { 100,   0,   0,   10,  1,   2,   1e3   },
+    { 0,     1,   0,   1,   1,   1,   1     },
+  };
+  int fixedCount = sizeof(fixed) / sizeof(fixed[0]);
+  int failed     = 0;
+
+  printf("S-curve planPos: %d profiles, %d samples each\n",
+         fixedCount + profiles, CHECK_SAMPLES);
+
+  for (int i = 0; i < fixedCount + profiles; i++) {
+    ecmcCheckMove move;
+
+    if (i < fixedCount) {
+      move = fixed[i];
+    } else {
+      randMove(&move);
+    }
+
+    const char *error = checkMove(&move);
+
+    if (error) {
+      if (failed < CHECK_MAX_PRINTED) {
+        printMove(i, &move, error);
+      }
+      failed++;
+    }
+  }
+
+  if (failed) {
+    printf("ERROR: %d profiles failed.\n", failed);
+    return 1;
+  }
+  printf("  OK\n");
+  return 0;
+}